@@ -632,8 +632,8 @@ static int aztec_text_process(const unsigned char source[], int src_len, int bp,
             if ((reduced_encode_mode[i] == 'B') && (!byte_mode)) {
                 for (count = 0; ((i + count) < reduced_length) && (reduced_encode_mode[i + count] == 'B'); count++);
 
-                if (count > 2079) {
-                    return 0;
+                if (count > 2078) {
+                    count = 2078; /* Maximum for 11-bit length, any remaining bytes get another B/S */
                 }
 
                 if (count > 31) {
@@ -644,7 +644,7 @@ static int aztec_text_process(const unsigned char source[], int src_len, int bp,
                     /* Put 5-bit number of bytes */
                     if (!(bp = az_bin_append_posn(count, 5, binary_string, bp))) return 0;
                 }
-                byte_mode = 1;
+                byte_mode = count; /* Bytes left in this B/S */
             }
 
             if ((reduced_encode_mode[i] != 'B') && (reduced_encode_mode[i] != 'u')
@@ -711,6 +711,7 @@ static int aztec_text_process(const unsigned char source[], int src_len, int bp,
             }
         } else if (reduced_encode_mode[i] == 'B') {
             if (!(bp = az_bin_append_posn(reduced_source[i], 8, binary_string, bp))) return 0;
+            byte_mode--;
         }
     }
 
@@ -1182,6 +1183,17 @@ INTERNAL int aztec(struct zint_symbol *symbol, struct zint_seg segs[], const int
         return ZINT_ERROR_TOO_LONG;
     }
 
+    if (symbol->priv->geometry) { /* Sizing only, so skip ECC and placement */
+        /* ECC level only applicable if size automatic */
+        const int ecc_level = symbol->option_2 ? -1 : symbol->option_1 >= 1 ? symbol->option_1 : 2;
+        if (compact) {
+            set_geometry(symbol, 27 - 2 * AztecCompactOffset[layers - 1], layers, ecc_level);
+        } else {
+            set_geometry(symbol, 151 - 2 * AztecOffset[layers - 1], layers + 4, ecc_level);
+        }
+        return error_number;
+    }
+
     data_blocks = adjusted_length / codeword_size;
 
     if (compact) {
@@ -1213,6 +1225,7 @@ INTERNAL int aztec(struct zint_symbol *symbol, struct zint_seg segs[], const int
         }
     }
 
+    STATS_BEGIN(symbol, ZINT_PHASE_RS);
     switch (codeword_size) {
         case 6:
             rs_init_gf(&rs, 0x43);
@@ -1225,25 +1238,20 @@ INTERNAL int aztec(struct zint_symbol *symbol, struct zint_seg segs[], const int
             rs_encode_uint(&rs, data_blocks, data_part, ecc_part);
             break;
         case 10:
-            if (!rs_uint_init_gf(&rs_uint, 0x409, 1023)) { /* Can fail on malloc() */
-                strcpy(symbol->errtxt, "500: Insufficient memory for Reed-Solomon log tables");
-                return ZINT_ERROR_MEMORY;
-            }
+            (void) rs_uint_init_gf(&rs_uint, 0x409, 1023); /* Static tables so can't fail */
             rs_uint_init_code(&rs_uint, ecc_blocks, 1);
             rs_uint_encode(&rs_uint, data_blocks, data_part, ecc_part);
             rs_uint_free(&rs_uint);
             break;
         case 12:
-            if (!rs_uint_init_gf(&rs_uint, 0x1069, 4095)) { /* Can fail on malloc() */
-                /* Note using AUSPOST error nos range as out of 50x ones & 51x taken by CODEONE */
-                strcpy(symbol->errtxt, "700: Insufficient memory for Reed-Solomon log tables");
-                return ZINT_ERROR_MEMORY;
-            }
+            (void) rs_uint_init_gf(&rs_uint, 0x1069, 4095); /* Static tables so can't fail */
             rs_uint_init_code(&rs_uint, ecc_blocks, 1);
             rs_uint_encode(&rs_uint, data_blocks, data_part, ecc_part);
             rs_uint_free(&rs_uint);
             break;
     }
+    STATS_END(symbol, ZINT_PHASE_RS);
+    STATS_SET(symbol, version, compact ? layers : layers + 4);
 
     for (i = (ecc_blocks - 1); i >= 0; i--) {
         adjusted_length = bin_append_posn(ecc_part[i], codeword_size, adjusted_string, adjusted_length);
@@ -1524,4 +1532,59 @@ INTERNAL int azrune(struct zint_symbol *symbol, unsigned char source[], int leng
     return 0;
 }
 
+/* Return the maximum number of characters of `char_type` (ZINT_CAPACITY_XXX) that Aztec Code can hold at ECC level
+   `option_1` (if size automatic) and size `option_2`, or 0 if not supported (`ZBarcode_Capacity()`). Assumes no bit
+   stuffing is needed */
+INTERNAL int azt_capacity(const int option_1, const int option_2, const int char_type) {
+    int bits, count, len;
+
+    if (option_1 < -1 || option_1 > 4 || option_2 < 0 || option_2 > 36) {
+        return 0;
+    }
+    if (option_2 == 0) { /* Largest full-range symbol at ECC level (default 23%), less 1 as must be below */
+        switch (option_1) {
+            case 1: bits = Aztec10DataSizes[31];
+                break;
+            case 3: bits = Aztec36DataSizes[31];
+                break;
+            case 4: bits = Aztec50DataSizes[31];
+                break;
+            default: bits = Aztec23DataSizes[31];
+                break;
+        }
+        bits--;
+    } else {
+        const int layers = option_2 <= 4 ? option_2 : option_2 - 4;
+        const int codeword_size = layers <= 2 ? 6 : layers <= 8 ? 8 : layers <= 22 ? 10 : 12;
+        bits = codeword_size * ((option_2 <= 4 ? AztecCompactSizes[layers - 1] : AztecSizes[layers - 1]) - 3);
+    }
+    if (bits > AZTEC_BIN_CAPACITY) {
+        bits = AZTEC_BIN_CAPACITY;
+    }
+
+    switch (char_type) {
+        case ZINT_CAPACITY_NUMERIC: /* D/L then 4 bits each */
+            return bits >= 9 ? (bits - 5) / 4 : 0;
+            break;
+        case ZINT_CAPACITY_ALPHANUMERIC: /* Upper mode 5 bits each */
+            return bits / 5;
+            break;
+        case ZINT_CAPACITY_BYTE:
+            /* B/S then 5-bit length (up to 31) or 5 zero bits and 11-bit length (up to 2078), repeated as needed */
+            for (count = 0; bits >= 21 + 32 * 8; count += len, bits -= 21 + len * 8) {
+                len = (bits - 21) / 8;
+                if (len > 2078) {
+                    len = 2078;
+                }
+            }
+            if (bits >= 10 + 8) {
+                len = (bits - 10) / 8;
+                count += len > 31 ? 31 : len;
+            }
+            return count;
+            break;
+    }
+    return 0;
+}
+
 /* vim: set ts=4 sw=4 et : */
@@ -370,89 +370,100 @@ static const unsigned short big5_uro_mb_ind[1307] = {
     13552, 13553, 13560,
 };
 
-/* Unicode codepoints sorted */
-static const unsigned short big5_u[642] = {
-    0x00A2, 0x00A3, 0x00A5, 0x00A7, 0x00B0, 0x00B1, 0x00B7, 0x00D7,
-    0x00F7, 0x02C7, 0x02C9, 0x02CA, 0x02CB, 0x02D9, 0x0391, 0x0392,
-    0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039A,
-    0x039B, 0x039C, 0x039D, 0x039E, 0x039F, 0x03A0, 0x03A1, 0x03A3,
-    0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x03B1, 0x03B2,
-    0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA,
-    0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C3,
-    0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8, 0x03C9, 0x0401, 0x0414,
-    0x0415, 0x0416, 0x0417, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C,
-    0x0423, 0x0424, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429, 0x042A,
-    0x042B, 0x042C, 0x042D, 0x042E, 0x042F, 0x0430, 0x0431, 0x0432,
-    0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0439, 0x043A,
-    0x043B, 0x043C, 0x043D, 0x043E, 0x043F, 0x0440, 0x0441, 0x0442,
-    0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044A,
-    0x044B, 0x044C, 0x044D, 0x044E, 0x044F, 0x0451, 0x2013, 0x2014,
-    0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2025, 0x2026, 0x2032,
-    0x2035, 0x203B, 0x203E, 0x2103, 0x2105, 0x2109, 0x2160, 0x2161,
-    0x2162, 0x2163, 0x2164, 0x2165, 0x2166, 0x2167, 0x2168, 0x2169,
-    0x2190, 0x2191, 0x2192, 0x2193, 0x2196, 0x2197, 0x2198, 0x2199,
-    0x221A, 0x221E, 0x221F, 0x2220, 0x2223, 0x2225, 0x2229, 0x222A,
-    0x222B, 0x222E, 0x2234, 0x2235, 0x223C, 0x2252, 0x2260, 0x2261,
-    0x2266, 0x2267, 0x22A5, 0x22BF, 0x2460, 0x2461, 0x2462, 0x2463,
-    0x2464, 0x2465, 0x2466, 0x2467, 0x2468, 0x2469, 0x2474, 0x2475,
-    0x2476, 0x2477, 0x2478, 0x2479, 0x247A, 0x247B, 0x247C, 0x247D,
-    0x2500, 0x2502, 0x250C, 0x2510, 0x2514, 0x2518, 0x251C, 0x2524,
-    0x252C, 0x2534, 0x253C, 0x2550, 0x255E, 0x2561, 0x256A, 0x256D,
-    0x256E, 0x256F, 0x2570, 0x2571, 0x2572, 0x2573, 0x2581, 0x2582,
-    0x2583, 0x2584, 0x2585, 0x2586, 0x2587, 0x2588, 0x2589, 0x258A,
-    0x258B, 0x258C, 0x258D, 0x258E, 0x258F, 0x2594, 0x2595, 0x25A0,
-    0x25A1, 0x25B2, 0x25B3, 0x25BC, 0x25BD, 0x25C6, 0x25C7, 0x25CB,
-    0x25CE, 0x25CF, 0x25E2, 0x25E3, 0x25E4, 0x25E5, 0x2605, 0x2606,
-    0x2609, 0x2640, 0x2641, 0x2642, 0x3000, 0x3001, 0x3002, 0x3003,
-    0x3005, 0x3008, 0x3009, 0x300A, 0x300B, 0x300C, 0x300D, 0x300E,
-    0x300F, 0x3010, 0x3011, 0x3012, 0x3014, 0x3015, 0x301D, 0x301E,
-    0x3021, 0x3022, 0x3023, 0x3024, 0x3025, 0x3026, 0x3027, 0x3028,
-    0x3029, 0x3041, 0x3042, 0x3043, 0x3044, 0x3045, 0x3046, 0x3047,
-    0x3048, 0x3049, 0x304A, 0x304B, 0x304C, 0x304D, 0x304E, 0x304F,
-    0x3050, 0x3051, 0x3052, 0x3053, 0x3054, 0x3055, 0x3056, 0x3057,
-    0x3058, 0x3059, 0x305A, 0x305B, 0x305C, 0x305D, 0x305E, 0x305F,
-    0x3060, 0x3061, 0x3062, 0x3063, 0x3064, 0x3065, 0x3066, 0x3067,
-    0x3068, 0x3069, 0x306A, 0x306B, 0x306C, 0x306D, 0x306E, 0x306F,
-    0x3070, 0x3071, 0x3072, 0x3073, 0x3074, 0x3075, 0x3076, 0x3077,
-    0x3078, 0x3079, 0x307A, 0x307B, 0x307C, 0x307D, 0x307E, 0x307F,
-    0x3080, 0x3081, 0x3082, 0x3083, 0x3084, 0x3085, 0x3086, 0x3087,
-    0x3088, 0x3089, 0x308A, 0x308B, 0x308C, 0x308D, 0x308E, 0x308F,
-    0x3090, 0x3091, 0x3092, 0x3093, 0x309D, 0x309E, 0x30A1, 0x30A2,
-    0x30A3, 0x30A4, 0x30A5, 0x30A6, 0x30A7, 0x30A8, 0x30A9, 0x30AA,
-    0x30AB, 0x30AC, 0x30AD, 0x30AE, 0x30AF, 0x30B0, 0x30B1, 0x30B2,
-    0x30B3, 0x30B4, 0x30B5, 0x30B6, 0x30B7, 0x30B8, 0x30B9, 0x30BA,
-    0x30BB, 0x30BC, 0x30BD, 0x30BE, 0x30BF, 0x30C0, 0x30C1, 0x30C2,
-    0x30C3, 0x30C4, 0x30C5, 0x30C6, 0x30C7, 0x30C8, 0x30C9, 0x30CA,
-    0x30CB, 0x30CC, 0x30CD, 0x30CE, 0x30CF, 0x30D0, 0x30D1, 0x30D2,
-    0x30D3, 0x30D4, 0x30D5, 0x30D6, 0x30D7, 0x30D8, 0x30D9, 0x30DA,
-    0x30DB, 0x30DC, 0x30DD, 0x30DE, 0x30DF, 0x30E0, 0x30E1, 0x30E2,
-    0x30E3, 0x30E4, 0x30E5, 0x30E6, 0x30E7, 0x30E8, 0x30E9, 0x30EA,
-    0x30EB, 0x30EC, 0x30ED, 0x30EE, 0x30EF, 0x30F0, 0x30F1, 0x30F2,
-    0x30F3, 0x30F4, 0x30F5, 0x30F6, 0x30FE, 0x3105, 0x3106, 0x3107,
-    0x3108, 0x3109, 0x310A, 0x310B, 0x310C, 0x310D, 0x310E, 0x310F,
-    0x3110, 0x3111, 0x3112, 0x3113, 0x3114, 0x3115, 0x3116, 0x3117,
-    0x3118, 0x3119, 0x311A, 0x311B, 0x311C, 0x311D, 0x311E, 0x311F,
-    0x3120, 0x3121, 0x3122, 0x3123, 0x3124, 0x3125, 0x3126, 0x3127,
-    0x3128, 0x3129, 0x32A3, 0x338E, 0x338F, 0x339C, 0x339D, 0x339E,
-    0x33A1, 0x33C4, 0x33CE, 0x33D1, 0x33D2, 0x33D5, 0xFA0C, 0xFA0D,
-    0xFE30, 0xFE31, 0xFE33, 0xFE34, 0xFE35, 0xFE36, 0xFE37, 0xFE38,
-    0xFE39, 0xFE3A, 0xFE3B, 0xFE3C, 0xFE3D, 0xFE3E, 0xFE3F, 0xFE40,
-    0xFE41, 0xFE42, 0xFE43, 0xFE44, 0xFE49, 0xFE4A, 0xFE4B, 0xFE4C,
-    0xFE4D, 0xFE4E, 0xFE4F, 0xFE50, 0xFE52, 0xFE54, 0xFE55, 0xFE56,
-    0xFE57, 0xFE59, 0xFE5A, 0xFE5B, 0xFE5C, 0xFE5D, 0xFE5E, 0xFE5F,
-    0xFE60, 0xFE61, 0xFE62, 0xFE63, 0xFE64, 0xFE65, 0xFE66, 0xFE69,
-    0xFE6A, 0xFE6B, 0xFF01, 0xFF03, 0xFF04, 0xFF05, 0xFF06, 0xFF08,
-    0xFF09, 0xFF0A, 0xFF0B, 0xFF0C, 0xFF0D, 0xFF0E, 0xFF0F, 0xFF10,
-    0xFF11, 0xFF12, 0xFF13, 0xFF14, 0xFF15, 0xFF16, 0xFF17, 0xFF18,
-    0xFF19, 0xFF1A, 0xFF1B, 0xFF1C, 0xFF1D, 0xFF1E, 0xFF1F, 0xFF20,
-    0xFF21, 0xFF22, 0xFF23, 0xFF24, 0xFF25, 0xFF26, 0xFF27, 0xFF28,
-    0xFF29, 0xFF2A, 0xFF2B, 0xFF2C, 0xFF2D, 0xFF2E, 0xFF2F, 0xFF30,
-    0xFF31, 0xFF32, 0xFF33, 0xFF34, 0xFF35, 0xFF36, 0xFF37, 0xFF38,
-    0xFF39, 0xFF3A, 0xFF3C, 0xFF3F, 0xFF41, 0xFF42, 0xFF43, 0xFF44,
-    0xFF45, 0xFF46, 0xFF47, 0xFF48, 0xFF49, 0xFF4A, 0xFF4B, 0xFF4C,
-    0xFF4D, 0xFF4E, 0xFF4F, 0xFF50, 0xFF51, 0xFF52, 0xFF53, 0xFF54,
-    0xFF55, 0xFF56, 0xFF57, 0xFF58, 0xFF59, 0xFF5A, 0xFF5B, 0xFF5C,
-    0xFF5D, 0xFF64,
+/* Page (U+xx00-xxFF) blocks of `big5_page_u[]` & `big5_page_mb_ind[]`, 1-based, 0 if none */
+static const unsigned char big5_page[256] = {
+      1,   0,   2,   3,   4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      5,   6,   7,   0,   8,   9,  10,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+     11,  12,  13,  14,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  15,   0,   0,   0,  16,  17,
+};
+
+/* Unicode usage bit-flags for pages in blocks of 16 */
+static const unsigned short big5_page_u[272] = {
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x00AC, 0x0083, 0x0000, 0x0080, 0x0000, 0x0080,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0E80, 0x0200, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xFFFE, 0x03FB, 0xFFFE, 0x03FB, 0x0000, 0x0000, 0x0000,
+    0x0002, 0x1FF0, 0xFFF8, 0xFFFF, 0xFFFF, 0x0002, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x3318, 0x0064, 0x4824, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0228, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03FF, 0x0000,
+    0x0000, 0x03CF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xC400, 0x4E29, 0x1030, 0x0000, 0x0004, 0x00C3, 0x0000,
+    0x0000, 0x0000, 0x0020, 0x8000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03FF, 0x3FF0,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1005, 0x1111, 0x1010, 0x1010, 0x0000, 0x4001, 0xE402, 0x000F,
+    0xFFFE, 0x0030, 0x0003, 0x300C, 0xC8C0, 0x0000, 0x003C, 0x0000,
+    0x0260, 0x0000, 0x0000, 0x0000, 0x0007, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xFF2F, 0x6037, 0x03FE, 0x0000, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x600F, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x407F,
+    0xFFE0, 0xFFFF, 0x03FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0008, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xC000, 0x7000, 0x0002, 0x0000, 0x4010, 0x0026, 0x0000, 0x0000,
+    0x3000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xFFFB, 0xFE1F, 0xFEF5, 0x0E7F, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xFF7A, 0xFFFF, 0xFFFF, 0x97FF, 0xFFFE, 0x3FFF, 0x0010, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+};
+
+/* Multibyte indexes for pages in blocks of 16 */
+static const unsigned short big5_page_mb_ind[272] = {
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     4,     0,     7,     0,     8,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     9,    13,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,    14,    29,    38,    53,     0,     0,     0,
+       62,    63,    72,    85,   101,   117,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,   118,   124,   127,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+      131,     0,     0,     0,     0,     0,   134,     0,
+        0,   144,     0,     0,     0,     0,     0,     0,
+        0,   152,   155,   162,     0,   165,   166,     0,
+        0,     0,   170,   171,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,   172,   182,
+        0,     0,     0,     0,     0,     0,     0,     0,
+      192,   195,   199,   201,     0,   203,   205,   210,
+      214,   229,   231,   233,   237,     0,   242,     0,
+      246,     0,     0,     0,   249,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+      252,   265,   272,     0,   281,   296,   312,   328,
+      344,   360,   366,   381,   397,   413,   429,   445,
+      453,   464,   480,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,   490,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+      491,   493,   496,     0,   497,   499,     0,     0,
+    13563,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0, 13565, 13580, 13592, 13605,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+    13615, 13628, 13644, 13660, 13673, 13688, 13702,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
 };
 
 /* Multibyte values sorted in Unicode order */
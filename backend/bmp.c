@@ -38,6 +38,7 @@
 #include <fcntl.h>
 #endif
 #include "common.h"
+#include "filemem.h"
 #include "output.h"
 #include "bmp.h"        /* Bitmap header structure */
 
@@ -50,7 +51,8 @@ INTERNAL int bmp_pixel_plot(struct zint_symbol *symbol, const unsigned char *pix
     unsigned int data_offset, data_size, file_size;
     unsigned char *bitmap_file_start, *bmp_posn;
     unsigned char *bitmap;
-    FILE *bmp_file;
+    struct filemem fm;
+    struct filemem *const fmp = &fm;
     bitmap_file_header_t file_header;
     bitmap_info_header_t info_header;
     color_ref_t bg_color_ref;
@@ -96,7 +98,7 @@ INTERNAL int bmp_pixel_plot(struct zint_symbol *symbol, const unsigned char *pix
     data_offset += colour_count * sizeof(color_ref_t);
     file_size = data_offset + data_size;
 
-    bitmap_file_start = (unsigned char *) malloc(file_size);
+    bitmap_file_start = (unsigned char *) z_malloc(file_size);
     if (bitmap_file_start == NULL) {
         strcpy(symbol->errtxt, "602: Insufficient memory for BMP file buffer");
         return ZINT_ERROR_MEMORY;
@@ -164,49 +166,41 @@ INTERNAL int bmp_pixel_plot(struct zint_symbol *symbol, const unsigned char *pix
     }
 
     /* Open output file in binary mode */
-    if (output_to_stdout) {
 #ifdef _MSC_VER
+    if (output_to_stdout) {
         if (-1 == _setmode(_fileno(stdout), _O_BINARY)) {
             sprintf(symbol->errtxt, "600: Could not set stdout to binary (%d: %.30s)", errno, strerror(errno));
-            free(bitmap_file_start);
+            z_free(bitmap_file_start);
             return ZINT_ERROR_FILE_ACCESS;
         }
+    }
 #endif
-        bmp_file = stdout;
-    } else {
-        if (!(bmp_file = out_fopen(symbol->outfile, "wb"))) {
-            sprintf(symbol->errtxt, "601: Could not open output file (%d: %.30s)", errno, strerror(errno));
-            free(bitmap_file_start);
-            return ZINT_ERROR_FILE_ACCESS;
-        }
+    if (!fm_open(fmp, symbol, "wb")) {
+        sprintf(symbol->errtxt, "601: Could not open output file (%d: %.30s)", errno, strerror(errno));
+        z_free(bitmap_file_start);
+        return ZINT_ERROR_FILE_ACCESS;
     }
 
-    fwrite(bitmap_file_start, file_header.file_size, 1, bmp_file);
+    fm_write(bitmap_file_start, file_header.file_size, 1, fmp);
+    z_free(bitmap_file_start);
 
-    if (ferror(bmp_file)) {
-        sprintf(symbol->errtxt, "603: Incomplete write to output (%d: %.30s)", errno, strerror(errno));
-        free(bitmap_file_start);
-        if (!output_to_stdout) {
-            (void) fclose(bmp_file);
-        }
+    if (fm_error(fmp)) {
+        sprintf(symbol->errtxt, "603: Incomplete write to output (%d: %.30s)", fm_error(fmp),
+                strerror(fm_error(fmp)));
+        fm_discard(fmp, symbol);
         return ZINT_ERROR_FILE_WRITE;
     }
 
-    if (output_to_stdout) {
-        if (fflush(bmp_file) != 0) {
-            sprintf(symbol->errtxt, "604: Incomplete flush to output (%d: %.30s)", errno, strerror(errno));
-            free(bitmap_file_start);
-            return ZINT_ERROR_FILE_WRITE;
-        }
-    } else {
-        if (fclose(bmp_file) != 0) {
-            sprintf(symbol->errtxt, "605: Failure on closing output file (%d: %.30s)", errno, strerror(errno));
-            free(bitmap_file_start);
-            return ZINT_ERROR_FILE_WRITE;
+    if (!fm_close(fmp, symbol)) {
+        if (output_to_stdout) {
+            sprintf(symbol->errtxt, "604: Incomplete flush to output (%d: %.30s)", fmp->err, strerror(fmp->err));
+        } else {
+            sprintf(symbol->errtxt, "605: Failure on closing output file (%d: %.30s)", fmp->err,
+                    strerror(fmp->err));
         }
+        return ZINT_ERROR_FILE_WRITE;
     }
 
-    free(bitmap_file_start);
     return 0;
 }
 
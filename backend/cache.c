@@ -0,0 +1,854 @@
+/*  cache.c - encode and output result cache */
+/*
+    libzint - the open source barcode library
+    Copyright (C) 2023 Robin Stuart <rstuart114@gmail.com>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+    3. Neither the name of the project nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+ */
+/* SPDX-License-Identifier: BSD-3-Clause */
+
+#include <stddef.h>
+#include "common.h"
+#include "cache.h"
+#include "zthread.h"
+
+#define CACHE_SHARDS            16          /* Number of independently locked shards, power of 2 */
+#define CACHE_MIN_BUCKETS       16          /* Initial number of hash buckets per shard, power of 2 */
+#define CACHE_DEFAULT_MEMORY    0x1000000UL /* 16 MiB */
+
+/* Entry types (first byte of key) */
+#define CACHE_ENCODE    'E'
+#define CACHE_RASTER    'R'
+#define CACHE_VECTOR    'V'
+
+/* Size of a `struct zint_symbol` field */
+#define FIELD_SIZE(field)   sizeof(((const struct zint_symbol *) 0)->field)
+
+/* Upper bound on the size of `put_options()` output: 14 ints, 6 floats and 4 strings with their length prefixes */
+#define CACHE_OPTIONS_MAX   (sizeof(int) * (14 + 4) + sizeof(float) * 6 + FIELD_SIZE(fgcolour) \
+                                + FIELD_SIZE(bgcolour) + FIELD_SIZE(primary) + FIELD_SIZE(structapp.id))
+
+/* Cache entry, allocated with room for its key followed by its data */
+struct cache_entry {
+    struct cache_entry *next;       /* Next entry in hash bucket */
+    struct cache_entry *lru_prev;   /* More recently used entry */
+    struct cache_entry *lru_next;   /* Less recently used entry */
+    size_t size;                    /* Size of allocation, as counted against `max_memory` */
+    unsigned int hash;
+    int key_len;
+    unsigned char key[1];           /* Key then data, extending beyond end of structure */
+};
+
+#define ENTRY_KEY(e)    ((e)->key)
+#define ENTRY_DATA(e)   ((e)->key + (e)->key_len)
+
+/* Independently locked part of the cache, entries being assigned to shards by hash */
+struct cache_shard {
+    z_mutex_t mutex;                /* Protects all the following */
+    struct cache_entry **buckets;   /* Hash table */
+    unsigned int bucket_mask;       /* Number of buckets less 1 */
+    unsigned long entry_count;
+    struct cache_entry *lru_head;   /* Most recently used entry */
+    struct cache_entry *lru_tail;   /* Least recently used entry */
+    size_t memory;                  /* Total size of entries */
+    size_t max_memory;              /* Share of the cache's memory cap */
+    unsigned long hits;
+    unsigned long misses;
+    unsigned long evictions;
+};
+
+struct zint_cache {
+    struct cache_shard shards[CACHE_SHARDS];
+    unsigned long max_memory;
+};
+
+/* Restore the data of an entry into `symbol`, returning its error/warning value, or -1 on failure */
+typedef int (*cache_restore_func_t)(struct zint_symbol *symbol, const unsigned char *data);
+
+INTERNAL void vector_free(struct zint_symbol *symbol); /* Free vector structures */
+
+/* Create a cache holding up to `max_memory` bytes. Returns NULL on failure (no memory) */
+INTERNAL struct zint_cache *cache_create(unsigned long max_memory) {
+    struct zint_cache *cache;
+    int i;
+
+    if (!(cache = (struct zint_cache *) z_calloc(1, sizeof(struct zint_cache)))) {
+        return NULL;
+    }
+    cache->max_memory = max_memory ? max_memory : CACHE_DEFAULT_MEMORY;
+
+    for (i = 0; i < CACHE_SHARDS; i++) {
+        struct cache_shard *shard = &cache->shards[i];
+        if (!(shard->buckets = (struct cache_entry **) z_calloc(CACHE_MIN_BUCKETS, sizeof(struct cache_entry *)))) {
+            break;
+        }
+        if (!z_mutex_init(&shard->mutex)) {
+            z_free(shard->buckets);
+            break;
+        }
+        shard->bucket_mask = CACHE_MIN_BUCKETS - 1;
+        shard->max_memory = cache->max_memory / CACHE_SHARDS;
+    }
+    if (i < CACHE_SHARDS) {
+        while (i--) {
+            z_mutex_destroy(&cache->shards[i].mutex);
+            z_free(cache->shards[i].buckets);
+        }
+        z_free(cache);
+        return NULL;
+    }
+
+    return cache;
+}
+
+/* Free all the entries of `shard`, which must be locked */
+static void shard_clear(struct cache_shard *shard) {
+    struct cache_entry *entry = shard->lru_head;
+
+    while (entry) {
+        struct cache_entry *next = entry->lru_next;
+        z_free(entry);
+        entry = next;
+    }
+    memset(shard->buckets, 0, sizeof(struct cache_entry *) * (shard->bucket_mask + 1));
+    shard->lru_head = shard->lru_tail = NULL;
+    shard->entry_count = 0;
+    shard->memory = 0;
+}
+
+/* Discard all entries of `cache` */
+INTERNAL void cache_clear(struct zint_cache *cache) {
+    int i;
+
+    for (i = 0; i < CACHE_SHARDS; i++) {
+        z_mutex_lock(&cache->shards[i].mutex);
+        shard_clear(&cache->shards[i]);
+        z_mutex_unlock(&cache->shards[i].mutex);
+    }
+}
+
+/* Copy the statistics of `cache` into `stats` */
+INTERNAL void cache_stats(struct zint_cache *cache, struct zint_cache_stats *stats) {
+    int i;
+
+    memset(stats, 0, sizeof(struct zint_cache_stats));
+    for (i = 0; i < CACHE_SHARDS; i++) {
+        struct cache_shard *shard = &cache->shards[i];
+        z_mutex_lock(&shard->mutex);
+        stats->hits += shard->hits;
+        stats->misses += shard->misses;
+        stats->evictions += shard->evictions;
+        stats->entries += shard->entry_count;
+        stats->memory += (unsigned long) shard->memory;
+        z_mutex_unlock(&shard->mutex);
+    }
+    stats->max_memory = cache->max_memory;
+}
+
+/* Free `cache` and all its entries */
+INTERNAL void cache_delete(struct zint_cache *cache) {
+    int i;
+
+    for (i = 0; i < CACHE_SHARDS; i++) {
+        shard_clear(&cache->shards[i]);
+        z_mutex_destroy(&cache->shards[i].mutex);
+        z_free(cache->shards[i].buckets);
+    }
+    z_free(cache);
+}
+
+/* 32-bit FNV-1a hash of `key` */
+static unsigned int cache_hash(const unsigned char *key, const int key_len) {
+    unsigned int hash = 0x811C9DC5;
+    int i;
+
+    for (i = 0; i < key_len; i++) {
+        hash = ((hash ^ key[i]) * 0x01000193) & 0xFFFFFFFF;
+    }
+
+    return hash;
+}
+
+/* Return the shard for `hash`, using its top bits (its bottom bits select the bucket) */
+static struct cache_shard *cache_shard(struct zint_cache *cache, const unsigned int hash) {
+    return &cache->shards[(hash >> 24) & (CACHE_SHARDS - 1)];
+}
+
+/* Remove `entry` from the LRU list of `shard` */
+static void lru_unlink(struct cache_shard *shard, struct cache_entry *entry) {
+    if (entry->lru_prev) {
+        entry->lru_prev->lru_next = entry->lru_next;
+    } else {
+        shard->lru_head = entry->lru_next;
+    }
+    if (entry->lru_next) {
+        entry->lru_next->lru_prev = entry->lru_prev;
+    } else {
+        shard->lru_tail = entry->lru_prev;
+    }
+}
+
+/* Add `entry` to the front (most recently used end) of the LRU list of `shard` */
+static void lru_push(struct cache_shard *shard, struct cache_entry *entry) {
+    entry->lru_prev = NULL;
+    entry->lru_next = shard->lru_head;
+    if (shard->lru_head) {
+        shard->lru_head->lru_prev = entry;
+    } else {
+        shard->lru_tail = entry;
+    }
+    shard->lru_head = entry;
+}
+
+/* Return the entry of `shard` with `key`, or NULL if none */
+static struct cache_entry *shard_find(const struct cache_shard *shard, const unsigned char *key, const int key_len,
+            const unsigned int hash) {
+    struct cache_entry *entry;
+
+    for (entry = shard->buckets[hash & shard->bucket_mask]; entry; entry = entry->next) {
+        if (entry->hash == hash && entry->key_len == key_len && memcmp(ENTRY_KEY(entry), key, key_len) == 0) {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+/* Remove `entry` from `shard` and free it */
+static void shard_remove(struct cache_shard *shard, struct cache_entry *entry) {
+    struct cache_entry **p_entry = &shard->buckets[entry->hash & shard->bucket_mask];
+
+    while (*p_entry != entry) {
+        p_entry = &(*p_entry)->next;
+    }
+    *p_entry = entry->next;
+    lru_unlink(shard, entry);
+    shard->entry_count--;
+    shard->memory -= entry->size;
+    z_free(entry);
+}
+
+/* Double the number of hash buckets of `shard`, leaving as is if no memory */
+static void shard_grow(struct cache_shard *shard) {
+    const unsigned int new_mask = (shard->bucket_mask << 1) | 1;
+    struct cache_entry **buckets;
+    struct cache_entry *entry;
+
+    if (!(buckets = (struct cache_entry **) z_calloc(new_mask + 1, sizeof(struct cache_entry *)))) {
+        return;
+    }
+    for (entry = shard->lru_head; entry; entry = entry->lru_next) {
+        entry->next = buckets[entry->hash & new_mask];
+        buckets[entry->hash & new_mask] = entry;
+    }
+    z_free(shard->buckets);
+    shard->buckets = buckets;
+    shard->bucket_mask = new_mask;
+}
+
+/* Allocate an entry for `key` with room for `data_len` bytes of data, to be filled in by the caller before passing
+   to `cache_insert()`. Returns NULL if no memory */
+static struct cache_entry *entry_create(const unsigned char *key, const int key_len, const size_t data_len) {
+    const size_t size = offsetof(struct cache_entry, key) + key_len + data_len;
+    struct cache_entry *entry;
+
+    if (!(entry = (struct cache_entry *) z_malloc(size))) {
+        return NULL;
+    }
+    entry->size = size;
+    entry->hash = cache_hash(key, key_len);
+    entry->key_len = key_len;
+    memcpy(ENTRY_KEY(entry), key, key_len);
+
+    return entry;
+}
+
+/* Add `entry` to `cache`, replacing any entry with the same key and discarding least recently used entries as
+   necessary to keep within the memory cap. `entry` is freed if too big to be held */
+static void cache_insert(struct zint_cache *cache, struct cache_entry *entry) {
+    struct cache_shard *shard = cache_shard(cache, entry->hash);
+    struct cache_entry *old;
+
+    z_mutex_lock(&shard->mutex);
+
+    if (entry->size > shard->max_memory) {
+        z_mutex_unlock(&shard->mutex);
+        z_free(entry);
+        return;
+    }
+    /* May have been added by another thread since our lookup */
+    if ((old = shard_find(shard, ENTRY_KEY(entry), entry->key_len, entry->hash))) {
+        shard_remove(shard, old);
+    }
+    while (shard->memory + entry->size > shard->max_memory) {
+        shard_remove(shard, shard->lru_tail);
+        shard->evictions++;
+    }
+    if (shard->entry_count > shard->bucket_mask) {
+        shard_grow(shard);
+    }
+
+    entry->next = shard->buckets[entry->hash & shard->bucket_mask];
+    shard->buckets[entry->hash & shard->bucket_mask] = entry;
+    lru_push(shard, entry);
+    shard->entry_count++;
+    shard->memory += entry->size;
+
+    z_mutex_unlock(&shard->mutex);
+}
+
+/* Look up `key` in `cache` and if found restore its data into `symbol` using `restore`, returning its
+   error/warning value, else return -1 */
+static int cache_lookup(struct zint_cache *cache, const unsigned char *key, const int key_len,
+            struct zint_symbol *symbol, cache_restore_func_t restore) {
+    const unsigned int hash = cache_hash(key, key_len);
+    struct cache_shard *shard = cache_shard(cache, hash);
+    struct cache_entry *entry;
+    int error_number = -1;
+
+    z_mutex_lock(&shard->mutex);
+
+    if ((entry = shard_find(shard, key, key_len, hash))) {
+        /* Restore under lock, as entry may otherwise be evicted by another thread */
+        if ((error_number = restore(symbol, ENTRY_DATA(entry))) >= 0) {
+            lru_unlink(shard, entry);
+            lru_push(shard, entry);
+        }
+    }
+    if (error_number >= 0) {
+        shard->hits++;
+    } else {
+        shard->misses++;
+    }
+
+    z_mutex_unlock(&shard->mutex);
+
+    return error_number;
+}
+
+/* Serialization helpers - data is only ever read back by the same process, so native layout is used */
+
+static unsigned char *put_bytes(unsigned char *d, const void *src, const size_t size) {
+    memcpy(d, src, size);
+    return d + size;
+}
+
+static unsigned char *put_int(unsigned char *d, const int i) {
+    return put_bytes(d, &i, sizeof(int));
+}
+
+static unsigned char *put_float(unsigned char *d, const float f) {
+    return put_bytes(d, &f, sizeof(float));
+}
+
+/* Put the length of `str` (NUL-terminated unless `max` long) followed by its characters */
+static unsigned char *put_str(unsigned char *d, const char *str, const int max) {
+    int len;
+
+    for (len = 0; len < max && str[len]; len++);
+    d = put_int(d, len);
+    return put_bytes(d, str, len);
+}
+
+static void get_bytes(void *dst, const unsigned char **p_s, const size_t size) {
+    memcpy(dst, *p_s, size);
+    *p_s += size;
+}
+
+static int get_int(const unsigned char **p_s) {
+    int i;
+    get_bytes(&i, p_s, sizeof(int));
+    return i;
+}
+
+static float get_float(const unsigned char **p_s) {
+    float f;
+    get_bytes(&f, p_s, sizeof(float));
+    return f;
+}
+
+/* Get a string put by `put_str()` into `str`, NUL-terminating it */
+static void get_str(char *str, const unsigned char **p_s) {
+    const int len = get_int(p_s);
+    get_bytes(str, p_s, len);
+    str[len] = '\0';
+}
+
+/* Put the options of `symbol` that may affect encoding or output, i.e. all input fields apart from `outfile`,
+   `fontsize` (unused), `debug` (caching not done if set) and the pointers, field by field so that no pointers or
+   padding bytes are included. At most `CACHE_OPTIONS_MAX` bytes */
+static unsigned char *put_options(unsigned char *d, const struct zint_symbol *symbol) {
+    d = put_int(d, symbol->symbology);
+    d = put_float(d, symbol->height);
+    d = put_float(d, symbol->scale);
+    d = put_int(d, symbol->whitespace_width);
+    d = put_int(d, symbol->whitespace_height);
+    d = put_int(d, symbol->border_width);
+    d = put_int(d, symbol->output_options);
+    d = put_str(d, symbol->fgcolour, (int) sizeof(symbol->fgcolour));
+    d = put_str(d, symbol->bgcolour, (int) sizeof(symbol->bgcolour));
+    d = put_str(d, symbol->primary, (int) sizeof(symbol->primary));
+    d = put_int(d, symbol->option_1);
+    d = put_int(d, symbol->option_2);
+    d = put_int(d, symbol->option_3);
+    d = put_int(d, symbol->show_hrt);
+    d = put_int(d, symbol->input_mode);
+    d = put_int(d, symbol->eci);
+    d = put_float(d, symbol->dpmm);
+    d = put_float(d, symbol->dot_size);
+    d = put_float(d, symbol->text_gap);
+    d = put_float(d, symbol->guard_descent);
+    d = put_int(d, symbol->structapp.index);
+    d = put_int(d, symbol->structapp.count);
+    d = put_str(d, symbol->structapp.id, (int) sizeof(symbol->structapp.id));
+    d = put_int(d, symbol->warn_level);
+
+    return d;
+}
+
+/* Get the options put by `put_options()` into `symbol`, leaving all other fields (including the pointers) as is */
+static void get_options(struct zint_symbol *symbol, const unsigned char **p_s) {
+    symbol->symbology = get_int(p_s);
+    symbol->height = get_float(p_s);
+    symbol->scale = get_float(p_s);
+    symbol->whitespace_width = get_int(p_s);
+    symbol->whitespace_height = get_int(p_s);
+    symbol->border_width = get_int(p_s);
+    symbol->output_options = get_int(p_s);
+    get_str(symbol->fgcolour, p_s);
+    get_str(symbol->bgcolour, p_s);
+    get_str(symbol->primary, p_s);
+    symbol->option_1 = get_int(p_s);
+    symbol->option_2 = get_int(p_s);
+    symbol->option_3 = get_int(p_s);
+    symbol->show_hrt = get_int(p_s);
+    symbol->input_mode = get_int(p_s);
+    symbol->eci = get_int(p_s);
+    symbol->dpmm = get_float(p_s);
+    symbol->dot_size = get_float(p_s);
+    symbol->text_gap = get_float(p_s);
+    symbol->guard_descent = get_float(p_s);
+    symbol->structapp.index = get_int(p_s);
+    symbol->structapp.count = get_int(p_s);
+    get_str(symbol->structapp.id, p_s);
+    symbol->warn_level = get_int(p_s);
+}
+
+/* Set `symbol->priv->cache_key` to the key for encoding `segs` with the current options of `symbol`. Returns 1 on
+   success, 0 on failure (no memory) */
+INTERNAL int cache_encode_key(struct zint_symbol *symbol, const struct zint_seg segs[], const int seg_count) {
+    size_t size = 1 + CACHE_OPTIONS_MAX + sizeof(int);
+    unsigned char *key, *d;
+    int i;
+
+    for (i = 0; i < seg_count; i++) {
+        size += sizeof(int) * 2 + segs[i].length;
+    }
+    if (!(key = (unsigned char *) z_malloc(size))) {
+        return 0;
+    }
+
+    d = key;
+    *d++ = CACHE_ENCODE;
+    d = put_options(d, symbol);
+    d = put_int(d, seg_count);
+    for (i = 0; i < seg_count; i++) {
+        d = put_int(d, segs[i].eci);
+        d = put_int(d, segs[i].length);
+        d = put_bytes(d, segs[i].source, segs[i].length);
+    }
+
+    symbol->priv->cache_key = key;
+    symbol->priv->cache_key_len = (int) (d - key);
+
+    return 1;
+}
+
+/* Bytes per row of the module matrix as held in the cache (same as for compact symbols) */
+static int cache_module_stride(const struct zint_symbol *symbol) {
+    const int stride = symbol->symbology == BARCODE_ULTRA ? symbol->width : (symbol->width + 7) >> 3;
+
+    if (stride < 1) {
+        return 1;
+    }
+    return stride > (int) sizeof(symbol->encoded_data[0]) ? (int) sizeof(symbol->encoded_data[0]) : stride;
+}
+
+/* Restore encode result (see `cache_encode_put()` for layout) */
+static int encode_restore(struct zint_symbol *symbol, const unsigned char *data) {
+    struct zint_symbol_private *priv = symbol->priv;
+    const unsigned char *s = data;
+    const int error_number = get_int(&s);
+    const int options_len = get_int(&s);
+    const unsigned char *options = s;
+    int rows, stride;
+    int i;
+
+    s += options_len;
+    rows = get_int(&s);
+    stride = get_int(&s);
+
+    if (priv->compact) {
+        if (rows * stride > priv->module_alloc) {
+            unsigned char *modules = (unsigned char *) z_malloc(rows * stride);
+            if (!modules) {
+                return -1;
+            }
+            z_free(priv->modules);
+            priv->modules = modules;
+            priv->module_alloc = rows * stride;
+        }
+        priv->module_stride = stride;
+    }
+
+    /* Options as left by encoding (the caller's pointers, `outfile` etc. are kept) */
+    get_options(symbol, &options);
+
+    symbol->rows = rows;
+    symbol->width = get_int(&s);
+    get_str((char *) symbol->text, &s);
+    get_bytes(symbol->row_height, &s, sizeof(float) * rows);
+    get_str(symbol->errtxt, &s);
+    for (i = 0; i < rows; i++) {
+        get_bytes(priv->modules + i * priv->module_stride, &s, stride);
+    }
+
+    return error_number;
+}
+
+/* If `symbol->cache` holds an encode result for `symbol->priv->cache_key`, restore it into `symbol` and return its
+   error/warning value, else return -1 */
+INTERNAL int cache_encode_get(struct zint_symbol *symbol) {
+
+    if (!symbol->cache || !symbol->priv->cache_key) {
+        return -1;
+    }
+
+    return cache_lookup(symbol->cache, symbol->priv->cache_key, symbol->priv->cache_key_len, symbol, encode_restore);
+}
+
+/* Store the encode result held in `symbol` with `error_number` under `symbol->priv->cache_key`. Only the fields
+   set by encoding are stored: the options (as possibly adjusted by the encoder), `text`, `rows`, `width`,
+   `row_height`, `errtxt` and the modules */
+INTERNAL void cache_encode_put(struct zint_symbol *symbol, const int error_number) {
+    const struct zint_symbol_private *priv = symbol->priv;
+    const int stride = cache_module_stride(symbol);
+    unsigned char options[CACHE_OPTIONS_MAX];
+    int options_len;
+    size_t data_len;
+    struct cache_entry *entry;
+    unsigned char *d;
+    int i;
+
+    if (!symbol->cache || !priv->cache_key) {
+        return;
+    }
+    options_len = (int) (put_options(options, symbol) - options);
+    data_len = sizeof(int) * 7 + options_len + ustrlen(symbol->text) + sizeof(float) * symbol->rows
+                + strlen(symbol->errtxt) + (size_t) symbol->rows * stride;
+    if (!(entry = entry_create(priv->cache_key, priv->cache_key_len, data_len))) {
+        return;
+    }
+
+    d = ENTRY_DATA(entry);
+    d = put_int(d, error_number);
+    d = put_int(d, options_len);
+    d = put_bytes(d, options, options_len);
+    d = put_int(d, symbol->rows);
+    d = put_int(d, stride);
+    d = put_int(d, symbol->width);
+    d = put_str(d, (const char *) symbol->text, (int) sizeof(symbol->text));
+    d = put_bytes(d, symbol->row_height, sizeof(float) * symbol->rows);
+    d = put_str(d, symbol->errtxt, (int) sizeof(symbol->errtxt));
+    for (i = 0; i < symbol->rows; i++) {
+        d = put_bytes(d, priv->modules + i * priv->module_stride, stride);
+    }
+
+    cache_insert(symbol->cache, entry);
+}
+
+/* Return the key for outputting the encode result `symbol->priv->cache_key` with `rotate_angle` and the current
+   options of `symbol`, or NULL if no memory */
+static unsigned char *output_key(const struct zint_symbol *symbol, const int rotate_angle, const int is_vector,
+            int *p_key_len) {
+    unsigned char *key, *d;
+
+    if (!(key = (unsigned char *) z_malloc(1 + sizeof(int) + CACHE_OPTIONS_MAX + symbol->priv->cache_key_len))) {
+        return NULL;
+    }
+
+    d = key;
+    *d++ = is_vector ? CACHE_VECTOR : CACHE_RASTER;
+    d = put_int(d, rotate_angle);
+    d = put_options(d, symbol);
+    d = put_bytes(d, symbol->priv->cache_key, symbol->priv->cache_key_len);
+    *p_key_len = (int) (d - key);
+
+    return key;
+}
+
+/* Size in bytes of `symbol->bitmap` */
+static size_t raster_bitmap_size(const struct zint_symbol *symbol) {
+    return (size_t) symbol->bitmap_width * symbol->bitmap_height
+            * (symbol->output_options & OUT_BUFFER_INTERMEDIATE ? 1 : 3);
+}
+
+/* Restore raster output (see `raster_put()` for layout) */
+static int raster_restore(struct zint_symbol *symbol, const unsigned char *data) {
+    const unsigned char *s = data;
+    const int error_number = get_int(&s);
+    const int bitmap_width = get_int(&s);
+    const int bitmap_height = get_int(&s);
+    const int has_alpha = get_int(&s);
+    const size_t alpha_size = (size_t) bitmap_width * bitmap_height;
+    size_t bitmap_size;
+    unsigned char *bitmap, *alphamap = NULL;
+
+    get_bytes(&bitmap_size, &s, sizeof(size_t));
+    if (!(bitmap = (unsigned char *) z_malloc(bitmap_size))
+            || (has_alpha && !(alphamap = (unsigned char *) z_malloc(alpha_size)))) {
+        z_free(bitmap);
+        return -1;
+    }
+    get_bytes(bitmap, &s, bitmap_size);
+    if (alphamap) {
+        get_bytes(alphamap, &s, alpha_size);
+    }
+    if (error_number) {
+        get_str(symbol->errtxt, &s);
+    }
+
+    z_free(symbol->bitmap);
+    z_free(symbol->alphamap);
+    symbol->bitmap = bitmap;
+    symbol->alphamap = alphamap;
+    symbol->bitmap_width = bitmap_width;
+    symbol->bitmap_height = bitmap_height;
+
+    return error_number;
+}
+
+/* Return raster output entry for `symbol` */
+static struct cache_entry *raster_put(const struct zint_symbol *symbol, const unsigned char *key, const int key_len,
+            const int error_number) {
+    const size_t bitmap_size = raster_bitmap_size(symbol);
+    const size_t alpha_size = symbol->alphamap ? (size_t) symbol->bitmap_width * symbol->bitmap_height : 0;
+    const size_t data_len = sizeof(int) * 5 + sizeof(size_t) + bitmap_size + alpha_size + strlen(symbol->errtxt);
+    struct cache_entry *entry;
+    unsigned char *d;
+
+    if (!symbol->bitmap || !(entry = entry_create(key, key_len, data_len))) {
+        return NULL;
+    }
+
+    d = ENTRY_DATA(entry);
+    d = put_int(d, error_number);
+    d = put_int(d, symbol->bitmap_width);
+    d = put_int(d, symbol->bitmap_height);
+    d = put_int(d, symbol->alphamap != NULL);
+    d = put_bytes(d, &bitmap_size, sizeof(size_t));
+    d = put_bytes(d, symbol->bitmap, bitmap_size);
+    if (symbol->alphamap) {
+        d = put_bytes(d, symbol->alphamap, alpha_size);
+    }
+    if (error_number) {
+        (void) put_str(d, symbol->errtxt, (int) sizeof(symbol->errtxt));
+    }
+
+    return entry;
+}
+
+/* Restore vector output (see `vector_put()` for layout) */
+static int vector_restore(struct zint_symbol *symbol, const unsigned char *data) {
+    const unsigned char *s = data;
+    const int error_number = get_int(&s);
+    struct zint_vector *vector;
+    struct zint_vector_rect **p_rect;
+    struct zint_vector_hexagon **p_hex;
+    struct zint_vector_string **p_string;
+    struct zint_vector_circle **p_circle;
+    int count;
+
+    vector_free(symbol);
+
+    if (!(vector = symbol->vector = (struct zint_vector *) z_malloc(sizeof(struct zint_vector)))) {
+        return -1;
+    }
+    vector->width = get_float(&s);
+    vector->height = get_float(&s);
+    vector->rectangles = NULL;
+    vector->hexagons = NULL;
+    vector->strings = NULL;
+    vector->circles = NULL;
+
+    for (count = get_int(&s), p_rect = &vector->rectangles; count; count--, p_rect = &(*p_rect)->next) {
+        if (!(*p_rect = (struct zint_vector_rect *) z_malloc(sizeof(struct zint_vector_rect)))) {
+            vector_free(symbol);
+            return -1;
+        }
+        get_bytes(*p_rect, &s, sizeof(struct zint_vector_rect));
+        (*p_rect)->next = NULL;
+    }
+    for (count = get_int(&s), p_hex = &vector->hexagons; count; count--, p_hex = &(*p_hex)->next) {
+        if (!(*p_hex = (struct zint_vector_hexagon *) z_malloc(sizeof(struct zint_vector_hexagon)))) {
+            vector_free(symbol);
+            return -1;
+        }
+        get_bytes(*p_hex, &s, sizeof(struct zint_vector_hexagon));
+        (*p_hex)->next = NULL;
+    }
+    for (count = get_int(&s), p_string = &vector->strings; count; count--, p_string = &(*p_string)->next) {
+        if (!(*p_string = (struct zint_vector_string *) z_malloc(sizeof(struct zint_vector_string)))) {
+            vector_free(symbol);
+            return -1;
+        }
+        get_bytes(*p_string, &s, sizeof(struct zint_vector_string));
+        (*p_string)->next = NULL;
+        if (!((*p_string)->text = (unsigned char *) z_malloc((*p_string)->length + 1))) {
+            vector_free(symbol);
+            return -1;
+        }
+        get_bytes((*p_string)->text, &s, (*p_string)->length);
+        (*p_string)->text[(*p_string)->length] = '\0';
+    }
+    for (count = get_int(&s), p_circle = &vector->circles; count; count--, p_circle = &(*p_circle)->next) {
+        if (!(*p_circle = (struct zint_vector_circle *) z_malloc(sizeof(struct zint_vector_circle)))) {
+            vector_free(symbol);
+            return -1;
+        }
+        get_bytes(*p_circle, &s, sizeof(struct zint_vector_circle));
+        (*p_circle)->next = NULL;
+    }
+    if (error_number) {
+        get_str(symbol->errtxt, &s);
+    }
+
+    return error_number;
+}
+
+/* Return vector output entry for `symbol` */
+static struct cache_entry *vector_put(const struct zint_symbol *symbol, const unsigned char *key, const int key_len,
+            const int error_number) {
+    const struct zint_vector *vector = symbol->vector;
+    const struct zint_vector_rect *rect;
+    const struct zint_vector_hexagon *hex;
+    const struct zint_vector_string *string;
+    const struct zint_vector_circle *circle;
+    int rect_count = 0, hex_count = 0, string_count = 0, circle_count = 0;
+    size_t data_len = sizeof(int) * 6 + sizeof(float) * 2 + strlen(symbol->errtxt);
+    struct cache_entry *entry;
+    unsigned char *d;
+
+    if (!vector) {
+        return NULL;
+    }
+    for (rect = vector->rectangles; rect; rect = rect->next, rect_count++);
+    for (hex = vector->hexagons; hex; hex = hex->next, hex_count++);
+    for (string = vector->strings; string; string = string->next, string_count++) {
+        data_len += string->length;
+    }
+    for (circle = vector->circles; circle; circle = circle->next, circle_count++);
+    data_len += sizeof(struct zint_vector_rect) * rect_count + sizeof(struct zint_vector_hexagon) * hex_count
+                + sizeof(struct zint_vector_string) * string_count + sizeof(struct zint_vector_circle) * circle_count;
+
+    if (!(entry = entry_create(key, key_len, data_len))) {
+        return NULL;
+    }
+
+    d = ENTRY_DATA(entry);
+    d = put_int(d, error_number);
+    d = put_float(d, vector->width);
+    d = put_float(d, vector->height);
+    d = put_int(d, rect_count);
+    for (rect = vector->rectangles; rect; rect = rect->next) {
+        d = put_bytes(d, rect, sizeof(struct zint_vector_rect));
+    }
+    d = put_int(d, hex_count);
+    for (hex = vector->hexagons; hex; hex = hex->next) {
+        d = put_bytes(d, hex, sizeof(struct zint_vector_hexagon));
+    }
+    d = put_int(d, string_count);
+    for (string = vector->strings; string; string = string->next) {
+        d = put_bytes(d, string, sizeof(struct zint_vector_string));
+        d = put_bytes(d, string->text, string->length);
+    }
+    d = put_int(d, circle_count);
+    for (circle = vector->circles; circle; circle = circle->next) {
+        d = put_bytes(d, circle, sizeof(struct zint_vector_circle));
+    }
+    if (error_number) {
+        (void) put_str(d, symbol->errtxt, (int) sizeof(symbol->errtxt));
+    }
+
+    return entry;
+}
+
+/* If `symbol->cache` holds a raster (`is_vector` 0) or vector (`is_vector` 1) buffer output for the encode result
+   `symbol->priv->cache_key`, `rotate_angle` and the current options of `symbol`, restore it into `symbol` and return
+   its error/warning value, else return -1 */
+INTERNAL int cache_output_get(struct zint_symbol *symbol, const int rotate_angle, const int is_vector) {
+    unsigned char *key;
+    int key_len;
+    int error_number;
+
+    if (!symbol->cache || !symbol->priv->cache_key) {
+        return -1;
+    }
+    if (!(key = output_key(symbol, rotate_angle, is_vector, &key_len))) {
+        return -1;
+    }
+    error_number = cache_lookup(symbol->cache, key, key_len, symbol, is_vector ? vector_restore : raster_restore);
+    z_free(key);
+
+    return error_number;
+}
+
+/* Store the raster or vector buffer output held in `symbol` with `error_number` */
+INTERNAL void cache_output_put(struct zint_symbol *symbol, const int rotate_angle, const int is_vector,
+            const int error_number) {
+    unsigned char *key;
+    int key_len;
+    struct cache_entry *entry;
+
+    if (!symbol->cache || !symbol->priv->cache_key) {
+        return;
+    }
+    if (!(key = output_key(symbol, rotate_angle, is_vector, &key_len))) {
+        return;
+    }
+    if (is_vector) {
+        entry = vector_put(symbol, key, key_len, error_number);
+    } else {
+        entry = raster_put(symbol, key, key_len, error_number);
+    }
+    z_free(key);
+
+    if (entry) {
+        cache_insert(symbol->cache, entry);
+    }
+}
+
+/* vim: set ts=4 sw=4 et : */
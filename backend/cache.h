@@ -0,0 +1,77 @@
+/*  cache.h - encode and output result cache */
+/*
+    libzint - the open source barcode library
+    Copyright (C) 2023 Robin Stuart <rstuart114@gmail.com>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+    3. Neither the name of the project nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+ */
+/* SPDX-License-Identifier: BSD-3-Clause */
+
+#ifndef Z_CACHE_H
+#define Z_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Create a cache holding up to `max_memory` bytes. Returns NULL on failure (no memory) */
+INTERNAL struct zint_cache *cache_create(unsigned long max_memory);
+
+/* Discard all entries of `cache` */
+INTERNAL void cache_clear(struct zint_cache *cache);
+
+/* Copy the statistics of `cache` into `stats` */
+INTERNAL void cache_stats(struct zint_cache *cache, struct zint_cache_stats *stats);
+
+/* Free `cache` and all its entries */
+INTERNAL void cache_delete(struct zint_cache *cache);
+
+/* Set `symbol->priv->cache_key` to the key for encoding `segs` with the current options of `symbol`. Returns 1 on
+   success, 0 on failure (no memory) */
+INTERNAL int cache_encode_key(struct zint_symbol *symbol, const struct zint_seg segs[], const int seg_count);
+
+/* If `symbol->cache` holds an encode result for `symbol->priv->cache_key`, restore it into `symbol` and return its
+   error/warning value, else return -1 */
+INTERNAL int cache_encode_get(struct zint_symbol *symbol);
+
+/* Store the encode result held in `symbol` with `error_number` under `symbol->priv->cache_key` */
+INTERNAL void cache_encode_put(struct zint_symbol *symbol, const int error_number);
+
+/* If `symbol->cache` holds a raster (`is_vector` 0) or vector (`is_vector` 1) buffer output for the encode result
+   `symbol->priv->cache_key`, `rotate_angle` and the current options of `symbol`, restore it into `symbol` and return
+   its error/warning value, else return -1 */
+INTERNAL int cache_output_get(struct zint_symbol *symbol, const int rotate_angle, const int is_vector);
+
+/* Store the raster or vector buffer output held in `symbol` with `error_number` */
+INTERNAL void cache_output_put(struct zint_symbol *symbol, const int rotate_angle, const int is_vector,
+            const int error_number);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+/* vim: set ts=4 sw=4 et : */
+#endif /* Z_CACHE_H */
@@ -1571,4 +1571,34 @@ INTERNAL int codeone(struct zint_symbol *symbol, struct zint_seg segs[], const i
     return error_number;
 }
 
+/* Return the maximum number of characters of `char_type` (ZINT_CAPACITY_XXX) that Code One can hold at version
+   `option_2`, or 0 if not supported (`ZBarcode_Capacity()`) */
+INTERNAL int c1_capacity(const int option_2, const int char_type) {
+    int cw, bits;
+
+    if (option_2 < 0 || option_2 > 10) {
+        return 0;
+    }
+    if (option_2 == 9) { /* Version S numeric only */
+        return char_type == ZINT_CAPACITY_NUMERIC ? 18 : 0;
+    }
+    cw = option_2 == 10 ? 38 : c1_data_length[option_2 ? option_2 - 1 : 7];
+
+    switch (char_type) {
+        case ZINT_CAPACITY_NUMERIC:
+            /* Decimal 4-bit latch then 10 bits per 3 digits, final codeword holding 2 digits (ASCII) if whole or 1
+               digit if 4 bits or more left (Version T limited to 90 anyway) */
+            bits = cw * 8 - 4;
+            return (bits / 10) * 3 + (bits % 10 >= 8 ? 2 : bits % 10 >= 4);
+            break;
+        case ZINT_CAPACITY_ALPHANUMERIC: /* C40 latch then 3 per 2 codewords, final odd codeword ASCII */
+            return ((cw - 1) / 2) * 3 + ((cw - 1) & 1);
+            break;
+        case ZINT_CAPACITY_BYTE: /* Byte latch and field length, a single codeword as symbol full */
+            return cw - 2;
+            break;
+    }
+    return 0;
+}
+
 /* vim: set ts=4 sw=4 et : */
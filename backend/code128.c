@@ -1246,7 +1246,7 @@ INTERNAL int upu_s10(struct zint_symbol *symbol, unsigned char source[], int len
     unsigned char local_source[13 + 1];
     unsigned char have_check_digit = '\0';
     int check_digit;
-    static char weights[8] = { 8, 6, 4, 2, 3, 5, 9, 7 };
+    static const char weights[8] = { 8, 6, 4, 2, 3, 5, 9, 7 };
     int error_number = 0, warn_number = 0;
 
     if (length != 12 && length != 13) {
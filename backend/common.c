@@ -34,8 +34,24 @@
 #ifdef ZINT_TEST
 #include <stdio.h>
 #endif
+#ifdef ZINT_STATS
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+#endif /* ZINT_STATS */
 #include "common.h"
 
+/* Use 128-bit vectors for the UTF-8 ASCII fast path if baseline for the target (as in "reedsol.c") */
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define UTF8_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define UTF8_NEON
+#include <arm_neon.h>
+#endif
+
 /* Converts a character 0-9, A-F to its equivalent integer value */
 INTERNAL int ctoi(const char source) {
     if (z_isdigit(source))
@@ -197,31 +213,81 @@ INTERNAL int bin_append_posn(const int arg, const int length, char *binary, cons
     return bin_posn + length;
 }
 
+/* Places the `length` (<= 24) least significant bits of `arg` in packed (most significant bit first) `bits` at
+   bit position `bit_posn`, overwriting any previous bits there. Returns `bit_posn` + `length` */
+INTERNAL int bits_append_posn(const unsigned int arg, const int length, unsigned char *bits, const int bit_posn) {
+    int bp = bit_posn;
+    int remaining = length;
+
+    while (remaining > 0) {
+        const int offset = bp & 0x07;
+        const int n = remaining < 8 - offset ? remaining : 8 - offset; /* Number of bits going into this byte */
+        const int shift = 8 - offset - n;
+        const unsigned int mask = ((1u << n) - 1) << shift;
+
+        remaining -= n;
+        bits[bp >> 3] = (unsigned char) ((bits[bp >> 3] & ~mask) | (((arg >> remaining) << shift) & mask));
+        bp += n;
+    }
+    return bp;
+}
+
+/* Returns the `length` (<= 24) bits at bit position `bit_posn` in packed (most significant bit first) `bits` */
+INTERNAL unsigned int bits_get_posn(const unsigned char *bits, const int bit_posn, const int length) {
+    unsigned int val = 0;
+    int bp = bit_posn;
+    int remaining = length;
+
+    while (remaining > 0) {
+        const int offset = bp & 0x07;
+        const int n = remaining < 8 - offset ? remaining : 8 - offset;
+
+        val = (val << n) | ((bits[bp >> 3] >> (8 - offset - n)) & ((1u << n) - 1));
+        remaining -= n;
+        bp += n;
+    }
+    return val;
+}
+
+/* Formats the first `length` bits of packed `bits` as '0'/'1' characters into `buf`, which should be at least
+   `length` + 1 chars in size (for debug output) */
+INTERNAL char *bits_dump(const unsigned char *bits, const int length, char *buf) {
+    int i;
+
+    for (i = 0; i < length; i++) {
+        buf[i] = bits[i >> 3] & (0x80 >> (i & 0x07)) ? '1' : '0';
+    }
+    buf[length] = '\0';
+    return buf;
+}
+
 #ifndef Z_COMMON_INLINE
 /* Returns true (1) if a module is dark/black, otherwise false (0) */
 INTERNAL int module_is_set(const struct zint_symbol *symbol, const int y_coord, const int x_coord) {
-    return (symbol->encoded_data[y_coord][x_coord >> 3] >> (x_coord & 0x07)) & 1;
+    const struct zint_symbol_private *priv = symbol->priv;
+    return (priv->modules[y_coord * priv->module_stride + (x_coord >> 3)] >> (x_coord & 0x07)) & 1;
 }
 
 /* Sets a module to dark/black */
 INTERNAL void set_module(struct zint_symbol *symbol, const int y_coord, const int x_coord) {
-    symbol->encoded_data[y_coord][x_coord >> 3] |= 1 << (x_coord & 0x07);
+    symbol->priv->modules[y_coord * symbol->priv->module_stride + (x_coord >> 3)] |= 1 << (x_coord & 0x07);
 }
 
 /* Returns true (1-8) if a module is colour, otherwise false (0) */
 INTERNAL int module_colour_is_set(const struct zint_symbol *symbol, const int y_coord, const int x_coord) {
-    return symbol->encoded_data[y_coord][x_coord];
+    return symbol->priv->modules[y_coord * symbol->priv->module_stride + x_coord];
 }
 
 /* Sets a module to a colour */
 INTERNAL void set_module_colour(struct zint_symbol *symbol, const int y_coord, const int x_coord, const int colour) {
-    symbol->encoded_data[y_coord][x_coord] = colour;
+    symbol->priv->modules[y_coord * symbol->priv->module_stride + x_coord] = colour;
 }
 #endif
 
 /* Sets a dark/black module to white (i.e. unsets) */
 INTERNAL void unset_module(struct zint_symbol *symbol, const int y_coord, const int x_coord) {
-    symbol->encoded_data[y_coord][x_coord >> 3] &= ~(1 << (x_coord & 0x07));
+    struct zint_symbol_private *priv = symbol->priv;
+    priv->modules[y_coord * priv->module_stride + (x_coord >> 3)] &= ~(1 << (x_coord & 0x07));
 }
 
 /* Expands from a width pattern to a bit pattern */
@@ -416,13 +482,56 @@ INTERNAL unsigned int decode_utf8(unsigned int *state, unsigned int *codep, cons
     return *state;
 }
 
+/* Return length of the run of ASCII at the start of `source`, checking 16 bytes at a time using SSE2/NEON if
+   available, else 2 machine words */
+static int ascii_run_len(const unsigned char source[], const int length) {
+#if defined(UTF8_SSE2) || defined(UTF8_NEON)
+    const int step = 16;
+#else
+    const size_t high_bits = ((size_t) -1 / 0xFF) * 0x80; /* 0x80 in every byte */
+    const int step = (int) sizeof(size_t) * 2;
+    size_t w1, w2;
+#endif
+    int i;
+
+    for (i = 0; i + step <= length; i += step) {
+#if defined(UTF8_SSE2)
+        if (_mm_movemask_epi8(_mm_loadu_si128((const __m128i *) (source + i)))) { /* High bit of each byte */
+            break;
+        }
+#elif defined(UTF8_NEON)
+        const uint8x16_t v = vld1q_u8(source + i);
+        const uint32x2_t v32 = vreinterpret_u32_u8(vorr_u8(vget_low_u8(v), vget_high_u8(v)));
+        if ((vget_lane_u32(v32, 0) | vget_lane_u32(v32, 1)) & 0x80808080) {
+            break;
+        }
+#else
+        memcpy(&w1, source + i, sizeof(size_t));
+        memcpy(&w2, source + i + sizeof(size_t), sizeof(size_t));
+        if ((w1 | w2) & high_bits) {
+            break;
+        }
+#endif
+    }
+    while (i < length && source[i] < 0x80) {
+        i++;
+    }
+
+    return i;
+}
+
 /* Is string valid UTF-8? */
 INTERNAL int is_valid_utf8(const unsigned char source[], const int length) {
     int i;
     unsigned int codepoint, state = 0;
 
     for (i = 0; i < length; i++) {
-        if (decode_utf8(&state, &codepoint, source[i]) == 12) {
+        if (source[i] < 0x80) { /* Skip ASCII runs */
+            if (state != 0) {
+                return 0;
+            }
+            i += ascii_run_len(source + i, length - i) - 1;
+        } else if (decode_utf8(&state, &codepoint, source[i]) == 12) {
             return 0;
         }
     }
@@ -442,6 +551,13 @@ INTERNAL int utf8_to_unicode(struct zint_symbol *symbol, const unsigned char sou
     jpos = 0;
 
     while (bpos < *length) {
+        if (source[bpos] < 0x80) { /* Copy ASCII runs straight */
+            const int end = bpos + ascii_run_len(source + bpos, *length - bpos);
+            while (bpos < end) {
+                vals[jpos++] = source[bpos++];
+            }
+            continue;
+        }
         do {
             decode_utf8(&state, &codepoint, source[bpos++]);
         } while (bpos < *length && state != 0 && state != 12);
@@ -522,6 +638,21 @@ INTERNAL int set_height(struct zint_symbol *symbol, const float min_row_height,
     return error_number;
 }
 
+/* Sizing only (`symbol->priv->geometry` set, see `ZBarcode_Geometry()`): sets symbol to `size` x `size` matrix
+   without placing modules, and records `version` and `ecc_level` */
+INTERNAL void set_geometry(struct zint_symbol *symbol, const int size, const int version, const int ecc_level) {
+    int i;
+
+    for (i = 0; i < size; i++) {
+        symbol->row_height[i] = 1;
+    }
+    symbol->height = size;
+    symbol->rows = size;
+    symbol->width = size;
+    symbol->priv->geometry->version = version;
+    symbol->priv->geometry->ecc_level = ecc_level;
+}
+
 /* Prevent inlining of `stripf()` which can optimize away its effect */
 #if defined(__GNUC__) || defined(__clang__)
 __attribute__((__noinline__))
@@ -610,6 +741,218 @@ INTERNAL int colour_to_blue(const int colour) {
     return return_val;
 }
 
+/* Allocator, see `ZBarcode_SetAllocator()` */
+static void *(*z_malloc_fn)(size_t) = malloc;
+static void *(*z_realloc_fn)(void *, size_t) = realloc;
+static void (*z_free_fn)(void *) = free;
+
+INTERNAL void *z_malloc(const size_t size) {
+    return z_malloc_fn(size);
+}
+
+INTERNAL void *z_calloc(const size_t nmemb, const size_t size) {
+    void *ptr;
+
+    if (size && nmemb > (size_t) -1 / size) {
+        return NULL;
+    }
+    if ((ptr = z_malloc_fn(nmemb * size))) {
+        memset(ptr, 0, nmemb * size);
+    }
+    return ptr;
+}
+
+INTERNAL void *z_realloc(void *ptr, const size_t size) {
+    return z_realloc_fn(ptr, size);
+}
+
+INTERNAL void z_free(void *ptr) {
+    if (ptr) {
+        z_free_fn(ptr);
+    }
+}
+
+/* Set the allocator used by `z_malloc()` etc (all NULL for the standard library). Returns 0 on success, 1 if only
+   some NULL */
+INTERNAL int z_set_allocator(void *(*malloc_fn)(size_t), void *(*realloc_fn)(void *, size_t),
+            void (*free_fn)(void *)) {
+    if (!malloc_fn && !realloc_fn && !free_fn) {
+        z_malloc_fn = malloc;
+        z_realloc_fn = realloc;
+        z_free_fn = free;
+        return 0;
+    }
+    if (!malloc_fn || !realloc_fn || !free_fn) {
+        return 1;
+    }
+    z_malloc_fn = malloc_fn;
+    z_realloc_fn = realloc_fn;
+    z_free_fn = free_fn;
+    return 0;
+}
+
+/* Arena block, followed by its data at `ARENA_HDR_SIZE` */
+struct zint_arena_block {
+    struct zint_arena_block *next;
+    size_t size;                /* Size of data */
+    size_t used;                /* Bytes of data allocated */
+};
+
+#define ARENA_ALIGN     16 /* Allows for any of the types used */
+#define ARENA_ROUND(n)  (((n) + (ARENA_ALIGN - 1)) & ~((size_t) ARENA_ALIGN - 1))
+#define ARENA_HDR_SIZE  ARENA_ROUND(sizeof(struct zint_arena_block))
+
+/* Allocate an arena block with `size` bytes of data */
+static struct zint_arena_block *arena_block_new(const size_t size) {
+    struct zint_arena_block *block;
+
+    if (size > (size_t) -1 - ARENA_HDR_SIZE) {
+        return NULL;
+    }
+    if (!(block = (struct zint_arena_block *) z_malloc(ARENA_HDR_SIZE + size))) {
+        return NULL;
+    }
+    block->next = NULL;
+    block->size = size;
+    block->used = 0;
+    return block;
+}
+
+/* Free arena block `block` and all following */
+static void arena_blocks_free(struct zint_arena_block *block) {
+    while (block) {
+        struct zint_arena_block *next = block->next;
+        z_free(block);
+        block = next;
+    }
+}
+
+/* Create arena with first block of `size` bytes. Returns NULL on failure */
+INTERNAL struct zint_arena *arena_create(const size_t size) {
+    struct zint_arena *arena;
+
+    if (!(arena = (struct zint_arena *) z_malloc(sizeof(struct zint_arena)))) {
+        return NULL;
+    }
+    if (!(arena->head = arena_block_new(ARENA_ROUND(size)))) {
+        z_free(arena);
+        return NULL;
+    }
+    arena->curr = arena->head;
+    return arena;
+}
+
+/* Free arena and all its blocks */
+INTERNAL void arena_free(struct zint_arena *arena) {
+    if (arena) {
+        arena_blocks_free(arena->head);
+        z_free(arena);
+    }
+}
+
+/* Release all allocations, coalescing blocks into one if grown */
+INTERNAL void arena_reset(struct zint_arena *arena) {
+    if (arena->head->next) {
+        struct zint_arena_block *block;
+        size_t total = 0;
+        for (block = arena->head; block; block = block->next) {
+            total += block->size;
+        }
+        if ((block = arena_block_new(total))) {
+            arena_blocks_free(arena->head);
+            arena->head = block;
+        }
+    }
+    arena->curr = arena->head;
+    arena->head->used = 0;
+}
+
+/* Allocate `size` bytes (aligned), adding a block if necessary. Returns NULL on failure */
+INTERNAL void *arena_alloc(struct zint_arena *arena, const size_t size) {
+    const size_t rounded = ARENA_ROUND(size);
+    struct zint_arena_block *block = arena->curr;
+
+    if (rounded < size) { /* Overflow */
+        return NULL;
+    }
+    for (;;) {
+        if (block->size - block->used >= rounded) {
+            void *ptr = (unsigned char *) block + ARENA_HDR_SIZE + block->used;
+            block->used += rounded;
+            arena->curr = block;
+            return ptr;
+        }
+        if (!block->next) {
+            const size_t new_size = block->size > rounded / 2 ? block->size * 2 : rounded;
+            if (new_size < block->size || !(block->next = arena_block_new(new_size))) {
+                return NULL;
+            }
+        }
+        block = block->next;
+        block->used = 0; /* Blocks beyond `curr` are free */
+    }
+}
+
+/* Scratch buffer of `size` bytes from `symbol`'s arena if any (see `ZBarcode_SetArena()`). Returns NULL if none
+   (or if the arena can't grow), in which case the caller uses `z_alloca()` instead */
+INTERNAL void *z_scratch(struct zint_symbol *symbol, const size_t size) {
+    return symbol->priv->arena ? arena_alloc(symbol->priv->arena, size) : NULL;
+}
+
+/* Zeroed scratch buffer from `symbol`'s arena if any, else from `z_calloc()`. Returns NULL on failure */
+INTERNAL void *z_scratch_calloc(struct zint_symbol *symbol, const size_t nmemb, const size_t size) {
+    void *ptr;
+
+    if (!symbol->priv->arena) {
+        return z_calloc(nmemb, size);
+    }
+    if ((size && nmemb > (size_t) -1 / size) || !(ptr = arena_alloc(symbol->priv->arena, nmemb * size))) {
+        return NULL;
+    }
+    memset(ptr, 0, nmemb * size);
+    return ptr;
+}
+
+/* Free buffer from `z_scratch_calloc()` (no-op if arena) */
+INTERNAL void z_scratch_free(struct zint_symbol *symbol, void *ptr) {
+    if (!symbol->priv->arena) {
+        z_free(ptr);
+    }
+}
+
+#ifdef ZINT_STATS
+/* Returns monotonic time in nanoseconds */
+INTERNAL double stats_now_ns(void) {
+#if defined(_WIN32)
+    static double ns_per_tick = 0.0;
+    LARGE_INTEGER count;
+    if (ns_per_tick == 0.0) {
+        LARGE_INTEGER freq;
+        QueryPerformanceFrequency(&freq);
+        ns_per_tick = 1e9 / (double) freq.QuadPart;
+    }
+    QueryPerformanceCounter(&count);
+    return (double) count.QuadPart * ns_per_tick;
+#elif defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec * 1e9 + (double) ts.tv_nsec;
+#else
+    return (double) clock() * (1e9 / CLOCKS_PER_SEC); /* Processor time, best available */
+#endif
+}
+
+/* Ends timing of all phases begun but not yet ended, e.g. due to an early error return */
+INTERNAL void stats_end_open(struct zint_symbol *symbol) {
+    int phase;
+
+    /* In reverse so that the enclosing ENCODE phase ends last */
+    for (phase = ZINT_PHASE_COUNT - 1; phase >= 0 && symbol->priv->stats_open; phase--) {
+        STATS_END(symbol, phase);
+    }
+}
+#endif /* ZINT_STATS */
+
 #ifdef ZINT_TEST
 /* Dumps hex-formatted codewords in symbol->errtxt (for use in testing) */
 void debug_test_codeword_dump(struct zint_symbol *symbol, const unsigned char *codewords, const int length) {
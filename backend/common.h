@@ -143,20 +143,39 @@ typedef unsigned __int64 uint64_t;
 #  define INTERNAL_DATA
 #endif
 
+/* Internal state of a symbol (`symbol->priv`), allocated along with it by `ZBarcode_Create()` */
+struct zint_symbol_private {
+    unsigned char *modules;     /* Module matrix in use, `encoded_data` unless compact (see `ZBarcode_Module()`) */
+    int module_stride;          /* Bytes per row of `modules` */
+    int module_alloc;           /* Allocated size of `modules` (compact symbols only) */
+    int compact;                /* Set if created by `ZBarcode_Create_Compact()` */
+    unsigned char *cache_key;   /* Cache key of last encode */
+    int cache_key_len;          /* Length of `cache_key` */
+    struct zint_geometry *geometry; /* Set if sizing only, see `ZBarcode_Geometry()` */
+    struct zint_arena *arena;   /* Scratch arena if set by `ZBarcode_SetArena()` */
+#ifdef ZINT_STATS
+    double stats_start_ns[ZINT_PHASE_COUNT]; /* Start time of each phase being timed for `symbol->stats` */
+    unsigned int stats_open;    /* Bit-flags of phases begun but not yet ended */
+#endif
+};
+
 #define Z_COMMON_INLINE   1
 
 #ifdef Z_COMMON_INLINE
 /* Returns true (1) if a module is dark/black, otherwise false (0) */
-#  define module_is_set(s, y, x) (((s)->encoded_data[(y)][(x) >> 3] >> ((x) & 0x07)) & 1)
+#  define module_is_set(s, y, x) \
+    (((s)->priv->modules[(y) * (s)->priv->module_stride + ((x) >> 3)] >> ((x) & 0x07)) & 1)
 
 /* Sets a module to dark/black */
-#  define set_module(s, y, x) do { (s)->encoded_data[(y)][(x) >> 3] |= 1 << ((x) & 0x07); } while (0)
+#  define set_module(s, y, x) \
+    do { (s)->priv->modules[(y) * (s)->priv->module_stride + ((x) >> 3)] |= 1 << ((x) & 0x07); } while (0)
 
 /* Returns true (1-8) if a module is colour, otherwise false (0) */
-#  define module_colour_is_set(s, y, x) ((s)->encoded_data[(y)][(x)])
+#  define module_colour_is_set(s, y, x) ((s)->priv->modules[(y) * (s)->priv->module_stride + (x)])
 
 /* Sets a module to a colour */
-#  define set_module_colour(s, y, x, c) do { (s)->encoded_data[(y)][(x)] = (c); } while (0)
+#  define set_module_colour(s, y, x, c) \
+    do { (s)->priv->modules[(y) * (s)->priv->module_stride + (x)] = (c); } while (0)
 #endif
 
 /* Converts a character 0-9, A-F to its equivalent integer value */
@@ -193,6 +212,20 @@ INTERNAL int posn(const char set_string[], const char data);
   `bin_posn`. Returns `bin_posn` + `length` */
 INTERNAL int bin_append_posn(const int arg, const int length, char *binary, const int bin_posn);
 
+/* Number of bytes needed to hold `n` packed bits */
+#define BITS_SIZE(n) (((n) + 7) >> 3)
+
+/* Places the `length` (<= 24) least significant bits of `arg` in packed (most significant bit first) `bits` at
+   bit position `bit_posn`, overwriting any previous bits there. Returns `bit_posn` + `length` */
+INTERNAL int bits_append_posn(const unsigned int arg, const int length, unsigned char *bits, const int bit_posn);
+
+/* Returns the `length` (<= 24) bits at bit position `bit_posn` in packed (most significant bit first) `bits` */
+INTERNAL unsigned int bits_get_posn(const unsigned char *bits, const int bit_posn, const int length);
+
+/* Formats the first `length` bits of packed `bits` as '0'/'1' characters into `buf`, which should be at least
+   `length` + 1 chars in size (for debug output) */
+INTERNAL char *bits_dump(const unsigned char *bits, const int length, char *buf);
+
 
 #ifndef Z_COMMON_INLINE
 /* Returns true (1) if a module is dark/black, otherwise false (0) */
@@ -256,6 +289,10 @@ INTERNAL int set_height(struct zint_symbol *symbol, const float min_row_height,
                 const float max_height, const int set_errtxt);
 
 
+/* Sizing only (`symbol->priv->geometry` set, see `ZBarcode_Geometry()`): sets symbol to `size` x `size` matrix
+   without placing modules, and records `version` and `ecc_level` */
+INTERNAL void set_geometry(struct zint_symbol *symbol, const int size, const int version, const int ecc_level);
+
 /* Removes excess precision from floats - see https://stackoverflow.com/q/503436 */
 INTERNAL float stripf(const float arg);
 
@@ -278,6 +315,79 @@ INTERNAL int colour_to_green(const int colour);
 INTERNAL int colour_to_blue(const int colour);
 
 
+/* Heap allocation through any allocator set by `ZBarcode_SetAllocator()`, else the standard library */
+INTERNAL void *z_malloc(const size_t size);
+INTERNAL void *z_calloc(const size_t nmemb, const size_t size);
+INTERNAL void *z_realloc(void *ptr, const size_t size);
+INTERNAL void z_free(void *ptr);
+
+/* Set the allocator used by the above (all NULL for the standard library). Returns 0 on success, 1 if only some
+   NULL */
+INTERNAL int z_set_allocator(void *(*malloc_fn)(size_t), void *(*realloc_fn)(void *, size_t),
+            void (*free_fn)(void *));
+
+
+/* Per-symbol scratch arena, see `ZBarcode_SetArena()` */
+struct zint_arena_block;
+struct zint_arena {
+    struct zint_arena_block *head; /* First block */
+    struct zint_arena_block *curr; /* Block being allocated from */
+};
+
+/* Create arena with first block of `size` bytes. Returns NULL on failure */
+INTERNAL struct zint_arena *arena_create(const size_t size);
+
+/* Free arena and all its blocks */
+INTERNAL void arena_free(struct zint_arena *arena);
+
+/* Release all allocations, coalescing blocks into one if grown */
+INTERNAL void arena_reset(struct zint_arena *arena);
+
+/* Allocate `size` bytes (aligned), adding a block if necessary. Returns NULL on failure */
+INTERNAL void *arena_alloc(struct zint_arena *arena, const size_t size);
+
+/* Scratch buffer of `size` bytes from `symbol`'s arena if any (see `ZBarcode_SetArena()`). Returns NULL if none
+   (or if the arena can't grow), in which case the caller uses `z_alloca()` instead */
+INTERNAL void *z_scratch(struct zint_symbol *symbol, const size_t size);
+
+/* Zeroed scratch buffer from `symbol`'s arena if any, else from `z_calloc()`. Returns NULL on failure */
+INTERNAL void *z_scratch_calloc(struct zint_symbol *symbol, const size_t nmemb, const size_t size);
+
+/* Free buffer from `z_scratch_calloc()` (no-op if arena) */
+INTERNAL void z_scratch_free(struct zint_symbol *symbol, void *ptr);
+
+
+/* Per-phase timing of `symbol->stats` (see `struct zint_stats` in "zint.h"), compiled out unless ZINT_STATS */
+#ifdef ZINT_STATS
+/* Returns monotonic time in nanoseconds */
+INTERNAL double stats_now_ns(void);
+
+/* Ends timing of all phases begun but not yet ended, e.g. due to an early error return */
+INTERNAL void stats_end_open(struct zint_symbol *symbol);
+
+#define STATS_BEGIN(symbol, phase) \
+    do { \
+        if ((symbol)->stats) { \
+            (symbol)->priv->stats_start_ns[phase] = stats_now_ns(); \
+            (symbol)->priv->stats_open |= 1 << (phase); \
+        } \
+    } while (0)
+#define STATS_END(symbol, phase) \
+    do { \
+        if ((symbol)->stats && ((symbol)->priv->stats_open & (1 << (phase)))) { \
+            (symbol)->stats->ns[phase] += stats_now_ns() - (symbol)->priv->stats_start_ns[phase]; \
+            (symbol)->stats->calls[phase]++; \
+            (symbol)->priv->stats_open &= ~(1 << (phase)); \
+        } \
+    } while (0)
+#define STATS_SET(symbol, field, value) do { if ((symbol)->stats) (symbol)->stats->field = (value); } while (0)
+#else
+#define STATS_BEGIN(symbol, phase) do { } while (0)
+#define STATS_END(symbol, phase) do { } while (0)
+#define STATS_SET(symbol, field, value) do { } while (0)
+#endif /* ZINT_STATS */
+
+
 #ifdef ZINT_TEST
 /* Dumps hex-formatted codewords in symbol->errtxt (for use in testing) */
 INTERNAL void debug_test_codeword_dump(struct zint_symbol *symbol, const unsigned char *codewords, const int length);
@@ -1227,6 +1227,7 @@ static int cc_binary_string(struct zint_symbol *symbol, const unsigned char sour
 /* Calculate the width of the linear part (primary) */
 static int linear_dummy_run(int input_mode, unsigned char *source, const int length, const int debug, char *errtxt) {
     struct zint_symbol dummy = {0};
+    struct zint_symbol_private dummy_priv = {0};
     int error_number;
     int linear_width;
 
@@ -1234,6 +1235,9 @@ static int linear_dummy_run(int input_mode, unsigned char *source, const int len
     dummy.option_1 = -1;
     dummy.input_mode = input_mode;
     dummy.debug = debug;
+    dummy.priv = &dummy_priv;
+    dummy.priv->modules = dummy.encoded_data[0];
+    dummy.priv->module_stride = (int) sizeof(dummy.encoded_data[0]);
     error_number = gs1_128_cc(&dummy, source, length, 3 /*cc_mode*/, 0 /*cc_rows*/);
     linear_width = dummy.width;
     if (error_number >= ZINT_ERROR || (debug & ZINT_DEBUG_TEST)) {
@@ -166,34 +166,32 @@ static void dm_placement(int *array, const int NR, const int NC) {
 
 /* calculate and append ecc code, and if necessary interleave */
 static void dm_ecc(unsigned char *binary, const int bytes, const int datablock, const int rsblock, const int skew) {
-    int blocks = (bytes + 2) / datablock, b;
-    int rsblocks = rsblock * blocks;
-    int n;
+    const int blocks = (bytes + 2) / datablock;
+    const int long_blocks = bytes % blocks; /* Blocks with an extra data codeword */
+    int b, b_end;
     rs_t rs;
 
     rs_init_gf(&rs, 0x12d);
     rs_init_code(&rs, rsblock, 1);
-    for (b = 0; b < blocks; b++) {
-        unsigned char buf[256], ecc[256];
-        int p = 0;
-        for (n = b; n < bytes; n += blocks)
-            buf[p++] = binary[n];
-        rs_encode(&rs, p, buf, ecc);
-        p = rsblock - 1; /* comes back reversed */
-        for (n = b; n < rsblocks; n += blocks) {
-            if (skew) {
-                /* Rotate ecc data to make 144x144 size symbols acceptable */
-                /* See http://groups.google.com/group/postscriptbarcode/msg/5ae8fda7757477da
-                   or https://github.com/nu-book/zxing-cpp/issues/259 */
-                if (b < 8) {
-                    binary[bytes + n + 2] = ecc[p--];
-                } else {
-                    binary[bytes + n - 8] = ecc[p--];
-                }
+
+    /* Encode each run of blocks with the same data length and ECC offset straight from and to their interleaved
+       positions */
+    for (b = 0; b < blocks; b = b_end) {
+        int offset = 0;
+        b_end = b < long_blocks ? long_blocks : blocks;
+        if (skew) {
+            /* Rotate ecc data to make 144x144 size symbols acceptable */
+            /* See http://groups.google.com/group/postscriptbarcode/msg/5ae8fda7757477da
+               or https://github.com/nu-book/zxing-cpp/issues/259 */
+            if (b < 8) {
+                b_end = b_end < 8 ? b_end : 8;
+                offset = 2;
             } else {
-                binary[bytes + n] = ecc[p--];
+                offset = -8;
             }
         }
+        rs_encode_blocks(&rs, b_end - b, bytes / blocks + (b < long_blocks), binary + b, 1 /*data_block_step*/,
+                        blocks /*data_step*/, binary + bytes + b + offset, 1 /*res_block_step*/, blocks /*res_step*/);
     }
 }
 
@@ -580,6 +578,15 @@ static int dm_edi_buffer_xfer(int process_buffer[8], int process_p, unsigned cha
     return process_p;
 }
 
+/* Return version (as `option_2`) of symbol size index `symbolsize` */
+static int dm_version(const int symbolsize) {
+    int i;
+
+    for (i = 0; i < DMSIZESCOUNT && dm_intsymbol[i] != symbolsize; i++);
+
+    return i + 1;
+}
+
 /* Get index of symbol size in codewords array `dm_matrixbytes`, as specified or
    else smallest containing `minimum` codewords */
 static int dm_get_symbolsize(struct zint_symbol *symbol, const int minimum) {
@@ -978,7 +985,8 @@ static int dm_define_mode(struct zint_symbol *symbol, char modes[], const unsign
     int current_mode;
     int mode_end, mode_len;
 
-    struct dm_edge *edges = (struct dm_edge *) calloc((length + 1) * DM_NUM_MODES, sizeof(struct dm_edge));
+    struct dm_edge *edges = (struct dm_edge *) z_scratch_calloc(symbol, (length + 1) * DM_NUM_MODES,
+                                                                sizeof(struct dm_edge));
     if (!edges) {
         return 0;
     }
@@ -1039,7 +1047,7 @@ static int dm_define_mode(struct zint_symbol *symbol, char modes[], const unsign
     }
     assert(mode_end == 0);
 
-    free(edges);
+    z_scratch_free(symbol, edges);
 
     return 1;
 }
@@ -1054,14 +1062,20 @@ static int dm_minimalenc(struct zint_symbol *symbol, const unsigned char source[
     int current_mode = *p_current_mode;
     int last_ascii, symbols_left;
     int i;
-    char *modes = (char *) z_alloca(length);
+    char *modes;
+
+    if (!(modes = (char *) z_scratch(symbol, length))) {
+        modes = (char *) z_alloca(length);
+    }
 
     assert(length <= 10921); /* Can only handle (10921 + 1) * 6 = 65532 < 65536 (2*16) due to sizeof(previous) */
 
+    STATS_BEGIN(symbol, ZINT_PHASE_MODE);
     if (!dm_define_mode(symbol, modes, source, length, gs1, debug_print)) {
         strcpy(symbol->errtxt, "728: Insufficient memory for mode buffers");
         return ZINT_ERROR_MEMORY;
     }
+    STATS_END(symbol, ZINT_PHASE_MODE);
 
     while (sp < length) {
 
@@ -1866,6 +1880,12 @@ static int dm_ecc200(struct zint_symbol *symbol, struct zint_seg segs[], const i
         return ZINT_ERROR_TOO_LONG;
     }
 
+    if (symbol->priv->geometry) { /* Sizing only, so skip padding, ECC and placement */
+        set_geometry(symbol, dm_matrixH[symbolsize], dm_version(symbolsize), -1 /*ecc_level*/);
+        symbol->width = dm_matrixW[symbolsize]; /* May be rectangular */
+        return error_number;
+    }
+
     H = dm_matrixH[symbolsize];
     W = dm_matrixW[symbolsize];
     FH = dm_matrixFH[symbolsize];
@@ -1889,7 +1909,10 @@ static int dm_ecc200(struct zint_symbol *symbol, struct zint_seg segs[], const i
     if (symbolsize == INTSYMBOL144) {
         skew = 1;
     }
+    STATS_BEGIN(symbol, ZINT_PHASE_RS);
     dm_ecc(binary, bytes, datablock, rsblock, skew);
+    STATS_END(symbol, ZINT_PHASE_RS);
+    STATS_SET(symbol, version, dm_version(symbolsize));
     if (debug_print) {
         printf("ECC (%d): ", rsblock * (bytes / datablock));
         for (i = bytes; i < bytes + rsblock * (bytes / datablock); i++) printf("%d ", binary[i]);
@@ -1905,7 +1928,7 @@ static int dm_ecc200(struct zint_symbol *symbol, struct zint_seg segs[], const i
         const int NC = W - 2 * (W / FW);
         const int NR = H - 2 * (H / FH);
         int x, y, *places;
-        if (!(places = (int *) calloc(NC * NR, sizeof(int)))) {
+        if (!(places = (int *) z_scratch_calloc(symbol, NC * NR, sizeof(int)))) {
             strcpy(symbol->errtxt, "718: Insufficient memory for placement array");
             return ZINT_ERROR_MEMORY;
         }
@@ -1944,7 +1967,7 @@ static int dm_ecc200(struct zint_symbol *symbol, struct zint_seg segs[], const i
         for (y = 0; y < H; y++) {
             symbol->row_height[y] = 1;
         }
-        free(places);
+        z_scratch_free(symbol, places);
     }
 
     symbol->height = H;
@@ -1969,4 +1992,28 @@ INTERNAL int datamatrix(struct zint_symbol *symbol, struct zint_seg segs[], cons
     return error_number;
 }
 
+/* Return the maximum number of characters of `char_type` (ZINT_CAPACITY_XXX) that Data Matrix can hold at size
+   `option_2`, or 0 if not supported (`ZBarcode_Capacity()`) */
+INTERNAL int dm_capacity(const int option_1, const int option_2, const int char_type) {
+    int cw;
+
+    if (option_1 > 1 || option_2 < 0 || option_2 > DMSIZESCOUNT) {
+        return 0;
+    }
+    cw = dm_matrixbytes[option_2 ? dm_intsymbol[option_2 - 1] : DMSIZESCOUNT - 1];
+
+    switch (char_type) {
+        case ZINT_CAPACITY_NUMERIC: /* ASCII digit pairs */
+            return cw * 2;
+            break;
+        case ZINT_CAPACITY_ALPHANUMERIC: /* C40 latch then 3 per 2 codewords, final odd codeword ASCII */
+            return ((cw - 1) / 2) * 3 + ((cw - 1) & 1);
+            break;
+        case ZINT_CAPACITY_BYTE: /* Base 256 latch and field length (0 meaning to end of symbol) */
+            return cw - 2;
+            break;
+    }
+    return 0;
+}
+
 /* vim: set ts=4 sw=4 et : */
@@ -1031,16 +1031,16 @@ static int dc_encode_message_segs(struct zint_symbol *symbol, const struct zint_
 }
 
 /* Convert codewords to binary data stream */
-static int dc_make_dotstream(const unsigned char masked_array[], const int array_length, char dot_stream[]) {
+static int dc_make_dotstream(const unsigned char masked_array[], const int array_length, unsigned char dot_stream[]) {
     int i;
     int bp = 0;
 
     /* Mask value is encoded as two dots */
-    bp = bin_append_posn(masked_array[0], 2, dot_stream, bp);
+    bp = bits_append_posn(masked_array[0], 2, dot_stream, bp);
 
     /* The rest of the data uses 9-bit dot patterns from Annex C */
     for (i = 1; i < array_length; i++) {
-        bp = bin_append_posn(dc_dot_patterns[masked_array[i]], 9, dot_stream, bp);
+        bp = bits_append_posn(dc_dot_patterns[masked_array[i]], 9, dot_stream, bp);
     }
 
     return bp;
@@ -1089,8 +1089,11 @@ static int dc_is_corner(const int column, const int row, const int width, const
     return 0;
 }
 
+/* Returns the dot at `position` in packed `dot_stream` as '1' or '0' */
+#define DC_DOT(position) (bits_get_posn(dot_stream, (position), 1) ? '1' : '0')
+
 /* Place the dots in the symbol*/
-static void dc_fold_dotstream(const char dot_stream[], const int width, const int height, char dot_array[]) {
+static void dc_fold_dotstream(const unsigned char dot_stream[], const int width, const int height, char dot_array[]) {
     int column, row;
     int position = 0;
 
@@ -1102,7 +1105,7 @@ static void dc_fold_dotstream(const char dot_stream[], const int width, const in
                     if (dc_is_corner(column, row, width, height)) {
                         dot_array[(row * width) + column] = 'C';
                     } else {
-                        dot_array[((height - row - 1) * width) + column] = dot_stream[position++];
+                        dot_array[((height - row - 1) * width) + column] = DC_DOT(position++);
                     }
                 } else {
                     dot_array[((height - row - 1) * width) + column] = ' '; /* Non-data position */
@@ -1111,12 +1114,12 @@ static void dc_fold_dotstream(const char dot_stream[], const int width, const in
         }
 
         /* Corners */
-        dot_array[width - 2] = dot_stream[position++];
-        dot_array[(height * width) - 2] = dot_stream[position++];
-        dot_array[(width * 2) - 1] = dot_stream[position++];
-        dot_array[((height - 1) * width) - 1] = dot_stream[position++];
-        dot_array[0] = dot_stream[position++];
-        dot_array[(height - 1) * width] = dot_stream[position];
+        dot_array[width - 2] = DC_DOT(position++);
+        dot_array[(height * width) - 2] = DC_DOT(position++);
+        dot_array[(width * 2) - 1] = DC_DOT(position++);
+        dot_array[((height - 1) * width) - 1] = DC_DOT(position++);
+        dot_array[0] = DC_DOT(position++);
+        dot_array[(height - 1) * width] = DC_DOT(position);
     } else {
         /* Vertical folding */
         for (column = 0; column < width; column++) {
@@ -1125,7 +1128,7 @@ static void dc_fold_dotstream(const char dot_stream[], const int width, const in
                     if (dc_is_corner(column, row, width, height)) {
                         dot_array[(row * width) + column] = 'C';
                     } else {
-                        dot_array[(row * width) + column] = dot_stream[position++];
+                        dot_array[(row * width) + column] = DC_DOT(position++);
                     }
                 } else {
                     dot_array[(row * width) + column] = ' '; /* Non-data position */
@@ -1134,15 +1137,17 @@ static void dc_fold_dotstream(const char dot_stream[], const int width, const in
         }
 
         /* Corners */
-        dot_array[((height - 1) * width) - 1] = dot_stream[position++];
-        dot_array[(height - 2) * width] = dot_stream[position++];
-        dot_array[(height * width) - 2] = dot_stream[position++];
-        dot_array[((height - 1) * width) + 1] = dot_stream[position++];
-        dot_array[width - 1] = dot_stream[position++];
-        dot_array[0] = dot_stream[position];
+        dot_array[((height - 1) * width) - 1] = DC_DOT(position++);
+        dot_array[(height - 2) * width] = DC_DOT(position++);
+        dot_array[(height * width) - 2] = DC_DOT(position++);
+        dot_array[((height - 1) * width) + 1] = DC_DOT(position++);
+        dot_array[width - 1] = DC_DOT(position++);
+        dot_array[0] = DC_DOT(position);
     }
 }
 
+#undef DC_DOT
+
 static void dc_apply_mask(const int mask, const int data_length, unsigned char *masked_codeword_array,
             const unsigned char *codeword_array, const int ecc_length) {
     int weight = 0;
@@ -1224,7 +1229,7 @@ INTERNAL int dotcode(struct zint_symbol *symbol, struct zint_seg segs[], const i
        + 5 (Structured Append) + 10 (PAD) */
     const int codeword_array_len = segs_length(segs, seg_count) * 4 + 2 + seg_count * 4 + 2 + 5 + 10;
     unsigned char *codeword_array = (unsigned char *) z_alloca(codeword_array_len);
-    char *dot_stream;
+    unsigned char *dot_stream;
     char *dot_array;
     unsigned char *masked_codeword_array;
 
@@ -1357,7 +1362,7 @@ INTERNAL int dotcode(struct zint_symbol *symbol, struct zint_seg segs[], const i
 
     n_dots = (height * width) / 2;
 
-    dot_stream = (char *) z_alloca(height * width * 3);
+    dot_stream = (unsigned char *) z_alloca(BITS_SIZE(height * width * 3));
     dot_array = (char *) z_alloca(width * height);
 
     /* Add pad characters */
@@ -1435,7 +1440,7 @@ INTERNAL int dotcode(struct zint_symbol *symbol, struct zint_seg segs[], const i
 
             /* Add pad bits */
             for (jc = dot_stream_length; jc < n_dots; jc++) {
-                dot_stream[dot_stream_length++] = '1';
+                dot_stream_length = bits_append_posn(1, 1, dot_stream, dot_stream_length);
             }
 
             dc_fold_dotstream(dot_stream, width, height, dot_array);
@@ -1472,7 +1477,7 @@ INTERNAL int dotcode(struct zint_symbol *symbol, struct zint_seg segs[], const i
 
                 /* Add pad bits */
                 for (jc = dot_stream_length; jc < n_dots; jc++) {
-                    dot_stream[dot_stream_length++] = '1';
+                    dot_stream_length = bits_append_posn(1, 1, dot_stream, dot_stream_length);
                 }
 
                 dc_fold_dotstream(dot_stream, width, height, dot_array);
@@ -1519,9 +1524,12 @@ INTERNAL int dotcode(struct zint_symbol *symbol, struct zint_seg segs[], const i
 
     /* Add pad bits */
     for (jc = dot_stream_length; jc < n_dots; jc++) {
-        dot_stream[dot_stream_length++] = '1';
+        dot_stream_length = bits_append_posn(1, 1, dot_stream, dot_stream_length);
+    }
+    if (debug_print) {
+        printf("Binary (%d): %s\n", dot_stream_length,
+                bits_dump(dot_stream, dot_stream_length, (char *) z_alloca(dot_stream_length + 1)));
     }
-    if (debug_print) printf("Binary (%d): %.*s\n", dot_stream_length, dot_stream_length, dot_stream);
 
     dc_fold_dotstream(dot_stream, width, height, dot_array);
 
@@ -43,67 +43,15 @@
 
 /* Single-byte stuff */
 
-/* Base ISO/IEC 8859 routine to convert Unicode codepoint `u` */
-static int u_iso8859(const unsigned int u, const unsigned short *tab_s, const unsigned short *tab_u,
-            const unsigned char *tab_sb, int e, unsigned char *dest) {
-    int s;
-    if (u < 0xA0) {
-        if (u >= 0x80) { /* U+0080-9F fail */
-            return 0;
-        }
-        *dest = (unsigned char) u;
-        return 1;
-    }
-    if (u <= 0xFF) {
-        const unsigned int u2 = u - 0xA0;
-        if (tab_s[u2 >> 4] & ((unsigned short) 1 << (u2 & 0xF))) {
-            *dest = (unsigned char) u; /* Straight-thru */
-            return 1;
-        }
-    }
-
-    s = 0;
-    while (s <= e) {
-        const int m = (s + e) >> 1;
-        if (tab_u[m] < u) {
-            s = m + 1;
-        } else if (tab_u[m] > u) {
-            e = m - 1;
-        } else {
-            *dest = tab_sb[m];
-            return 1;
-        }
-    }
-    return 0;
-}
-
-/* Base Windows-125x routine to convert Unicode codepoint `u` */
-static int u_cp125x(const unsigned int u, const unsigned short *tab_s, const unsigned short *tab_u,
-            const unsigned char *tab_sb, int e, unsigned char *dest) {
-    int s;
+/* Base single-byte ISO/IEC 8859 & Windows-125x routine to convert Unicode codepoint `u`, looking up the block of
+   64 codepoints in `tab_ind` (size `ind_size`) */
+static int u_sb(const unsigned int u, const unsigned char *tab_ind, const int ind_size, unsigned char *dest) {
     if (u < 0x80) {
         *dest = (unsigned char) u;
         return 1;
     }
-    if (u <= 0xFF && u >= 0xA0) {
-        const unsigned int u2 = u - 0xA0;
-        if (tab_s[u2 >> 4] & ((unsigned short) 1 << (u2 & 0xF))) {
-            *dest = (unsigned char) u; /* Straight-thru */
-            return 1;
-        }
-    }
-
-    s = 0;
-    while (s <= e) {
-        const int m = (s + e) >> 1;
-        if (tab_u[m] < u) {
-            s = m + 1;
-        } else if (tab_u[m] > u) {
-            e = m - 1;
-        } else {
-            *dest = tab_sb[m];
-            return 1;
-        }
+    if ((int) (u >> 6) < ind_size && (*dest = eci_sb_blocks[tab_ind[u >> 6]][u & 0x3F])) {
+        return 1;
     }
     return 0;
 }
@@ -185,10 +133,10 @@ static int u_utf32le(const unsigned int u, unsigned char *dest) {
 
 /* Acknowledgements to Bruno Haible <bruno@clisp.org> for a no. of techniques used here */
 
-/* Helper to lookup Unicode codepoint `u` in the URO (Unified Repertoire and Ordering) block (U+4E00-9FFF) */
-static int eci_u_lookup_uro_int(const unsigned int u, const unsigned short *tab_u, const unsigned short *tab_mb_ind,
-            const unsigned short *tab_mb, unsigned int *d) {
-    unsigned int u2 = (u - 0x4E00) >> 4; /* Blocks of 16 */
+/* Helper to lookup the codepoint at bit `u & 0xF` of block `u2` of bit-flags `tab_u`, setting `*d` from `tab_mb` at
+   `tab_mb_ind[u2]` offset by the no. of bits set before it. Returns 0 if not set */
+static int eci_u_lookup_bits_int(const unsigned int u, const unsigned int u2, const unsigned short *tab_u,
+            const unsigned short *tab_mb_ind, const unsigned short *tab_mb, unsigned int *d) {
     unsigned int v = (unsigned int) 1 << (u & 0xF);
     if ((tab_u[u2] & v) == 0) {
         return 0;
@@ -199,7 +147,23 @@ static int eci_u_lookup_uro_int(const unsigned int u, const unsigned short *tab_
     v = (v & 0x33333333) + ((v >> 2) & 0x33333333);
     v = (((v + (v >> 4)) & 0xF0F0F0F) * 0x1010101) >> 24;
     *d = tab_mb[tab_mb_ind[u2] + v];
-    return 2;
+    return 1;
+}
+
+/* Helper to lookup Unicode codepoint `u` in the URO (Unified Repertoire and Ordering) block (U+4E00-9FFF) */
+static int eci_u_lookup_uro_int(const unsigned int u, const unsigned short *tab_u, const unsigned short *tab_mb_ind,
+            const unsigned short *tab_mb, unsigned int *d) {
+    return eci_u_lookup_bits_int(u, (u - 0x4E00) >> 4 /* Blocks of 16 */, tab_u, tab_mb_ind, tab_mb, d) ? 2 : 0;
+}
+
+/* Helper to lookup BMP Unicode codepoint `u` outside the URO block via its page (U+xx00-xxFF) in `tab_page`, then
+   as for the URO block. Returns 1 if found, 0 if not */
+static int eci_u_lookup_page_int(const unsigned int u, const unsigned char *tab_page, const unsigned short *tab_u,
+            const unsigned short *tab_mb_ind, const unsigned short *tab_mb, unsigned int *d) {
+    if (u > 0xFFFF || tab_page[u >> 8] == 0) {
+        return 0;
+    }
+    return eci_u_lookup_bits_int(u, ((tab_page[u >> 8] - 1) << 4) | ((u >> 4) & 0xF), tab_u, tab_mb_ind, tab_mb, d);
 }
 
 /* Version of `eci_u_lookup_uro_int()` taking unsigned char destination */
@@ -217,13 +181,12 @@ static int eci_u_lookup_uro(const unsigned int u, const unsigned short *tab_u, c
 /* ECI 20 Shift JIS */
 static int u_sjis_int(const unsigned int u, unsigned int *d) {
     unsigned int u2, dv, md;
-    int s, e;
 
     if (u < 0x80 && u != 0x5C && u != 0x7E) { /* Backslash & tilde re-mapped according to JIS X 0201 Roman */
         *d = u;
         return 1;
     }
-    /* Special case URO block sequential mappings (considerably lessens size of `sjis_u[]` array) */
+    /* Special case URO block sequential mappings (considerably lessens size of `sjis_page_u[]` array) */
     if (u >= 0x4E00 && u <= 0xDFFF) { /* 0xE000 next used value >= 0x4E00 */
         if (u >= 0x9FB0) {
             return 0;
@@ -238,20 +201,8 @@ static int u_sjis_int(const unsigned int u, unsigned int *d) {
         *d = ((dv + 0xF0) << 8) | (md + 0x40 + (md >= 0x3F));
         return 2;
     }
-    if (u >= sjis_u[0] && u <= sjis_u[ARRAY_SIZE(sjis_u) - 1]) {
-        s = 0;
-        e = ARRAY_SIZE(sjis_u) - 1;
-        while (s <= e) {
-            const int m = (s + e) >> 1;
-            if (sjis_u[m] < u) {
-                s = m + 1;
-            } else if (sjis_u[m] > u) {
-                e = m - 1;
-            } else {
-                *d = sjis_mb[u >= 0x4E00 ? m + 6356 : m]; /* Adjust for URO block */
-                return 1 + (*d > 0xFF);
-            }
-        }
+    if (eci_u_lookup_page_int(u, sjis_page, sjis_page_u, sjis_page_mb_ind, sjis_mb, d)) {
+        return 1 + (*d > 0xFF);
     }
     return 0;
 }
@@ -279,35 +230,23 @@ static int u_sjis(const unsigned int u, unsigned char *dest) {
 
 /* ECI 28 Big5 Chinese (Taiwan) */
 static int u_big5(const unsigned int u, unsigned char *dest) {
-    int s, e;
+    unsigned int d;
 
     if (u < 0x80) {
         *dest = (unsigned char) u;
         return 1;
     }
-    /* Special case URO block sequential mappings (considerably lessens size of `big5_u[]` array) */
+    /* Special case URO block sequential mappings (considerably lessens size of `big5_page_u[]` array) */
     if (u >= 0x4E00 && u <= 0xFA0B) { /* 0xFA0C next used value >= 0x4E00 */
         if (u >= 0x9FB0) {
             return 0;
         }
         return eci_u_lookup_uro(u, big5_uro_u, big5_uro_mb_ind, big5_mb, dest);
     }
-    if (u >= big5_u[0] && u <= big5_u[ARRAY_SIZE(big5_u) - 1]) {
-        s = 0;
-        e = ARRAY_SIZE(big5_u) - 1;
-        while (s <= e) {
-            const int m = (s + e) >> 1;
-            if (big5_u[m] < u) {
-                s = m + 1;
-            } else if (big5_u[m] > u) {
-                e = m - 1;
-            } else {
-                const unsigned short mb = big5_mb[u >= 0x4E00 ? m + 13061 : m]; /* Adjust for URO block */
-                dest[0] = (unsigned char) (mb >> 8);
-                dest[1] = (unsigned char) mb;
-                return 2;
-            }
-        }
+    if (eci_u_lookup_page_int(u, big5_page, big5_page_u, big5_page_mb_ind, big5_mb, &d)) {
+        dest[0] = (unsigned char) (d >> 8);
+        dest[1] = (unsigned char) d;
+        return 2;
     }
     return 0;
 }
@@ -320,35 +259,23 @@ INTERNAL int u_big5_test(const unsigned int u, unsigned char *dest) {
 
 /* ECI 30 EUC-KR (KS X 1001, formerly KS C 5601) Korean */
 static int u_ksx1001(const unsigned int u, unsigned char *dest) {
-    int s, e;
+    unsigned int d;
 
     if (u < 0x80) {
         *dest = (unsigned char) u;
         return 1;
     }
-    /* Special case URO block sequential mappings (considerably lessens size of `ksx1001_u[]` array) */
+    /* Special case URO block sequential mappings (considerably lessens size of `ksx1001_page_u[]` array) */
     if (u >= 0x4E00 && u <= 0xABFF) { /* 0xAC00 next used value >= 0x4E00 */
         if (u >= 0x9FA0) {
             return 0;
         }
         return eci_u_lookup_uro(u, ksx1001_uro_u, ksx1001_uro_mb_ind, ksx1001_mb, dest);
     }
-    if (u >= ksx1001_u[0] && u <= ksx1001_u[ARRAY_SIZE(ksx1001_u) - 1]) {
-        s = ksx1001_u_ind[(u - ksx1001_u[0]) >> 8];
-        e = s + 0x100 > ARRAY_SIZE(ksx1001_u) ? ARRAY_SIZE(ksx1001_u) - 1 : s + 0x100 - 1;
-        while (s <= e) {
-            const int m = (s + e) >> 1;
-            if (ksx1001_u[m] < u) {
-                s = m + 1;
-            } else if (ksx1001_u[m] > u) {
-                e = m - 1;
-            } else {
-                const unsigned short mb = ksx1001_mb[u >= 0x4E00 ? m + 4620 : m]; /* Adjust for URO block */
-                dest[0] = (unsigned char) (mb >> 8);
-                dest[1] = (unsigned char) mb;
-                return 2;
-            }
-        }
+    if (eci_u_lookup_page_int(u, ksx1001_page, ksx1001_page_u, ksx1001_page_mb_ind, ksx1001_mb, &d)) {
+        dest[0] = (unsigned char) (d >> 8);
+        dest[1] = (unsigned char) d;
+        return 2;
     }
     return 0;
 }
@@ -361,33 +288,19 @@ INTERNAL int u_ksx1001_test(const unsigned int u, unsigned char *dest) {
 
 /* ECI 29 GB 2312 Chinese (PRC) */
 static int u_gb2312_int(const unsigned int u, unsigned int *d) {
-    int s, e;
-
     if (u < 0x80) {
         *d = u;
         return 1;
     }
-    /* Special case URO block sequential mappings (considerably lessens size of `gb2312_u[]` array) */
+    /* Special case URO block sequential mappings (considerably lessens size of `gb2312_page_u[]` array) */
     if (u >= 0x4E00 && u <= 0x9E1E) { /* 0x9E1F next used value >= 0x4E00 */
         if (u >= 0x9CF0) {
             return 0;
         }
         return eci_u_lookup_uro_int(u, gb2312_uro_u, gb2312_uro_mb_ind, gb2312_mb, d);
     }
-    if (u >= gb2312_u[0] && u <= gb2312_u[ARRAY_SIZE(gb2312_u) - 1]) {
-        s = gb2312_u_ind[(u - gb2312_u[0]) >> 8];
-        e = s + 0x100 > ARRAY_SIZE(gb2312_u) ? ARRAY_SIZE(gb2312_u) - 1 : s + 0x100 - 1;
-        while (s <= e) {
-            const int m = (s + e) >> 1;
-            if (gb2312_u[m] < u) {
-                s = m + 1;
-            } else if (gb2312_u[m] > u) {
-                e = m - 1;
-            } else {
-                *d = gb2312_mb[u > 0x4E00 ? m + 6627 : m]; /* Adjust for URO block */
-                return 2;
-            }
-        }
+    if (eci_u_lookup_page_int(u, gb2312_page, gb2312_page_u, gb2312_page_mb_ind, gb2312_mb, d)) {
+        return 2;
     }
     return 0;
 }
@@ -415,8 +328,6 @@ static int u_gb2312(const unsigned int u, unsigned char *dest) {
 
 /* ECI 31 GBK Chinese */
 static int u_gbk_int(const unsigned int u, unsigned int *d) {
-    int s, e;
-
     if (u < 0x80) {
         *d = u;
         return 1;
@@ -436,27 +347,15 @@ static int u_gbk_int(const unsigned int u, unsigned int *d) {
         return 2;
     }
 
-    /* Special case URO block sequential mappings (considerably lessens size of `gbk_u[]` array) */
+    /* Special case URO block sequential mappings (considerably lessens size of `gbk_page_u[]` array) */
     if (u >= 0x4E00 && u <= 0xF92B) { /* 0xF92C next used value >= 0x4E00 */
         if (u >= 0x9FB0) {
             return 0;
         }
         return eci_u_lookup_uro_int(u, gbk_uro_u, gbk_uro_mb_ind, gbk_mb, d);
     }
-    if (u >= gbk_u[0] && u <= gbk_u[ARRAY_SIZE(gbk_u) - 1]) {
-        s = 0;
-        e = ARRAY_SIZE(gbk_u) - 1;
-        while (s <= e) {
-            const int m = (s + e) >> 1;
-            if (gbk_u[m] < u) {
-                s = m + 1;
-            } else if (gbk_u[m] > u) {
-                e = m - 1;
-            } else {
-                *d = gbk_mb[u >= 0x4E00 ? m + 14139 : m]; /* Adjust for URO block */
-                return 2;
-            }
-        }
+    if (eci_u_lookup_page_int(u, gbk_page, gbk_page_u, gbk_page_mb_ind, gbk_mb, d)) {
+        return 2;
     }
     return 0;
 }
@@ -555,20 +454,8 @@ static int u_gb18030_int(const unsigned int u, unsigned int *d1, unsigned int *d
         }
         return 2;
     }
-    if (u >= gb18030_2_u[0] && u <= gb18030_2_u[ARRAY_SIZE(gb18030_2_u) - 1]) {
-        s = 0;
-        e = ARRAY_SIZE(gb18030_2_u) - 1;
-        while (s <= e) {
-            const int m = (s + e) >> 1;
-            if (gb18030_2_u[m] < u) {
-                s = m + 1;
-            } else if (gb18030_2_u[m] > u) {
-                e = m - 1;
-            } else {
-                *d1 = gb18030_2_mb[m];
-                return 2;
-            }
-        }
+    if (eci_u_lookup_page_int(u, gb18030_2_page, gb18030_2_page_u, gb18030_2_page_mb_ind, gb18030_2_mb, d1)) {
+        return 2;
     }
     /* All other BMP U+0080-FFFF */
     if (u == 0xE7C7) { /* PUA change to non-PUA, see Table 3-39, Lunde, 2nd ed. */
@@ -764,23 +651,74 @@ INTERNAL int utf8_to_eci(const int eci, const unsigned char source[], unsigned c
     return 0;
 }
 
+/* Bit-flags `1 << ECI` of all the single-byte ECIs 3-24 (i.e. not reserved 14, 19 and multibyte 20) */
+#define ECI_SB_ALL_MASK 0x1E7BFF8
+
+/* Return bit-flags `1 << ECI` of the single-byte ECIs able to encode Unicode codepoint `u`. A direct lookup for
+   U+0000-00FF, but a binary search of the 515 entries of `eci_sb_u` (up to 10 probes) above that */
+static unsigned int eci_sb_mask(const unsigned int u) {
+    int s, e;
+
+    if (u < 0x80) {
+        return ECI_SB_ALL_MASK;
+    }
+    if (u < 0xA0) {
+        return 0;
+    }
+    if (u <= 0xFF) {
+        return eci_sb_latin1_masks[u - 0xA0];
+    }
+    s = 0;
+    e = ARRAY_SIZE(eci_sb_u) - 1;
+    if (u > eci_sb_u[e]) {
+        return 0;
+    }
+    while (s <= e) {
+        const int m = (s + e) >> 1;
+        if (eci_sb_u[m] < u) {
+            s = m + 1;
+        } else if (eci_sb_u[m] > u) {
+            e = m - 1;
+        } else {
+            return eci_sb_masks[m];
+        }
+    }
+    return 0;
+}
+
+/* Return bit-flags `1 << ECI` of the single-byte ECIs (3-24) able to encode all of UTF-8 `source`, decoding each
+   codepoint once (see `eci_sb_mask()` for the per-codepoint cost). Returns 0 if none or if `source` not valid
+   UTF-8 */
+INTERNAL unsigned int get_eci_sb_mask(const unsigned char source[], const int length) {
+    unsigned int mask = ECI_SB_ALL_MASK;
+    unsigned int state = 0, codepoint;
+    int i;
+
+    for (i = 0; i < length && mask; i++) {
+        if (source[i] < 0x80 && state == 0) {
+            continue;
+        }
+        if (decode_utf8(&state, &codepoint, source[i]) == 0) {
+            mask &= eci_sb_mask(codepoint);
+        } else if (state == 12) {
+            return 0;
+        }
+    }
+
+    return state == 0 ? mask : 0;
+}
+
 /* Find the lowest single-byte ECI mode which will encode a given set of Unicode text */
 INTERNAL int get_best_eci(const unsigned char source[], int length) {
-    int eci = 3;
-    /* Note: attempting single-byte conversions only, so get_eci_length() unnecessary */
-    unsigned char *local_source = (unsigned char *) z_alloca(length + 1);
-
-    do {
-        if (eci == 14) { /* Reserved */
-            eci = 15;
-        } else if (eci == 19) { /* Reserved */
-            eci = 21; /* Skip 20 Shift JIS */
-        }
-        if (utf8_to_eci(eci, source, local_source, &length) == 0) {
-            return eci;
+    const unsigned int mask = get_eci_sb_mask(source, length);
+
+    if (mask) {
+        int eci = 3;
+        while (!(mask & (1 << eci))) {
+            eci++;
         }
-        eci++;
-    } while (eci < 25);
+        return eci;
+    }
 
     if (!is_valid_utf8(source, length)) {
         return 0;
@@ -823,6 +761,53 @@ INTERNAL int get_best_eci_segs(struct zint_symbol *symbol, struct zint_seg segs[
     return first_eci_set;
 }
 
+/* Whether UTF-8 `source` can be encoded in the default character set of `symbology` when no ECI is given, i.e.
+   GB 2312 for Grid Matrix, otherwise ISO/IEC 8859-1, or failing that if `single_seg`, Shift JIS for QR Code & rMQR
+   and GB 18030 for Han Xin. Must mirror the defaulting done by those encoders */
+static int is_default_charset(const int symbology, const unsigned char source[], const int length,
+            const int single_seg) {
+    unsigned int state = 0, codepoint, d;
+    int i;
+
+    if (symbology == BARCODE_GRIDMATRIX) {
+        for (i = 0; i < length && source[i] < 0x80; i++);
+    } else {
+        /* Anything beyond ISO/IEC 8859-1 has a UTF-8 lead byte >= 0xC4 */
+        for (i = 0; i < length && source[i] < 0xC4; i++);
+    }
+    if (i == length) {
+        return 1;
+    }
+    if (symbology == BARCODE_HANXIN) {
+        return single_seg; /* GB 18030 covers all of Unicode */
+    }
+    if (symbology == BARCODE_GRIDMATRIX || (single_seg && (symbology == BARCODE_QRCODE
+            || symbology == BARCODE_RMQR))) {
+        for (i = 0; i < length; i++) {
+            if (decode_utf8(&state, &codepoint, source[i]) == 0) {
+                if (symbology == BARCODE_GRIDMATRIX ? !u_gb2312_int(codepoint, &d) : !u_sjis_int(codepoint, &d)) {
+                    return 0;
+                }
+            }
+        }
+        return 1;
+    }
+    return 0;
+}
+
+/* Whether an ECI needs to be added to any of `segs` (ECI 0 in UNICODE_MODE) for `symbology` to encode them, i.e.
+   whether `get_best_eci_segs()` should be called before encoding */
+INTERNAL int is_eci_needed_segs(const int symbology, const struct zint_seg segs[], const int seg_count) {
+    int i;
+
+    for (i = 0; i < seg_count; i++) {
+        if (segs[i].eci == 0 && !is_default_charset(symbology, segs[i].source, segs[i].length, seg_count == 1)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
 /* QRCODE Shift JIS helpers */
 
 /* Convert UTF-8 string to Shift JIS and place in array of ints */
@@ -45,8 +45,10 @@ INTERNAL int get_eci_length_segs(const struct zint_seg segs[], const int seg_cou
 
 INTERNAL int utf8_to_eci(const int eci, const unsigned char source[], unsigned char dest[], int *p_length);
 
+INTERNAL unsigned int get_eci_sb_mask(const unsigned char source[], const int length);
 INTERNAL int get_best_eci(const unsigned char source[], int length);
 INTERNAL int get_best_eci_segs(struct zint_symbol *symbol, struct zint_seg segs[], const int seg_count);
+INTERNAL int is_eci_needed_segs(const int symbology, const struct zint_seg segs[], const int seg_count);
 
 /* QRCODE Shift JIS helpers */
 INTERNAL int sjis_utf8(struct zint_symbol *symbol, const unsigned char source[], int *p_length,
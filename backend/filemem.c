@@ -0,0 +1,435 @@
+/*  filemem.c - buffered output sink for the file writers */
+/*
+    libzint - the open source barcode library
+    Copyright (C) 2023 Robin Stuart <rstuart114@gmail.com>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+    3. Neither the name of the project nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+ */
+/* SPDX-License-Identifier: BSD-3-Clause */
+
+
+#include <assert.h>
+#include <errno.h>
+#include <math.h>
+#include <stdio.h>
+#include "common.h"
+#include "filemem.h"
+#include "output.h"
+
+#define FM_MEM_INIT     0x1000  /* Initial buffer size */
+#define FM_STREAM_CHUNK 0x4000  /* Buffer size at which output is flushed, unless memory file */
+
+/* Whether output is flushed in chunks, i.e. to file (or stdout) or `write_fn`, rather than held whole in memory */
+#define fm_chunked(fmp) ((fmp)->fp || (fmp)->write_fn)
+
+/* Length of output so far, including any flushed */
+static size_t fm_length(const struct filemem *const fmp) {
+    return fmp->flushed + fmp->memend > fmp->outlen ? fmp->flushed + fmp->memend : fmp->outlen;
+}
+
+/* Pass `len` bytes of `ptr` to `write_fn` or write them to the file. Returns 1 on success, 0 on failure */
+static int fm_out(struct filemem *const fmp, const void *ptr, const size_t len) {
+    if (fmp->write_fn) {
+        const int err = fmp->write_fn(fmp->write_ctx, ptr, len);
+        if (err != 0) {
+            fmp->err = err;
+            return 0;
+        }
+    } else if (fwrite(ptr, 1, len, fmp->fp) != len) {
+        fmp->err = errno ? errno : EIO;
+        return 0;
+    }
+    fmp->flushed += len;
+    if (fmp->flushed > fmp->outlen) {
+        fmp->outlen = fmp->flushed;
+    }
+    return 1;
+}
+
+/* Flush the buffer and empty it. Returns 1 on success, 0 on failure */
+static int fm_flush(struct filemem *const fmp) {
+    if (fmp->memend) {
+        if (!fm_out(fmp, fmp->mem, fmp->memend)) {
+            return 0;
+        }
+        fmp->mempos = fmp->memend = 0;
+    }
+    return 1;
+}
+
+/* Make room for `len` more bytes, growing buffer (or if chunked and chunk full, flushing it) if necessary. Returns
+   1 on success, 0 on failure */
+static int fm_reserve(struct filemem *const fmp, const size_t len) {
+    size_t new_size;
+    unsigned char *new_mem;
+
+    if (fmp->err) {
+        return 0;
+    }
+    if (fm_chunked(fmp) && fmp->mempos == fmp->memend && fmp->memend + len > FM_STREAM_CHUNK && !fm_flush(fmp)) {
+        return 0;
+    }
+    if (fmp->mempos + len <= fmp->memsize) {
+        return 1;
+    }
+    if (fmp->mempos + len < fmp->mempos) { /* Overflow */
+        fmp->err = ENOMEM;
+        return 0;
+    }
+    new_size = fmp->memsize ? fmp->memsize : FM_MEM_INIT;
+    while (new_size < fmp->mempos + len) {
+        if (new_size * 2 < new_size) {
+            new_size = fmp->mempos + len;
+            break;
+        }
+        new_size *= 2;
+    }
+    if (!(new_mem = (unsigned char *) z_realloc(fmp->mem, new_size))) {
+        fmp->err = ENOMEM;
+        return 0;
+    }
+    fmp->mem = new_mem;
+    fmp->memsize = new_size;
+    return 1;
+}
+
+/* Advance write position by `len` bytes just written, extending output length if beyond it */
+static void fm_advance(struct filemem *const fmp, const size_t len) {
+    fmp->mempos += len;
+    if (fmp->mempos > fmp->memend) {
+        fmp->memend = fmp->mempos;
+    }
+}
+
+INTERNAL int fm_open(struct filemem *const fmp, struct zint_symbol *symbol, const char *mode) {
+    memset(fmp, 0, sizeof(*fmp));
+    if (symbol->output_options & BARCODE_MEMORY_FILE) {
+        return 1;
+    }
+    if (symbol->output_options & BARCODE_STREAM_WRITE) {
+        if (!symbol->write_fn) {
+            errno = EINVAL;
+            return 0;
+        }
+        fmp->write_fn = symbol->write_fn;
+        fmp->write_ctx = symbol->write_ctx;
+        return 1;
+    }
+    if (symbol->output_options & BARCODE_STDOUT) {
+        fmp->fp = stdout;
+        return 1;
+    }
+    if (!(fmp->fp = out_fopen(symbol->outfile, mode))) {
+        return 0;
+    }
+    return 1;
+}
+
+INTERNAL size_t fm_write(const void *ptr, size_t size, size_t nitems, struct filemem *const fmp) {
+    const size_t len = size * nitems;
+
+    if (nitems && len / nitems != size) { /* Overflow */
+        fmp->err = ENOMEM;
+        return 0;
+    }
+    if (fm_chunked(fmp) && len >= FM_STREAM_CHUNK && fmp->mempos == fmp->memend) {
+        /* Large append when chunked, so pass straight through */
+        if (fmp->err || !fm_flush(fmp) || !fm_out(fmp, ptr, len)) {
+            return 0;
+        }
+        return nitems;
+    }
+    if (!fm_reserve(fmp, len)) {
+        return 0;
+    }
+    memcpy(fmp->mem + fmp->mempos, ptr, len);
+    fm_advance(fmp, len);
+    return nitems;
+}
+
+INTERNAL int fm_putc(const int ch, struct filemem *const fmp) {
+    if (!fm_reserve(fmp, 1)) {
+        return 0;
+    }
+    fmp->mem[fmp->mempos] = (unsigned char) ch;
+    fm_advance(fmp, 1);
+    return 1;
+}
+
+INTERNAL int fm_puts(const char *str, struct filemem *const fmp) {
+    const size_t len = strlen(str);
+
+    if (!fm_reserve(fmp, len)) {
+        return 0;
+    }
+    memcpy(fmp->mem + fmp->mempos, str, len);
+    fm_advance(fmp, len);
+    return 1;
+}
+
+/* Write `val` (>= 2^32, finite), which is `arg` scaled by 10^`dp`, for `fm_putsf()`. Rounds to an integer (exact in
+   a double) and converts it using base 10^9 limbs, so no `sprintf()` (with its locale decimal point) needed */
+static int fm_putsf_big(double val, const int dp, const int negative, struct filemem *const fmp) {
+    unsigned long limbs[5]; /* Least significant first, enough for FLT_MAX * 10^4 (43 digits) */
+    char buf[64];
+    char *const end = buf + sizeof(buf);
+    char *s = end;
+    double ip, frac;
+    int exp = 0;
+    int n, i, j, k;
+
+    ip = floor(val);
+    frac = val - ip;
+    if (frac > 0.5 || (frac == 0.5 && fmod(ip, 2.0) != 0.0)) { /* Ties to even, as printf */
+        ip += 1.0; /* Exact, as only have a fraction if < 2^53 */
+    }
+    if (ip >= 9007199254740992.0) { /* 2^53 - split into integral mantissa and power of 2 */
+        ip = ldexp(frexp(ip, &exp), 53);
+        exp -= 53;
+    }
+    limbs[0] = (unsigned long) fmod(ip, 1e9);
+    limbs[1] = (unsigned long) ((ip - limbs[0]) / 1e9); /* Exact, and < 10^9 as `ip` < 2^53 */
+    n = limbs[1] ? 2 : 1;
+    for (i = 0; i < exp; i++) { /* Double `exp` times */
+        unsigned long carry = 0;
+        for (j = 0; j < n; j++) {
+            const unsigned long v = limbs[j] * 2 + carry;
+            carry = v >= 1000000000UL;
+            limbs[j] = v - carry * 1000000000UL;
+        }
+        if (carry) {
+            limbs[n++] = 1;
+        }
+    }
+
+    /* Last `dp` digits are the fraction - as >= 2^32 always have at least 1 integer digit */
+    for (j = 0, k = 0; j < n; j++) {
+        unsigned long limb = limbs[j];
+        for (i = 0; i < 9 && (j < n - 1 || limb); i++, k++) {
+            if (dp && k == dp) {
+                *--s = '.';
+            }
+            *--s = (char) ('0' + limb % 10);
+            limb /= 10;
+        }
+    }
+    if (negative) {
+        *--s = '-';
+    }
+
+    return fm_write(s, 1, end - s, fmp) != 0;
+}
+
+INTERNAL int fm_putsf(const char *prefix, const int dp, const float arg, struct filemem *const fmp) {
+    static const unsigned long pow10s[5] = { 1, 10, 100, 1000, 10000 };
+    char buf[64];
+    char *const end = buf + sizeof(buf);
+    char *s = end;
+    double val;
+    double ip, frac;
+    unsigned long scaled, int_part;
+    int negative;
+
+    assert(dp >= 0 && dp <= 4);
+
+    if (prefix && *prefix && !fm_puts(prefix, fmp)) {
+        return 0;
+    }
+
+    /* As `arg` has 24 bits of precision, multiplying by 10^4 or less is exact in a double, so rounding is done on
+       the exact value (ties to even, as printf) */
+    negative = arg < 0.0f || (arg == 0.0f && 1.0f / arg < 0.0f);
+    val = fabs((double) arg) * pow10s[dp];
+
+    if (val - val != 0.0) { /* NaN or infinity, which have no decimal point, so leave to sprintf() */
+        sprintf(buf, "%.*f", dp, arg);
+        return fm_puts(buf, fmp);
+    }
+    if (!(val < 4294967295.0)) { /* Too big for unsigned long */
+        return fm_putsf_big(val, dp, negative, fmp);
+    }
+
+    ip = floor(val);
+    frac = val - ip;
+    scaled = (unsigned long) ip;
+    if (frac > 0.5 || (frac == 0.5 && (scaled & 1))) {
+        scaled++;
+    }
+    int_part = scaled / pow10s[dp];
+
+    if (dp) {
+        unsigned long frac_part = scaled % pow10s[dp];
+        int i;
+        for (i = 0; i < dp; i++) {
+            *--s = (char) ('0' + frac_part % 10);
+            frac_part /= 10;
+        }
+        *--s = '.';
+    }
+    do {
+        *--s = (char) ('0' + int_part % 10);
+        int_part /= 10;
+    } while (int_part);
+    if (negative) {
+        *--s = '-';
+    }
+
+    return fm_write(s, 1, end - s, fmp) != 0;
+}
+
+INTERNAL int fm_putsi(const char *prefix, const int arg, struct filemem *const fmp) {
+    char buf[16];
+    char *const end = buf + sizeof(buf);
+    char *s = end;
+    /* Avoid overflow negating INT_MIN */
+    unsigned long uval = arg < 0 ? 0UL - (unsigned long) arg : (unsigned long) arg;
+
+    if (prefix && *prefix && !fm_puts(prefix, fmp)) {
+        return 0;
+    }
+    do {
+        *--s = (char) ('0' + uval % 10);
+        uval /= 10;
+    } while (uval);
+    if (arg < 0) {
+        *--s = '-';
+    }
+
+    return fm_write(s, 1, end - s, fmp) != 0;
+}
+
+INTERNAL int fm_seek(struct filemem *const fmp, const long offset, const int whence) {
+    const size_t length = fm_length(fmp);
+    const size_t base = whence == SEEK_CUR ? fmp->flushed + fmp->mempos : whence == SEEK_END ? length : 0;
+    size_t pos;
+
+    if (fmp->err) {
+        return 0;
+    }
+    if (offset < 0 && 0 - (size_t) offset > base) {
+        fmp->err = EINVAL;
+        return 0;
+    }
+    pos = base + (size_t) offset; /* Wraps for negative `offset` */
+    if ((offset > 0 && pos < base) || pos > length) {
+        fmp->err = EINVAL;
+        return 0;
+    }
+    if (pos < fmp->flushed || pos - fmp->flushed > fmp->memend) {
+        /* Outside the buffer, so only if the file itself can be seeked (not stdout or `write_fn`) */
+        if (!fmp->fp || fmp->fp == stdout) {
+            fmp->err = EINVAL;
+            return 0;
+        }
+        if (!fm_flush(fmp)) {
+            return 0;
+        }
+        if (pos > 0x7FFFFFFF || fseek(fmp->fp, (long) pos, SEEK_SET) != 0) { /* Keep to 32-bit `long` */
+            fmp->err = errno ? errno : EIO;
+            return 0;
+        }
+        fmp->flushed = pos;
+    }
+    fmp->mempos = pos - fmp->flushed;
+    return 1;
+}
+
+INTERNAL long fm_tell(struct filemem *const fmp) {
+    if (fmp->err) {
+        return -1;
+    }
+    if (fmp->flushed + fmp->mempos > 0x7FFFFFFF) { /* Keep to 32-bit `long` */
+        fmp->err = EFBIG;
+        return -1;
+    }
+    return (long) (fmp->flushed + fmp->mempos);
+}
+
+INTERNAL int fm_error(const struct filemem *const fmp) {
+    return fmp->err;
+}
+
+INTERNAL int fm_close(struct filemem *const fmp, struct zint_symbol *symbol) {
+    int ret = !fmp->err;
+    const int output_to_stdout = symbol->output_options & BARCODE_STDOUT;
+
+    STATS_SET(symbol, output_size, (int) fm_length(fmp));
+
+    if (fmp->write_fn) { /* Streaming */
+        if (ret && !fm_flush(fmp)) {
+            ret = 0;
+        }
+        fmp->write_fn = NULL;
+    } else if (!fmp->fp) { /* Memory file */
+        if (ret && fmp->memend > 0x7FFFFFFF) { /* Must fit `memfile_size` */
+            fmp->err = EFBIG;
+            ret = 0;
+        }
+        if (ret) {
+            if (symbol->memfile) {
+                z_free(symbol->memfile);
+            }
+            symbol->memfile = fmp->mem;
+            symbol->memfile_size = (int) fmp->memend;
+            fmp->mem = NULL;
+        }
+    } else {
+        if (ret && !fm_flush(fmp)) {
+            ret = 0;
+        }
+        if (output_to_stdout) {
+            if (fflush(fmp->fp) != 0 && ret) {
+                fmp->err = errno ? errno : EIO;
+                ret = 0;
+            }
+        } else {
+            if (fclose(fmp->fp) != 0 && ret) {
+                fmp->err = errno ? errno : EIO;
+                ret = 0;
+            }
+        }
+        fmp->fp = NULL;
+    }
+    z_free(fmp->mem);
+    fmp->mem = NULL;
+    fmp->memsize = fmp->mempos = fmp->memend = fmp->flushed = fmp->outlen = 0;
+
+    return ret;
+}
+
+INTERNAL void fm_discard(struct filemem *const fmp, struct zint_symbol *symbol) {
+    if (fmp->fp && !(symbol->output_options & BARCODE_STDOUT)) {
+        (void) fclose(fmp->fp);
+        (void) remove(symbol->outfile);
+    }
+    fmp->fp = NULL;
+    fmp->write_fn = NULL;
+    z_free(fmp->mem);
+    fmp->mem = NULL;
+    fmp->memsize = fmp->mempos = fmp->memend = fmp->flushed = fmp->outlen = 0;
+}
+
+/* vim: set ts=4 sw=4 et : */
@@ -0,0 +1,107 @@
+/*  filemem.h - buffered output sink for the file writers */
+/*
+    libzint - the open source barcode library
+    Copyright (C) 2023 Robin Stuart <rstuart114@gmail.com>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+    3. Neither the name of the project nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+ */
+/* SPDX-License-Identifier: BSD-3-Clause */
+
+#ifndef Z_FILEMEM_H
+#define Z_FILEMEM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdio.h> /* For FILE */
+
+/* Output sink for the file writers. Output is accumulated in a memory buffer, so that formatting is done without any
+   stdio (or locale) involvement, which is written to the file (or stdout), or passed to `symbol->write_fn` if
+   `symbol->output_options & BARCODE_STREAM_WRITE`, each time it fills a chunk. Only if
+   `symbol->output_options & BARCODE_MEMORY_FILE` is the buffer grown to hold the whole output, which is handed over
+   to `symbol->memfile` */
+struct filemem {
+    FILE *fp;               /* File (or stdout) to write to, NULL if memory file or streaming */
+    int (*write_fn)(void *ctx, const void *buf, size_t len); /* Stream callback, NULL if not streaming */
+    void *write_ctx;        /* Context for `write_fn` */
+    unsigned char *mem;     /* Buffer */
+    size_t memsize;         /* Allocated size of `mem` */
+    size_t mempos;          /* Current write position in `mem` */
+    size_t memend;          /* Length of output in `mem` (may be beyond `mempos` after `fm_seek()`) */
+    size_t flushed;         /* Output offset of start of `mem`, i.e. bytes already flushed unless `fm_seek()` back */
+    size_t outlen;          /* Length of output flushed (may be beyond `flushed` after `fm_seek()` back) */
+    int err;                /* `errno` of first error, 0 if none */
+};
+
+/* Initialize `fmp` for output to memory if `symbol->output_options & BARCODE_MEMORY_FILE`, else to `symbol->write_fn`
+   if `symbol->output_options & BARCODE_STREAM_WRITE`, else `fopen()` the output file (or use stdout if
+   `symbol->output_options & BARCODE_STDOUT`) with `mode`. Returns 1 on success, 0 on failure with `errno` set */
+INTERNAL int fm_open(struct filemem *const fmp, struct zint_symbol *symbol, const char *mode);
+
+/* Write `nitems` of `size` bytes from `ptr`. Returns `nitems` on success, 0 on failure */
+INTERNAL size_t fm_write(const void *ptr, size_t size, size_t nitems, struct filemem *const fmp);
+
+/* Write character `ch`. Returns 1 on success, 0 on failure */
+INTERNAL int fm_putc(const int ch, struct filemem *const fmp);
+
+/* Write NUL-terminated string `str`. Returns 1 on success, 0 on failure */
+INTERNAL int fm_puts(const char *str, struct filemem *const fmp);
+
+/* Write `prefix` (if non-NULL) followed by `arg` formatted as "%.<dp>f" in the "C" locale, i.e. exactly as
+   `printf("%s%.*f", prefix, dp, arg)` would (`dp` 0 to 4). Returns 1 on success, 0 on failure */
+INTERNAL int fm_putsf(const char *prefix, const int dp, const float arg, struct filemem *const fmp);
+
+/* Write `prefix` (if non-NULL) followed by `arg` formatted as "%d". Returns 1 on success, 0 on failure */
+INTERNAL int fm_putsi(const char *prefix, const int arg, struct filemem *const fmp);
+
+/* Set the write position to `offset` bytes from the start (`whence` SEEK_SET), current position (SEEK_CUR) or end
+   of output (SEEK_END), which must be within the output written so far and, if streaming or stdout, not already
+   flushed. Returns 1 on success, 0 on failure */
+INTERNAL int fm_seek(struct filemem *const fmp, const long offset, const int whence);
+
+/* Return the current write position, or -1 on failure */
+INTERNAL long fm_tell(struct filemem *const fmp);
+
+/* Return `errno` of first error if any, else 0 */
+INTERNAL int fm_error(const struct filemem *const fmp);
+
+/* Write out any remainder of the buffer, then close the file (or flush stdout), and free the buffer, or if memory
+   file, replace any previous `symbol->memfile` with the buffer, or if streaming, pass any remainder to `write_fn`.
+   Returns 1 on success, 0 on failure (including any previous failure) with `fmp->err` set */
+INTERNAL int fm_close(struct filemem *const fmp, struct zint_symbol *symbol);
+
+/* Discard the buffer on error, i.e. close the file (or leave stdout) without writing any more, removing the file, and
+   free the buffer, passing nothing further to `symbol->memfile` or `write_fn` (chunks already flushed to stdout or
+   `write_fn` can't be taken back) */
+INTERNAL void fm_discard(struct filemem *const fmp, struct zint_symbol *symbol);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+/* vim: set ts=4 sw=4 et : */
+#endif /* Z_FILEMEM_H */
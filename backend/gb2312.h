@@ -359,111 +359,104 @@ static const unsigned short gb2312_uro_mb_ind[1263] = {
      7142,  7151,  7161,  7174,  7187,  7198,  7210,
 };
 
-/* Unicode codepoints sorted */
-static const unsigned short gb2312_u[818] = {
-    0x00A4, 0x00A7, 0x00A8, 0x00B0, 0x00B1, 0x00D7, 0x00E0, 0x00E1,
-    0x00E8, 0x00E9, 0x00EA, 0x00EC, 0x00ED, 0x00F2, 0x00F3, 0x00F7,
-    0x00F9, 0x00FA, 0x00FC, 0x0101, 0x0113, 0x011B, 0x012B, 0x014D,
-    0x016B, 0x01CE, 0x01D0, 0x01D2, 0x01D4, 0x01D6, 0x01D8, 0x01DA,
-    0x01DC, 0x02C7, 0x02C9, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395,
-    0x0396, 0x0397, 0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D,
-    0x039E, 0x039F, 0x03A0, 0x03A1, 0x03A3, 0x03A4, 0x03A5, 0x03A6,
-    0x03A7, 0x03A8, 0x03A9, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5,
-    0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD,
-    0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C3, 0x03C4, 0x03C5, 0x03C6,
-    0x03C7, 0x03C8, 0x03C9, 0x0401, 0x0410, 0x0411, 0x0412, 0x0413,
-    0x0414, 0x0415, 0x0416, 0x0417, 0x0418, 0x0419, 0x041A, 0x041B,
-    0x041C, 0x041D, 0x041E, 0x041F, 0x0420, 0x0421, 0x0422, 0x0423,
-    0x0424, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429, 0x042A, 0x042B,
-    0x042C, 0x042D, 0x042E, 0x042F, 0x0430, 0x0431, 0x0432, 0x0433,
-    0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0439, 0x043A, 0x043B,
-    0x043C, 0x043D, 0x043E, 0x043F, 0x0440, 0x0441, 0x0442, 0x0443,
-    0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044A, 0x044B,
-    0x044C, 0x044D, 0x044E, 0x044F, 0x0451, 0x2015, 0x2016, 0x2018,
-    0x2019, 0x201C, 0x201D, 0x2026, 0x2030, 0x2032, 0x2033, 0x203B,
-    0x2103, 0x2116, 0x2160, 0x2161, 0x2162, 0x2163, 0x2164, 0x2165,
-    0x2166, 0x2167, 0x2168, 0x2169, 0x216A, 0x216B, 0x2190, 0x2191,
-    0x2192, 0x2193, 0x2208, 0x220F, 0x2211, 0x221A, 0x221D, 0x221E,
-    0x2220, 0x2225, 0x2227, 0x2228, 0x2229, 0x222A, 0x222B, 0x222E,
-    0x2234, 0x2235, 0x2236, 0x2237, 0x223D, 0x2248, 0x224C, 0x2260,
-    0x2261, 0x2264, 0x2265, 0x226E, 0x226F, 0x2299, 0x22A5, 0x2312,
-    0x2460, 0x2461, 0x2462, 0x2463, 0x2464, 0x2465, 0x2466, 0x2467,
-    0x2468, 0x2469, 0x2474, 0x2475, 0x2476, 0x2477, 0x2478, 0x2479,
-    0x247A, 0x247B, 0x247C, 0x247D, 0x247E, 0x247F, 0x2480, 0x2481,
-    0x2482, 0x2483, 0x2484, 0x2485, 0x2486, 0x2487, 0x2488, 0x2489,
-    0x248A, 0x248B, 0x248C, 0x248D, 0x248E, 0x248F, 0x2490, 0x2491,
-    0x2492, 0x2493, 0x2494, 0x2495, 0x2496, 0x2497, 0x2498, 0x2499,
-    0x249A, 0x249B, 0x2500, 0x2501, 0x2502, 0x2503, 0x2504, 0x2505,
-    0x2506, 0x2507, 0x2508, 0x2509, 0x250A, 0x250B, 0x250C, 0x250D,
-    0x250E, 0x250F, 0x2510, 0x2511, 0x2512, 0x2513, 0x2514, 0x2515,
-    0x2516, 0x2517, 0x2518, 0x2519, 0x251A, 0x251B, 0x251C, 0x251D,
-    0x251E, 0x251F, 0x2520, 0x2521, 0x2522, 0x2523, 0x2524, 0x2525,
-    0x2526, 0x2527, 0x2528, 0x2529, 0x252A, 0x252B, 0x252C, 0x252D,
-    0x252E, 0x252F, 0x2530, 0x2531, 0x2532, 0x2533, 0x2534, 0x2535,
-    0x2536, 0x2537, 0x2538, 0x2539, 0x253A, 0x253B, 0x253C, 0x253D,
-    0x253E, 0x253F, 0x2540, 0x2541, 0x2542, 0x2543, 0x2544, 0x2545,
-    0x2546, 0x2547, 0x2548, 0x2549, 0x254A, 0x254B, 0x25A0, 0x25A1,
-    0x25B2, 0x25B3, 0x25C6, 0x25C7, 0x25CB, 0x25CE, 0x25CF, 0x2605,
-    0x2606, 0x2640, 0x2642, 0x3000, 0x3001, 0x3002, 0x3003, 0x3005,
-    0x3008, 0x3009, 0x300A, 0x300B, 0x300C, 0x300D, 0x300E, 0x300F,
-    0x3010, 0x3011, 0x3013, 0x3014, 0x3015, 0x3016, 0x3017, 0x3041,
-    0x3042, 0x3043, 0x3044, 0x3045, 0x3046, 0x3047, 0x3048, 0x3049,
-    0x304A, 0x304B, 0x304C, 0x304D, 0x304E, 0x304F, 0x3050, 0x3051,
-    0x3052, 0x3053, 0x3054, 0x3055, 0x3056, 0x3057, 0x3058, 0x3059,
-    0x305A, 0x305B, 0x305C, 0x305D, 0x305E, 0x305F, 0x3060, 0x3061,
-    0x3062, 0x3063, 0x3064, 0x3065, 0x3066, 0x3067, 0x3068, 0x3069,
-    0x306A, 0x306B, 0x306C, 0x306D, 0x306E, 0x306F, 0x3070, 0x3071,
-    0x3072, 0x3073, 0x3074, 0x3075, 0x3076, 0x3077, 0x3078, 0x3079,
-    0x307A, 0x307B, 0x307C, 0x307D, 0x307E, 0x307F, 0x3080, 0x3081,
-    0x3082, 0x3083, 0x3084, 0x3085, 0x3086, 0x3087, 0x3088, 0x3089,
-    0x308A, 0x308B, 0x308C, 0x308D, 0x308E, 0x308F, 0x3090, 0x3091,
-    0x3092, 0x3093, 0x30A1, 0x30A2, 0x30A3, 0x30A4, 0x30A5, 0x30A6,
-    0x30A7, 0x30A8, 0x30A9, 0x30AA, 0x30AB, 0x30AC, 0x30AD, 0x30AE,
-    0x30AF, 0x30B0, 0x30B1, 0x30B2, 0x30B3, 0x30B4, 0x30B5, 0x30B6,
-    0x30B7, 0x30B8, 0x30B9, 0x30BA, 0x30BB, 0x30BC, 0x30BD, 0x30BE,
-    0x30BF, 0x30C0, 0x30C1, 0x30C2, 0x30C3, 0x30C4, 0x30C5, 0x30C6,
-    0x30C7, 0x30C8, 0x30C9, 0x30CA, 0x30CB, 0x30CC, 0x30CD, 0x30CE,
-    0x30CF, 0x30D0, 0x30D1, 0x30D2, 0x30D3, 0x30D4, 0x30D5, 0x30D6,
-    0x30D7, 0x30D8, 0x30D9, 0x30DA, 0x30DB, 0x30DC, 0x30DD, 0x30DE,
-    0x30DF, 0x30E0, 0x30E1, 0x30E2, 0x30E3, 0x30E4, 0x30E5, 0x30E6,
-    0x30E7, 0x30E8, 0x30E9, 0x30EA, 0x30EB, 0x30EC, 0x30ED, 0x30EE,
-    0x30EF, 0x30F0, 0x30F1, 0x30F2, 0x30F3, 0x30F4, 0x30F5, 0x30F6,
-    0x30FB, 0x3105, 0x3106, 0x3107, 0x3108, 0x3109, 0x310A, 0x310B,
-    0x310C, 0x310D, 0x310E, 0x310F, 0x3110, 0x3111, 0x3112, 0x3113,
-    0x3114, 0x3115, 0x3116, 0x3117, 0x3118, 0x3119, 0x311A, 0x311B,
-    0x311C, 0x311D, 0x311E, 0x311F, 0x3120, 0x3121, 0x3122, 0x3123,
-    0x3124, 0x3125, 0x3126, 0x3127, 0x3128, 0x3129, 0x3220, 0x3221,
-    0x3222, 0x3223, 0x3224, 0x3225, 0x3226, 0x3227, 0x3228, 0x3229,
-    0x9E1F, 0x9E20, 0x9E21, 0x9E22, 0x9E23, 0x9E25, 0x9E26, 0x9E28,
-    0x9E29, 0x9E2A, 0x9E2B, 0x9E2C, 0x9E2D, 0x9E2F, 0x9E31, 0x9E32,
-    0x9E33, 0x9E35, 0x9E36, 0x9E37, 0x9E38, 0x9E39, 0x9E3A, 0x9E3D,
-    0x9E3E, 0x9E3F, 0x9E41, 0x9E42, 0x9E43, 0x9E44, 0x9E45, 0x9E46,
-    0x9E47, 0x9E48, 0x9E49, 0x9E4A, 0x9E4B, 0x9E4C, 0x9E4E, 0x9E4F,
-    0x9E51, 0x9E55, 0x9E57, 0x9E58, 0x9E5A, 0x9E5B, 0x9E5C, 0x9E5E,
-    0x9E63, 0x9E64, 0x9E66, 0x9E67, 0x9E68, 0x9E69, 0x9E6A, 0x9E6B,
-    0x9E6C, 0x9E6D, 0x9E70, 0x9E71, 0x9E73, 0x9E7E, 0x9E7F, 0x9E82,
-    0x9E87, 0x9E88, 0x9E8B, 0x9E92, 0x9E93, 0x9E9D, 0x9E9F, 0x9EA6,
-    0x9EB4, 0x9EB8, 0x9EBB, 0x9EBD, 0x9EBE, 0x9EC4, 0x9EC9, 0x9ECD,
-    0x9ECE, 0x9ECF, 0x9ED1, 0x9ED4, 0x9ED8, 0x9EDB, 0x9EDC, 0x9EDD,
-    0x9EDF, 0x9EE0, 0x9EE2, 0x9EE5, 0x9EE7, 0x9EE9, 0x9EEA, 0x9EEF,
-    0x9EF9, 0x9EFB, 0x9EFC, 0x9EFE, 0x9F0B, 0x9F0D, 0x9F0E, 0x9F10,
-    0x9F13, 0x9F17, 0x9F19, 0x9F20, 0x9F22, 0x9F2C, 0x9F2F, 0x9F37,
-    0x9F39, 0x9F3B, 0x9F3D, 0x9F3E, 0x9F44, 0x9F50, 0x9F51, 0x9F7F,
-    0x9F80, 0x9F83, 0x9F84, 0x9F85, 0x9F86, 0x9F87, 0x9F88, 0x9F89,
-    0x9F8A, 0x9F8B, 0x9F8C, 0x9F99, 0x9F9A, 0x9F9B, 0x9F9F, 0x9FA0,
-    0xFF01, 0xFF02, 0xFF03, 0xFF04, 0xFF05, 0xFF06, 0xFF07, 0xFF08,
-    0xFF09, 0xFF0A, 0xFF0B, 0xFF0C, 0xFF0D, 0xFF0E, 0xFF0F, 0xFF10,
-    0xFF11, 0xFF12, 0xFF13, 0xFF14, 0xFF15, 0xFF16, 0xFF17, 0xFF18,
-    0xFF19, 0xFF1A, 0xFF1B, 0xFF1C, 0xFF1D, 0xFF1E, 0xFF1F, 0xFF20,
-    0xFF21, 0xFF22, 0xFF23, 0xFF24, 0xFF25, 0xFF26, 0xFF27, 0xFF28,
-    0xFF29, 0xFF2A, 0xFF2B, 0xFF2C, 0xFF2D, 0xFF2E, 0xFF2F, 0xFF30,
-    0xFF31, 0xFF32, 0xFF33, 0xFF34, 0xFF35, 0xFF36, 0xFF37, 0xFF38,
-    0xFF39, 0xFF3A, 0xFF3B, 0xFF3C, 0xFF3D, 0xFF3E, 0xFF3F, 0xFF40,
-    0xFF41, 0xFF42, 0xFF43, 0xFF44, 0xFF45, 0xFF46, 0xFF47, 0xFF48,
-    0xFF49, 0xFF4A, 0xFF4B, 0xFF4C, 0xFF4D, 0xFF4E, 0xFF4F, 0xFF50,
-    0xFF51, 0xFF52, 0xFF53, 0xFF54, 0xFF55, 0xFF56, 0xFF57, 0xFF58,
-    0xFF59, 0xFF5A, 0xFF5B, 0xFF5C, 0xFF5D, 0xFF5E, 0xFFE0, 0xFFE1,
-    0xFFE3, 0xFFE5,
+/* Page (U+xx00-xxFF) blocks of `gb2312_page_u[]` & `gb2312_page_mb_ind[]`, 1-based, 0 if none */
+static const unsigned char gb2312_page[256] = {
+      1,   2,   3,   4,   5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      6,   7,   8,   9,  10,  11,  12,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+     13,  14,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  16,  17,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  18,
+};
+
+/* Unicode usage bit-flags for pages in blocks of 16 */
+static const unsigned short gb2312_page_u[288] = {
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0190, 0x0003, 0x0000, 0x0080, 0x3703, 0x168C,
+    0x0002, 0x0808, 0x0800, 0x0000, 0x2000, 0x0000, 0x0800, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x4000, 0x1555, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0280, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xFFFE, 0x03FB, 0xFFFE, 0x03FB, 0x0000, 0x0000, 0x0000,
+    0x0002, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0002, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x3360, 0x0040, 0x080D, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0008, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0FFF, 0x0000,
+    0x0000, 0x000F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x8100, 0x6402, 0x4FA1, 0x20F0, 0x1100, 0x0000, 0xC033, 0x0000,
+    0x0000, 0x0200, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03FF, 0xFFF0,
+    0xFFFF, 0x0FFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0FFF, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0003, 0x000C, 0xC8C0, 0x0000, 0x0000, 0x0000,
+    0x0060, 0x0000, 0x0000, 0x0000, 0x0005, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xFF2F, 0x00FB, 0x0000, 0x0000, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x000F, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x087F,
+    0xFFE0, 0xFFFF, 0x03FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x03FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x8000, 0xBF6F, 0xE7EE, 0xDFFE, 0x5DA2, 0x3FD8, 0xC00B,
+    0x0984, 0xA00C, 0x0040, 0x6910, 0xE210, 0xB912, 0x86A5, 0x5A00,
+    0x6800, 0x0289, 0x9005, 0x6A80, 0x0010, 0x0003, 0x0000, 0x8000,
+    0x1FF9, 0x8E00, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xFFFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7FFF, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x002B, 0x0000,
+};
+
+/* Multibyte indexes for pages in blocks of 16 */
+static const unsigned short gb2312_page_mb_ind[288] = {
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     3,     0,     5,     6,    13,
+       19,    20,    22,     0,    23,     0,    24,     0,
+        0,     0,     0,     0,    25,    26,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,    33,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,    35,    50,    59,    74,     0,     0,     0,
+       83,    84,   100,   116,   132,   148,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,   149,   155,   156,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+      160,   161,     0,     0,     0,     0,   162,     0,
+        0,   174,     0,     0,     0,     0,     0,     0,
+      178,   180,   184,   192,   197,     0,   199,     0,
+        0,   205,   206,     0,     0,     0,     0,     0,
+        0,   207,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,   208,   218,
+      230,   246,     0,     0,     0,     0,     0,     0,
+      258,   274,   290,   306,   322,     0,     0,     0,
+        0,     0,   334,   336,   338,     0,     0,     0,
+      343,     0,     0,     0,   345,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+      347,   360,     0,     0,   367,   382,   398,   414,
+      430,   446,   450,   465,   481,   497,   513,   529,
+      537,   548,   564,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,   574,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,  7211,  7212,  7225,  7237,  7251,  7259,  7269,
+     7274,  7278,  7282,  7283,  7288,  7293,  7300,  7307,
+     7311,  7314,  7318,  7322,  7327,  7328,     0,  7330,
+     7331,  7342,  7346,     0,     0,     0,     0,     0,
+     7347,  7362,  7378,  7394,  7410,  7426,     0,     0,
+        0,     0,     0,     0,     0,     0,  7441,     0,
 };
 
 /* Multibyte values sorted in Unicode order */
@@ -1401,40 +1394,4 @@ static const unsigned short gb2312_mb[7445] = {
     0xA1AB, 0xA1E9, 0xA1EA, 0xA3FE, 0xA3A4,
 };
 
-/* Indexes into Unicode `gb2312_u[]` array in blocks of 0x100 */
-static const unsigned short gb2312_u_ind[256] = {
-        0,    25,    33,    53,   149,   149,   149,   149,
-      149,   149,   149,   149,   149,   149,   149,   149,
-      149,   149,   149,   149,   149,   149,   149,   149,
-      149,   149,   149,   149,   149,   149,   149,   149,
-      160,   178,   206,   208,   258,   336,   347,   347,
-      347,   347,   347,   347,   347,   347,   347,   347,
-      453,   574,   584,   584,   584,   584,   584,   584,
-      584,   584,   584,   584,   584,   584,   584,   584,
-      584,   584,   584,   584,   584,   584,   584,   584,
-      584,   584,   584,   584,   584,   584,   584,   584,
-      584,   584,   584,   584,   584,   584,   584,   584,
-      584,   584,   584,   584,   584,   584,   584,   584,
-      584,   584,   584,   584,   584,   584,   584,   584,
-      584,   584,   584,   584,   584,   584,   584,   584,
-      584,   584,   584,   584,   584,   584,   584,   584,
-      584,   584,   584,   584,   584,   584,   584,   584,
-      584,   584,   584,   584,   584,   584,   584,   584,
-      584,   584,   584,   584,   584,   584,   584,   584,
-      584,   584,   584,   584,   584,   584,   584,   584,
-      584,   584,   584,   584,   584,   584,   655,   720,
-      720,   720,   720,   720,   720,   720,   720,   720,
-      720,   720,   720,   720,   720,   720,   720,   720,
-      720,   720,   720,   720,   720,   720,   720,   720,
-      720,   720,   720,   720,   720,   720,   720,   720,
-      720,   720,   720,   720,   720,   720,   720,   720,
-      720,   720,   720,   720,   720,   720,   720,   720,
-      720,   720,   720,   720,   720,   720,   720,   720,
-      720,   720,   720,   720,   720,   720,   720,   720,
-      720,   720,   720,   720,   720,   720,   720,   720,
-      720,   720,   720,   720,   720,   720,   720,   720,
-      720,   720,   720,   720,   720,   720,   720,   720,
-      720,   720,   720,   720,   720,   720,   720,   814,
-};
-
 #endif /* Z_GB2312_H */
@@ -370,35 +370,92 @@ static const unsigned short gbk_uro_mb_ind[1307] = {
     14251, 14256, 14268,
 };
 
-/* Unicode codepoints sorted */
-static const unsigned short gbk_u[209] = {
-    0x00B7, 0x0144, 0x0148, 0x0251, 0x0261, 0x02CA, 0x02CB, 0x02D9,
-    0x2010, 0x2013, 0x2014, 0x2015, 0x2025, 0x2035, 0x2105, 0x2109,
-    0x2121, 0x2170, 0x2171, 0x2172, 0x2173, 0x2174, 0x2175, 0x2176,
-    0x2177, 0x2178, 0x2179, 0x2196, 0x2197, 0x2198, 0x2199, 0x2215,
-    0x221F, 0x2223, 0x2252, 0x2266, 0x2267, 0x2295, 0x22BF, 0x2550,
-    0x2551, 0x2552, 0x2553, 0x2554, 0x2555, 0x2556, 0x2557, 0x2558,
-    0x2559, 0x255A, 0x255B, 0x255C, 0x255D, 0x255E, 0x255F, 0x2560,
-    0x2561, 0x2562, 0x2563, 0x2564, 0x2565, 0x2566, 0x2567, 0x2568,
-    0x2569, 0x256A, 0x256B, 0x256C, 0x256D, 0x256E, 0x256F, 0x2570,
-    0x2571, 0x2572, 0x2573, 0x2581, 0x2582, 0x2583, 0x2584, 0x2585,
-    0x2586, 0x2587, 0x2588, 0x2589, 0x258A, 0x258B, 0x258C, 0x258D,
-    0x258E, 0x258F, 0x2593, 0x2594, 0x2595, 0x25BC, 0x25BD, 0x25E2,
-    0x25E3, 0x25E4, 0x25E5, 0x2609, 0x3006, 0x3007, 0x3012, 0x301D,
-    0x301E, 0x3021, 0x3022, 0x3023, 0x3024, 0x3025, 0x3026, 0x3027,
-    0x3028, 0x3029, 0x309B, 0x309C, 0x309D, 0x309E, 0x30FC, 0x30FD,
-    0x30FE, 0x3231, 0x32A3, 0x338E, 0x338F, 0x339C, 0x339D, 0x339E,
-    0x33A1, 0x33C4, 0x33CE, 0x33D1, 0x33D2, 0x33D5, 0xF92C, 0xF979,
-    0xF995, 0xF9E7, 0xF9F1, 0xFA0C, 0xFA0D, 0xFA0E, 0xFA0F, 0xFA11,
-    0xFA13, 0xFA14, 0xFA18, 0xFA1F, 0xFA20, 0xFA21, 0xFA23, 0xFA24,
-    0xFA27, 0xFA28, 0xFA29, 0xFE30, 0xFE31, 0xFE33, 0xFE34, 0xFE35,
-    0xFE36, 0xFE37, 0xFE38, 0xFE39, 0xFE3A, 0xFE3B, 0xFE3C, 0xFE3D,
-    0xFE3E, 0xFE3F, 0xFE40, 0xFE41, 0xFE42, 0xFE43, 0xFE44, 0xFE49,
-    0xFE4A, 0xFE4B, 0xFE4C, 0xFE4D, 0xFE4E, 0xFE4F, 0xFE50, 0xFE51,
-    0xFE52, 0xFE54, 0xFE55, 0xFE56, 0xFE57, 0xFE59, 0xFE5A, 0xFE5B,
-    0xFE5C, 0xFE5D, 0xFE5E, 0xFE5F, 0xFE60, 0xFE61, 0xFE62, 0xFE63,
-    0xFE64, 0xFE65, 0xFE66, 0xFE68, 0xFE69, 0xFE6A, 0xFE6B, 0xFFE2,
-    0xFFE4,
+/* Page (U+xx00-xxFF) blocks of `gbk_page_u[]` & `gbk_page_mb_ind[]`, 1-based, 0 if none */
+static const unsigned char gbk_page[256] = {
+      1,   2,   3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      4,   5,   6,   0,   0,   7,   8,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      9,   0,  10,  11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,  12,  13,   0,   0,   0,  14,  15,
+};
+
+/* Unicode usage bit-flags for pages in blocks of 16 */
+static const unsigned short gbk_page_u[240] = {
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0110, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0C00, 0x0200, 0x0000, 0x0000,
+    0x0000, 0x0039, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0220, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x03FF,
+    0x0000, 0x03C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x8020, 0x0008, 0x0000, 0x0000, 0x0004, 0x00C0, 0x0000,
+    0x0000, 0x0020, 0x0000, 0x8000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x000F,
+    0xFFFE, 0x0038, 0x0000, 0x3000, 0x0000, 0x0000, 0x003C, 0x0000,
+    0x0200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x00C0, 0x6004, 0x03FE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x7800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7000,
+    0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0008, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xC000, 0x7000, 0x0002, 0x0000, 0x4010, 0x0026, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0200,
+    0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0080, 0x0002,
+    0xF000, 0x811A, 0x039B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xFFFB, 0xFE1F, 0xFEF7, 0x0F7F, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0014, 0x0000,
+};
+
+/* Multibyte indexes for pages in blocks of 16 */
+static const unsigned short gbk_page_mb_ind[240] = {
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     1,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     3,     4,     0,
+        0,     0,     0,     0,     5,     7,     0,     0,
+        0,     8,    12,    13,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+       14,     0,    16,     0,     0,     0,     0,    17,
+        0,    27,     0,     0,     0,     0,     0,     0,
+        0,    31,    33,     0,     0,    34,    35,     0,
+        0,    37,     0,    38,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,    39,    55,    71,
+       75,    90,     0,    93,     0,     0,    95,     0,
+       99,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+      100,   102,   105,     0,     0,     0,     0,     0,
+        0,   114,     0,     0,     0,     0,     0,   118,
+        0,     0,     0,   121,     0,     0,     0,     0,
+        0,     0,   122,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+      123,   125,   128,     0,   129,   131,     0,     0,
+        0,     0, 14273,     0,     0,     0,     0, 14274,
+        0, 14275,     0,     0,     0,     0, 14276, 14277,
+    14278, 14282, 14287,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0, 14294, 14309, 14321, 14335,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0, 14346,     0,
 };
 
 /* Multibyte values sorted in Unicode order */
@@ -37,6 +37,7 @@
 #include <fcntl.h>
 #endif
 #include "common.h"
+#include "filemem.h"
 #include "output.h"
 
 /* Limit initial LZW buffer size to this in expectation that compressed data will fit for typical scalings */
@@ -98,7 +99,7 @@ static int BufferNextByte(statestruct *pState) {
         unsigned char *pOut;
         pState->OutLength += GIF_LZW_PAGE_SIZE;
         /* Note pState->pOut not free()d by realloc() on failure */
-        if (!(pOut = (unsigned char *) realloc(pState->pOut, pState->OutLength))) {
+        if (!(pOut = (unsigned char *) z_realloc(pState->pOut, pState->OutLength))) {
             return 1;
         }
         pState->pOut = pOut;
@@ -280,7 +281,8 @@ static int gif_lzw(statestruct *pState, int paletteBitSize) {
  */
 INTERNAL int gif_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf) {
     unsigned char outbuf[10];
-    FILE *gif_file;
+    struct filemem fm;
+    struct filemem *const fmp = &fm;
     unsigned short usTemp;
     int byte_out;
     int colourCount;
@@ -464,19 +466,17 @@ INTERNAL int gif_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf)
     paletteSize = 1 << paletteBitSize;
 
     /* Open output file in binary mode */
-    if (output_to_stdout) {
 #ifdef _MSC_VER
+    if (output_to_stdout) {
         if (-1 == _setmode(_fileno(stdout), _O_BINARY)) {
             sprintf(symbol->errtxt, "610: Could not set stdout to binary (%d: %.30s)", errno, strerror(errno));
             return ZINT_ERROR_FILE_ACCESS;
         }
+    }
 #endif
-        gif_file = stdout;
-    } else {
-        if (!(gif_file = out_fopen(symbol->outfile, "wb"))) {
-            sprintf(symbol->errtxt, "611: Could not open output file (%d: %.30s)", errno, strerror(errno));
-            return ZINT_ERROR_FILE_ACCESS;
-        }
+    if (!fm_open(fmp, symbol, "wb")) {
+        sprintf(symbol->errtxt, "611: Could not open output file (%d: %.30s)", errno, strerror(errno));
+        return ZINT_ERROR_FILE_ACCESS;
     }
 
     /* GIF signature (6) */
@@ -484,7 +484,7 @@ INTERNAL int gif_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf)
     if (transparent_index != -1)
         outbuf[4] = '9';
 
-    fwrite(outbuf, 6, 1, gif_file);
+    fm_write(outbuf, 6, 1, fmp);
     /* Screen Descriptor (7) */
     /* Screen Width */
     usTemp = (unsigned short) symbol->bitmap_width;
@@ -519,12 +519,12 @@ INTERNAL int gif_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf)
     outbuf[5] = backgroundColourIndex;
     /* Byte 7 must be 0x00  */
     outbuf[6] = 0x00;
-    fwrite(outbuf, 7, 1, gif_file);
+    fm_write(outbuf, 7, 1, fmp);
     /* Global Color Table (paletteSize*3) */
-    fwrite(paletteRGB, 3*paletteCount, 1, gif_file);
+    fm_write(paletteRGB, 3*paletteCount, 1, fmp);
     /* add unused palette items to fill palette size */
     for (paletteIndex = paletteCount; paletteIndex < paletteSize; paletteIndex++) {
-        fwrite(RGBUnused, 3, 1, gif_file);
+        fm_write(RGBUnused, 3, 1, fmp);
     }
 
     /* Graphic control extension (8) */
@@ -552,7 +552,7 @@ INTERNAL int gif_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf)
         outbuf[6] = (unsigned char) transparent_index;
         /* Block Terminator */
         outbuf[7] = 0;
-        fwrite(outbuf, 8, 1, gif_file);
+        fm_write(outbuf, 8, 1, fmp);
     }
     /* Image Descriptor */
     /* Image separator character = ',' */
@@ -575,15 +575,13 @@ INTERNAL int gif_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf)
      * There is no local color table if its most significant bit is reset.
      */
     outbuf[9] = 0x00;
-    fwrite(outbuf, 10, 1, gif_file);
+    fm_write(outbuf, 10, 1, fmp);
 
     /* prepare state array */
     State.pIn = pixelbuf;
     State.InLen = bitmapSize;
-    if (!(State.pOut = (unsigned char *) malloc(lzoutbufSize))) {
-        if (!output_to_stdout) {
-            (void) fclose(gif_file);
-        }
+    if (!(State.pOut = (unsigned char *) z_malloc(lzoutbufSize))) {
+        fm_discard(fmp, symbol);
         strcpy(symbol->errtxt, "614: Insufficient memory for LZW buffer");
         return ZINT_ERROR_MEMORY;
     }
@@ -592,37 +590,32 @@ INTERNAL int gif_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf)
     /* call lzw encoding */
     byte_out = gif_lzw(&State, paletteBitSize);
     if (byte_out <= 0) {
-        free(State.pOut);
-        if (!output_to_stdout) {
-            (void) fclose(gif_file);
-        }
+        z_free(State.pOut);
+        fm_discard(fmp, symbol);
         strcpy(symbol->errtxt, "613: Insufficient memory for LZW buffer");
         return ZINT_ERROR_MEMORY;
     }
-    fwrite((const char *) State.pOut, byte_out, 1, gif_file);
-    free(State.pOut);
+    fm_write((const char *) State.pOut, byte_out, 1, fmp);
+    z_free(State.pOut);
 
     /* GIF terminator */
-    fputc('\x3b', gif_file);
+    fm_putc('\x3b', fmp);
 
-    if (ferror(gif_file)) {
-        sprintf(symbol->errtxt, "615: Incomplete write to output (%d: %.30s)", errno, strerror(errno));
-        if (!output_to_stdout) {
-            (void) fclose(gif_file);
-        }
+    if (fm_error(fmp)) {
+        sprintf(symbol->errtxt, "615: Incomplete write to output (%d: %.30s)", fm_error(fmp),
+                strerror(fm_error(fmp)));
+        fm_discard(fmp, symbol);
         return ZINT_ERROR_FILE_WRITE;
     }
 
-    if (output_to_stdout) {
-        if (fflush(gif_file) != 0) {
-            sprintf(symbol->errtxt, "616: Incomplete flush to output (%d: %.30s)", errno, strerror(errno));
-            return ZINT_ERROR_FILE_WRITE;
-        }
-    } else {
-        if (fclose(gif_file) != 0) {
-            sprintf(symbol->errtxt, "617: Failure on closing output file (%d: %.30s)", errno, strerror(errno));
-            return ZINT_ERROR_FILE_WRITE;
+    if (!fm_close(fmp, symbol)) {
+        if (output_to_stdout) {
+            sprintf(symbol->errtxt, "616: Incomplete flush to output (%d: %.30s)", fmp->err, strerror(fmp->err));
+        } else {
+            sprintf(symbol->errtxt, "617: Failure on closing output file (%d: %.30s)", fmp->err,
+                    strerror(fmp->err));
         }
+        return ZINT_ERROR_FILE_WRITE;
     }
 
     return 0;
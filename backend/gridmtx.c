@@ -290,14 +290,14 @@ static void gm_define_mode(char *mode, const unsigned int ddata[], const int len
 }
 
 /* Add the length indicator for byte encoded blocks */
-static void gm_add_byte_count(char binary[], const int byte_count_posn, const int byte_count) {
+static void gm_add_byte_count(unsigned char binary[], const int byte_count_posn, const int byte_count) {
     /* AIMD014 6.3.7: "Let L be the number of bytes of input data to be encoded in the 8-bit binary data set.
      * First output (L-1) as a 9-bit binary prefix to record the number of bytes..." */
-    bin_append_posn(byte_count - 1, 9, binary, byte_count_posn);
+    bits_append_posn(byte_count - 1, 9, binary, byte_count_posn);
 }
 
 /* Add a control character to the data stream */
-static int gm_add_shift_char(char binary[], int bp, int shifty, const int debug_print) {
+static int gm_add_shift_char(unsigned char binary[], int bp, int shifty, const int debug_print) {
     int i;
     int glyph = 0;
 
@@ -316,12 +316,12 @@ static int gm_add_shift_char(char binary[], int bp, int shifty, const int debug_
         printf("SHIFT [%d] ", glyph);
     }
 
-    bp = bin_append_posn(glyph, 6, binary, bp);
+    bp = bits_append_posn(glyph, 6, binary, bp);
 
     return bp;
 }
 
-static int gm_encode(unsigned int ddata[], const int length, char binary[], const int eci, int *p_bp,
+static int gm_encode(unsigned int ddata[], const int length, unsigned char binary[], const int eci, int *p_bp,
             const int debug_print) {
     /* Create a binary stream representation of the input data.
        7 sets are defined - Chinese characters, Numerals, Lower case letters, Upper case letters,
@@ -342,15 +342,15 @@ static int gm_encode(unsigned int ddata[], const int length, char binary[], cons
 
     if (eci != 0) {
         /* ECI assignment according to Table 8 */
-        bp = bin_append_posn(12, 4, binary, bp); /* ECI */
+        bp = bits_append_posn(12, 4, binary, bp); /* ECI */
         if (eci <= 1023) {
-            bp = bin_append_posn(eci, 11, binary, bp);
+            bp = bits_append_posn(eci, 11, binary, bp);
         } else if (eci <= 32767) {
-            bp = bin_append_posn(2, 2, binary, bp);
-            bp = bin_append_posn(eci, 15, binary, bp);
+            bp = bits_append_posn(2, 2, binary, bp);
+            bp = bits_append_posn(eci, 15, binary, bp);
         } else {
-            bp = bin_append_posn(3, 2, binary, bp);
-            bp = bin_append_posn(eci, 20, binary, bp);
+            bp = bits_append_posn(3, 2, binary, bp);
+            bp = bits_append_posn(eci, 20, binary, bp);
         }
     }
 
@@ -363,87 +363,84 @@ static int gm_encode(unsigned int ddata[], const int length, char binary[], cons
             switch (current_mode) {
                 case 0:
                     switch (next_mode) {
-                        case GM_CHINESE: bp = bin_append_posn(1, 4, binary, bp);
+                        case GM_CHINESE: bp = bits_append_posn(1, 4, binary, bp);
                             break;
-                        case GM_NUMBER: bp = bin_append_posn(2, 4, binary, bp);
+                        case GM_NUMBER: bp = bits_append_posn(2, 4, binary, bp);
                             break;
-                        case GM_LOWER: bp = bin_append_posn(3, 4, binary, bp);
+                        case GM_LOWER: bp = bits_append_posn(3, 4, binary, bp);
                             break;
-                        case GM_UPPER: bp = bin_append_posn(4, 4, binary, bp);
+                        case GM_UPPER: bp = bits_append_posn(4, 4, binary, bp);
                             break;
-                        case GM_MIXED: bp = bin_append_posn(5, 4, binary, bp);
+                        case GM_MIXED: bp = bits_append_posn(5, 4, binary, bp);
                             break;
-                        case GM_BYTE: bp = bin_append_posn(6, 4, binary, bp);
+                        case GM_BYTE: bp = bits_append_posn(6, 4, binary, bp);
                             break;
                     }
                     break;
                 case GM_CHINESE:
                     switch (next_mode) {
-                        case GM_NUMBER: bp = bin_append_posn(8161, 13, binary, bp);
+                        case GM_NUMBER: bp = bits_append_posn(8161, 13, binary, bp);
                             break;
-                        case GM_LOWER: bp = bin_append_posn(8162, 13, binary, bp);
+                        case GM_LOWER: bp = bits_append_posn(8162, 13, binary, bp);
                             break;
-                        case GM_UPPER: bp = bin_append_posn(8163, 13, binary, bp);
+                        case GM_UPPER: bp = bits_append_posn(8163, 13, binary, bp);
                             break;
-                        case GM_MIXED: bp = bin_append_posn(8164, 13, binary, bp);
+                        case GM_MIXED: bp = bits_append_posn(8164, 13, binary, bp);
                             break;
-                        case GM_BYTE: bp = bin_append_posn(8165, 13, binary, bp);
+                        case GM_BYTE: bp = bits_append_posn(8165, 13, binary, bp);
                             break;
                     }
                     break;
                 case GM_NUMBER:
                     /* add numeric block padding value */
                     switch (p) {
-                        case 1: binary[number_pad_posn] = '1';
-                            binary[number_pad_posn + 1] = '0';
+                        case 1: (void) bits_append_posn(2, 2, binary, number_pad_posn);
                             break; /* 2 pad digits */
-                        case 2: binary[number_pad_posn] = '0';
-                            binary[number_pad_posn + 1] = '1';
-                            break; /* 1 pad digits */
-                        case 3: binary[number_pad_posn] = '0';
-                            binary[number_pad_posn + 1] = '0';
+                        case 2: (void) bits_append_posn(1, 2, binary, number_pad_posn);
+                            break; /* 1 pad digit */
+                        case 3: (void) bits_append_posn(0, 2, binary, number_pad_posn);
                             break; /* 0 pad digits */
                     }
                     switch (next_mode) {
-                        case GM_CHINESE: bp = bin_append_posn(1019, 10, binary, bp);
+                        case GM_CHINESE: bp = bits_append_posn(1019, 10, binary, bp);
                             break;
-                        case GM_LOWER: bp = bin_append_posn(1020, 10, binary, bp);
+                        case GM_LOWER: bp = bits_append_posn(1020, 10, binary, bp);
                             break;
-                        case GM_UPPER: bp = bin_append_posn(1021, 10, binary, bp);
+                        case GM_UPPER: bp = bits_append_posn(1021, 10, binary, bp);
                             break;
-                        case GM_MIXED: bp = bin_append_posn(1022, 10, binary, bp);
+                        case GM_MIXED: bp = bits_append_posn(1022, 10, binary, bp);
                             break;
-                        case GM_BYTE: bp = bin_append_posn(1023, 10, binary, bp);
+                        case GM_BYTE: bp = bits_append_posn(1023, 10, binary, bp);
                             break;
                     }
                     break;
                 case GM_LOWER:
                 case GM_UPPER:
                     switch (next_mode) {
-                        case GM_CHINESE: bp = bin_append_posn(28, 5, binary, bp);
+                        case GM_CHINESE: bp = bits_append_posn(28, 5, binary, bp);
                             break;
-                        case GM_NUMBER: bp = bin_append_posn(29, 5, binary, bp);
+                        case GM_NUMBER: bp = bits_append_posn(29, 5, binary, bp);
                             break;
                         case GM_LOWER:
-                        case GM_UPPER: bp = bin_append_posn(30, 5, binary, bp);
+                        case GM_UPPER: bp = bits_append_posn(30, 5, binary, bp);
                             break;
-                        case GM_MIXED: bp = bin_append_posn(124, 7, binary, bp);
+                        case GM_MIXED: bp = bits_append_posn(124, 7, binary, bp);
                             break;
-                        case GM_BYTE: bp = bin_append_posn(126, 7, binary, bp);
+                        case GM_BYTE: bp = bits_append_posn(126, 7, binary, bp);
                             break;
                     }
                     break;
                 case GM_MIXED:
                     switch (next_mode) {
-                        case GM_CHINESE: bp = bin_append_posn(1009, 10, binary, bp);
+                        case GM_CHINESE: bp = bits_append_posn(1009, 10, binary, bp);
                             break;
-                        case GM_NUMBER: bp = bin_append_posn(1010, 10, binary, bp);
+                        case GM_NUMBER: bp = bits_append_posn(1010, 10, binary, bp);
                             break;
-                        case GM_LOWER: bp = bin_append_posn(1011, 10, binary, bp);
+                        case GM_LOWER: bp = bits_append_posn(1011, 10, binary, bp);
                             break;
-                        case GM_UPPER: bp = bin_append_posn(1012, 10, binary, bp);
+                        case GM_UPPER: bp = bits_append_posn(1012, 10, binary, bp);
                             break;
-                        case GM_BYTE: bp = bin_append_posn(1015, 10, binary, bp);
+                        case GM_BYTE: bp = bits_append_posn(1015, 10, binary, bp);
                             break;
                     }
                     break;
@@ -452,15 +449,15 @@ static int gm_encode(unsigned int ddata[], const int length, char binary[], cons
                     gm_add_byte_count(binary, byte_count_posn, byte_count);
                     byte_count = 0;
                     switch (next_mode) {
-                        case GM_CHINESE: bp = bin_append_posn(1, 4, binary, bp);
+                        case GM_CHINESE: bp = bits_append_posn(1, 4, binary, bp);
                             break;
-                        case GM_NUMBER: bp = bin_append_posn(2, 4, binary, bp);
+                        case GM_NUMBER: bp = bits_append_posn(2, 4, binary, bp);
                             break;
-                        case GM_LOWER: bp = bin_append_posn(3, 4, binary, bp);
+                        case GM_LOWER: bp = bits_append_posn(3, 4, binary, bp);
                             break;
-                        case GM_UPPER: bp = bin_append_posn(4, 4, binary, bp);
+                        case GM_UPPER: bp = bits_append_posn(4, 4, binary, bp);
                             break;
-                        case GM_MIXED: bp = bin_append_posn(5, 4, binary, bp);
+                        case GM_MIXED: bp = bits_append_posn(5, 4, binary, bp);
                             break;
                     }
                     break;
@@ -530,7 +527,7 @@ static int gm_encode(unsigned int ddata[], const int length, char binary[], cons
                     printf("[%d] ", (int) glyph);
                 }
 
-                bp = bin_append_posn(glyph, 13, binary, bp);
+                bp = bits_append_posn(glyph, 13, binary, bp);
                 sp++;
                 break;
 
@@ -538,7 +535,7 @@ static int gm_encode(unsigned int ddata[], const int length, char binary[], cons
                 if (last_mode != current_mode) {
                     /* Reserve a space for numeric digit padding value (2 bits) */
                     number_pad_posn = bp;
-                    bp = bin_append_posn(0, 2, binary, bp);
+                    bp = bits_append_posn(0, 2, binary, bp);
                 }
                 p = 0;
                 ppos = -1;
@@ -595,7 +592,7 @@ static int gm_encode(unsigned int ddata[], const int length, char binary[], cons
                         printf("[%d] ", (int) glyph);
                     }
 
-                    bp = bin_append_posn(glyph, 10, binary, bp);
+                    bp = bits_append_posn(glyph, 10, binary, bp);
                 }
 
                 glyph = (100 * (numbuf[0] - '0')) + (10 * (numbuf[1] - '0')) + (numbuf[2] - '0');
@@ -603,34 +600,34 @@ static int gm_encode(unsigned int ddata[], const int length, char binary[], cons
                     printf("[%d] ", (int) glyph);
                 }
 
-                bp = bin_append_posn(glyph, 10, binary, bp);
+                bp = bits_append_posn(glyph, 10, binary, bp);
                 break;
 
             case GM_BYTE:
                 if (last_mode != current_mode) {
                     /* Reserve space for byte block length indicator (9 bits) */
                     byte_count_posn = bp;
-                    bp = bin_append_posn(0, 9, binary, bp);
+                    bp = bits_append_posn(0, 9, binary, bp);
                 }
                 glyph = ddata[sp];
                 if (byte_count == 512 || (glyph > 0xFF && byte_count == 511)) {
                     /* Maximum byte block size is 512 bytes. If longer is needed then start a new block */
                     if (glyph > 0xFF && byte_count == 511) { /* Split double-byte */
-                        bp = bin_append_posn(glyph >> 8, 8, binary, bp);
+                        bp = bits_append_posn(glyph >> 8, 8, binary, bp);
                         glyph &= 0xFF;
                         byte_count++;
                     }
                     gm_add_byte_count(binary, byte_count_posn, byte_count);
-                    bp = bin_append_posn(7, 4, binary, bp);
+                    bp = bits_append_posn(7, 4, binary, bp);
                     byte_count_posn = bp;
-                    bp = bin_append_posn(0, 9, binary, bp);
+                    bp = bits_append_posn(0, 9, binary, bp);
                     byte_count = 0;
                 }
 
                 if (debug_print) {
                     printf("[%d] ", (int) glyph);
                 }
-                bp = bin_append_posn(glyph, glyph > 0xFF ? 16 : 8, binary, bp);
+                bp = bits_append_posn(glyph, glyph > 0xFF ? 16 : 8, binary, bp);
                 sp++;
                 byte_count++;
                 if (glyph > 0xFF) {
@@ -657,10 +654,10 @@ static int gm_encode(unsigned int ddata[], const int length, char binary[], cons
                         printf("[%d] ", (int) glyph);
                     }
 
-                    bp = bin_append_posn(glyph, 6, binary, bp);
+                    bp = bits_append_posn(glyph, 6, binary, bp);
                 } else {
                     /* Shift Mode character */
-                    bp = bin_append_posn(1014, 10, binary, bp); /* shift indicator */
+                    bp = bits_append_posn(1014, 10, binary, bp); /* shift indicator */
                     bp = gm_add_shift_char(binary, bp, ddata[sp], debug_print);
                 }
 
@@ -682,10 +679,10 @@ static int gm_encode(unsigned int ddata[], const int length, char binary[], cons
                         printf("[%d] ", (int) glyph);
                     }
 
-                    bp = bin_append_posn(glyph, 5, binary, bp);
+                    bp = bits_append_posn(glyph, 5, binary, bp);
                 } else {
                     /* Shift Mode character */
-                    bp = bin_append_posn(125, 7, binary, bp); /* shift indicator */
+                    bp = bits_append_posn(125, 7, binary, bp); /* shift indicator */
                     bp = gm_add_shift_char(binary, bp, ddata[sp], debug_print);
                 }
 
@@ -707,10 +704,10 @@ static int gm_encode(unsigned int ddata[], const int length, char binary[], cons
                         printf("[%d] ", (int) glyph);
                     }
 
-                    bp = bin_append_posn(glyph, 5, binary, bp);
+                    bp = bits_append_posn(glyph, 5, binary, bp);
                 } else {
                     /* Shift Mode character */
-                    bp = bin_append_posn(125, 7, binary, bp); /* shift indicator */
+                    bp = bits_append_posn(125, 7, binary, bp); /* shift indicator */
                     bp = gm_add_shift_char(binary, bp, ddata[sp], debug_print);
                 }
 
@@ -726,14 +723,11 @@ static int gm_encode(unsigned int ddata[], const int length, char binary[], cons
     if (current_mode == GM_NUMBER) {
         /* add numeric block padding value */
         switch (p) {
-            case 1: binary[number_pad_posn] = '1';
-                binary[number_pad_posn + 1] = '0';
+            case 1: (void) bits_append_posn(2, 2, binary, number_pad_posn);
                 break; /* 2 pad digits */
-            case 2: binary[number_pad_posn] = '0';
-                binary[number_pad_posn + 1] = '1';
+            case 2: (void) bits_append_posn(1, 2, binary, number_pad_posn);
                 break; /* 1 pad digit */
-            case 3: binary[number_pad_posn] = '0';
-                binary[number_pad_posn + 1] = '0';
+            case 3: (void) bits_append_posn(0, 2, binary, number_pad_posn);
                 break; /* 0 pad digits */
         }
     }
@@ -745,16 +739,16 @@ static int gm_encode(unsigned int ddata[], const int length, char binary[], cons
 
     /* Add "end of data" character */
     switch (current_mode) {
-        case GM_CHINESE: bp = bin_append_posn(8160, 13, binary, bp);
+        case GM_CHINESE: bp = bits_append_posn(8160, 13, binary, bp);
             break;
-        case GM_NUMBER: bp = bin_append_posn(1018, 10, binary, bp);
+        case GM_NUMBER: bp = bits_append_posn(1018, 10, binary, bp);
             break;
         case GM_LOWER:
-        case GM_UPPER: bp = bin_append_posn(27, 5, binary, bp);
+        case GM_UPPER: bp = bits_append_posn(27, 5, binary, bp);
             break;
-        case GM_MIXED: bp = bin_append_posn(1008, 10, binary, bp);
+        case GM_MIXED: bp = bits_append_posn(1008, 10, binary, bp);
             break;
-        case GM_BYTE: bp = bin_append_posn(0, 4, binary, bp);
+        case GM_BYTE: bp = bits_append_posn(0, 4, binary, bp);
             break;
     }
 
@@ -765,29 +759,30 @@ static int gm_encode(unsigned int ddata[], const int length, char binary[], cons
     *p_bp = bp;
 
     if (debug_print) {
-        printf("\nBinary (%d): %.*s\n", bp, bp, binary);
+        printf("\nBinary (%d): %s\n", bp, bits_dump(binary, bp, (char *) z_alloca(bp + 1)));
     }
 
     return 0;
 }
 
-static int gm_encode_segs(unsigned int ddata[], const struct zint_seg segs[], const int seg_count, char binary[],
-            const int reader, const struct zint_structapp *p_structapp, int *p_bin_len, const int debug_print) {
+static int gm_encode_segs(unsigned int ddata[], const struct zint_seg segs[], const int seg_count,
+            unsigned char binary[], const int reader, const struct zint_structapp *p_structapp, int *p_bin_len,
+            const int debug_print) {
     int i;
     unsigned int *dd = ddata;
     int bp = 0;
     int p;
 
     if (reader && (!p_structapp || p_structapp->index == 1)) { /* Appears only in 1st symbol if Structured Append */
-        bp = bin_append_posn(10, 4, binary, bp); /* FNC3 - Reader Initialisation */
+        bp = bits_append_posn(10, 4, binary, bp); /* FNC3 - Reader Initialisation */
     }
 
     if (p_structapp) {
-        bp = bin_append_posn(9, 4, binary, bp); /* FNC2 - Structured Append */
-        bp = bin_append_posn(to_int((const unsigned char *) p_structapp->id, (int) strlen(p_structapp->id)), 8,
+        bp = bits_append_posn(9, 4, binary, bp); /* FNC2 - Structured Append */
+        bp = bits_append_posn(to_int((const unsigned char *) p_structapp->id, (int) strlen(p_structapp->id)), 8,
                 binary, bp); /* File signature */
-        bp = bin_append_posn(p_structapp->count - 1, 4, binary, bp);
-        bp = bin_append_posn(p_structapp->index - 1, 4, binary, bp);
+        bp = bits_append_posn(p_structapp->count - 1, 4, binary, bp);
+        bp = bits_append_posn(p_structapp->index - 1, 4, binary, bp);
     }
 
     for (i = 0; i < seg_count; i++) {
@@ -801,12 +796,12 @@ static int gm_encode_segs(unsigned int ddata[], const struct zint_seg segs[], co
     /* Add padding bits if required */
     p = 7 - (bp % 7);
     if (p % 7) {
-        bp = bin_append_posn(0, p, binary, bp);
+        bp = bits_append_posn(0, p, binary, bp);
     }
     /* Note bit-padding can't tip `bp` over max 9191 (1313 * 7) */
 
     if (debug_print) {
-        printf("\nBinary (%d): %.*s\n", bp, bp, binary);
+        printf("\nBinary (%d): %s\n", bp, bits_dump(binary, bp, (char *) z_alloca(bp + 1)));
     }
 
     *p_bin_len = bp;
@@ -814,9 +809,9 @@ static int gm_encode_segs(unsigned int ddata[], const struct zint_seg segs[], co
     return 0;
 }
 
-static void gm_add_ecc(const char binary[], const int data_posn, const int layers, const int ecc_level,
+static void gm_add_ecc(const unsigned char binary[], const int data_posn, const int layers, const int ecc_level,
             unsigned char word[]) {
-    int data_cw, i, j, wp, p;
+    int data_cw, i, j, wp;
     int n1, b1, n2, b2, e1, b3, e2;
     int block_size, ecc_size;
     unsigned char data[1320], block[130];
@@ -831,11 +826,7 @@ static void gm_add_ecc(const char binary[], const int data_posn, const int layer
 
     /* Convert from binary stream to 7-bit codewords */
     for (i = 0; i < data_posn; i++) {
-        for (p = 0; p < 7; p++) {
-            if (binary[i * 7 + p] == '1') {
-                data[i] += (0x40 >> p);
-            }
-        }
+        data[i] = (unsigned char) bits_get_posn(binary, i * 7, 7);
     }
 
     /* Add padding codewords */
@@ -1019,7 +1010,7 @@ INTERNAL int gridmatrix(struct zint_symbol *symbol, struct zint_seg segs[], cons
     int auto_layers, min_layers, layers, auto_ecc_level, min_ecc_level, ecc_level;
     int x, y, i;
     int full_multibyte;
-    char binary[9300];
+    unsigned char binary[BITS_SIZE(9300)] = {0};
     int data_cw, input_latch = 0;
     unsigned char word[1460] = {0};
     int data_max, reader = 0;
@@ -1243,4 +1234,33 @@ INTERNAL int gridmatrix(struct zint_symbol *symbol, struct zint_seg segs[], cons
     return warn_number;
 }
 
+/* Return the maximum number of characters of `char_type` (ZINT_CAPACITY_XXX) that Grid Matrix can hold at ECC level
+   `option_1` and layers `option_2`, or 0 if not supported (`ZBarcode_Capacity()`). Kanji is taken to mean GB 2312
+   Hanzi. The ECC level makes no difference as it is lowered as needed */
+INTERNAL int gm_capacity(const int option_1, const int option_2, const int char_type) {
+    int bits, count;
+
+    if (option_1 < -1 || option_1 > 5 || option_2 < 0 || option_2 > 13) {
+        return 0;
+    }
+    bits = gm_max_cw[option_2 ? option_2 - 1 : 12] * 7;
+
+    switch (char_type) {
+        case ZINT_CAPACITY_NUMERIC: /* Mode indicator, padding count and end then 10 bits per 3 digits */
+            return ((bits - 16) / 10) * 3;
+            break;
+        case ZINT_CAPACITY_ALPHANUMERIC: /* Upper case mode indicator and end then 5 bits each */
+            return (bits - 9) / 5;
+            break;
+        case ZINT_CAPACITY_BYTE: /* Mode indicator and end then 9-bit count per block of up to 512, 8 bits each */
+            for (count = (bits - 17) / 8; count > 0 && 8 * count + 13 * ((count + 511) / 512) + 4 > bits; count--);
+            return count;
+            break;
+        case ZINT_CAPACITY_KANJI: /* Mode indicator and end then 13 bits each */
+            return (bits - 17) / 13;
+            break;
+    }
+    return 0;
+}
+
 /* vim: set ts=4 sw=4 et : */
@@ -507,8 +507,8 @@ static void hx_define_mode_segs(char mode[], const unsigned int ddata[], const s
 }
 
 /* Convert input data to binary stream */
-static void hx_calculate_binary(char binary[], const char mode[], const unsigned int ddata[], const int length,
-            const int eci, int *p_bp, const int debug_print) {
+static void hx_calculate_binary(unsigned char binary[], const char mode[], const unsigned int ddata[],
+            const int length, const int eci, int *p_bp, const int debug_print) {
     int position = 0;
     int i, count, encoding_value;
     int first_byte, second_byte;
@@ -519,15 +519,15 @@ static void hx_calculate_binary(char binary[], const char mode[], const unsigned
 
     if (eci != 0) {
         /* Encoding ECI assignment number, according to Table 5 */
-        bp = bin_append_posn(8, 4, binary, bp); /* ECI */
+        bp = bits_append_posn(8, 4, binary, bp); /* ECI */
         if (eci <= 127) {
-            bp = bin_append_posn(eci, 8, binary, bp);
+            bp = bits_append_posn(eci, 8, binary, bp);
         } else if (eci <= 16383) {
-            bp = bin_append_posn(2, 2, binary, bp);
-            bp = bin_append_posn(eci, 14, binary, bp);
+            bp = bits_append_posn(2, 2, binary, bp);
+            bp = bits_append_posn(eci, 14, binary, bp);
         } else {
-            bp = bin_append_posn(6, 3, binary, bp);
-            bp = bin_append_posn(eci, 21, binary, bp);
+            bp = bits_append_posn(6, 3, binary, bp);
+            bp = bits_append_posn(eci, 21, binary, bp);
         }
     }
 
@@ -545,7 +545,7 @@ static void hx_calculate_binary(char binary[], const char mode[], const unsigned
             case 'n':
                 /* Numeric mode */
                 /* Mode indicator */
-                bp = bin_append_posn(1, 4, binary, bp);
+                bp = bits_append_posn(1, 4, binary, bp);
 
                 if (debug_print) {
                     printf("Numeric\n");
@@ -571,7 +571,7 @@ static void hx_calculate_binary(char binary[], const char mode[], const unsigned
                         }
                     }
 
-                    bp = bin_append_posn(encoding_value, 10, binary, bp);
+                    bp = bits_append_posn(encoding_value, 10, binary, bp);
 
                     if (debug_print) {
                         printf("0x%3x (%d)", encoding_value, encoding_value);
@@ -583,13 +583,13 @@ static void hx_calculate_binary(char binary[], const char mode[], const unsigned
                 /* Mode terminator depends on number of characters in last group (Table 2) */
                 switch (count) {
                     case 1:
-                        bp = bin_append_posn(1021, 10, binary, bp);
+                        bp = bits_append_posn(1021, 10, binary, bp);
                         break;
                     case 2:
-                        bp = bin_append_posn(1022, 10, binary, bp);
+                        bp = bits_append_posn(1022, 10, binary, bp);
                         break;
                     case 3:
-                        bp = bin_append_posn(1023, 10, binary, bp);
+                        bp = bits_append_posn(1023, 10, binary, bp);
                         break;
                 }
 
@@ -601,7 +601,7 @@ static void hx_calculate_binary(char binary[], const char mode[], const unsigned
             case 't':
                 /* Text mode */
                 /* Mode indicator */
-                bp = bin_append_posn(2, 4, binary, bp);
+                bp = bits_append_posn(2, 4, binary, bp);
 
                 if (debug_print) {
                     printf("Text\n");
@@ -615,7 +615,7 @@ static void hx_calculate_binary(char binary[], const char mode[], const unsigned
 
                     if (hx_getsubmode(ddata[i + position]) != submode) {
                         /* Change submode */
-                        bp = bin_append_posn(62, 6, binary, bp);
+                        bp = bits_append_posn(62, 6, binary, bp);
                         submode = hx_getsubmode(ddata[i + position]);
                         if (debug_print) {
                             printf("SWITCH ");
@@ -628,7 +628,7 @@ static void hx_calculate_binary(char binary[], const char mode[], const unsigned
                         encoding_value = hx_lookup_text2(ddata[i + position]);
                     }
 
-                    bp = bin_append_posn(encoding_value, 6, binary, bp);
+                    bp = bits_append_posn(encoding_value, 6, binary, bp);
 
                     if (debug_print) {
                         printf("%.2x [ASC %.2x] ", encoding_value, ddata[i + position]);
@@ -637,7 +637,7 @@ static void hx_calculate_binary(char binary[], const char mode[], const unsigned
                 }
 
                 /* Terminator */
-                bp = bin_append_posn(63, 6, binary, bp);
+                bp = bits_append_posn(63, 6, binary, bp);
 
                 if (debug_print) {
                     printf("\n");
@@ -646,10 +646,10 @@ static void hx_calculate_binary(char binary[], const char mode[], const unsigned
             case 'b':
                 /* Binary Mode */
                 /* Mode indicator */
-                bp = bin_append_posn(3, 4, binary, bp);
+                bp = bits_append_posn(3, 4, binary, bp);
 
                 /* Count indicator */
-                bp = bin_append_posn(block_length + double_byte, 13, binary, bp);
+                bp = bits_append_posn(block_length + double_byte, 13, binary, bp);
 
                 if (debug_print) {
                     printf("Binary Mode (%d):", block_length + double_byte);
@@ -660,7 +660,7 @@ static void hx_calculate_binary(char binary[], const char mode[], const unsigned
                 while (i < block_length) {
 
                     /* 8-bit bytes with no conversion */
-                    bp = bin_append_posn(ddata[i + position], ddata[i + position] > 0xFF ? 16 : 8, binary, bp);
+                    bp = bits_append_posn(ddata[i + position], ddata[i + position] > 0xFF ? 16 : 8, binary, bp);
 
                     if (debug_print) {
                         printf(" %02x", (int) ddata[i + position]);
@@ -677,7 +677,7 @@ static void hx_calculate_binary(char binary[], const char mode[], const unsigned
                 /* Region One encoding */
                 /* Mode indicator */
                 if (position == 0 || mode[position - 1] != '2') { /* Unless previous mode Region Two */
-                    bp = bin_append_posn(4, 4, binary, bp);
+                    bp = bits_append_posn(4, 4, binary, bp);
                 }
 
                 if (debug_print) {
@@ -709,12 +709,12 @@ static void hx_calculate_binary(char binary[], const char mode[], const unsigned
                         printf("%.3x [GB %.4x] ", glyph, ddata[i + position]);
                     }
 
-                    bp = bin_append_posn(glyph, 12, binary, bp);
+                    bp = bits_append_posn(glyph, 12, binary, bp);
                     i++;
                 }
 
                 /* Terminator */
-                bp = bin_append_posn(position + block_length == length || mode[position + block_length] != '2'
+                bp = bits_append_posn(position + block_length == length || mode[position + block_length] != '2'
                                     ? 4095 : 4094, 12, binary, bp);
 
                 if (debug_print) {
@@ -727,7 +727,7 @@ static void hx_calculate_binary(char binary[], const char mode[], const unsigned
                 /* Region Two encoding */
                 /* Mode indicator */
                 if (position == 0 || mode[position - 1] != '1') { /* Unless previous mode Region One */
-                    bp = bin_append_posn(5, 4, binary, bp);
+                    bp = bits_append_posn(5, 4, binary, bp);
                 }
 
                 if (debug_print) {
@@ -746,12 +746,12 @@ static void hx_calculate_binary(char binary[], const char mode[], const unsigned
                         printf("%.3x [GB %.4x] ", glyph, ddata[i + position]);
                     }
 
-                    bp = bin_append_posn(glyph, 12, binary, bp);
+                    bp = bits_append_posn(glyph, 12, binary, bp);
                     i++;
                 }
 
                 /* Terminator */
-                bp = bin_append_posn(position + block_length == length || mode[position + block_length] != '1'
+                bp = bits_append_posn(position + block_length == length || mode[position + block_length] != '1'
                                     ? 4095 : 4094, 12, binary, bp);
 
                 if (debug_print) {
@@ -763,7 +763,7 @@ static void hx_calculate_binary(char binary[], const char mode[], const unsigned
             case 'd':
                 /* Double byte encoding */
                 /* Mode indicator */
-                bp = bin_append_posn(6, 4, binary, bp);
+                bp = bits_append_posn(6, 4, binary, bp);
 
                 if (debug_print) {
                     printf("Double byte\n");
@@ -785,12 +785,12 @@ static void hx_calculate_binary(char binary[], const char mode[], const unsigned
                         printf("%.4x ", glyph);
                     }
 
-                    bp = bin_append_posn(glyph, 15, binary, bp);
+                    bp = bits_append_posn(glyph, 15, binary, bp);
                     i++;
                 }
 
                 /* Terminator */
-                bp = bin_append_posn(32767, 15, binary, bp);
+                bp = bits_append_posn(32767, 15, binary, bp);
                 /* Terminator sequence of length 12 is a mistake
                    - confirmed by Wang Yi */
 
@@ -809,7 +809,7 @@ static void hx_calculate_binary(char binary[], const char mode[], const unsigned
                 while (i < block_length) {
 
                     /* Mode indicator */
-                    bp = bin_append_posn(7, 4, binary, bp);
+                    bp = bits_append_posn(7, 4, binary, bp);
 
                     first_byte = (ddata[i + position] & 0xff00) >> 8;
                     second_byte = ddata[i + position] & 0xff;
@@ -823,7 +823,7 @@ static void hx_calculate_binary(char binary[], const char mode[], const unsigned
                         printf("%d ", glyph);
                     }
 
-                    bp = bin_append_posn(glyph, 21, binary, bp);
+                    bp = bits_append_posn(glyph, 21, binary, bp);
                     i += 2;
                 }
 
@@ -839,13 +839,15 @@ static void hx_calculate_binary(char binary[], const char mode[], const unsigned
 
     } while (position < length);
 
-    if (debug_print) printf("Binary (%d): %.*s\n", bp, bp, binary);
+    if (debug_print) {
+        printf("Binary (%d): %s\n", bp, bits_dump(binary, bp, (char *) z_alloca(bp + 1)));
+    }
 
     *p_bp = bp;
 }
 
 /* Call `hx_calculate_binary()` for each segment */
-static void hx_calculate_binary_segs(char binary[], const char mode[], const unsigned int ddata[],
+static void hx_calculate_binary_segs(unsigned char binary[], const char mode[], const unsigned int ddata[],
             const struct zint_seg segs[], const int seg_count, int *p_bin_len, const int debug_print) {
     int i;
     const unsigned int *dd = ddata;
@@ -1113,14 +1115,24 @@ static void hx_setup_grid(unsigned char *grid, const int size, const int version
 /* Calculate error correction codes */
 static void hx_add_ecc(unsigned char fullstream[], const unsigned char datastream[], const int data_codewords,
             const int version, const int ecc_level) {
-    unsigned char data_block[180];
-    unsigned char ecc_block[36];
-    int i, j, block;
-    int input_position = -1;
-    int output_position = -1;
+    int i, block;
+    int input_position = 0;
+    int output_position = 0;
+    int total_length = 0;
     const int table_d1_pos = ((version - 1) * 36) + ((ecc_level - 1) * 9);
+    const unsigned char *data = datastream;
     rs_t rs;
 
+    for (i = 0; i < 3; i++) {
+        total_length += hx_table_d1[table_d1_pos + (3 * i)] * hx_table_d1[table_d1_pos + (3 * i) + 1];
+    }
+    if (total_length > data_codewords) { /* Zero-pad so that blocks can be read in place */
+        unsigned char *padded = (unsigned char *) z_alloca(total_length);
+        memcpy(padded, datastream, data_codewords);
+        memset(padded + data_codewords, 0, total_length - data_codewords);
+        data = padded;
+    }
+
     rs_init_gf(&rs, 0x163); /* x^8 + x^6 + x^5 + x + 1 = 0 */
 
     for (i = 0; i < 3; i++) {
@@ -1128,23 +1140,21 @@ static void hx_add_ecc(unsigned char fullstream[], const unsigned char datastrea
         const int data_length = hx_table_d1[table_d1_pos + (3 * i) + 1];
         const int ecc_length = hx_table_d1[table_d1_pos + (3 * i) + 2];
 
-        rs_init_code(&rs, ecc_length, 1);
+        if (!batch_size) {
+            continue;
+        }
 
+        /* Each block's data followed by its ECC */
         for (block = 0; block < batch_size; block++) {
-            for (j = 0; j < data_length; j++) {
-                input_position++;
-                output_position++;
-                data_block[j] = input_position < data_codewords ? datastream[input_position] : 0;
-                fullstream[output_position] = data_block[j];
-            }
-
-            rs_encode(&rs, data_length, data_block, ecc_block);
-
-            for (j = 0; j < ecc_length; j++) {
-                output_position++;
-                fullstream[output_position] = ecc_block[ecc_length - j - 1];
-            }
+            memcpy(fullstream + output_position + block * (data_length + ecc_length),
+                    data + input_position + block * data_length, data_length);
         }
+        rs_init_code(&rs, ecc_length, 1);
+        rs_encode_blocks(&rs, batch_size, data_length, data + input_position, data_length, 1,
+                        fullstream + output_position + data_length, data_length + ecc_length, 1 /*res_step*/);
+
+        input_position += batch_size * data_length;
+        output_position += batch_size * (data_length + ecc_length);
     }
 }
 
@@ -1491,7 +1501,7 @@ INTERNAL int hanxin(struct zint_symbol *symbol, struct zint_seg segs[], const in
     struct zint_seg *local_segs = (struct zint_seg *) z_alloca(sizeof(struct zint_seg) * seg_count);
     unsigned int *ddata = (unsigned int *) z_alloca(sizeof(unsigned int) * eci_length_segs);
     char *mode = (char *) z_alloca(eci_length_segs);
-    char *binary;
+    unsigned char *binary;
     unsigned char *datastream;
     unsigned char *fullstream;
     unsigned char *picket_fence;
@@ -1538,11 +1548,14 @@ INTERNAL int hanxin(struct zint_symbol *symbol, struct zint_seg segs[], const in
         }
     }
 
+    STATS_BEGIN(symbol, ZINT_PHASE_MODE);
     hx_define_mode_segs(mode, ddata, local_segs, seg_count, debug_print);
+    STATS_END(symbol, ZINT_PHASE_MODE);
 
     est_binlen = hx_calc_binlen_segs(mode, ddata, local_segs, seg_count);
 
-    binary = (char *) z_alloca((est_binlen + 1));
+    binary = (unsigned char *) z_alloca(BITS_SIZE(est_binlen));
+    memset(binary, 0, BITS_SIZE(est_binlen));
 
     if ((ecc_level <= 0) || (ecc_level >= 5)) {
         ecc_level = 1;
@@ -1636,13 +1649,8 @@ INTERNAL int hanxin(struct zint_symbol *symbol, struct zint_seg segs[], const in
     picket_fence = (unsigned char *) z_alloca(hx_total_codewords[version - 1]);
     grid = (unsigned char *) z_alloca(size_squared);
 
-    memset(datastream, 0, data_codewords);
-
-    for (i = 0; i < bin_len; i++) {
-        if (binary[i] == '1') {
-            datastream[i >> 3] |= 0x80 >> (i & 0x07);
-        }
-    }
+    memcpy(datastream, binary, codewords); /* Any trailing bits in last codeword already zero */
+    memset(datastream + codewords, 0, data_codewords - codewords);
 
     if (debug_print) {
         printf("Datastream (%d): ", data_codewords);
@@ -1657,7 +1665,9 @@ INTERNAL int hanxin(struct zint_symbol *symbol, struct zint_seg segs[], const in
 
     hx_setup_grid(grid, size, version);
 
+    STATS_BEGIN(symbol, ZINT_PHASE_RS);
     hx_add_ecc(fullstream, datastream, data_codewords, version, ecc_level);
+    STATS_END(symbol, ZINT_PHASE_RS);
 
     if (debug_print) {
         printf("Fullstream (%d): ", hx_total_codewords[version - 1]);
@@ -1685,7 +1695,11 @@ INTERNAL int hanxin(struct zint_symbol *symbol, struct zint_seg segs[], const in
         }
     }
 
+    STATS_BEGIN(symbol, ZINT_PHASE_MASK);
     hx_apply_bitmask(grid, size, version, ecc_level, user_mask, debug_print);
+    STATS_END(symbol, ZINT_PHASE_MASK);
+    STATS_SET(symbol, version, version);
+    STATS_SET(symbol, ecc_level, ecc_level);
 
     symbol->width = size;
     symbol->rows = size;
@@ -1704,4 +1718,42 @@ INTERNAL int hanxin(struct zint_symbol *symbol, struct zint_seg segs[], const in
     return warn_number;
 }
 
+/* Return the maximum number of characters of `char_type` (ZINT_CAPACITY_XXX) that Han Xin Code can hold at ECC level
+   `option_1` and version `option_2`, or 0 if not supported (`ZBarcode_Capacity()`). Kanji is taken to mean GB 2312
+   Region One Hanzi */
+INTERNAL int hx_capacity(const int option_1, const int option_2, const int char_type) {
+    int bits;
+
+    if (option_1 < -1 || option_1 > 4 || option_2 < 0 || option_2 > 84) {
+        return 0;
+    }
+    switch (option_1) {
+        case 2: bits = hx_data_codewords_L2[option_2 ? option_2 - 1 : 83];
+            break;
+        case 3: bits = hx_data_codewords_L3[option_2 ? option_2 - 1 : 83];
+            break;
+        case 4: bits = hx_data_codewords_L4[option_2 ? option_2 - 1 : 83];
+            break;
+        default: bits = hx_data_codewords_L1[option_2 ? option_2 - 1 : 83];
+            break;
+    }
+    bits *= 8;
+
+    switch (char_type) {
+        case ZINT_CAPACITY_NUMERIC: /* Mode indicator and terminator then 10 bits per 3 digits */
+            return ((bits - 14) / 10) * 3;
+            break;
+        case ZINT_CAPACITY_ALPHANUMERIC: /* Text mode indicator and terminator then 6 bits each */
+            return (bits - 10) / 6;
+            break;
+        case ZINT_CAPACITY_BYTE: /* Binary mode indicator and 13-bit count then 8 bits each */
+            return (bits - 17) / 8;
+            break;
+        case ZINT_CAPACITY_KANJI: /* Region One mode indicator and terminator then 12 bits each */
+            return (bits - 16) / 12;
+            break;
+    }
+    return 0;
+}
+
 /* vim: set ts=4 sw=4 et : */
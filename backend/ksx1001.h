@@ -370,459 +370,284 @@ static const unsigned short ksx1001_uro_mb_ind[1306] = {
      5505,  5506,
 };
 
-/* Unicode codepoints sorted */
-static const unsigned short ksx1001_u[3607] = {
-    0x00A1, 0x00A4, 0x00A7, 0x00A8, 0x00AA, 0x00AD, 0x00AE, 0x00B0,
-    0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B6, 0x00B7, 0x00B8, 0x00B9,
-    0x00BA, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C6, 0x00D0, 0x00D7,
-    0x00D8, 0x00DE, 0x00DF, 0x00E6, 0x00F0, 0x00F7, 0x00F8, 0x00FE,
-    0x0111, 0x0126, 0x0127, 0x0131, 0x0132, 0x0133, 0x0138, 0x013F,
-    0x0140, 0x0141, 0x0142, 0x0149, 0x014A, 0x014B, 0x0152, 0x0153,
-    0x0166, 0x0167, 0x02C7, 0x02D0, 0x02D8, 0x02D9, 0x02DA, 0x02DB,
-    0x02DD, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397,
-    0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F,
-    0x03A0, 0x03A1, 0x03A3, 0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8,
-    0x03A9, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7,
-    0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF,
-    0x03C0, 0x03C1, 0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8,
-    0x03C9, 0x0401, 0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415,
-    0x0416, 0x0417, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D,
-    0x041E, 0x041F, 0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425,
-    0x0426, 0x0427, 0x0428, 0x0429, 0x042A, 0x042B, 0x042C, 0x042D,
-    0x042E, 0x042F, 0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435,
-    0x0436, 0x0437, 0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D,
-    0x043E, 0x043F, 0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445,
-    0x0446, 0x0447, 0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D,
-    0x044E, 0x044F, 0x0451, 0x2015, 0x2018, 0x2019, 0x201C, 0x201D,
-    0x2020, 0x2021, 0x2025, 0x2026, 0x2030, 0x2032, 0x2033, 0x203B,
-    0x2074, 0x207F, 0x2081, 0x2082, 0x2083, 0x2084, 0x20AC, 0x2103,
-    0x2109, 0x2113, 0x2116, 0x2121, 0x2122, 0x2126, 0x212B, 0x2153,
-    0x2154, 0x215B, 0x215C, 0x215D, 0x215E, 0x2160, 0x2161, 0x2162,
-    0x2163, 0x2164, 0x2165, 0x2166, 0x2167, 0x2168, 0x2169, 0x2170,
-    0x2171, 0x2172, 0x2173, 0x2174, 0x2175, 0x2176, 0x2177, 0x2178,
-    0x2179, 0x2190, 0x2191, 0x2192, 0x2193, 0x2194, 0x2195, 0x2196,
-    0x2197, 0x2198, 0x2199, 0x21D2, 0x21D4, 0x2200, 0x2202, 0x2203,
-    0x2207, 0x2208, 0x220B, 0x220F, 0x2211, 0x221A, 0x221D, 0x221E,
-    0x2220, 0x2225, 0x2227, 0x2228, 0x2229, 0x222A, 0x222B, 0x222C,
-    0x222E, 0x2234, 0x2235, 0x223C, 0x223D, 0x2252, 0x2260, 0x2261,
-    0x2264, 0x2265, 0x226A, 0x226B, 0x2282, 0x2283, 0x2286, 0x2287,
-    0x2299, 0x22A5, 0x2312, 0x2460, 0x2461, 0x2462, 0x2463, 0x2464,
-    0x2465, 0x2466, 0x2467, 0x2468, 0x2469, 0x246A, 0x246B, 0x246C,
-    0x246D, 0x246E, 0x2474, 0x2475, 0x2476, 0x2477, 0x2478, 0x2479,
-    0x247A, 0x247B, 0x247C, 0x247D, 0x247E, 0x247F, 0x2480, 0x2481,
-    0x2482, 0x249C, 0x249D, 0x249E, 0x249F, 0x24A0, 0x24A1, 0x24A2,
-    0x24A3, 0x24A4, 0x24A5, 0x24A6, 0x24A7, 0x24A8, 0x24A9, 0x24AA,
-    0x24AB, 0x24AC, 0x24AD, 0x24AE, 0x24AF, 0x24B0, 0x24B1, 0x24B2,
-    0x24B3, 0x24B4, 0x24B5, 0x24D0, 0x24D1, 0x24D2, 0x24D3, 0x24D4,
-    0x24D5, 0x24D6, 0x24D7, 0x24D8, 0x24D9, 0x24DA, 0x24DB, 0x24DC,
-    0x24DD, 0x24DE, 0x24DF, 0x24E0, 0x24E1, 0x24E2, 0x24E3, 0x24E4,
-    0x24E5, 0x24E6, 0x24E7, 0x24E8, 0x24E9, 0x2500, 0x2501, 0x2502,
-    0x2503, 0x250C, 0x250D, 0x250E, 0x250F, 0x2510, 0x2511, 0x2512,
-    0x2513, 0x2514, 0x2515, 0x2516, 0x2517, 0x2518, 0x2519, 0x251A,
-    0x251B, 0x251C, 0x251D, 0x251E, 0x251F, 0x2520, 0x2521, 0x2522,
-    0x2523, 0x2524, 0x2525, 0x2526, 0x2527, 0x2528, 0x2529, 0x252A,
-    0x252B, 0x252C, 0x252D, 0x252E, 0x252F, 0x2530, 0x2531, 0x2532,
-    0x2533, 0x2534, 0x2535, 0x2536, 0x2537, 0x2538, 0x2539, 0x253A,
-    0x253B, 0x253C, 0x253D, 0x253E, 0x253F, 0x2540, 0x2541, 0x2542,
-    0x2543, 0x2544, 0x2545, 0x2546, 0x2547, 0x2548, 0x2549, 0x254A,
-    0x254B, 0x2592, 0x25A0, 0x25A1, 0x25A3, 0x25A4, 0x25A5, 0x25A6,
-    0x25A7, 0x25A8, 0x25A9, 0x25B2, 0x25B3, 0x25B6, 0x25B7, 0x25BC,
-    0x25BD, 0x25C0, 0x25C1, 0x25C6, 0x25C7, 0x25C8, 0x25CB, 0x25CE,
-    0x25CF, 0x25D0, 0x25D1, 0x2605, 0x2606, 0x260E, 0x260F, 0x261C,
-    0x261E, 0x2640, 0x2642, 0x2660, 0x2661, 0x2663, 0x2664, 0x2665,
-    0x2667, 0x2668, 0x2669, 0x266A, 0x266C, 0x266D, 0x3000, 0x3001,
-    0x3002, 0x3003, 0x3008, 0x3009, 0x300A, 0x300B, 0x300C, 0x300D,
-    0x300E, 0x300F, 0x3010, 0x3011, 0x3013, 0x3014, 0x3015, 0x3041,
-    0x3042, 0x3043, 0x3044, 0x3045, 0x3046, 0x3047, 0x3048, 0x3049,
-    0x304A, 0x304B, 0x304C, 0x304D, 0x304E, 0x304F, 0x3050, 0x3051,
-    0x3052, 0x3053, 0x3054, 0x3055, 0x3056, 0x3057, 0x3058, 0x3059,
-    0x305A, 0x305B, 0x305C, 0x305D, 0x305E, 0x305F, 0x3060, 0x3061,
-    0x3062, 0x3063, 0x3064, 0x3065, 0x3066, 0x3067, 0x3068, 0x3069,
-    0x306A, 0x306B, 0x306C, 0x306D, 0x306E, 0x306F, 0x3070, 0x3071,
-    0x3072, 0x3073, 0x3074, 0x3075, 0x3076, 0x3077, 0x3078, 0x3079,
-    0x307A, 0x307B, 0x307C, 0x307D, 0x307E, 0x307F, 0x3080, 0x3081,
-    0x3082, 0x3083, 0x3084, 0x3085, 0x3086, 0x3087, 0x3088, 0x3089,
-    0x308A, 0x308B, 0x308C, 0x308D, 0x308E, 0x308F, 0x3090, 0x3091,
-    0x3092, 0x3093, 0x30A1, 0x30A2, 0x30A3, 0x30A4, 0x30A5, 0x30A6,
-    0x30A7, 0x30A8, 0x30A9, 0x30AA, 0x30AB, 0x30AC, 0x30AD, 0x30AE,
-    0x30AF, 0x30B0, 0x30B1, 0x30B2, 0x30B3, 0x30B4, 0x30B5, 0x30B6,
-    0x30B7, 0x30B8, 0x30B9, 0x30BA, 0x30BB, 0x30BC, 0x30BD, 0x30BE,
-    0x30BF, 0x30C0, 0x30C1, 0x30C2, 0x30C3, 0x30C4, 0x30C5, 0x30C6,
-    0x30C7, 0x30C8, 0x30C9, 0x30CA, 0x30CB, 0x30CC, 0x30CD, 0x30CE,
-    0x30CF, 0x30D0, 0x30D1, 0x30D2, 0x30D3, 0x30D4, 0x30D5, 0x30D6,
-    0x30D7, 0x30D8, 0x30D9, 0x30DA, 0x30DB, 0x30DC, 0x30DD, 0x30DE,
-    0x30DF, 0x30E0, 0x30E1, 0x30E2, 0x30E3, 0x30E4, 0x30E5, 0x30E6,
-    0x30E7, 0x30E8, 0x30E9, 0x30EA, 0x30EB, 0x30EC, 0x30ED, 0x30EE,
-    0x30EF, 0x30F0, 0x30F1, 0x30F2, 0x30F3, 0x30F4, 0x30F5, 0x30F6,
-    0x3131, 0x3132, 0x3133, 0x3134, 0x3135, 0x3136, 0x3137, 0x3138,
-    0x3139, 0x313A, 0x313B, 0x313C, 0x313D, 0x313E, 0x313F, 0x3140,
-    0x3141, 0x3142, 0x3143, 0x3144, 0x3145, 0x3146, 0x3147, 0x3148,
-    0x3149, 0x314A, 0x314B, 0x314C, 0x314D, 0x314E, 0x314F, 0x3150,
-    0x3151, 0x3152, 0x3153, 0x3154, 0x3155, 0x3156, 0x3157, 0x3158,
-    0x3159, 0x315A, 0x315B, 0x315C, 0x315D, 0x315E, 0x315F, 0x3160,
-    0x3161, 0x3162, 0x3163, 0x3164, 0x3165, 0x3166, 0x3167, 0x3168,
-    0x3169, 0x316A, 0x316B, 0x316C, 0x316D, 0x316E, 0x316F, 0x3170,
-    0x3171, 0x3172, 0x3173, 0x3174, 0x3175, 0x3176, 0x3177, 0x3178,
-    0x3179, 0x317A, 0x317B, 0x317C, 0x317D, 0x317E, 0x317F, 0x3180,
-    0x3181, 0x3182, 0x3183, 0x3184, 0x3185, 0x3186, 0x3187, 0x3188,
-    0x3189, 0x318A, 0x318B, 0x318C, 0x318D, 0x318E, 0x3200, 0x3201,
-    0x3202, 0x3203, 0x3204, 0x3205, 0x3206, 0x3207, 0x3208, 0x3209,
-    0x320A, 0x320B, 0x320C, 0x320D, 0x320E, 0x320F, 0x3210, 0x3211,
-    0x3212, 0x3213, 0x3214, 0x3215, 0x3216, 0x3217, 0x3218, 0x3219,
-    0x321A, 0x321B, 0x321C, 0x3260, 0x3261, 0x3262, 0x3263, 0x3264,
-    0x3265, 0x3266, 0x3267, 0x3268, 0x3269, 0x326A, 0x326B, 0x326C,
-    0x326D, 0x326E, 0x326F, 0x3270, 0x3271, 0x3272, 0x3273, 0x3274,
-    0x3275, 0x3276, 0x3277, 0x3278, 0x3279, 0x327A, 0x327B, 0x327E,
-    0x327F, 0x3380, 0x3381, 0x3382, 0x3383, 0x3384, 0x3388, 0x3389,
-    0x338A, 0x338B, 0x338C, 0x338D, 0x338E, 0x338F, 0x3390, 0x3391,
-    0x3392, 0x3393, 0x3394, 0x3395, 0x3396, 0x3397, 0x3398, 0x3399,
-    0x339A, 0x339B, 0x339C, 0x339D, 0x339E, 0x339F, 0x33A0, 0x33A1,
-    0x33A2, 0x33A3, 0x33A4, 0x33A5, 0x33A6, 0x33A7, 0x33A8, 0x33A9,
-    0x33AA, 0x33AB, 0x33AC, 0x33AD, 0x33AE, 0x33AF, 0x33B0, 0x33B1,
-    0x33B2, 0x33B3, 0x33B4, 0x33B5, 0x33B6, 0x33B7, 0x33B8, 0x33B9,
-    0x33BA, 0x33BB, 0x33BC, 0x33BD, 0x33BE, 0x33BF, 0x33C0, 0x33C1,
-    0x33C2, 0x33C3, 0x33C4, 0x33C5, 0x33C6, 0x33C7, 0x33C8, 0x33C9,
-    0x33CA, 0x33CF, 0x33D0, 0x33D3, 0x33D6, 0x33D8, 0x33DB, 0x33DC,
-    0x33DD, 0xAC00, 0xAC01, 0xAC04, 0xAC07, 0xAC08, 0xAC09, 0xAC0A,
-    0xAC10, 0xAC11, 0xAC12, 0xAC13, 0xAC14, 0xAC15, 0xAC16, 0xAC17,
-    0xAC19, 0xAC1A, 0xAC1B, 0xAC1C, 0xAC1D, 0xAC20, 0xAC24, 0xAC2C,
-    0xAC2D, 0xAC2F, 0xAC30, 0xAC31, 0xAC38, 0xAC39, 0xAC3C, 0xAC40,
-    0xAC4B, 0xAC4D, 0xAC54, 0xAC58, 0xAC5C, 0xAC70, 0xAC71, 0xAC74,
-    0xAC77, 0xAC78, 0xAC7A, 0xAC80, 0xAC81, 0xAC83, 0xAC84, 0xAC85,
-    0xAC86, 0xAC89, 0xAC8A, 0xAC8B, 0xAC8C, 0xAC90, 0xAC94, 0xAC9C,
-    0xAC9D, 0xAC9F, 0xACA0, 0xACA1, 0xACA8, 0xACA9, 0xACAA, 0xACAC,
-    0xACAF, 0xACB0, 0xACB8, 0xACB9, 0xACBB, 0xACBC, 0xACBD, 0xACC1,
-    0xACC4, 0xACC8, 0xACCC, 0xACD5, 0xACD7, 0xACE0, 0xACE1, 0xACE4,
-    0xACE7, 0xACE8, 0xACEA, 0xACEC, 0xACEF, 0xACF0, 0xACF1, 0xACF3,
-    0xACF5, 0xACF6, 0xACFC, 0xACFD, 0xAD00, 0xAD04, 0xAD06, 0xAD0C,
-    0xAD0D, 0xAD0F, 0xAD11, 0xAD18, 0xAD1C, 0xAD20, 0xAD29, 0xAD2C,
-    0xAD2D, 0xAD34, 0xAD35, 0xAD38, 0xAD3C, 0xAD44, 0xAD45, 0xAD47,
-    0xAD49, 0xAD50, 0xAD54, 0xAD58, 0xAD61, 0xAD63, 0xAD6C, 0xAD6D,
-    0xAD70, 0xAD73, 0xAD74, 0xAD75, 0xAD76, 0xAD7B, 0xAD7C, 0xAD7D,
-    0xAD7F, 0xAD81, 0xAD82, 0xAD88, 0xAD89, 0xAD8C, 0xAD90, 0xAD9C,
-    0xAD9D, 0xADA4, 0xADB7, 0xADC0, 0xADC1, 0xADC4, 0xADC8, 0xADD0,
-    0xADD1, 0xADD3, 0xADDC, 0xADE0, 0xADE4, 0xADF8, 0xADF9, 0xADFC,
-    0xADFF, 0xAE00, 0xAE01, 0xAE08, 0xAE09, 0xAE0B, 0xAE0D, 0xAE14,
-    0xAE30, 0xAE31, 0xAE34, 0xAE37, 0xAE38, 0xAE3A, 0xAE40, 0xAE41,
-    0xAE43, 0xAE45, 0xAE46, 0xAE4A, 0xAE4C, 0xAE4D, 0xAE4E, 0xAE50,
-    0xAE54, 0xAE56, 0xAE5C, 0xAE5D, 0xAE5F, 0xAE60, 0xAE61, 0xAE65,
-    0xAE68, 0xAE69, 0xAE6C, 0xAE70, 0xAE78, 0xAE79, 0xAE7B, 0xAE7C,
-    0xAE7D, 0xAE84, 0xAE85, 0xAE8C, 0xAEBC, 0xAEBD, 0xAEBE, 0xAEC0,
-    0xAEC4, 0xAECC, 0xAECD, 0xAECF, 0xAED0, 0xAED1, 0xAED8, 0xAED9,
-    0xAEDC, 0xAEE8, 0xAEEB, 0xAEED, 0xAEF4, 0xAEF8, 0xAEFC, 0xAF07,
-    0xAF08, 0xAF0D, 0xAF10, 0xAF2C, 0xAF2D, 0xAF30, 0xAF32, 0xAF34,
-    0xAF3C, 0xAF3D, 0xAF3F, 0xAF41, 0xAF42, 0xAF43, 0xAF48, 0xAF49,
-    0xAF50, 0xAF5C, 0xAF5D, 0xAF64, 0xAF65, 0xAF79, 0xAF80, 0xAF84,
-    0xAF88, 0xAF90, 0xAF91, 0xAF95, 0xAF9C, 0xAFB8, 0xAFB9, 0xAFBC,
-    0xAFC0, 0xAFC7, 0xAFC8, 0xAFC9, 0xAFCB, 0xAFCD, 0xAFCE, 0xAFD4,
-    0xAFDC, 0xAFE8, 0xAFE9, 0xAFF0, 0xAFF1, 0xAFF4, 0xAFF8, 0xB000,
-    0xB001, 0xB004, 0xB00C, 0xB010, 0xB014, 0xB01C, 0xB01D, 0xB028,
-    0xB044, 0xB045, 0xB048, 0xB04A, 0xB04C, 0xB04E, 0xB053, 0xB054,
-    0xB055, 0xB057, 0xB059, 0xB05D, 0xB07C, 0xB07D, 0xB080, 0xB084,
-    0xB08C, 0xB08D, 0xB08F, 0xB091, 0xB098, 0xB099, 0xB09A, 0xB09C,
-    0xB09F, 0xB0A0, 0xB0A1, 0xB0A2, 0xB0A8, 0xB0A9, 0xB0AB, 0xB0AC,
-    0xB0AD, 0xB0AE, 0xB0AF, 0xB0B1, 0xB0B3, 0xB0B4, 0xB0B5, 0xB0B8,
-    0xB0BC, 0xB0C4, 0xB0C5, 0xB0C7, 0xB0C8, 0xB0C9, 0xB0D0, 0xB0D1,
-    0xB0D4, 0xB0D8, 0xB0E0, 0xB0E5, 0xB108, 0xB109, 0xB10B, 0xB10C,
-    0xB110, 0xB112, 0xB113, 0xB118, 0xB119, 0xB11B, 0xB11C, 0xB11D,
-    0xB123, 0xB124, 0xB125, 0xB128, 0xB12C, 0xB134, 0xB135, 0xB137,
-    0xB138, 0xB139, 0xB140, 0xB141, 0xB144, 0xB148, 0xB150, 0xB151,
-    0xB154, 0xB155, 0xB158, 0xB15C, 0xB160, 0xB178, 0xB179, 0xB17C,
-    0xB180, 0xB182, 0xB188, 0xB189, 0xB18B, 0xB18D, 0xB192, 0xB193,
-    0xB194, 0xB198, 0xB19C, 0xB1A8, 0xB1CC, 0xB1D0, 0xB1D4, 0xB1DC,
-    0xB1DD, 0xB1DF, 0xB1E8, 0xB1E9, 0xB1EC, 0xB1F0, 0xB1F9, 0xB1FB,
-    0xB1FD, 0xB204, 0xB205, 0xB208, 0xB20B, 0xB20C, 0xB214, 0xB215,
-    0xB217, 0xB219, 0xB220, 0xB234, 0xB23C, 0xB258, 0xB25C, 0xB260,
-    0xB268, 0xB269, 0xB274, 0xB275, 0xB27C, 0xB284, 0xB285, 0xB289,
-    0xB290, 0xB291, 0xB294, 0xB298, 0xB299, 0xB29A, 0xB2A0, 0xB2A1,
-    0xB2A3, 0xB2A5, 0xB2A6, 0xB2AA, 0xB2AC, 0xB2B0, 0xB2B4, 0xB2C8,
-    0xB2C9, 0xB2CC, 0xB2D0, 0xB2D2, 0xB2D8, 0xB2D9, 0xB2DB, 0xB2DD,
-    0xB2E2, 0xB2E4, 0xB2E5, 0xB2E6, 0xB2E8, 0xB2EB, 0xB2EC, 0xB2ED,
-    0xB2EE, 0xB2EF, 0xB2F3, 0xB2F4, 0xB2F5, 0xB2F7, 0xB2F8, 0xB2F9,
-    0xB2FA, 0xB2FB, 0xB2FF, 0xB300, 0xB301, 0xB304, 0xB308, 0xB310,
-    0xB311, 0xB313, 0xB314, 0xB315, 0xB31C, 0xB354, 0xB355, 0xB356,
-    0xB358, 0xB35B, 0xB35C, 0xB35E, 0xB35F, 0xB364, 0xB365, 0xB367,
-    0xB369, 0xB36B, 0xB36E, 0xB370, 0xB371, 0xB374, 0xB378, 0xB380,
-    0xB381, 0xB383, 0xB384, 0xB385, 0xB38C, 0xB390, 0xB394, 0xB3A0,
-    0xB3A1, 0xB3A8, 0xB3AC, 0xB3C4, 0xB3C5, 0xB3C8, 0xB3CB, 0xB3CC,
-    0xB3CE, 0xB3D0, 0xB3D4, 0xB3D5, 0xB3D7, 0xB3D9, 0xB3DB, 0xB3DD,
-    0xB3E0, 0xB3E4, 0xB3E8, 0xB3FC, 0xB410, 0xB418, 0xB41C, 0xB420,
-    0xB428, 0xB429, 0xB42B, 0xB434, 0xB450, 0xB451, 0xB454, 0xB458,
-    0xB460, 0xB461, 0xB463, 0xB465, 0xB46C, 0xB480, 0xB488, 0xB49D,
-    0xB4A4, 0xB4A8, 0xB4AC, 0xB4B5, 0xB4B7, 0xB4B9, 0xB4C0, 0xB4C4,
-    0xB4C8, 0xB4D0, 0xB4D5, 0xB4DC, 0xB4DD, 0xB4E0, 0xB4E3, 0xB4E4,
-    0xB4E6, 0xB4EC, 0xB4ED, 0xB4EF, 0xB4F1, 0xB4F8, 0xB514, 0xB515,
-    0xB518, 0xB51B, 0xB51C, 0xB524, 0xB525, 0xB527, 0xB528, 0xB529,
-    0xB52A, 0xB530, 0xB531, 0xB534, 0xB538, 0xB540, 0xB541, 0xB543,
-    0xB544, 0xB545, 0xB54B, 0xB54C, 0xB54D, 0xB550, 0xB554, 0xB55C,
-    0xB55D, 0xB55F, 0xB560, 0xB561, 0xB5A0, 0xB5A1, 0xB5A4, 0xB5A8,
-    0xB5AA, 0xB5AB, 0xB5B0, 0xB5B1, 0xB5B3, 0xB5B4, 0xB5B5, 0xB5BB,
-    0xB5BC, 0xB5BD, 0xB5C0, 0xB5C4, 0xB5CC, 0xB5CD, 0xB5CF, 0xB5D0,
-    0xB5D1, 0xB5D8, 0xB5EC, 0xB610, 0xB611, 0xB614, 0xB618, 0xB625,
-    0xB62C, 0xB634, 0xB648, 0xB664, 0xB668, 0xB69C, 0xB69D, 0xB6A0,
-    0xB6A4, 0xB6AB, 0xB6AC, 0xB6B1, 0xB6D4, 0xB6F0, 0xB6F4, 0xB6F8,
-    0xB700, 0xB701, 0xB705, 0xB728, 0xB729, 0xB72C, 0xB72F, 0xB730,
-    0xB738, 0xB739, 0xB73B, 0xB744, 0xB748, 0xB74C, 0xB754, 0xB755,
-    0xB760, 0xB764, 0xB768, 0xB770, 0xB771, 0xB773, 0xB775, 0xB77C,
-    0xB77D, 0xB780, 0xB784, 0xB78C, 0xB78D, 0xB78F, 0xB790, 0xB791,
-    0xB792, 0xB796, 0xB797, 0xB798, 0xB799, 0xB79C, 0xB7A0, 0xB7A8,
-    0xB7A9, 0xB7AB, 0xB7AC, 0xB7AD, 0xB7B4, 0xB7B5, 0xB7B8, 0xB7C7,
-    0xB7C9, 0xB7EC, 0xB7ED, 0xB7F0, 0xB7F4, 0xB7FC, 0xB7FD, 0xB7FF,
-    0xB800, 0xB801, 0xB807, 0xB808, 0xB809, 0xB80C, 0xB810, 0xB818,
-    0xB819, 0xB81B, 0xB81D, 0xB824, 0xB825, 0xB828, 0xB82C, 0xB834,
-    0xB835, 0xB837, 0xB838, 0xB839, 0xB840, 0xB844, 0xB851, 0xB853,
-    0xB85C, 0xB85D, 0xB860, 0xB864, 0xB86C, 0xB86D, 0xB86F, 0xB871,
-    0xB878, 0xB87C, 0xB88D, 0xB8A8, 0xB8B0, 0xB8B4, 0xB8B8, 0xB8C0,
-    0xB8C1, 0xB8C3, 0xB8C5, 0xB8CC, 0xB8D0, 0xB8D4, 0xB8DD, 0xB8DF,
-    0xB8E1, 0xB8E8, 0xB8E9, 0xB8EC, 0xB8F0, 0xB8F8, 0xB8F9, 0xB8FB,
-    0xB8FD, 0xB904, 0xB918, 0xB920, 0xB93C, 0xB93D, 0xB940, 0xB944,
-    0xB94C, 0xB94F, 0xB951, 0xB958, 0xB959, 0xB95C, 0xB960, 0xB968,
-    0xB969, 0xB96B, 0xB96D, 0xB974, 0xB975, 0xB978, 0xB97C, 0xB984,
-    0xB985, 0xB987, 0xB989, 0xB98A, 0xB98D, 0xB98E, 0xB9AC, 0xB9AD,
-    0xB9B0, 0xB9B4, 0xB9BC, 0xB9BD, 0xB9BF, 0xB9C1, 0xB9C8, 0xB9C9,
-    0xB9CC, 0xB9CE, 0xB9CF, 0xB9D0, 0xB9D1, 0xB9D2, 0xB9D8, 0xB9D9,
-    0xB9DB, 0xB9DD, 0xB9DE, 0xB9E1, 0xB9E3, 0xB9E4, 0xB9E5, 0xB9E8,
-    0xB9EC, 0xB9F4, 0xB9F5, 0xB9F7, 0xB9F8, 0xB9F9, 0xB9FA, 0xBA00,
-    0xBA01, 0xBA08, 0xBA15, 0xBA38, 0xBA39, 0xBA3C, 0xBA40, 0xBA42,
-    0xBA48, 0xBA49, 0xBA4B, 0xBA4D, 0xBA4E, 0xBA53, 0xBA54, 0xBA55,
-    0xBA58, 0xBA5C, 0xBA64, 0xBA65, 0xBA67, 0xBA68, 0xBA69, 0xBA70,
-    0xBA71, 0xBA74, 0xBA78, 0xBA83, 0xBA84, 0xBA85, 0xBA87, 0xBA8C,
-    0xBAA8, 0xBAA9, 0xBAAB, 0xBAAC, 0xBAB0, 0xBAB2, 0xBAB8, 0xBAB9,
-    0xBABB, 0xBABD, 0xBAC4, 0xBAC8, 0xBAD8, 0xBAD9, 0xBAFC, 0xBB00,
-    0xBB04, 0xBB0D, 0xBB0F, 0xBB11, 0xBB18, 0xBB1C, 0xBB20, 0xBB29,
-    0xBB2B, 0xBB34, 0xBB35, 0xBB36, 0xBB38, 0xBB3B, 0xBB3C, 0xBB3D,
-    0xBB3E, 0xBB44, 0xBB45, 0xBB47, 0xBB49, 0xBB4D, 0xBB4F, 0xBB50,
-    0xBB54, 0xBB58, 0xBB61, 0xBB63, 0xBB6C, 0xBB88, 0xBB8C, 0xBB90,
-    0xBBA4, 0xBBA8, 0xBBAC, 0xBBB4, 0xBBB7, 0xBBC0, 0xBBC4, 0xBBC8,
-    0xBBD0, 0xBBD3, 0xBBF8, 0xBBF9, 0xBBFC, 0xBBFF, 0xBC00, 0xBC02,
-    0xBC08, 0xBC09, 0xBC0B, 0xBC0C, 0xBC0D, 0xBC0F, 0xBC11, 0xBC14,
-    0xBC15, 0xBC16, 0xBC17, 0xBC18, 0xBC1B, 0xBC1C, 0xBC1D, 0xBC1E,
-    0xBC1F, 0xBC24, 0xBC25, 0xBC27, 0xBC29, 0xBC2D, 0xBC30, 0xBC31,
-    0xBC34, 0xBC38, 0xBC40, 0xBC41, 0xBC43, 0xBC44, 0xBC45, 0xBC49,
-    0xBC4C, 0xBC4D, 0xBC50, 0xBC5D, 0xBC84, 0xBC85, 0xBC88, 0xBC8B,
-    0xBC8C, 0xBC8E, 0xBC94, 0xBC95, 0xBC97, 0xBC99, 0xBC9A, 0xBCA0,
-    0xBCA1, 0xBCA4, 0xBCA7, 0xBCA8, 0xBCB0, 0xBCB1, 0xBCB3, 0xBCB4,
-    0xBCB5, 0xBCBC, 0xBCBD, 0xBCC0, 0xBCC4, 0xBCCD, 0xBCCF, 0xBCD0,
-    0xBCD1, 0xBCD5, 0xBCD8, 0xBCDC, 0xBCF4, 0xBCF5, 0xBCF6, 0xBCF8,
-    0xBCFC, 0xBD04, 0xBD05, 0xBD07, 0xBD09, 0xBD10, 0xBD14, 0xBD24,
-    0xBD2C, 0xBD40, 0xBD48, 0xBD49, 0xBD4C, 0xBD50, 0xBD58, 0xBD59,
-    0xBD64, 0xBD68, 0xBD80, 0xBD81, 0xBD84, 0xBD87, 0xBD88, 0xBD89,
-    0xBD8A, 0xBD90, 0xBD91, 0xBD93, 0xBD95, 0xBD99, 0xBD9A, 0xBD9C,
-    0xBDA4, 0xBDB0, 0xBDB8, 0xBDD4, 0xBDD5, 0xBDD8, 0xBDDC, 0xBDE9,
-    0xBDF0, 0xBDF4, 0xBDF8, 0xBE00, 0xBE03, 0xBE05, 0xBE0C, 0xBE0D,
-    0xBE10, 0xBE14, 0xBE1C, 0xBE1D, 0xBE1F, 0xBE44, 0xBE45, 0xBE48,
-    0xBE4C, 0xBE4E, 0xBE54, 0xBE55, 0xBE57, 0xBE59, 0xBE5A, 0xBE5B,
-    0xBE60, 0xBE61, 0xBE64, 0xBE68, 0xBE6A, 0xBE70, 0xBE71, 0xBE73,
-    0xBE74, 0xBE75, 0xBE7B, 0xBE7C, 0xBE7D, 0xBE80, 0xBE84, 0xBE8C,
-    0xBE8D, 0xBE8F, 0xBE90, 0xBE91, 0xBE98, 0xBE99, 0xBEA8, 0xBED0,
-    0xBED1, 0xBED4, 0xBED7, 0xBED8, 0xBEE0, 0xBEE3, 0xBEE4, 0xBEE5,
-    0xBEEC, 0xBF01, 0xBF08, 0xBF09, 0xBF18, 0xBF19, 0xBF1B, 0xBF1C,
-    0xBF1D, 0xBF40, 0xBF41, 0xBF44, 0xBF48, 0xBF50, 0xBF51, 0xBF55,
-    0xBF94, 0xBFB0, 0xBFC5, 0xBFCC, 0xBFCD, 0xBFD0, 0xBFD4, 0xBFDC,
-    0xBFDF, 0xBFE1, 0xC03C, 0xC051, 0xC058, 0xC05C, 0xC060, 0xC068,
-    0xC069, 0xC090, 0xC091, 0xC094, 0xC098, 0xC0A0, 0xC0A1, 0xC0A3,
-    0xC0A5, 0xC0AC, 0xC0AD, 0xC0AF, 0xC0B0, 0xC0B3, 0xC0B4, 0xC0B5,
-    0xC0B6, 0xC0BC, 0xC0BD, 0xC0BF, 0xC0C0, 0xC0C1, 0xC0C5, 0xC0C8,
-    0xC0C9, 0xC0CC, 0xC0D0, 0xC0D8, 0xC0D9, 0xC0DB, 0xC0DC, 0xC0DD,
-    0xC0E4, 0xC0E5, 0xC0E8, 0xC0EC, 0xC0F4, 0xC0F5, 0xC0F7, 0xC0F9,
-    0xC100, 0xC104, 0xC108, 0xC110, 0xC115, 0xC11C, 0xC11D, 0xC11E,
-    0xC11F, 0xC120, 0xC123, 0xC124, 0xC126, 0xC127, 0xC12C, 0xC12D,
-    0xC12F, 0xC130, 0xC131, 0xC136, 0xC138, 0xC139, 0xC13C, 0xC140,
-    0xC148, 0xC149, 0xC14B, 0xC14C, 0xC14D, 0xC154, 0xC155, 0xC158,
-    0xC15C, 0xC164, 0xC165, 0xC167, 0xC168, 0xC169, 0xC170, 0xC174,
-    0xC178, 0xC185, 0xC18C, 0xC18D, 0xC18E, 0xC190, 0xC194, 0xC196,
-    0xC19C, 0xC19D, 0xC19F, 0xC1A1, 0xC1A5, 0xC1A8, 0xC1A9, 0xC1AC,
-    0xC1B0, 0xC1BD, 0xC1C4, 0xC1C8, 0xC1CC, 0xC1D4, 0xC1D7, 0xC1D8,
-    0xC1E0, 0xC1E4, 0xC1E8, 0xC1F0, 0xC1F1, 0xC1F3, 0xC1FC, 0xC1FD,
-    0xC200, 0xC204, 0xC20C, 0xC20D, 0xC20F, 0xC211, 0xC218, 0xC219,
-    0xC21C, 0xC21F, 0xC220, 0xC228, 0xC229, 0xC22B, 0xC22D, 0xC22F,
-    0xC231, 0xC232, 0xC234, 0xC248, 0xC250, 0xC251, 0xC254, 0xC258,
-    0xC260, 0xC265, 0xC26C, 0xC26D, 0xC270, 0xC274, 0xC27C, 0xC27D,
-    0xC27F, 0xC281, 0xC288, 0xC289, 0xC290, 0xC298, 0xC29B, 0xC29D,
-    0xC2A4, 0xC2A5, 0xC2A8, 0xC2AC, 0xC2AD, 0xC2B4, 0xC2B5, 0xC2B7,
-    0xC2B9, 0xC2DC, 0xC2DD, 0xC2E0, 0xC2E3, 0xC2E4, 0xC2EB, 0xC2EC,
-    0xC2ED, 0xC2EF, 0xC2F1, 0xC2F6, 0xC2F8, 0xC2F9, 0xC2FB, 0xC2FC,
-    0xC300, 0xC308, 0xC309, 0xC30C, 0xC30D, 0xC313, 0xC314, 0xC315,
-    0xC318, 0xC31C, 0xC324, 0xC325, 0xC328, 0xC329, 0xC345, 0xC368,
-    0xC369, 0xC36C, 0xC370, 0xC372, 0xC378, 0xC379, 0xC37C, 0xC37D,
-    0xC384, 0xC388, 0xC38C, 0xC3C0, 0xC3D8, 0xC3D9, 0xC3DC, 0xC3DF,
-    0xC3E0, 0xC3E2, 0xC3E8, 0xC3E9, 0xC3ED, 0xC3F4, 0xC3F5, 0xC3F8,
-    0xC408, 0xC410, 0xC424, 0xC42C, 0xC430, 0xC434, 0xC43C, 0xC43D,
-    0xC448, 0xC464, 0xC465, 0xC468, 0xC46C, 0xC474, 0xC475, 0xC479,
-    0xC480, 0xC494, 0xC49C, 0xC4B8, 0xC4BC, 0xC4E9, 0xC4F0, 0xC4F1,
-    0xC4F4, 0xC4F8, 0xC4FA, 0xC4FF, 0xC500, 0xC501, 0xC50C, 0xC510,
-    0xC514, 0xC51C, 0xC528, 0xC529, 0xC52C, 0xC530, 0xC538, 0xC539,
-    0xC53B, 0xC53D, 0xC544, 0xC545, 0xC548, 0xC549, 0xC54A, 0xC54C,
-    0xC54D, 0xC54E, 0xC553, 0xC554, 0xC555, 0xC557, 0xC558, 0xC559,
-    0xC55D, 0xC55E, 0xC560, 0xC561, 0xC564, 0xC568, 0xC570, 0xC571,
-    0xC573, 0xC574, 0xC575, 0xC57C, 0xC57D, 0xC580, 0xC584, 0xC587,
-    0xC58C, 0xC58D, 0xC58F, 0xC591, 0xC595, 0xC597, 0xC598, 0xC59C,
-    0xC5A0, 0xC5A9, 0xC5B4, 0xC5B5, 0xC5B8, 0xC5B9, 0xC5BB, 0xC5BC,
-    0xC5BD, 0xC5BE, 0xC5C4, 0xC5C5, 0xC5C6, 0xC5C7, 0xC5C8, 0xC5C9,
-    0xC5CA, 0xC5CC, 0xC5CE, 0xC5D0, 0xC5D1, 0xC5D4, 0xC5D8, 0xC5E0,
-    0xC5E1, 0xC5E3, 0xC5E5, 0xC5EC, 0xC5ED, 0xC5EE, 0xC5F0, 0xC5F4,
-    0xC5F6, 0xC5F7, 0xC5FC, 0xC5FD, 0xC5FE, 0xC5FF, 0xC600, 0xC601,
-    0xC605, 0xC606, 0xC607, 0xC608, 0xC60C, 0xC610, 0xC618, 0xC619,
-    0xC61B, 0xC61C, 0xC624, 0xC625, 0xC628, 0xC62C, 0xC62D, 0xC62E,
-    0xC630, 0xC633, 0xC634, 0xC635, 0xC637, 0xC639, 0xC63B, 0xC640,
-    0xC641, 0xC644, 0xC648, 0xC650, 0xC651, 0xC653, 0xC654, 0xC655,
-    0xC65C, 0xC65D, 0xC660, 0xC66C, 0xC66F, 0xC671, 0xC678, 0xC679,
-    0xC67C, 0xC680, 0xC688, 0xC689, 0xC68B, 0xC68D, 0xC694, 0xC695,
-    0xC698, 0xC69C, 0xC6A4, 0xC6A5, 0xC6A7, 0xC6A9, 0xC6B0, 0xC6B1,
-    0xC6B4, 0xC6B8, 0xC6B9, 0xC6BA, 0xC6C0, 0xC6C1, 0xC6C3, 0xC6C5,
-    0xC6CC, 0xC6CD, 0xC6D0, 0xC6D4, 0xC6DC, 0xC6DD, 0xC6E0, 0xC6E1,
-    0xC6E8, 0xC6E9, 0xC6EC, 0xC6F0, 0xC6F8, 0xC6F9, 0xC6FD, 0xC704,
-    0xC705, 0xC708, 0xC70C, 0xC714, 0xC715, 0xC717, 0xC719, 0xC720,
-    0xC721, 0xC724, 0xC728, 0xC730, 0xC731, 0xC733, 0xC735, 0xC737,
-    0xC73C, 0xC73D, 0xC740, 0xC744, 0xC74A, 0xC74C, 0xC74D, 0xC74F,
-    0xC751, 0xC752, 0xC753, 0xC754, 0xC755, 0xC756, 0xC757, 0xC758,
-    0xC75C, 0xC760, 0xC768, 0xC76B, 0xC774, 0xC775, 0xC778, 0xC77C,
-    0xC77D, 0xC77E, 0xC783, 0xC784, 0xC785, 0xC787, 0xC788, 0xC789,
-    0xC78A, 0xC78E, 0xC790, 0xC791, 0xC794, 0xC796, 0xC797, 0xC798,
-    0xC79A, 0xC7A0, 0xC7A1, 0xC7A3, 0xC7A4, 0xC7A5, 0xC7A6, 0xC7AC,
-    0xC7AD, 0xC7B0, 0xC7B4, 0xC7BC, 0xC7BD, 0xC7BF, 0xC7C0, 0xC7C1,
-    0xC7C8, 0xC7C9, 0xC7CC, 0xC7CE, 0xC7D0, 0xC7D8, 0xC7DD, 0xC7E4,
-    0xC7E8, 0xC7EC, 0xC800, 0xC801, 0xC804, 0xC808, 0xC80A, 0xC810,
-    0xC811, 0xC813, 0xC815, 0xC816, 0xC81C, 0xC81D, 0xC820, 0xC824,
-    0xC82C, 0xC82D, 0xC82F, 0xC831, 0xC838, 0xC83C, 0xC840, 0xC848,
-    0xC849, 0xC84C, 0xC84D, 0xC854, 0xC870, 0xC871, 0xC874, 0xC878,
-    0xC87A, 0xC880, 0xC881, 0xC883, 0xC885, 0xC886, 0xC887, 0xC88B,
-    0xC88C, 0xC88D, 0xC894, 0xC89D, 0xC89F, 0xC8A1, 0xC8A8, 0xC8BC,
-    0xC8BD, 0xC8C4, 0xC8C8, 0xC8CC, 0xC8D4, 0xC8D5, 0xC8D7, 0xC8D9,
-    0xC8E0, 0xC8E1, 0xC8E4, 0xC8F5, 0xC8FC, 0xC8FD, 0xC900, 0xC904,
-    0xC905, 0xC906, 0xC90C, 0xC90D, 0xC90F, 0xC911, 0xC918, 0xC92C,
-    0xC934, 0xC950, 0xC951, 0xC954, 0xC958, 0xC960, 0xC961, 0xC963,
-    0xC96C, 0xC970, 0xC974, 0xC97C, 0xC988, 0xC989, 0xC98C, 0xC990,
-    0xC998, 0xC999, 0xC99B, 0xC99D, 0xC9C0, 0xC9C1, 0xC9C4, 0xC9C7,
-    0xC9C8, 0xC9CA, 0xC9D0, 0xC9D1, 0xC9D3, 0xC9D5, 0xC9D6, 0xC9D9,
-    0xC9DA, 0xC9DC, 0xC9DD, 0xC9E0, 0xC9E2, 0xC9E4, 0xC9E7, 0xC9EC,
-    0xC9ED, 0xC9EF, 0xC9F0, 0xC9F1, 0xC9F8, 0xC9F9, 0xC9FC, 0xCA00,
-    0xCA08, 0xCA09, 0xCA0B, 0xCA0C, 0xCA0D, 0xCA14, 0xCA18, 0xCA29,
-    0xCA4C, 0xCA4D, 0xCA50, 0xCA54, 0xCA5C, 0xCA5D, 0xCA5F, 0xCA60,
-    0xCA61, 0xCA68, 0xCA7D, 0xCA84, 0xCA98, 0xCABC, 0xCABD, 0xCAC0,
-    0xCAC4, 0xCACC, 0xCACD, 0xCACF, 0xCAD1, 0xCAD3, 0xCAD8, 0xCAD9,
-    0xCAE0, 0xCAEC, 0xCAF4, 0xCB08, 0xCB10, 0xCB14, 0xCB18, 0xCB20,
-    0xCB21, 0xCB41, 0xCB48, 0xCB49, 0xCB4C, 0xCB50, 0xCB58, 0xCB59,
-    0xCB5D, 0xCB64, 0xCB78, 0xCB79, 0xCB9C, 0xCBB8, 0xCBD4, 0xCBE4,
-    0xCBE7, 0xCBE9, 0xCC0C, 0xCC0D, 0xCC10, 0xCC14, 0xCC1C, 0xCC1D,
-    0xCC21, 0xCC22, 0xCC27, 0xCC28, 0xCC29, 0xCC2C, 0xCC2E, 0xCC30,
-    0xCC38, 0xCC39, 0xCC3B, 0xCC3C, 0xCC3D, 0xCC3E, 0xCC44, 0xCC45,
-    0xCC48, 0xCC4C, 0xCC54, 0xCC55, 0xCC57, 0xCC58, 0xCC59, 0xCC60,
-    0xCC64, 0xCC66, 0xCC68, 0xCC70, 0xCC75, 0xCC98, 0xCC99, 0xCC9C,
-    0xCCA0, 0xCCA8, 0xCCA9, 0xCCAB, 0xCCAC, 0xCCAD, 0xCCB4, 0xCCB5,
-    0xCCB8, 0xCCBC, 0xCCC4, 0xCCC5, 0xCCC7, 0xCCC9, 0xCCD0, 0xCCD4,
-    0xCCE4, 0xCCEC, 0xCCF0, 0xCD01, 0xCD08, 0xCD09, 0xCD0C, 0xCD10,
-    0xCD18, 0xCD19, 0xCD1B, 0xCD1D, 0xCD24, 0xCD28, 0xCD2C, 0xCD39,
-    0xCD5C, 0xCD60, 0xCD64, 0xCD6C, 0xCD6D, 0xCD6F, 0xCD71, 0xCD78,
-    0xCD88, 0xCD94, 0xCD95, 0xCD98, 0xCD9C, 0xCDA4, 0xCDA5, 0xCDA7,
-    0xCDA9, 0xCDB0, 0xCDC4, 0xCDCC, 0xCDD0, 0xCDE8, 0xCDEC, 0xCDF0,
-    0xCDF8, 0xCDF9, 0xCDFB, 0xCDFD, 0xCE04, 0xCE08, 0xCE0C, 0xCE14,
-    0xCE19, 0xCE20, 0xCE21, 0xCE24, 0xCE28, 0xCE30, 0xCE31, 0xCE33,
-    0xCE35, 0xCE58, 0xCE59, 0xCE5C, 0xCE5F, 0xCE60, 0xCE61, 0xCE68,
-    0xCE69, 0xCE6B, 0xCE6D, 0xCE74, 0xCE75, 0xCE78, 0xCE7C, 0xCE84,
-    0xCE85, 0xCE87, 0xCE89, 0xCE90, 0xCE91, 0xCE94, 0xCE98, 0xCEA0,
-    0xCEA1, 0xCEA3, 0xCEA4, 0xCEA5, 0xCEAC, 0xCEAD, 0xCEC1, 0xCEE4,
-    0xCEE5, 0xCEE8, 0xCEEB, 0xCEEC, 0xCEF4, 0xCEF5, 0xCEF7, 0xCEF8,
-    0xCEF9, 0xCF00, 0xCF01, 0xCF04, 0xCF08, 0xCF10, 0xCF11, 0xCF13,
-    0xCF15, 0xCF1C, 0xCF20, 0xCF24, 0xCF2C, 0xCF2D, 0xCF2F, 0xCF30,
-    0xCF31, 0xCF38, 0xCF54, 0xCF55, 0xCF58, 0xCF5C, 0xCF64, 0xCF65,
-    0xCF67, 0xCF69, 0xCF70, 0xCF71, 0xCF74, 0xCF78, 0xCF80, 0xCF85,
-    0xCF8C, 0xCFA1, 0xCFA8, 0xCFB0, 0xCFC4, 0xCFE0, 0xCFE1, 0xCFE4,
-    0xCFE8, 0xCFF0, 0xCFF1, 0xCFF3, 0xCFF5, 0xCFFC, 0xD000, 0xD004,
-    0xD011, 0xD018, 0xD02D, 0xD034, 0xD035, 0xD038, 0xD03C, 0xD044,
-    0xD045, 0xD047, 0xD049, 0xD050, 0xD054, 0xD058, 0xD060, 0xD06C,
-    0xD06D, 0xD070, 0xD074, 0xD07C, 0xD07D, 0xD081, 0xD0A4, 0xD0A5,
-    0xD0A8, 0xD0AC, 0xD0B4, 0xD0B5, 0xD0B7, 0xD0B9, 0xD0C0, 0xD0C1,
-    0xD0C4, 0xD0C8, 0xD0C9, 0xD0D0, 0xD0D1, 0xD0D3, 0xD0D4, 0xD0D5,
-    0xD0DC, 0xD0DD, 0xD0E0, 0xD0E4, 0xD0EC, 0xD0ED, 0xD0EF, 0xD0F0,
-    0xD0F1, 0xD0F8, 0xD10D, 0xD130, 0xD131, 0xD134, 0xD138, 0xD13A,
-    0xD140, 0xD141, 0xD143, 0xD144, 0xD145, 0xD14C, 0xD14D, 0xD150,
-    0xD154, 0xD15C, 0xD15D, 0xD15F, 0xD161, 0xD168, 0xD16C, 0xD17C,
-    0xD184, 0xD188, 0xD1A0, 0xD1A1, 0xD1A4, 0xD1A8, 0xD1B0, 0xD1B1,
-    0xD1B3, 0xD1B5, 0xD1BA, 0xD1BC, 0xD1C0, 0xD1D8, 0xD1F4, 0xD1F8,
-    0xD207, 0xD209, 0xD210, 0xD22C, 0xD22D, 0xD230, 0xD234, 0xD23C,
-    0xD23D, 0xD23F, 0xD241, 0xD248, 0xD25C, 0xD264, 0xD280, 0xD281,
-    0xD284, 0xD288, 0xD290, 0xD291, 0xD295, 0xD29C, 0xD2A0, 0xD2A4,
-    0xD2AC, 0xD2B1, 0xD2B8, 0xD2B9, 0xD2BC, 0xD2BF, 0xD2C0, 0xD2C2,
-    0xD2C8, 0xD2C9, 0xD2CB, 0xD2D4, 0xD2D8, 0xD2DC, 0xD2E4, 0xD2E5,
-    0xD2F0, 0xD2F1, 0xD2F4, 0xD2F8, 0xD300, 0xD301, 0xD303, 0xD305,
-    0xD30C, 0xD30D, 0xD30E, 0xD310, 0xD314, 0xD316, 0xD31C, 0xD31D,
-    0xD31F, 0xD320, 0xD321, 0xD325, 0xD328, 0xD329, 0xD32C, 0xD330,
-    0xD338, 0xD339, 0xD33B, 0xD33C, 0xD33D, 0xD344, 0xD345, 0xD37C,
-    0xD37D, 0xD380, 0xD384, 0xD38C, 0xD38D, 0xD38F, 0xD390, 0xD391,
-    0xD398, 0xD399, 0xD39C, 0xD3A0, 0xD3A8, 0xD3A9, 0xD3AB, 0xD3AD,
-    0xD3B4, 0xD3B8, 0xD3BC, 0xD3C4, 0xD3C5, 0xD3C8, 0xD3C9, 0xD3D0,
-    0xD3D8, 0xD3E1, 0xD3E3, 0xD3EC, 0xD3ED, 0xD3F0, 0xD3F4, 0xD3FC,
-    0xD3FD, 0xD3FF, 0xD401, 0xD408, 0xD41D, 0xD440, 0xD444, 0xD45C,
-    0xD460, 0xD464, 0xD46D, 0xD46F, 0xD478, 0xD479, 0xD47C, 0xD47F,
-    0xD480, 0xD482, 0xD488, 0xD489, 0xD48B, 0xD48D, 0xD494, 0xD4A9,
-    0xD4CC, 0xD4D0, 0xD4D4, 0xD4DC, 0xD4DF, 0xD4E8, 0xD4EC, 0xD4F0,
-    0xD4F8, 0xD4FB, 0xD4FD, 0xD504, 0xD508, 0xD50C, 0xD514, 0xD515,
-    0xD517, 0xD53C, 0xD53D, 0xD540, 0xD544, 0xD54C, 0xD54D, 0xD54F,
-    0xD551, 0xD558, 0xD559, 0xD55C, 0xD560, 0xD565, 0xD568, 0xD569,
-    0xD56B, 0xD56D, 0xD574, 0xD575, 0xD578, 0xD57C, 0xD584, 0xD585,
-    0xD587, 0xD588, 0xD589, 0xD590, 0xD5A5, 0xD5C8, 0xD5C9, 0xD5CC,
-    0xD5D0, 0xD5D2, 0xD5D8, 0xD5D9, 0xD5DB, 0xD5DD, 0xD5E4, 0xD5E5,
-    0xD5E8, 0xD5EC, 0xD5F4, 0xD5F5, 0xD5F7, 0xD5F9, 0xD600, 0xD601,
-    0xD604, 0xD608, 0xD610, 0xD611, 0xD613, 0xD614, 0xD615, 0xD61C,
-    0xD620, 0xD624, 0xD62D, 0xD638, 0xD639, 0xD63C, 0xD640, 0xD645,
-    0xD648, 0xD649, 0xD64B, 0xD64D, 0xD651, 0xD654, 0xD655, 0xD658,
-    0xD65C, 0xD667, 0xD669, 0xD670, 0xD671, 0xD674, 0xD683, 0xD685,
-    0xD68C, 0xD68D, 0xD690, 0xD694, 0xD69D, 0xD69F, 0xD6A1, 0xD6A8,
-    0xD6AC, 0xD6B0, 0xD6B9, 0xD6BB, 0xD6C4, 0xD6C5, 0xD6C8, 0xD6CC,
-    0xD6D1, 0xD6D4, 0xD6D7, 0xD6D9, 0xD6E0, 0xD6E4, 0xD6E8, 0xD6F0,
-    0xD6F5, 0xD6FC, 0xD6FD, 0xD700, 0xD704, 0xD711, 0xD718, 0xD719,
-    0xD71C, 0xD720, 0xD728, 0xD729, 0xD72B, 0xD72D, 0xD734, 0xD735,
-    0xD738, 0xD73C, 0xD744, 0xD747, 0xD749, 0xD750, 0xD751, 0xD754,
-    0xD756, 0xD757, 0xD758, 0xD759, 0xD760, 0xD761, 0xD763, 0xD765,
-    0xD769, 0xD76C, 0xD770, 0xD774, 0xD77C, 0xD77D, 0xD781, 0xD788,
-    0xD789, 0xD78C, 0xD790, 0xD798, 0xD799, 0xD79B, 0xD79D, 0xF900,
-    0xF901, 0xF902, 0xF903, 0xF904, 0xF905, 0xF906, 0xF907, 0xF908,
-    0xF909, 0xF90A, 0xF90B, 0xF90C, 0xF90D, 0xF90E, 0xF90F, 0xF910,
-    0xF911, 0xF912, 0xF913, 0xF914, 0xF915, 0xF916, 0xF917, 0xF918,
-    0xF919, 0xF91A, 0xF91B, 0xF91C, 0xF91D, 0xF91E, 0xF91F, 0xF920,
-    0xF921, 0xF922, 0xF923, 0xF924, 0xF925, 0xF926, 0xF927, 0xF928,
-    0xF929, 0xF92A, 0xF92B, 0xF92C, 0xF92D, 0xF92E, 0xF92F, 0xF930,
-    0xF931, 0xF932, 0xF933, 0xF934, 0xF935, 0xF936, 0xF937, 0xF938,
-    0xF939, 0xF93A, 0xF93B, 0xF93C, 0xF93D, 0xF93E, 0xF93F, 0xF940,
-    0xF941, 0xF942, 0xF943, 0xF944, 0xF945, 0xF946, 0xF947, 0xF948,
-    0xF949, 0xF94A, 0xF94B, 0xF94C, 0xF94D, 0xF94E, 0xF94F, 0xF950,
-    0xF951, 0xF952, 0xF953, 0xF954, 0xF955, 0xF956, 0xF957, 0xF958,
-    0xF959, 0xF95A, 0xF95B, 0xF95C, 0xF95D, 0xF95E, 0xF95F, 0xF960,
-    0xF961, 0xF962, 0xF963, 0xF964, 0xF965, 0xF966, 0xF967, 0xF968,
-    0xF969, 0xF96A, 0xF96B, 0xF96C, 0xF96D, 0xF96E, 0xF96F, 0xF970,
-    0xF971, 0xF972, 0xF973, 0xF974, 0xF975, 0xF976, 0xF977, 0xF978,
-    0xF979, 0xF97A, 0xF97B, 0xF97C, 0xF97D, 0xF97E, 0xF97F, 0xF980,
-    0xF981, 0xF982, 0xF983, 0xF984, 0xF985, 0xF986, 0xF987, 0xF988,
-    0xF989, 0xF98A, 0xF98B, 0xF98C, 0xF98D, 0xF98E, 0xF98F, 0xF990,
-    0xF991, 0xF992, 0xF993, 0xF994, 0xF995, 0xF996, 0xF997, 0xF998,
-    0xF999, 0xF99A, 0xF99B, 0xF99C, 0xF99D, 0xF99E, 0xF99F, 0xF9A0,
-    0xF9A1, 0xF9A2, 0xF9A3, 0xF9A4, 0xF9A5, 0xF9A6, 0xF9A7, 0xF9A8,
-    0xF9A9, 0xF9AA, 0xF9AB, 0xF9AC, 0xF9AD, 0xF9AE, 0xF9AF, 0xF9B0,
-    0xF9B1, 0xF9B2, 0xF9B3, 0xF9B4, 0xF9B5, 0xF9B6, 0xF9B7, 0xF9B8,
-    0xF9B9, 0xF9BA, 0xF9BB, 0xF9BC, 0xF9BD, 0xF9BE, 0xF9BF, 0xF9C0,
-    0xF9C1, 0xF9C2, 0xF9C3, 0xF9C4, 0xF9C5, 0xF9C6, 0xF9C7, 0xF9C8,
-    0xF9C9, 0xF9CA, 0xF9CB, 0xF9CC, 0xF9CD, 0xF9CE, 0xF9CF, 0xF9D0,
-    0xF9D1, 0xF9D2, 0xF9D3, 0xF9D4, 0xF9D5, 0xF9D6, 0xF9D7, 0xF9D8,
-    0xF9D9, 0xF9DA, 0xF9DB, 0xF9DC, 0xF9DD, 0xF9DE, 0xF9DF, 0xF9E0,
-    0xF9E1, 0xF9E2, 0xF9E3, 0xF9E4, 0xF9E5, 0xF9E6, 0xF9E7, 0xF9E8,
-    0xF9E9, 0xF9EA, 0xF9EB, 0xF9EC, 0xF9ED, 0xF9EE, 0xF9EF, 0xF9F0,
-    0xF9F1, 0xF9F2, 0xF9F3, 0xF9F4, 0xF9F5, 0xF9F6, 0xF9F7, 0xF9F8,
-    0xF9F9, 0xF9FA, 0xF9FB, 0xF9FC, 0xF9FD, 0xF9FE, 0xF9FF, 0xFA00,
-    0xFA01, 0xFA02, 0xFA03, 0xFA04, 0xFA05, 0xFA06, 0xFA07, 0xFA08,
-    0xFA09, 0xFA0A, 0xFA0B, 0xFF01, 0xFF02, 0xFF03, 0xFF04, 0xFF05,
-    0xFF06, 0xFF07, 0xFF08, 0xFF09, 0xFF0A, 0xFF0B, 0xFF0C, 0xFF0D,
-    0xFF0E, 0xFF0F, 0xFF10, 0xFF11, 0xFF12, 0xFF13, 0xFF14, 0xFF15,
-    0xFF16, 0xFF17, 0xFF18, 0xFF19, 0xFF1A, 0xFF1B, 0xFF1C, 0xFF1D,
-    0xFF1E, 0xFF1F, 0xFF20, 0xFF21, 0xFF22, 0xFF23, 0xFF24, 0xFF25,
-    0xFF26, 0xFF27, 0xFF28, 0xFF29, 0xFF2A, 0xFF2B, 0xFF2C, 0xFF2D,
-    0xFF2E, 0xFF2F, 0xFF30, 0xFF31, 0xFF32, 0xFF33, 0xFF34, 0xFF35,
-    0xFF36, 0xFF37, 0xFF38, 0xFF39, 0xFF3A, 0xFF3B, 0xFF3C, 0xFF3D,
-    0xFF3E, 0xFF3F, 0xFF40, 0xFF41, 0xFF42, 0xFF43, 0xFF44, 0xFF45,
-    0xFF46, 0xFF47, 0xFF48, 0xFF49, 0xFF4A, 0xFF4B, 0xFF4C, 0xFF4D,
-    0xFF4E, 0xFF4F, 0xFF50, 0xFF51, 0xFF52, 0xFF53, 0xFF54, 0xFF55,
-    0xFF56, 0xFF57, 0xFF58, 0xFF59, 0xFF5A, 0xFF5B, 0xFF5C, 0xFF5D,
-    0xFF5E, 0xFFE0, 0xFFE1, 0xFFE2, 0xFFE3, 0xFFE5, 0xFFE6,
+/* Page (U+xx00-xxFF) blocks of `ksx1001_page_u[]` & `ksx1001_page_mb_ind[]`, 1-based, 0 if none */
+static const unsigned char ksx1001_page[256] = {
+      1,   2,   3,   4,   5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      6,   7,   8,   9,  10,  11,  12,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+     13,  14,  15,  16,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  17,  18,  19,  20,
+     21,  22,  23,  24,  25,  26,  27,  28,  29,  30,  31,  32,  33,  34,  35,  36,
+     37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,  48,  49,  50,  51,  52,
+     53,  54,  55,  56,  57,  58,  59,  60,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,  61,  62,   0,   0,   0,   0,  63,
+};
+
+/* Unicode usage bit-flags for pages in blocks of 16 */
+static const unsigned short ksx1001_page_u[1008] = {
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x6592, 0xF7DF, 0x0040, 0xC181, 0x0040, 0x4181,
+    0x0000, 0x0002, 0x00C0, 0x810E, 0x0E07, 0x000C, 0x00C0, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0080, 0x2F01, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xFFFE, 0x03FB, 0xFFFE, 0x03FB, 0x0000, 0x0000, 0x0000,
+    0x0002, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0002, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x3320, 0x0063, 0x080D, 0x0000, 0x0000, 0x0000, 0x8010,
+    0x001E, 0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0208, 0x0048, 0x0846, 0x0000, 0x0000, 0x7818, 0x03FF, 0x03FF,
+    0x0000, 0x03FF, 0x0000, 0x0000, 0x0000, 0x0014, 0x0000, 0x0000,
+    0x898D, 0x6402, 0x5FA1, 0x3030, 0x0000, 0x0004, 0x0C33, 0x0000,
+    0x00CC, 0x0200, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7FFF, 0xFFF0,
+    0x0007, 0xF000, 0xFFFF, 0x003F, 0x0000, 0xFFFF, 0x03FF, 0x0000,
+    0xF00F, 0xFFFF, 0xFFFF, 0xFFFF, 0x0FFF, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0004, 0x03FB, 0x30CC, 0xC9C3, 0x0003, 0x0000, 0x0000,
+    0xC060, 0x5000, 0x0000, 0x0000, 0x0005, 0x0000, 0x37BB, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xFF0F, 0x003B, 0x0000, 0x0000, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x000F, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x007F,
+    0x0000, 0x0000, 0x0000, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x7FFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xFFFF, 0x1FFF, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xCFFF,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xFF1F, 0xFFFF, 0xFFFF, 0xFFFF, 0x87FF, 0x3949, 0x0000, 0x0000,
+    0x0793, 0x3EFF, 0xB011, 0x1303, 0x2801, 0x1110, 0x0000, 0x0593,
+    0x1E7B, 0xB011, 0x9703, 0x3B01, 0x1112, 0x00A0, 0x9593, 0x306B,
+    0xB051, 0x1102, 0x3201, 0x1130, 0x02B0, 0x0111, 0x300A, 0xB879,
+    0x1306, 0x3001, 0x0010, 0x0080, 0x0113, 0x100B, 0x0011, 0x9300,
+    0x2B03, 0x0010, 0x0000, 0x0593, 0x746B, 0xB051, 0x1323, 0x3B01,
+    0x1030, 0x0000, 0x0000, 0x7000, 0xB011, 0x1303, 0x2900, 0x1110,
+    0x2180, 0x0001, 0x3000, 0xB015, 0x030E, 0x3001, 0x0030, 0x0200,
+    0x0111, 0x1023, 0x0000, 0x1300, 0x6B81, 0x1010, 0x0300, 0x0113,
+    0x1013, 0x3011, 0x0100, 0x0000, 0x5530, 0x22B8, 0x0000, 0x3000,
+    0xB011, 0x9702, 0xFB07, 0x113A, 0x03B0, 0x0113, 0x0021, 0x0000,
+    0x1B00, 0x3B0D, 0x1138, 0x03B0, 0x0113, 0x1133, 0x0001, 0x1300,
+    0x2B05, 0x111C, 0x0100, 0x0000, 0x1000, 0xB011, 0x1300, 0x2A01,
+    0x1930, 0x02B0, 0x0001, 0x1010, 0x0000, 0x1100, 0x0301, 0x1030,
+    0x0230, 0x0713, 0x146B, 0x0011, 0x1300, 0x2B05, 0xF974, 0x8FB8,
+    0x0113, 0x103B, 0x0000, 0x0000, 0x0000, 0xD970, 0x4AB0, 0x0113,
+    0x103B, 0x0011, 0x1103, 0x0000, 0x5930, 0x2AB1, 0x0111, 0x1000,
+    0x0000, 0x1101, 0x0B01, 0x0010, 0x0000, 0x0113, 0x102B, 0x0000,
+    0x0101, 0x2000, 0x1110, 0x02A0, 0x0111, 0x3021, 0xB059, 0x0102,
+    0x0000, 0x1930, 0x07B0, 0x0113, 0x383B, 0xB011, 0x0003, 0x0000,
+    0x0000, 0x0000, 0x0D13, 0x383B, 0xB011, 0x0103, 0x1000, 0x0000,
+    0x0000, 0x0113, 0x1020, 0x0010, 0x0100, 0x0000, 0x0110, 0x0000,
+    0x0000, 0x3000, 0x1811, 0x0002, 0x0000, 0x0010, 0x0000, 0x0111,
+    0x0023, 0x0000, 0x9300, 0x0B01, 0x1110, 0x0030, 0x0111, 0x302B,
+    0xB011, 0x13C7, 0x3B01, 0x0130, 0x0280, 0x0000, 0x3000, 0xB011,
+    0x1383, 0x2B01, 0x1130, 0x03B0, 0x0011, 0x300A, 0xB011, 0x1102,
+    0x2000, 0x0000, 0x0100, 0x0111, 0x102B, 0xA011, 0x1302, 0x2B01,
+    0x0010, 0x0100, 0x0001, 0x3000, 0x9011, 0x1302, 0x2B01, 0x1130,
+    0x66B0, 0x0000, 0x3000, 0xB011, 0xD302, 0x6B07, 0x113A, 0x07B0,
+    0x0103, 0x0020, 0x0000, 0x1300, 0x6B05, 0x1138, 0x03B0, 0x0113,
+    0x10B8, 0x0000, 0x1B00, 0x2B05, 0x0110, 0x0300, 0x0000, 0x1000,
+    0xA011, 0x1102, 0x0A01, 0x7970, 0xA2B0, 0x0111, 0x100A, 0x0000,
+    0x1100, 0x0001, 0x1110, 0x0090, 0x0111, 0x0009, 0x0000, 0x9300,
+    0xBB05, 0xF9F2, 0x22B0, 0x0113, 0x323B, 0x2001, 0x0000, 0x0000,
+    0x5930, 0x06B0, 0x0193, 0x303B, 0xA011, 0x1123, 0x0000, 0x1170,
+    0x02B0, 0x0011, 0x1010, 0x0000, 0x1301, 0x0301, 0x0110, 0x0000,
+    0x0793, 0x162B, 0x0010, 0x0101, 0x0000, 0x1130, 0x0200, 0x0111,
+    0x3029, 0xB011, 0x0000, 0x0000, 0x5130, 0x0EB0, 0x0513, 0x383B,
+    0xB011, 0x0303, 0x0100, 0x0000, 0x0000, 0x0193, 0x1039, 0x0000,
+    0x0302, 0x3B00, 0x0000, 0x0000, 0x0113, 0x0023, 0x0000, 0x0000,
+    0x0000, 0x0010, 0x0000, 0x0001, 0x3020, 0x9011, 0x0002, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x1000, 0x0000, 0x1102, 0x0301, 0x0000,
+    0x0000, 0x0113, 0xB02B, 0xB079, 0x1323, 0x3B01, 0x1130, 0x02B0,
+    0x0111, 0xF021, 0xB0D9, 0x1343, 0x3B01, 0x1130, 0x03B0, 0x0111,
+    0x7020, 0xB051, 0x1322, 0x2001, 0x1110, 0x0190, 0x0111, 0x300B,
+    0xB011, 0x9302, 0xAB01, 0x0016, 0x0100, 0x0113, 0x3021, 0xB011,
+    0x0302, 0x2901, 0x3130, 0x02B0, 0x0000, 0x3000, 0xB819, 0x1B42,
+    0x3301, 0x1138, 0x0330, 0x0000, 0x0020, 0x0000, 0x1300, 0x3305,
+    0x1110, 0x0000, 0x0000, 0x0000, 0x0001, 0x9300, 0x2305, 0x0130,
+    0x0100, 0x0001, 0x1010, 0x3011, 0x0100, 0x0000, 0x1130, 0x0230,
+    0x0001, 0x1010, 0x0000, 0x1100, 0x0000, 0x0000, 0x0200, 0x8513,
+    0x1003, 0x1011, 0x1300, 0x2B01, 0x7730, 0x63B8, 0x0113, 0x303B,
+    0xB091, 0x11A2, 0x0201, 0x7B30, 0x57F0, 0x0113, 0x702B, 0xF0D1,
+    0x11E3, 0x1B01, 0x7130, 0x0AB9, 0x0113, 0x303B, 0x9001, 0x1302,
+    0x2B01, 0x1130, 0x02B0, 0x0713, 0x302B, 0x3011, 0x1303, 0x2301,
+    0x1130, 0x02B0, 0x0113, 0x30AB, 0xB411, 0x11FE, 0x0901, 0x7130,
+    0x47B8, 0x05D3, 0x307B, 0xB011, 0x5303, 0x2101, 0x1110, 0x0000,
+    0x0513, 0x306B, 0xB011, 0x1102, 0x3301, 0x0010, 0x0000, 0x0513,
+    0x38EB, 0xA010, 0x0102, 0x3000, 0x1110, 0x02B0, 0x0013, 0x3020,
+    0xB071, 0x0102, 0x1000, 0x0010, 0x0000, 0x0113, 0x100B, 0x1011,
+    0x1300, 0x2B01, 0x0000, 0x0000, 0x0593, 0x366B, 0xB095, 0x1303,
+    0x3B01, 0x0110, 0x0200, 0x0000, 0x3000, 0xB011, 0x0103, 0x2000,
+    0x0010, 0x0100, 0x0000, 0x3000, 0xB011, 0x030A, 0x1001, 0x0010,
+    0x0100, 0x0111, 0x0003, 0x0000, 0x1302, 0x2301, 0x0010, 0x0300,
+    0x0000, 0x1000, 0x0000, 0x0100, 0x0000, 0x0010, 0x0290, 0x0000,
+    0x3000, 0x3011, 0x5386, 0x7B01, 0x1130, 0x03B0, 0x0151, 0x0021,
+    0x0000, 0x1300, 0x3B01, 0x1130, 0x02B0, 0x0011, 0x1010, 0x0001,
+    0x1302, 0x2B01, 0x1110, 0x0200, 0x0000, 0x1000, 0xB011, 0x0102,
+    0x0100, 0x1130, 0x02B0, 0x0001, 0x1010, 0x0001, 0x1100, 0x2B01,
+    0x1110, 0x0210, 0x0113, 0x002B, 0x0000, 0x9300, 0x2B03, 0x1130,
+    0x02B0, 0x0113, 0x303B, 0x0000, 0x0002, 0x0000, 0x1930, 0x03B0,
+    0x0113, 0x102B, 0xB011, 0x0103, 0x0000, 0x1130, 0x02B0, 0x0113,
+    0x1021, 0x0000, 0x0102, 0x0001, 0x0010, 0x0000, 0x0113, 0x102B,
+    0x0011, 0x0102, 0x2000, 0x1130, 0x02B0, 0x0111, 0x3001, 0x3011,
+    0x0002, 0x0000, 0x1130, 0x02B0, 0x0313, 0x303B, 0xB011, 0x0103,
+    0x2000, 0x0000, 0x0000, 0x0513, 0x303B, 0xB011, 0x1102, 0x1000,
+    0x0110, 0x0000, 0x0113, 0x142B, 0x0001, 0x0100, 0x0000, 0x0110,
+    0x0280, 0x0001, 0x3000, 0xB011, 0x0102, 0x1000, 0x0010, 0x0000,
+    0x0113, 0x1023, 0x1011, 0x9302, 0x0B05, 0x1110, 0x0030, 0x0113,
+    0x702B, 0xB051, 0x1323, 0x3B01, 0x0030, 0x0000, 0x0000, 0x3000,
+    0xB011, 0x1303, 0x2B01, 0x1110, 0x0330, 0x0101, 0x300A, 0xB011,
+    0x0102, 0x2000, 0x0000, 0x0000, 0x0011, 0x1000, 0xA011, 0x9300,
+    0x2B05, 0x0010, 0x0200, 0x0000, 0x1000, 0x9011, 0x1100, 0x2901,
+    0x1110, 0x00B0, 0x0000, 0x3000, 0xB011, 0x1302, 0x2B21, 0x1130,
+    0x03B0, 0x0001, 0x0020, 0x0000, 0x1300, 0x2B05, 0x1130, 0x02B0,
+    0x0113, 0x103B, 0x2011, 0x1300, 0x2B21, 0x1132, 0x0280, 0x0013,
+    0x3028, 0xA011, 0x1102, 0x0A01, 0x1130, 0x0292, 0x0111, 0x3021,
+    0x0011, 0x1302, 0x2B01, 0x1130, 0x0290, 0x03D3, 0x122B, 0x3011,
+    0x1302, 0x2B01, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0FFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xFFFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7FFF, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x006F, 0x0000,
+};
+
+/* Multibyte indexes for pages in blocks of 16 */
+static const unsigned short ksx1001_page_mb_ind[1008] = {
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     7,    21,    22,    27,    28,
+        0,    32,    33,    35,    40,    46,    48,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,    50,    51,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,    57,    72,    81,    96,     0,     0,     0,
+      105,   106,   122,   138,   154,   170,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,   171,   176,   180,     0,     0,     0,   184,
+      186,     0,   190,     0,     0,     0,     0,     0,
+      191,   193,   195,     0,     0,   199,   205,   215,
+        0,   225,     0,     0,     0,   235,     0,     0,
+      237,   244,   248,   257,     0,   261,   262,     0,
+      268,   272,   273,     0,     0,     0,     0,     0,
+        0,   274,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,   275,   290,
+      302,   305,   309,   325,     0,   331,   347,     0,
+      357,   365,   381,   397,   413,     0,     0,     0,
+        0,   425,   426,   435,   441,   449,     0,     0,
+      451,   455,     0,     0,   457,     0,   459,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+      470,   482,     0,     0,   487,   502,   518,   534,
+      550,   566,   570,   585,   601,   617,   633,   649,
+        0,     0,     0,   656,   671,   687,   703,   719,
+      735,     0,     0,     0,     0,     0,     0,     0,
+      750,   766,     0,     0,     0,     0,   779,   795,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+      809,   822,   838,   854,   870,   882,     0,     0,
+     5509,  5516,  5529,  5534,  5539,  5542,     0,  5545,
+     5551,  5561,  5566,  5573,  5579,  5583,  5585,  5593,
+     5600,  5606,  5609,  5613,  5617,  5621,  5624,  5628,
+     5637,  5642,  5645,  5646,  5647,  5651,  5655,  5657,
+     5661,  5667,     0,  5668,  5674,  5683,  5689,  5695,
+     5701,     0,     0,  5704,  5707,  5712,  5717,  5720,
+     5723,  5726,  5727,  5729,  5735,  5740,  5743,  5745,
+     5746,  5749,     0,  5753,  5756,  5763,  5765,  5767,
+     5771,  5775,  5779,     0,  5780,  5786,     0,  5792,
+     5794,  5799,  5805,  5815,  5821,  5826,  5830,     0,
+     5832,  5836,  5844,  5849,  5854,  5858,  5864,  5865,
+     5868,  5874,  5879,     0,  5880,  5881,  5886,  5889,
+     5893,  5898,  5902,  5903,     0,  5905,  5907,  5910,
+     5913,  5916,  5922,  5929,  5931,  5934,  5940,  5950,
+     5959,  5963,     0,     0,     0,  5969,  5977,  5983,
+     5987,  5993,  5995,     0,  5999,  6005,  6012,  6015,
+        0,  6016,  6019,  6023,     0,  6024,  6028,     0,
+     6033,  6035,  6036,  6039,  6042,  6045,  6049,  6056,
+        0,  6058,  6063,  6069,  6073,  6081,  6086,     0,
+        0,     0,  6088,  6094,  6102,  6107,  6110,     0,
+        0,  6111,  6115,  6117,  6118,     0,  6119,     0,
+        0,  6121,  6123,  6127,     0,  6128,     0,  6129,
+     6132,     0,  6135,  6139,  6143,  6146,  6148,  6151,
+     6157,  6162,  6170,  6176,  6179,     0,  6181,  6183,
+     6188,  6194,  6199,  6203,  6208,  6210,  6214,  6219,
+     6222,     0,  6223,  6224,  6227,  6232,  6236,  6240,
+     6245,  6246,  6247,  6248,  6250,  6254,  6258,  6263,
+     6267,     0,  6274,  6276,  6281,  6287,  6295,  6301,
+     6307,  6310,     0,  6311,  6314,  6321,  6326,  6331,
+     6335,     0,  6340,  6344,  6350,  6352,     0,  6354,
+     6355,  6359,  6362,  6365,  6373,  6379,  6382,     0,
+     6385,  6387,  6388,  6391,  6393,  6396,     0,  6398,
+     6402,  6410,  6421,  6426,  6430,  6438,     0,     0,
+     6440,  6446,  6451,  6456,  6463,  6467,     0,  6472,
+     6477,  6481,  6483,     0,  6485,  6489,  6492,     0,
+     6494,  6501,  6508,  6509,     0,  6511,  6515,  6516,
+     6519,  6524,     0,     0,  6529,  6534,  6540,  6545,
+     6553,  6558,  6562,     0,     0,  6563,  6568,     0,
+     6573,  6576,     0,     0,  6581,  6585,     0,     0,
+        0,  6588,     0,  6589,  6590,  6593,  6597,     0,
+        0,     0,     0,  6598,     0,  6599,  6602,     0,
+        0,  6605,  6609,  6616,  6624,  6630,  6636,  6640,
+     6644,  6647,  6653,  6661,  6667,  6673,  6677,  6682,
+     6685,  6689,  6695,  6700,  6702,  6705,  6708,  6711,
+     6716,  6721,  6726,  6732,  6735,  6736,  6740,  6744,
+     6749,  6752,  6756,  6761,     0,  6765,  6767,  6774,
+     6780,  6785,  6790,     0,  6794,     0,  6795,  6798,
+     6804,     0,     0,     0,  6807,  6808,  6812,  6817,
+     6820,  6821,  6822,  6824,  6828,     0,  6829,  6833,
+     6836,  6837,     0,  6839,     0,     0,  6841,  6842,
+     6848,  6851,  6854,  6857,  6862,  6870,  6878,  6882,
+     6889,  6895,  6900,  6902,  6910,  6919,  6923,  6930,
+     6938,  6945,  6950,  6956,  6963,  6967,  6974,  6977,
+     6981,  6986,  6990,  6994,  7000,  7006,  7010,  7015,
+     7019,  7023,  7027,  7031,  7038,  7044,  7053,  7056,
+     7062,  7070,  7077,  7085,  7090,  7096,  7099,     0,
+     7102,  7107,  7114,  7119,  7122,  7127,     0,  7128,
+     7133,  7142,  7145,  7147,  7149,  7152,  7156,  7159,
+     7162,  7169,  7171,  7172,     0,  7173,  7177,  7181,
+     7184,  7187,     0,     0,  7192,  7198,  7207,  7214,
+     7219,  7225,  7227,     0,  7228,  7230,  7235,  7238,
+     7239,  7240,     0,  7241,  7243,  7248,  7252,  7254,
+     7255,  7256,  7259,     0,  7261,  7265,  7269,  7270,
+        0,  7272,     0,  7273,     0,  7274,  7275,     0,
+     7278,  7280,  7284,  7291,  7298,  7302,  7307,  7311,
+        0,  7313,  7316,  7322,  7326,  7330,  7332,  7334,
+     7335,  7339,  7344,  7347,     0,  7348,  7349,  7354,
+     7356,  7357,  7361,  7365,  7366,  7368,  7369,  7371,
+     7376,  7379,  7381,  7385,     0,  7389,  7393,  7399,
+     7403,  7407,  7411,     0,  7418,     0,  7419,  7424,
+     7429,  7433,  7438,  7443,     0,  7446,  7450,  7454,
+     7458,     0,  7461,  7463,  7464,     0,  7465,  7469,
+     7474,  7476,  7478,  7479,  7483,  7487,  7490,  7493,
+     7497,     0,  7498,  7502,  7506,  7511,  7518,  7523,
+     7526,     0,     0,  7527,  7532,  7539,  7544,  7547,
+     7548,     0,  7550,  7554,  7560,  7561,     0,  7562,
+     7564,  7566,  7567,  7569,  7574,  7576,  7577,     0,
+     7578,  7582,  7586,  7589,  7594,  7599,  7602,  7604,
+     7608,  7615,  7621,  7627,  7633,     0,     0,  7635,
+     7637,  7642,  7647,  7652,  7655,  7659,  7661,  7665,
+     7670,  7672,     0,     0,  7673,  7675,  7676,  7680,
+     7684,  7690,  7691,     0,  7692,  7693,  7697,  7699,
+     7703,  7706,     0,  7709,  7711,  7716,  7720,  7726,
+     7730,  7735,  7736,     0,  7737,  7740,  7746,  7750,
+     7754,  7758,  7764,  7767,  7770,  7776,  7781,  7783,
+     7786,  7790,  7794,  7797,  7800,  7804,  7808,  7811,
+     7815,  7817,  7821,  7826,  7830,  7833,  7840,  7846,
+     7850,  7854,     0,     0,     0,     0,     0,     0,
+     7859,  7875,  7891,  7907,  7923,  7939,  7955,  7971,
+     7987,  8003,  8019,  8035,  8051,  8067,  8083,  8099,
+     8115,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+     8127,  8142,  8158,  8174,  8190,  8206,     0,     0,
+        0,     0,     0,     0,     0,     0,  8221,     0,
 };
 
 /* Multibyte values sorted in Unicode order */
@@ -1858,40 +1683,4 @@ static const unsigned short ksx1001_mb[8227] = {
     0xA3FE, 0xA1CD, 0xA3DC,
 };
 
-/* Indexes into Unicode `ksx1001_u[]` array in blocks of 0x100 */
-static const unsigned short ksx1001_u_ind[256] = {
-        0,    50,    50,    73,   171,   171,   171,   171,
-      171,   171,   171,   171,   171,   171,   171,   171,
-      171,   171,   171,   171,   171,   171,   171,   171,
-      171,   171,   171,   171,   171,   171,   171,   171,
-      190,   235,   273,   275,   310,   427,   470,   470,
-      470,   470,   470,   470,   470,   470,   470,   470,
-      570,   750,   809,   839,   889,   889,   889,   889,
-      889,   889,   889,   889,   889,   889,   889,   889,
-      889,   889,   889,   889,   889,   889,   889,   889,
-      889,   889,   889,   889,   889,   889,   889,   889,
-      889,   889,   889,   889,   889,   889,   889,   889,
-      889,   889,   889,   889,   889,   889,   889,   889,
-      889,   889,   889,   889,   889,   889,   889,   889,
-      889,   889,   889,   889,   889,   889,   889,   889,
-      889,   889,   889,   889,   889,   889,   889,   889,
-      889,   889,   889,   889,   889,   889,   889,   889,
-      889,   889,   889,   889,   889,   889,   889,   889,
-      889,   889,   889,   889,   889,   889,   889,   889,
-      889,   889,   889,   889,   889,   889,   889,   889,
-      889,   889,   889,   889,   889,   889,   889,   889,
-      889,   889,   889,   889,   889,   889,   889,   889,
-      889,   889,   889,   889,   947,  1025,  1084,  1133,
-     1186,  1259,  1303,  1376,  1416,  1469,  1504,  1551,
-     1603,  1654,  1720,  1768,  1832,  1888,  1942,  1969,
-     1990,  2075,  2136,  2187,  2219,  2281,  2370,  2458,
-     2525,  2572,  2621,  2653,  2697,  2741,  2792,  2841,
-     2878,  2931,  2967,  3028,  3071,  3116,  3174,  3239,
-     3239,  3239,  3239,  3239,  3239,  3239,  3239,  3239,
-     3239,  3239,  3239,  3239,  3239,  3239,  3239,  3239,
-     3239,  3239,  3239,  3239,  3239,  3239,  3239,  3239,
-     3239,  3239,  3239,  3239,  3239,  3239,  3239,  3239,
-     3239,  3400,  3507,  3507,  3507,  3507,  3507,  3601,
-};
-
 #endif /* Z_KSX1001_H */
@@ -34,11 +34,16 @@
 #include <errno.h>
 #include <limits.h>
 #include <math.h>
+#include <stddef.h>
 #include <stdio.h>
 #include "common.h"
+#include "cache.h"
 #include "eci.h"
+#include "filemem.h"
 #include "gs1.h"
+#include "output.h"
 #include "zfiletypes.h"
+#include "zthread.h"
 
 /* It's assumed that int is at least 32 bits, the following will compile-time fail if not
  * https://stackoverflow.com/a/1980056 */
@@ -49,11 +54,16 @@ typedef char static_assert_int32_is_32bits[sizeof(int32_t) * CHAR_BIT != 32 ? -1
 typedef char static_assert_uint32_is_32bits[sizeof(uint32_t) * CHAR_BIT != 32 ? -1 : 1];
 typedef char static_assert_uint64_at_least_64bits[sizeof(uint64_t) * CHAR_BIT < 64 ? -1 : 1];
 
-/* Create and initialize a symbol structure */
-struct zint_symbol *ZBarcode_Create(void) {
+/* Size of a compact symbol structure, which stops short of `encoded_data` (the last field), rounded up so that the
+   private state following it is aligned */
+#define COMPACT_SYMBOL_SIZE ((offsetof(struct zint_symbol, encoded_data) + 15) & ~((size_t) 15))
+
+/* Allocate and initialize a symbol structure, followed by its private state */
+static struct zint_symbol *create_symbol(const int compact) {
+    const size_t size = compact ? COMPACT_SYMBOL_SIZE : sizeof(struct zint_symbol);
     struct zint_symbol *symbol;
 
-    symbol = (struct zint_symbol *) calloc(1, sizeof(*symbol));
+    symbol = (struct zint_symbol *) z_calloc(1, size + sizeof(struct zint_symbol_private));
     if (!symbol) return NULL;
 
     symbol->symbology = BARCODE_CODE128;
@@ -79,19 +89,85 @@ struct zint_symbol *ZBarcode_Create(void) {
     symbol->alphamap = NULL;
     symbol->vector = NULL;
 
+    symbol->priv = (struct zint_symbol_private *) ((unsigned char *) symbol + size);
+    symbol->priv->compact = compact;
+    if (!compact) {
+        symbol->priv->modules = symbol->encoded_data[0];
+        symbol->priv->module_stride = (int) sizeof(symbol->encoded_data[0]);
+    }
+
     return symbol;
 }
 
+/* Create and initialize a symbol structure */
+struct zint_symbol *ZBarcode_Create(void) {
+    return create_symbol(0 /*compact*/);
+}
+
+/* Create and initialize a compact symbol structure, allocated without `encoded_data` */
+struct zint_symbol *ZBarcode_Create_Compact(void) {
+    return create_symbol(1 /*compact*/);
+}
+
 INTERNAL void vector_free(struct zint_symbol *symbol); /* Free vector structures */
 
+/* Free the cache key of the last encode, if any */
+static void cache_key_free(struct zint_symbol *symbol) {
+    if (symbol->priv && symbol->priv->cache_key) {
+        z_free(symbol->priv->cache_key);
+        symbol->priv->cache_key = NULL;
+        symbol->priv->cache_key_len = 0;
+    }
+}
+
+/* Whether `symbol` was created by `ZBarcode_Create_Compact()`. Checked by address, without dereferencing `priv`,
+   as `symbol` may be a copy of a normal symbol since deleted (compact symbols can't be copied whole) */
+static int is_compact(const struct zint_symbol *symbol) {
+    return symbol->priv == (const struct zint_symbol_private *) ((const unsigned char *) symbol
+                                                                    + COMPACT_SYMBOL_SIZE);
+}
+
+/* Point the module matrix at `encoded_data` for non-compact symbols, which may have been copied by the caller */
+static void modules_init(struct zint_symbol *symbol) {
+    if (!symbol->priv->compact) {
+        symbol->priv->modules = symbol->encoded_data[0];
+        symbol->priv->module_stride = (int) sizeof(symbol->encoded_data[0]);
+    }
+}
+
+/* Symbols not created by `ZBarcode_Create()` (e.g. zero-initialized by the caller) have no private state, so give
+   them the temporary state `local` for the duration of an API call, removed by `priv_detach()`. Also initializes
+   the module matrix */
+static void priv_attach(struct zint_symbol *symbol, struct zint_symbol_private *local) {
+    if (!symbol->priv) {
+        memset(local, 0, sizeof(*local));
+        symbol->priv = local;
+    }
+    modules_init(symbol);
+}
+
+/* Remove any temporary private state `local` given by `priv_attach()` */
+static void priv_detach(struct zint_symbol *symbol, struct zint_symbol_private *local) {
+    if (symbol->priv == local) {
+        cache_key_free(symbol);
+        symbol->priv = NULL;
+    }
+}
+
 /* Free any output buffers that may have been created and initialize output fields */
 void ZBarcode_Clear(struct zint_symbol *symbol) {
     int i;
 
     if (!symbol) return;
 
-    for (i = 0; i < symbol->rows; i++) {
-        memset(symbol->encoded_data[i], 0, sizeof(symbol->encoded_data[0]));
+    if (is_compact(symbol)) {
+        if (symbol->priv->modules) {
+            memset(symbol->priv->modules, 0, (size_t) symbol->rows * symbol->priv->module_stride);
+        }
+    } else {
+        for (i = 0; i < symbol->rows; i++) {
+            memset(symbol->encoded_data[i], 0, sizeof(symbol->encoded_data[0]));
+        }
     }
     symbol->rows = 0;
     symbol->width = 0;
@@ -99,19 +175,26 @@ void ZBarcode_Clear(struct zint_symbol *symbol) {
     memset(symbol->text, 0, sizeof(symbol->text));
     symbol->errtxt[0] = '\0';
     if (symbol->bitmap != NULL) {
-        free(symbol->bitmap);
+        z_free(symbol->bitmap);
         symbol->bitmap = NULL;
     }
     if (symbol->alphamap != NULL) {
-        free(symbol->alphamap);
+        z_free(symbol->alphamap);
         symbol->alphamap = NULL;
     }
+    if (symbol->memfile != NULL) {
+        z_free(symbol->memfile);
+        symbol->memfile = NULL;
+    }
+    symbol->memfile_size = 0;
     symbol->bitmap_width = 0;
     symbol->bitmap_height = 0;
     symbol->bitmap_byte_length = 0;
 
     /* If there is a rendered version, ensure its memory is released */
     vector_free(symbol);
+
+    cache_key_free(symbol);
 }
 
 /* Free a symbol structure, including any output buffers */
@@ -119,14 +202,104 @@ void ZBarcode_Delete(struct zint_symbol *symbol) {
     if (!symbol) return;
 
     if (symbol->bitmap != NULL)
-        free(symbol->bitmap);
+        z_free(symbol->bitmap);
     if (symbol->alphamap != NULL)
-        free(symbol->alphamap);
+        z_free(symbol->alphamap);
+    if (symbol->memfile != NULL)
+        z_free(symbol->memfile);
 
     /* If there is a rendered version, ensure its memory is released */
     vector_free(symbol);
 
-    free(symbol);
+    if (symbol->priv) {
+        if (symbol->priv->compact && symbol->priv->modules) {
+            z_free(symbol->priv->modules);
+        }
+        cache_key_free(symbol);
+        arena_free(symbol->priv->arena);
+    }
+
+    z_free(symbol);
+}
+
+/* Return the module at `row`, `column` of a previously encoded symbol: 1 if set, 0 if not, or for Ultracode its
+   colour. Returns -1 if `row` or `column` out of range */
+int ZBarcode_Module(const struct zint_symbol *symbol, int row, int column) {
+    const unsigned char *modules;
+    int stride;
+
+    if (!symbol || row < 0 || row >= symbol->rows || column < 0 || column >= symbol->width) {
+        return -1;
+    }
+    if (is_compact(symbol)) {
+        modules = symbol->priv->modules;
+        stride = symbol->priv->module_stride;
+    } else {
+        /* Not `symbol->priv->modules`, which may be stale if symbol copied */
+        modules = symbol->encoded_data[0];
+        stride = (int) sizeof(symbol->encoded_data[0]);
+    }
+    if (symbol->symbology == BARCODE_ULTRA) {
+        return modules[row * stride + column];
+    }
+    return (modules[row * stride + (column >> 3)] >> (column & 0x07)) & 1;
+}
+
+/* For compact symbols, grow the module matrix to the size of `encoded_data` to encode into, spreading any rows
+   already present (stacked symbols) out to its row stride in place. Returns 0 on success */
+static int modules_expand(struct zint_symbol *symbol) {
+    struct zint_symbol_private *priv = symbol->priv;
+    const int full_stride = (int) sizeof(symbol->encoded_data[0]);
+    const int full_size = (int) sizeof(symbol->encoded_data);
+    const int stride = priv->module_stride;
+    unsigned char *modules = priv->modules;
+    int i;
+
+    if (priv->module_alloc < full_size) {
+        if (!(modules = (unsigned char *) z_realloc(priv->modules, full_size))) {
+            strcpy(symbol->errtxt, "781: Insufficient memory for module matrix");
+            return ZINT_ERROR_MEMORY;
+        }
+        priv->modules = modules;
+        priv->module_alloc = full_size;
+    }
+    /* Last row first, as rows only move up */
+    for (i = symbol->rows - 1; i >= 0; i--) {
+        memmove(modules + i * full_stride, modules + i * stride, stride);
+        memset(modules + i * full_stride + stride, 0, full_stride - stride);
+    }
+    memset(modules + symbol->rows * full_stride, 0, full_size - symbol->rows * full_stride);
+    priv->module_stride = full_stride;
+
+    return 0;
+}
+
+/* For compact symbols, pack the encoded rows in place to the symbol's width, and shrink the module matrix to fit */
+static void modules_shrink(struct zint_symbol *symbol) {
+    struct zint_symbol_private *priv = symbol->priv;
+    const int full_stride = priv->module_stride;
+    int stride = symbol->symbology == BARCODE_ULTRA ? symbol->width : (symbol->width + 7) >> 3;
+    unsigned char *modules;
+    int size;
+    int i;
+
+    if (stride < 1) {
+        stride = 1;
+    } else if (stride > full_stride) { /* Shouldn't happen */
+        stride = full_stride;
+    }
+    for (i = 1; i < symbol->rows; i++) {
+        memmove(priv->modules + i * stride, priv->modules + i * full_stride, stride);
+    }
+    priv->module_stride = stride;
+    if ((size = symbol->rows * stride) == 0) { /* Nothing encoded (error) */
+        z_free(priv->modules);
+        priv->modules = NULL;
+        priv->module_alloc = 0;
+    } else if ((modules = (unsigned char *) z_realloc(priv->modules, size))) { /* If can't shrink keep as is */
+        priv->modules = modules;
+        priv->module_alloc = size;
+    }
 }
 
 /* Symbology handlers */
@@ -206,7 +379,18 @@ INTERNAL int rmqr(struct zint_symbol *symbol, struct zint_seg segs[], const int
 INTERNAL int dpd(struct zint_symbol *symbol, unsigned char source[], int length); /* DPD Code */
 INTERNAL int bc412(struct zint_symbol *symbol, unsigned char source[], int length); /* BC412 */
 
-/* Output handlers */
+/* Capacity handlers (`ZBarcode_Capacity()`) */
+INTERNAL int azt_capacity(const int option_1, const int option_2, const int char_type); /* Aztec Code */
+INTERNAL int c1_capacity(const int option_2, const int char_type); /* Code One */
+INTERNAL int dm_capacity(const int option_1, const int option_2, const int char_type); /* Data Matrix */
+INTERNAL int gm_capacity(const int option_1, const int option_2, const int char_type); /* Grid Matrix */
+INTERNAL int hx_capacity(const int option_1, const int option_2, const int char_type); /* Han Xin Code */
+/* PDF417 and MicroPDF417 */
+INTERNAL int pdf_capacity(const int symbology, const int option_1, const int option_2, const int char_type);
+/* QR Code, Micro QR Code and rMQR */
+INTERNAL int qr_capacity(const int symbology, const int option_1, const int option_2, const int char_type);
+
+/* Output handlers - colour options must already have been checked with `out_check_colour_options()` */
 /* Plot to BMP/GIF/PCX/PNG/TIF */
 INTERNAL int plot_raster(struct zint_symbol *symbol, int rotate_angle, int file_type);
 /* Plot to EMF/EPS/SVG */
@@ -248,20 +432,16 @@ INTERNAL int error_tag_test(struct zint_symbol *symbol, int error_number, const
 
 /* Output a hexadecimal representation of the rendered symbol */
 static int dump_plot(struct zint_symbol *symbol) {
-    FILE *f;
+    struct filemem fm;
+    struct filemem *const fmp = &fm;
     int i, r;
     static const char hex[] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'};
     int space = 0;
     const int output_to_stdout = symbol->output_options & BARCODE_STDOUT;
 
-    if (output_to_stdout) {
-        f = stdout;
-    } else {
-        f = fopen(symbol->outfile, "w");
-        if (!f) {
-            strcpy(symbol->errtxt, "201: Could not open output file");
-            return ZINT_ERROR_FILE_ACCESS;
-        }
+    if (!fm_open(fmp, symbol, "w")) {
+        strcpy(symbol->errtxt, "201: Could not open output file");
+        return ZINT_ERROR_FILE_ACCESS;
     }
 
     for (r = 0; r < symbol->rows; r++) {
@@ -278,42 +458,39 @@ static int dump_plot(struct zint_symbol *symbol) {
                 }
             }
             if (((i + 1) % 4) == 0) {
-                fputc(hex[byt], f);
+                fm_putc(hex[byt], fmp);
                 space++;
                 byt = 0;
             }
             if (space == 2 && i + 1 < symbol->width) {
-                fputc(' ', f);
+                fm_putc(' ', fmp);
                 space = 0;
             }
         }
 
         if ((symbol->width % 4) != 0) {
             byt = byt << (4 - (symbol->width % 4));
-            fputc(hex[byt], f);
+            fm_putc(hex[byt], fmp);
         }
-        fputs("\n", f);
+        fm_putc('\n', fmp);
         space = 0;
     }
 
-    if (ferror(f)) {
-        sprintf(symbol->errtxt, "795: Incomplete write to output (%d: %.30s)", errno, strerror(errno));
-        if (!output_to_stdout) {
-            (void) fclose(f);
-        }
+    if (fm_error(fmp)) {
+        sprintf(symbol->errtxt, "795: Incomplete write to output (%d: %.30s)", fm_error(fmp),
+                strerror(fm_error(fmp)));
+        fm_discard(fmp, symbol);
         return ZINT_ERROR_FILE_WRITE;
     }
 
-    if (output_to_stdout) {
-        if (fflush(f) != 0) {
-            sprintf(symbol->errtxt, "796: Incomplete flush to output (%d: %.30s)", errno, strerror(errno));
-            return ZINT_ERROR_FILE_WRITE;
-        }
-    } else {
-        if (fclose(f) != 0) {
-            sprintf(symbol->errtxt, "792: Failure on closing output file (%d: %.30s)", errno, strerror(errno));
-            return ZINT_ERROR_FILE_WRITE;
+    if (!fm_close(fmp, symbol)) {
+        if (output_to_stdout) {
+            sprintf(symbol->errtxt, "796: Incomplete flush to output (%d: %.30s)", fmp->err, strerror(fmp->err));
+        } else {
+            sprintf(symbol->errtxt, "792: Failure on closing output file (%d: %.30s)", fmp->err,
+                    strerror(fmp->err));
         }
+        return ZINT_ERROR_FILE_WRITE;
     }
 
     return 0;
@@ -600,17 +777,29 @@ static int extended_or_reduced_charset(struct zint_symbol *symbol, struct zint_s
 static int reduced_charset(struct zint_symbol *symbol, struct zint_seg segs[], const int seg_count) {
     int error_number = 0;
     int i;
-    struct zint_seg *local_segs = (struct zint_seg *) z_alloca(sizeof(struct zint_seg) * seg_count);
-    int *convertible = (int *) z_alloca(sizeof(int) * seg_count);
+    struct zint_seg *local_segs;
+    int *convertible;
+
+    if (!(local_segs = (struct zint_seg *) z_scratch(symbol, sizeof(struct zint_seg) * seg_count))) {
+        local_segs = (struct zint_seg *) z_alloca(sizeof(struct zint_seg) * seg_count);
+    }
+    if (!(convertible = (int *) z_scratch(symbol, sizeof(int) * seg_count))) {
+        convertible = (int *) z_alloca(sizeof(int) * seg_count);
+    }
 
     if ((symbol->input_mode & 0x07) == UNICODE_MODE && is_eci_convertible_segs(segs, seg_count, convertible)) {
         unsigned char *preprocessed;
         const int eci_length_segs = get_eci_length_segs(segs, seg_count);
-        unsigned char *preprocessed_buf = (unsigned char *) z_alloca(eci_length_segs + seg_count);
+        unsigned char *preprocessed_buf;
+
+        if (!(preprocessed_buf = (unsigned char *) z_scratch(symbol, eci_length_segs + seg_count))) {
+            preprocessed_buf = (unsigned char *) z_alloca(eci_length_segs + seg_count);
+        }
 
         /* Prior check ensures ECI only set for those that support it */
         segs_cpy(symbol, segs, seg_count, local_segs); /* Shallow copy (needed to set default ECIs) */
         preprocessed = preprocessed_buf;
+        STATS_BEGIN(symbol, ZINT_PHASE_ECI);
         for (i = 0; i < seg_count; i++) {
             if (convertible[i]) {
                 error_number = utf8_to_eci(local_segs[i].eci, local_segs[i].source, preprocessed,
@@ -627,6 +816,7 @@ static int reduced_charset(struct zint_symbol *symbol, struct zint_seg segs[], c
                 preprocessed += local_segs[i].length + 1;
             }
         }
+        STATS_END(symbol, ZINT_PHASE_ECI);
         if (supports_eci(symbol->symbology) || is_hibc(symbol->symbology)) {
             error_number = (*(barcode_segs_func_t)barcode_funcs[symbol->symbology])(symbol, local_segs, seg_count);
         } else {
@@ -702,19 +892,26 @@ static int esc_base(struct zint_symbol *symbol, unsigned char *input_string, int
     return -1;
 }
 
-/* Helper to parse escape sequences */
+/* Helper to parse escape sequences. As escape sequences never expand, processed in place, with runs between
+   backslashes moved in bulk, returning immediately if none */
 static int escape_char_process(struct zint_symbol *symbol, unsigned char *input_string, int *p_length) {
     const int length = *p_length;
     int in_posn, out_posn;
     int ch;
     int val;
     int i;
+    int run_len;
     unsigned long unicode;
-    unsigned char *escaped_string = (unsigned char *) z_alloca(length + 1);
+    const unsigned char *bs;
+    unsigned char *escaped_string = input_string; /* Write position never beyond read position */
     const int extra_escape_mode = (symbol->input_mode & EXTRA_ESCAPE_MODE) && symbol->symbology == BARCODE_CODE128;
 
-    in_posn = 0;
-    out_posn = 0;
+    if (!(bs = (const unsigned char *) memchr(input_string, '\\', length))) {
+        input_string[length] = '\0';
+        return 0; /* No escapes */
+    }
+
+    in_posn = out_posn = (int) (bs - input_string);
 
     do {
         if (input_string[in_posn] == '\\') {
@@ -834,13 +1031,16 @@ static int escape_char_process(struct zint_symbol *symbol, unsigned char *input_
                     break;
             }
         } else {
-            escaped_string[out_posn] = input_string[in_posn];
-            in_posn++;
+            /* Move run up to next backslash (or end) in bulk */
+            bs = (const unsigned char *) memchr(input_string + in_posn, '\\', length - in_posn);
+            run_len = bs ? (int) (bs - input_string) - in_posn : length - in_posn;
+            memmove(escaped_string + out_posn, input_string + in_posn, run_len);
+            in_posn += run_len;
+            out_posn += run_len - 1;
         }
         out_posn++;
     } while (in_posn < length);
 
-    memcpy(input_string, escaped_string, out_posn);
     input_string[out_posn] = '\0';
     *p_length = out_posn;
 
@@ -866,99 +1066,18 @@ int ZBarcode_Encode(struct zint_symbol *symbol, const unsigned char *source, int
     return ZBarcode_Encode_Segs(symbol, segs, 1);
 }
 
-/* Encode a barcode with multiple ECI segments. */
-int ZBarcode_Encode_Segs(struct zint_symbol *symbol, const struct zint_seg segs[], const int seg_count) {
-    int error_number, warn_number = 0;
-    int total_len = 0;
-    int have_zero_eci = 0;
-    int i;
-    unsigned char *local_source;
-    struct zint_seg *local_segs;
-    unsigned char *local_sources;
-
-    if (!symbol) return ZINT_ERROR_INVALID_DATA;
-
-    if (segs == NULL) {
-        return error_tag(symbol, ZINT_ERROR_INVALID_DATA, "200: Input segments NULL");
-    }
-    /* `seg_count` zero dealt with via `total_len` zero below */
-    if (seg_count > ZINT_MAX_SEG_COUNT) {
-        return error_tag(symbol, ZINT_ERROR_INVALID_DATA, "771: Too many input segments (max 256)");
-    }
-    local_segs = (struct zint_seg *) z_alloca(sizeof(struct zint_seg) * (seg_count > 0 ? seg_count : 1));
-
-    if ((symbol->input_mode & 0x07) > 2) {
-        symbol->input_mode = DATA_MODE; /* Reset completely TODO: in future, warn/error */
-    }
-
-    /* Check segment lengths */
-    for (i = 0; i < seg_count; i++) {
-        local_segs[i] = segs[i];
-        if (local_segs[i].source == NULL) {
-            sprintf(symbol->errtxt, "772: Input segment %d source NULL", i);
-            return error_tag(symbol, ZINT_ERROR_INVALID_DATA, NULL);
-        }
-        if (local_segs[i].length <= 0) {
-            local_segs[i].length = (int) ustrlen(local_segs[i].source);
-        }
-        if (local_segs[i].length <= 0) {
-            if (i == 0) {
-                /* Note: should really be referencing the symbology only after the symbology check switch below */
-                if (is_composite(symbol->symbology) &&
-                        ((symbol->input_mode & 0x07) == GS1_MODE || check_force_gs1(symbol->symbology))) {
-                    strcpy(symbol->errtxt, "779: No composite data in 2D component");
-                } else {
-                    sprintf(symbol->errtxt, "778: No input data%s",
-                            supports_eci(symbol->symbology) ? " (segment 0 empty)" : "");
-                }
-            } else {
-                sprintf(symbol->errtxt, "773: Input segment %d empty", i);
-            }
-            return error_tag(symbol, ZINT_ERROR_INVALID_DATA, NULL);
-        }
-        if (local_segs[i].length > ZINT_MAX_DATA_LEN) {
-            return error_tag(symbol, ZINT_ERROR_TOO_LONG, "777: Input data too long");
-        }
-        total_len += local_segs[i].length;
-    }
-
-    if (total_len == 0) {
-        return error_tag(symbol, ZINT_ERROR_INVALID_DATA, "205: No input data");
-    }
-
-    if (symbol->debug & ZINT_DEBUG_PRINT) {
-        const int len = local_segs[0].length;
-        const int primary_len = symbol->primary[0] ? (int) strlen(symbol->primary) : 0;
-        char name[32];
-        (void) ZBarcode_BarcodeName(symbol->symbology, name);
-        printf("\nZBarcode_Encode_Segs: %s (%d), input_mode: 0x%X, ECI: %d, option_1: %d, option_2: %d"
-                ", option_3: %d,\n                      scale: %g, output_options: 0x%X, fg: %s, bg: %s"
-                ", seg_count: %d,\n                      %ssource%s (%d): \"%.*s\", %sprimary (%d): \"%.20s\"\n",
-                name, symbol->symbology, symbol->input_mode, symbol->eci, symbol->option_1, symbol->option_2,
-                symbol->option_3, symbol->scale, symbol->output_options, symbol->fgcolour, symbol->bgcolour,
-                seg_count, len > 20 ? "First 20 " : "", seg_count > 1 ? "[0]" : "", len, len > 20 ? 20 : len,
-                local_segs[0].source, primary_len > 20 ? "First 20 " : "", primary_len, symbol->primary);
-    }
-
-    if (total_len > ZINT_MAX_DATA_LEN) {
-        return error_tag(symbol, ZINT_ERROR_TOO_LONG, "243: Input data too long");
-    }
+/* Options checked once by `ZBarcode_Prepare()` for repeated use by `ZBarcode_Encode_Prepared()` */
+struct zint_prepared {
+    struct zint_symbol *options; /* Compact symbol holding the checked options */
+    int output_type;    /* ZINT_BATCH_XXX */
+    int rotate_angle;
+    int warn_number;    /* Warning (if any) from checking, with text in `options->errtxt` */
+};
 
-    /* Reconcile symbol ECI and first segment ECI if both set */
-    if (symbol->eci != local_segs[0].eci) {
-        if (symbol->eci && local_segs[0].eci) {
-            sprintf(symbol->errtxt, "774: Symbol ECI %d must match segment zero ECI %d", symbol->eci,
-                    local_segs[0].eci);
-            return error_tag(symbol, ZINT_ERROR_INVALID_OPTION, NULL);
-        }
-        if (symbol->eci) {
-            local_segs[0].eci = symbol->eci;
-        } else {
-            symbol->eci = local_segs[0].eci;
-        }
-    }
+/* Check the symbology field, mapping legacy and out-of-range values. Returns warning or error (tagged) */
+static int check_symbology(struct zint_symbol *symbol) {
+    int warn_number = 0;
 
-    /* Check the symbology field */
     if (!ZBarcode_ValidID(symbol->symbology)) {
         int orig_symbology = symbol->symbology; /* For self-check */
         if (symbol->symbology < 1) {
@@ -1063,27 +1182,12 @@ int ZBarcode_Encode_Segs(struct zint_symbol *symbol, const struct zint_seg segs[
         }
     }
 
-    if (seg_count > 1 && !supports_eci(symbol->symbology)) {
-        return error_tag(symbol, ZINT_ERROR_INVALID_OPTION, "775: Symbology does not support multiple segments");
-    }
+    return warn_number;
+}
 
-    /* Check ECI(s) */
-    for (i = 0; i < seg_count; i++) {
-        if (local_segs[i].eci) {
-            if (!supports_eci(symbol->symbology)) {
-                return error_tag(symbol, ZINT_ERROR_INVALID_OPTION, "217: Symbology does not support ECI switching");
-            }
-            if (local_segs[i].eci < 0 || local_segs[i].eci == 1 || local_segs[i].eci == 2 || local_segs[i].eci == 14
-                    || local_segs[i].eci == 19 || local_segs[i].eci > 999999) {
-                sprintf(symbol->errtxt, "218: Invalid ECI code %d", local_segs[i].eci);
-                return error_tag(symbol, ZINT_ERROR_INVALID_OPTION, NULL);
-            }
-        } else {
-            have_zero_eci = 1;
-        }
-    }
+/* Check other symbol fields. Returns error (tagged) if any */
+static int check_options(struct zint_symbol *symbol) {
 
-    /* Check other symbol fields */
     if ((symbol->scale < 0.01f) || (symbol->scale > 200.0f)) {
         return error_tag(symbol, ZINT_ERROR_INVALID_OPTION, "227: Scale out of range (0.01 to 200)");
     }
@@ -1110,75 +1214,244 @@ int ZBarcode_Encode_Segs(struct zint_symbol *symbol, const struct zint_seg segs[
         return error_tag(symbol, ZINT_ERROR_INVALID_OPTION, "768: Border width out of range (0 to 100)");
     }
 
-    if (symbol->rows >= 200) { /* Check for stacking too many symbols */
-        return error_tag(symbol, ZINT_ERROR_TOO_LONG, "770: Too many stacked symbols");
-    }
-    if (symbol->rows < 0) { /* Silently defend against out-of-bounds access */
-        symbol->rows = 0;
-    }
-
     if ((symbol->input_mode & 0x07) == GS1_MODE && !gs1_compliant(symbol->symbology)) {
         return error_tag(symbol, ZINT_ERROR_INVALID_OPTION, "220: Selected symbology does not support GS1 mode");
     }
-    if (seg_count > 1) {
-        /* Note: GS1_MODE not currently supported when using multiple segments */
-        if ((symbol->input_mode & 0x07) == GS1_MODE) {
-            return error_tag(symbol, ZINT_ERROR_INVALID_OPTION, "776: GS1 mode not supported for multiple segments");
-        }
-    }
 
-    if ((symbol->input_mode & 0x07) == UNICODE_MODE) {
-        for (i = 0; i < seg_count; i++) {
-            if (!is_valid_utf8(local_segs[i].source, local_segs[i].length)) {
-                return error_tag(symbol, ZINT_ERROR_INVALID_DATA, "245: Invalid UTF-8 in input data");
-            }
-        }
-    }
+    return 0;
+}
 
-    local_sources = (unsigned char *) z_alloca(total_len + seg_count);
+/* Encode segments, using the options checked by `prepared` if non-NULL */
+static int encode_segs_main(struct zint_symbol *symbol, const struct zint_seg segs[], const int seg_count,
+            const struct zint_prepared *prepared) {
+    int error_number, warn_number = 0;
+    int total_len = 0;
+    int have_zero_eci = 0;
+    int first_eci_set = 0;
+    int i;
+    unsigned char *local_source;
+    struct zint_seg *local_segs;
+    unsigned char *local_sources;
+    const int alloc_seg_count = seg_count > 0 ? seg_count : 1;
 
-    for (i = 0, local_source = local_sources; i < seg_count; i++) {
-        local_segs[i].source = local_source;
-        memcpy(local_segs[i].source, segs[i].source, local_segs[i].length);
-        local_segs[i].source[local_segs[i].length] = '\0';
-        local_source += local_segs[i].length + 1;
-    }
+    if (!symbol) return ZINT_ERROR_INVALID_DATA;
 
-    /* Start acting on input mode */
-    if (symbol->input_mode & ESCAPE_MODE) {
-        for (i = 0; i < seg_count; i++) {
-            error_number = escape_char_process(symbol, local_segs[i].source, &local_segs[i].length);
-            if (error_number != 0) { /* Only returns errors, not warnings */
-                return error_tag(symbol, error_number, NULL);
-            }
-        }
-        if (symbol->primary[0]) {
-            int primary_len = (int) strlen(symbol->primary);
-            error_number = escape_char_process(symbol, (unsigned char *) symbol->primary, &primary_len);
-            if (error_number != 0) { /* Only returns errors, not warnings */
-                return error_tag(symbol, error_number, NULL);
-            }
-        }
+    STATS_BEGIN(symbol, ZINT_PHASE_VALIDATE);
+
+    cache_key_free(symbol);
+
+    if (segs == NULL) {
+        return error_tag(symbol, ZINT_ERROR_INVALID_DATA, "200: Input segments NULL");
+    }
+    /* `seg_count` zero dealt with via `total_len` zero below */
+    if (seg_count > ZINT_MAX_SEG_COUNT) {
+        return error_tag(symbol, ZINT_ERROR_INVALID_DATA, "771: Too many input segments (max 256)");
+    }
+    if (!(local_segs = (struct zint_seg *) z_scratch(symbol, sizeof(struct zint_seg) * alloc_seg_count))) {
+        local_segs = (struct zint_seg *) z_alloca(sizeof(struct zint_seg) * alloc_seg_count);
     }
 
-    if ((symbol->input_mode & 0x07) == UNICODE_MODE) {
-        /* Only strip BOM on first segment */
-        strip_bom(local_segs[0].source, &local_segs[0].length);
+    if ((symbol->input_mode & 0x07) > 2) {
+        symbol->input_mode = DATA_MODE; /* Reset completely TODO: in future, warn/error */
     }
 
-    if (((symbol->input_mode & 0x07) == GS1_MODE) || (check_force_gs1(symbol->symbology))) {
-        if (gs1_compliant(symbol->symbology)) {
-            /* Reduce input for composite and non-forced symbologies, others (EAN128 and RSS_EXP based) will
-               handle it themselves */
-            if (is_composite(symbol->symbology) || !check_force_gs1(symbol->symbology)) {
-                unsigned char *reduced = (unsigned char *) z_alloca(local_segs[0].length + 1);
-                error_number = gs1_verify(symbol, local_segs[0].source, local_segs[0].length, reduced);
-                if (error_number) {
-                    static const char in_2d_comp[] = " in 2D component";
-                    if (is_composite(symbol->symbology)
-                            && strlen(symbol->errtxt) + strlen(in_2d_comp) < sizeof(symbol->errtxt)) {
-                        strcat(symbol->errtxt, in_2d_comp);
-                    }
+    /* Check segment lengths */
+    for (i = 0; i < seg_count; i++) {
+        local_segs[i] = segs[i];
+        if (local_segs[i].source == NULL) {
+            sprintf(symbol->errtxt, "772: Input segment %d source NULL", i);
+            return error_tag(symbol, ZINT_ERROR_INVALID_DATA, NULL);
+        }
+        if (local_segs[i].length <= 0) {
+            local_segs[i].length = (int) ustrlen(local_segs[i].source);
+        }
+        if (local_segs[i].length <= 0) {
+            if (i == 0) {
+                /* Note: should really be referencing the symbology only after the symbology check switch below */
+                if (is_composite(symbol->symbology) &&
+                        ((symbol->input_mode & 0x07) == GS1_MODE || check_force_gs1(symbol->symbology))) {
+                    strcpy(symbol->errtxt, "779: No composite data in 2D component");
+                } else {
+                    sprintf(symbol->errtxt, "778: No input data%s",
+                            supports_eci(symbol->symbology) ? " (segment 0 empty)" : "");
+                }
+            } else {
+                sprintf(symbol->errtxt, "773: Input segment %d empty", i);
+            }
+            return error_tag(symbol, ZINT_ERROR_INVALID_DATA, NULL);
+        }
+        if (local_segs[i].length > ZINT_MAX_DATA_LEN) {
+            return error_tag(symbol, ZINT_ERROR_TOO_LONG, "777: Input data too long");
+        }
+        total_len += local_segs[i].length;
+    }
+
+    if (total_len == 0) {
+        return error_tag(symbol, ZINT_ERROR_INVALID_DATA, "205: No input data");
+    }
+    STATS_SET(symbol, input_length, total_len);
+
+    if (symbol->debug & ZINT_DEBUG_PRINT) {
+        const int len = local_segs[0].length;
+        const int primary_len = symbol->primary[0] ? (int) strlen(symbol->primary) : 0;
+        char name[32];
+        (void) ZBarcode_BarcodeName(symbol->symbology, name);
+        printf("\nZBarcode_Encode_Segs: %s (%d), input_mode: 0x%X, ECI: %d, option_1: %d, option_2: %d"
+                ", option_3: %d,\n                      scale: %g, output_options: 0x%X, fg: %s, bg: %s"
+                ", seg_count: %d,\n                      %ssource%s (%d): \"%.*s\", %sprimary (%d): \"%.20s\"\n",
+                name, symbol->symbology, symbol->input_mode, symbol->eci, symbol->option_1, symbol->option_2,
+                symbol->option_3, symbol->scale, symbol->output_options, symbol->fgcolour, symbol->bgcolour,
+                seg_count, len > 20 ? "First 20 " : "", seg_count > 1 ? "[0]" : "", len, len > 20 ? 20 : len,
+                local_segs[0].source, primary_len > 20 ? "First 20 " : "", primary_len, symbol->primary);
+    }
+
+    if (total_len > ZINT_MAX_DATA_LEN) {
+        return error_tag(symbol, ZINT_ERROR_TOO_LONG, "243: Input data too long");
+    }
+
+    /* Reconcile symbol ECI and first segment ECI if both set */
+    if (symbol->eci != local_segs[0].eci) {
+        if (symbol->eci && local_segs[0].eci) {
+            sprintf(symbol->errtxt, "774: Symbol ECI %d must match segment zero ECI %d", symbol->eci,
+                    local_segs[0].eci);
+            return error_tag(symbol, ZINT_ERROR_INVALID_OPTION, NULL);
+        }
+        if (symbol->eci) {
+            local_segs[0].eci = symbol->eci;
+        } else {
+            symbol->eci = local_segs[0].eci;
+        }
+    }
+
+    if (prepared) {
+        /* Options already checked */
+        warn_number = prepared->warn_number;
+        if (warn_number) {
+            strcpy(symbol->errtxt, prepared->options->errtxt);
+        }
+    } else {
+        warn_number = check_symbology(symbol);
+        if (warn_number >= ZINT_ERROR) {
+            return warn_number;
+        }
+    }
+
+    if (seg_count > 1 && !supports_eci(symbol->symbology)) {
+        return error_tag(symbol, ZINT_ERROR_INVALID_OPTION, "775: Symbology does not support multiple segments");
+    }
+
+    /* Check ECI(s) */
+    for (i = 0; i < seg_count; i++) {
+        if (local_segs[i].eci) {
+            if (!supports_eci(symbol->symbology)) {
+                return error_tag(symbol, ZINT_ERROR_INVALID_OPTION, "217: Symbology does not support ECI switching");
+            }
+            if (local_segs[i].eci < 0 || local_segs[i].eci == 1 || local_segs[i].eci == 2 || local_segs[i].eci == 14
+                    || local_segs[i].eci == 19 || local_segs[i].eci > 999999) {
+                sprintf(symbol->errtxt, "218: Invalid ECI code %d", local_segs[i].eci);
+                return error_tag(symbol, ZINT_ERROR_INVALID_OPTION, NULL);
+            }
+        } else {
+            have_zero_eci = 1;
+        }
+    }
+
+    if (!prepared && (error_number = check_options(symbol))) {
+        return error_number; /* Already tagged */
+    }
+
+    if (symbol->rows >= 200) { /* Check for stacking too many symbols */
+        return error_tag(symbol, ZINT_ERROR_TOO_LONG, "770: Too many stacked symbols");
+    }
+    if (symbol->rows < 0) { /* Silently defend against out-of-bounds access */
+        symbol->rows = 0;
+    }
+
+    if (seg_count > 1) {
+        /* Note: GS1_MODE not currently supported when using multiple segments */
+        if ((symbol->input_mode & 0x07) == GS1_MODE) {
+            return error_tag(symbol, ZINT_ERROR_INVALID_OPTION, "776: GS1 mode not supported for multiple segments");
+        }
+    }
+
+    if ((symbol->input_mode & 0x07) == UNICODE_MODE) {
+        for (i = 0; i < seg_count; i++) {
+            if (!is_valid_utf8(local_segs[i].source, local_segs[i].length)) {
+                return error_tag(symbol, ZINT_ERROR_INVALID_DATA, "245: Invalid UTF-8 in input data");
+            }
+        }
+    }
+
+    STATS_END(symbol, ZINT_PHASE_VALIDATE);
+
+    /* Use any cached result, unless stacking, debugging or sizing only */
+    if (symbol->cache && symbol->rows == 0 && !symbol->debug && !symbol->priv->geometry
+            && cache_encode_key(symbol, local_segs, seg_count)) {
+        if ((error_number = cache_encode_get(symbol)) >= 0) {
+            return error_number;
+        }
+    }
+
+    if (!(local_sources = (unsigned char *) z_scratch(symbol, total_len + seg_count))) {
+        local_sources = (unsigned char *) z_alloca(total_len + seg_count);
+    }
+
+    for (i = 0, local_source = local_sources; i < seg_count; i++) {
+        local_segs[i].source = local_source;
+        memcpy(local_segs[i].source, segs[i].source, local_segs[i].length);
+        local_segs[i].source[local_segs[i].length] = '\0';
+        local_source += local_segs[i].length + 1;
+    }
+
+    /* Start acting on input mode */
+    if (symbol->input_mode & ESCAPE_MODE) {
+        STATS_BEGIN(symbol, ZINT_PHASE_VALIDATE);
+        for (i = 0; i < seg_count; i++) {
+            error_number = escape_char_process(symbol, local_segs[i].source, &local_segs[i].length);
+            if (error_number != 0) { /* Only returns errors, not warnings */
+                return error_tag(symbol, error_number, NULL);
+            }
+        }
+        if (symbol->primary[0]) {
+            /* Process copy so `primary` left untouched on error */
+            unsigned char primary[sizeof(symbol->primary)];
+            const int primary_len = (int) strlen(symbol->primary);
+            int escaped_len = primary_len;
+            memcpy(primary, symbol->primary, primary_len + 1);
+            error_number = escape_char_process(symbol, primary, &escaped_len);
+            if (error_number != 0) { /* Only returns errors, not warnings */
+                return error_tag(symbol, error_number, NULL);
+            }
+            if (escaped_len != primary_len) { /* Only changes if escapes present & shrink */
+                memcpy(symbol->primary, primary, escaped_len + 1);
+            }
+        }
+        STATS_END(symbol, ZINT_PHASE_VALIDATE);
+    }
+
+    if ((symbol->input_mode & 0x07) == UNICODE_MODE) {
+        /* Only strip BOM on first segment */
+        strip_bom(local_segs[0].source, &local_segs[0].length);
+    }
+
+    if (((symbol->input_mode & 0x07) == GS1_MODE) || (check_force_gs1(symbol->symbology))) {
+        if (gs1_compliant(symbol->symbology)) {
+            /* Reduce input for composite and non-forced symbologies, others (EAN128 and RSS_EXP based) will
+               handle it themselves */
+            if (is_composite(symbol->symbology) || !check_force_gs1(symbol->symbology)) {
+                unsigned char *reduced;
+                if (!(reduced = (unsigned char *) z_scratch(symbol, local_segs[0].length + 1))) {
+                    reduced = (unsigned char *) z_alloca(local_segs[0].length + 1);
+                }
+                STATS_BEGIN(symbol, ZINT_PHASE_GS1);
+                error_number = gs1_verify(symbol, local_segs[0].source, local_segs[0].length, reduced);
+                STATS_END(symbol, ZINT_PHASE_GS1);
+                if (error_number) {
+                    static const char in_2d_comp[] = " in 2D component";
+                    if (is_composite(symbol->symbology)
+                            && strlen(symbol->errtxt) + strlen(in_2d_comp) < sizeof(symbol->errtxt)) {
+                        strcat(symbol->errtxt, in_2d_comp);
+                    }
                     error_number = error_tag(symbol, error_number, NULL);
                     if (error_number >= ZINT_ERROR) {
                         return error_number;
@@ -1193,23 +1466,34 @@ int ZBarcode_Encode_Segs(struct zint_symbol *symbol, const struct zint_seg segs[
         }
     }
 
+    if (symbol->priv->compact) {
+        /* Encode directly into the symbol's own matrix, grown for the duration */
+        if ((error_number = modules_expand(symbol))) {
+            return error_tag(symbol, error_number, NULL);
+        }
+    }
+
+    /* Select any ECI needed up front, so that the symbology is only encoded once */
+    if (have_zero_eci && supports_eci(symbol->symbology) && (symbol->input_mode & 0x07) == UNICODE_MODE
+            && is_eci_needed_segs(symbol->symbology, local_segs, seg_count)) {
+        STATS_BEGIN(symbol, ZINT_PHASE_ECI);
+        first_eci_set = get_best_eci_segs(symbol, local_segs, seg_count);
+        STATS_END(symbol, ZINT_PHASE_ECI);
+    }
+
     error_number = extended_or_reduced_charset(symbol, local_segs, seg_count);
 
-    if ((error_number == ZINT_ERROR_INVALID_DATA) && have_zero_eci && supports_eci(symbol->symbology)
-            && (symbol->input_mode & 0x07) == UNICODE_MODE) {
-        /* Try another ECI mode */
-        const int first_eci_set = get_best_eci_segs(symbol, local_segs, seg_count);
-        if (first_eci_set != 0) {
-            error_number = extended_or_reduced_charset(symbol, local_segs, seg_count);
-            /* Inclusion of ECI more noteworthy than other warnings, so overwrite (if any) */
-            if (error_number < ZINT_ERROR) {
-                error_number = ZINT_WARN_USES_ECI;
-                if (!(symbol->debug & ZINT_DEBUG_TEST)) {
-                    sprintf(symbol->errtxt, "222: Encoded data includes ECI %d", first_eci_set);
-                }
-                if (symbol->debug & ZINT_DEBUG_PRINT) printf("Added ECI %d\n", first_eci_set);
-            }
+    /* Inclusion of ECI more noteworthy than other warnings, so overwrite (if any) */
+    if (first_eci_set != 0 && error_number < ZINT_ERROR) {
+        error_number = ZINT_WARN_USES_ECI;
+        if (!(symbol->debug & ZINT_DEBUG_TEST)) {
+            sprintf(symbol->errtxt, "222: Encoded data includes ECI %d", first_eci_set);
         }
+        if (symbol->debug & ZINT_DEBUG_PRINT) printf("Added ECI %d\n", first_eci_set);
+    }
+
+    if (symbol->priv->compact) {
+        modules_shrink(symbol);
     }
 
     if (error_number == 0) {
@@ -1222,11 +1506,57 @@ int ZBarcode_Encode_Segs(struct zint_symbol *symbol, const struct zint_seg segs[
         if (symbol->height < 0.5f) { /* Absolute minimum */
             (void) set_height(symbol, 0.0f, 50.0f, 0.0f, 1 /*no_errtxt*/);
         }
+        if (symbol->priv->cache_key) {
+            cache_encode_put(symbol, error_number);
+        }
+    } else {
+        cache_key_free(symbol); /* Only successful encodes are output from cache */
     }
 
     return error_number;
 }
 
+/* Encode segments, timing the whole if `symbol->stats` set (see `struct zint_stats` in "zint.h") */
+static int encode_segs(struct zint_symbol *symbol, const struct zint_seg segs[], const int seg_count,
+            const struct zint_prepared *prepared) {
+    struct zint_symbol_private local_priv;
+    int error_number;
+
+    if (!symbol) return ZINT_ERROR_INVALID_DATA;
+
+    priv_attach(symbol, &local_priv);
+
+#ifdef ZINT_STATS
+    if (symbol->stats) {
+        memset(symbol->stats, 0, sizeof(*symbol->stats));
+        symbol->stats->version = symbol->stats->ecc_level = symbol->stats->mask = -1;
+        symbol->priv->stats_open = 0;
+
+        STATS_BEGIN(symbol, ZINT_PHASE_ENCODE);
+        error_number = encode_segs_main(symbol, segs, seg_count, prepared);
+        stats_end_open(symbol); /* Ends ENCODE and any phase left open by an error return */
+
+        symbol->stats->rows = symbol->rows;
+        symbol->stats->width = symbol->width;
+    } else
+#endif
+    error_number = encode_segs_main(symbol, segs, seg_count, prepared);
+
+    /* Release scratch, coalescing any overflow blocks now so that the next encode doesn't allocate */
+    if (symbol->priv->arena) {
+        arena_reset(symbol->priv->arena);
+    }
+
+    priv_detach(symbol, &local_priv);
+
+    return error_number;
+}
+
+/* Encode a barcode with multiple ECI segments. */
+int ZBarcode_Encode_Segs(struct zint_symbol *symbol, const struct zint_seg segs[], const int seg_count) {
+    return encode_segs(symbol, segs, seg_count, NULL /*prepared*/);
+}
+
 /* Helper for output routines to check `rotate_angle` and dottiness */
 static int check_output_args(struct zint_symbol *symbol, int rotate_angle) {
 
@@ -1277,27 +1607,59 @@ static int filetype_idx(const char *extension) {
     return i == ARRAY_SIZE(filetypes) ? -1 : i;
 }
 
+/* Output a previously encoded symbol to memory as raster (`is_vector` 0) or vector (`is_vector` 1), using any
+   cached output */
+static int plot_buffer(struct zint_symbol *symbol, const int rotate_angle, const int is_vector) {
+    int error_number;
+
+    if (symbol->priv->cache_key && (error_number = cache_output_get(symbol, rotate_angle, is_vector)) >= 0) {
+        return error_number;
+    }
+    STATS_BEGIN(symbol, ZINT_PHASE_PLOT);
+    if (is_vector) {
+        error_number = plot_vector(symbol, rotate_angle, OUT_BUFFER);
+    } else {
+        error_number = plot_raster(symbol, rotate_angle, OUT_BUFFER);
+    }
+    STATS_END(symbol, ZINT_PHASE_PLOT);
+    if (symbol->priv->cache_key && error_number < ZINT_ERROR) {
+        cache_output_put(symbol, rotate_angle, is_vector, error_number);
+    }
+
+    return error_number;
+}
+
 /* Output a previously encoded symbol to file `symbol->outfile` */
-int ZBarcode_Print(struct zint_symbol *symbol, int rotate_angle) {
+static int print_symbol(struct zint_symbol *symbol, const int rotate_angle) {
     int error_number;
     int len;
 
     if ((error_number = check_output_args(symbol, rotate_angle))) { /* >= ZINT_ERROR only */
         return error_number; /* Already tagged */
     }
+    if ((symbol->output_options & (BARCODE_MEMORY_FILE | BARCODE_STREAM_WRITE)) == BARCODE_STREAM_WRITE
+            && !symbol->write_fn) {
+        return error_tag(symbol, ZINT_ERROR_INVALID_OPTION, "786: Stream write callback NULL");
+    }
 
     len = (int) strlen(symbol->outfile);
     if (len > 3) {
         int i = filetype_idx(symbol->outfile + len - 3);
         if (i >= 0) {
             if (filetypes[i].filetype) {
-                if (filetypes[i].is_raster) {
-                    error_number = plot_raster(symbol, rotate_angle, filetypes[i].filetype);
-                } else {
-                    error_number = plot_vector(symbol, rotate_angle, filetypes[i].filetype);
+                if ((error_number = out_check_colour_options(symbol)) == 0) {
+                    STATS_BEGIN(symbol, ZINT_PHASE_PLOT);
+                    if (filetypes[i].is_raster) {
+                        error_number = plot_raster(symbol, rotate_angle, filetypes[i].filetype);
+                    } else {
+                        error_number = plot_vector(symbol, rotate_angle, filetypes[i].filetype);
+                    }
+                    STATS_END(symbol, ZINT_PHASE_PLOT);
                 }
             } else {
+                STATS_BEGIN(symbol, ZINT_PHASE_OUTPUT);
                 error_number = dump_plot(symbol);
+                STATS_END(symbol, ZINT_PHASE_OUTPUT);
             }
         } else {
             return error_tag(symbol, ZINT_ERROR_INVALID_OPTION, "225: Unknown output format");
@@ -1309,30 +1671,48 @@ int ZBarcode_Print(struct zint_symbol *symbol, int rotate_angle) {
     return error_tag(symbol, error_number, NULL);
 }
 
-/* Output a previously encoded symbol to memory as raster (`symbol->bitmap`) */
-int ZBarcode_Buffer(struct zint_symbol *symbol, int rotate_angle) {
+/* Output a previously encoded symbol to file `symbol->outfile` */
+int ZBarcode_Print(struct zint_symbol *symbol, int rotate_angle) {
+    struct zint_symbol_private local_priv;
     int error_number;
 
-    if ((error_number = check_output_args(symbol, rotate_angle))) { /* >= ZINT_ERROR only */
-        return error_number; /* Already tagged */
-    }
+    if (!symbol) return ZINT_ERROR_INVALID_DATA;
 
-    error_number = plot_raster(symbol, rotate_angle, OUT_BUFFER);
-    return error_tag(symbol, error_number, NULL);
+    priv_attach(symbol, &local_priv);
+    error_number = print_symbol(symbol, rotate_angle);
+    priv_detach(symbol, &local_priv);
+
+    return error_number;
 }
 
-/* Output a previously encoded symbol to memory as vector (`symbol->vector`) */
-int ZBarcode_Buffer_Vector(struct zint_symbol *symbol, int rotate_angle) {
+/* Output a previously encoded symbol to memory as raster (`is_vector` 0) or vector (`is_vector` 1) */
+static int buffer_symbol(struct zint_symbol *symbol, const int rotate_angle, const int is_vector) {
+    struct zint_symbol_private local_priv;
     int error_number;
 
     if ((error_number = check_output_args(symbol, rotate_angle))) { /* >= ZINT_ERROR only */
         return error_number; /* Already tagged */
     }
 
-    error_number = plot_vector(symbol, rotate_angle, OUT_BUFFER);
+    priv_attach(symbol, &local_priv);
+    if ((error_number = out_check_colour_options(symbol)) == 0) {
+        error_number = plot_buffer(symbol, rotate_angle, is_vector);
+    }
+    priv_detach(symbol, &local_priv);
+
     return error_tag(symbol, error_number, NULL);
 }
 
+/* Output a previously encoded symbol to memory as raster (`symbol->bitmap`) */
+int ZBarcode_Buffer(struct zint_symbol *symbol, int rotate_angle) {
+    return buffer_symbol(symbol, rotate_angle, 0 /*is_vector*/);
+}
+
+/* Output a previously encoded symbol to memory as vector (`symbol->vector`) */
+int ZBarcode_Buffer_Vector(struct zint_symbol *symbol, int rotate_angle) {
+    return buffer_symbol(symbol, rotate_angle, 1 /*is_vector*/);
+}
+
 /* Encode and output a symbol to file `symbol->outfile` */
 int ZBarcode_Encode_and_Print(struct zint_symbol *symbol, const unsigned char *source, int length, int rotate_angle) {
     struct zint_seg segs[1];
@@ -1487,7 +1867,7 @@ int ZBarcode_Encode_File(struct zint_symbol *symbol, const char *filename) {
     }
 
     /* Allocate memory */
-    buffer = (unsigned char *) malloc(fileLen);
+    buffer = (unsigned char *) z_malloc(fileLen);
     if (!buffer) {
         if (file_opened) {
             (void) fclose(file);
@@ -1501,7 +1881,7 @@ int ZBarcode_Encode_File(struct zint_symbol *symbol, const char *filename) {
         n = fread(buffer + nRead, 1, fileLen - nRead, file);
         if (ferror(file)) {
             sprintf(symbol->errtxt, "241: Input file read error (%d: %.30s)", errno, strerror(errno));
-            free(buffer);
+            z_free(buffer);
             if (file_opened) {
                 (void) fclose(file);
             }
@@ -1513,12 +1893,12 @@ int ZBarcode_Encode_File(struct zint_symbol *symbol, const char *filename) {
     if (file_opened) {
         if (fclose(file) != 0) {
             sprintf(symbol->errtxt, "794: Failure on closing input file (%d: %.30s)", errno, strerror(errno));
-            free(buffer);
+            z_free(buffer);
             return error_tag(symbol, ZINT_ERROR_INVALID_DATA, NULL);
         }
     }
     ret = ZBarcode_Encode(symbol, buffer, (int) nRead);
-    free(buffer);
+    z_free(buffer);
     return ret;
 }
 
@@ -1579,6 +1959,486 @@ int ZBarcode_Encode_File_and_Buffer_Vector(struct zint_symbol *symbol, const cha
     return error_number;
 }
 
+/* Determine the size of the symbol that encoding `source` would produce, and of its raster and vector output,
+   without placing modules or rendering */
+int ZBarcode_Geometry(struct zint_symbol *symbol, const unsigned char *source, int length,
+            struct zint_geometry *geometry) {
+    struct zint_seg segs[1];
+
+    if (!symbol) return ZINT_ERROR_INVALID_DATA;
+
+    segs[0].eci = symbol->eci;
+    segs[0].source = (unsigned char *) source;
+    segs[0].length = length;
+
+    return ZBarcode_Geometry_Segs(symbol, segs, 1, geometry);
+}
+
+/* Determine the size of the symbol that encoding segments `segs` would produce, as `ZBarcode_Geometry()` */
+static int geometry_segs(struct zint_symbol *symbol, const struct zint_seg segs[], const int seg_count,
+            struct zint_geometry *geometry) {
+    int error_number, output_error_number;
+    char errtxt[sizeof(symbol->errtxt)];
+    float height, row_height[sizeof(symbol->row_height) / sizeof(symbol->row_height[0])];
+
+    if (!geometry) {
+        return error_tag(symbol, ZINT_ERROR_INVALID_DATA, "787: Geometry argument NULL");
+    }
+    memset(geometry, 0, sizeof(*geometry));
+    geometry->version = geometry->ecc_level = -1;
+
+    if ((error_number = check_output_args(symbol, 0 /*rotate_angle*/))) { /* >= ZINT_ERROR only */
+        return error_number; /* Already tagged */
+    }
+
+    /* Encoders that support it size the symbol and return early, skipping error correction and placement */
+    symbol->priv->geometry = geometry;
+    error_number = encode_segs(symbol, segs, seg_count, NULL /*prepared*/);
+    symbol->priv->geometry = NULL;
+    if (error_number >= ZINT_ERROR) {
+        return error_number;
+    }
+
+    geometry->rows = symbol->rows;
+    geometry->width = symbol->width;
+
+    /* Raster plotting may round the heights to whole pixels, so restore them for the vector pass */
+    height = symbol->height;
+    memcpy(row_height, symbol->row_height, sizeof(row_height));
+    output_error_number = plot_raster(symbol, 0 /*rotate_angle*/, OUT_SIZE_ONLY);
+    if (output_error_number == 0) {
+        symbol->height = height;
+        memcpy(symbol->row_height, row_height, sizeof(row_height));
+        output_error_number = plot_vector(symbol, 0 /*rotate_angle*/, OUT_SIZE_ONLY);
+    }
+    if (output_error_number) {
+        return error_tag(symbol, output_error_number, NULL);
+    }
+    geometry->bitmap_width = symbol->bitmap_width;
+    geometry->bitmap_height = symbol->bitmap_height;
+    geometry->vector_width = symbol->vector->width;
+    geometry->vector_height = symbol->vector->height;
+    if (symbol->dpmm) {
+        geometry->width_mm = stripf(geometry->vector_width / symbol->dpmm);
+        geometry->height_mm = stripf(geometry->vector_height / symbol->dpmm);
+    }
+
+    /* Leave the symbol as if never encoded, bar any warning */
+    strcpy(errtxt, symbol->errtxt);
+    ZBarcode_Clear(symbol);
+    strcpy(symbol->errtxt, errtxt);
+
+    return error_number;
+}
+
+/* Determine the size of the symbol that encoding segments `segs` would produce, as `ZBarcode_Geometry()` */
+int ZBarcode_Geometry_Segs(struct zint_symbol *symbol, const struct zint_seg segs[], const int seg_count,
+            struct zint_geometry *geometry) {
+    struct zint_symbol_private local_priv;
+    int error_number;
+
+    if (!symbol) return ZINT_ERROR_INVALID_DATA;
+
+    priv_attach(symbol, &local_priv);
+    error_number = geometry_segs(symbol, segs, seg_count, geometry);
+    priv_detach(symbol, &local_priv);
+
+    return error_number;
+}
+
+/* Check whether `source` fits `symbol` from capacity tables alone, returning 1 if it certainly fits, 0 if it
+   certainly doesn't (setting `*p_max`), or -1 if the tables can't decide */
+static int capacity_fits(const struct zint_symbol *symbol, const unsigned char *source, const int length,
+            int *p_max) {
+    const int symbology = symbol->symbology;
+    const int mode = symbol->input_mode & 0x07;
+    int option_2 = symbol->option_2;
+    int max_numeric, i;
+
+    if (symbology != BARCODE_QRCODE && symbology != BARCODE_MICROQR && symbology != BARCODE_RMQR
+            && symbology != BARCODE_DATAMATRIX && symbology != BARCODE_PDF417 && symbology != BARCODE_PDF417COMP
+            && symbology != BARCODE_MICROPDF417) {
+        return -1; /* Aztec Code excluded as Punctuation pairs denser than digits and bit stuffing unpredictable */
+    }
+    /* Anything that adds to or compresses the data, or may be converted to ECI */
+    if ((mode != DATA_MODE && mode != UNICODE_MODE) || (symbol->input_mode & ESCAPE_MODE) || symbol->eci
+            || symbol->structapp.count || (symbol->output_options & READER_INIT)) {
+        return -1;
+    }
+    if (symbology == BARCODE_DATAMATRIX && length >= 3 && memcmp(source, "[)>", 3) == 0) {
+        return -1; /* Macro 05/06 header and trailer compressed */
+    }
+    if (symbology == BARCODE_PDF417 || symbology == BARCODE_PDF417COMP) {
+        if (symbol->option_3) {
+            return -1; /* Rows given */
+        }
+    } else if (symbology == BARCODE_MICROPDF417) {
+        option_2 = 0; /* Columns increased as needed, so reject on maximum */
+    }
+
+    /* Digits are densest (at least per input byte), so nothing longer than numeric capacity can fit */
+    if (!(max_numeric = ZBarcode_Capacity(symbology, symbol->option_1, option_2, ZINT_CAPACITY_NUMERIC))) {
+        return -1; /* Invalid options */
+    }
+    if (length > max_numeric) {
+        *p_max = max_numeric;
+        return 0;
+    }
+
+    /* Any bytes fit in byte capacity, provided no UTF-8 conversion */
+    if (mode == UNICODE_MODE) {
+        for (i = 0; i < length && !(source[i] & 0x80); i++);
+        if (i < length) {
+            return -1;
+        }
+    }
+    if (length <= ZBarcode_Capacity(symbology, symbol->option_1, symbol->option_2, ZINT_CAPACITY_BYTE)) {
+        return 1;
+    }
+
+    return -1;
+}
+
+/* Whether `source` would fit in `symbol` as currently set up */
+int ZBarcode_Fits(struct zint_symbol *symbol, const unsigned char *source, int length) {
+    struct zint_geometry geometry;
+    int max = 0;
+
+    if (!symbol) return ZINT_ERROR_INVALID_DATA;
+
+    if (source && length <= 0) {
+        length = (int) ustrlen(source);
+    }
+    if (source && length > 0 && length <= ZINT_MAX_DATA_LEN) {
+        const int fits = capacity_fits(symbol, source, length, &max);
+        if (fits >= 0) {
+            ZBarcode_Clear(symbol);
+            if (fits == 0) {
+                sprintf(symbol->errtxt, "788: Input too long (%d character maximum)", max);
+                return error_tag(symbol, ZINT_ERROR_TOO_LONG, NULL);
+            }
+            return 0;
+        }
+    }
+
+    return ZBarcode_Geometry(symbol, source, length, &geometry);
+}
+
+/* Copy the input fields (options) of `src` to `dst`, leaving its output fields as is */
+static void copy_symbol_options(struct zint_symbol *dst, const struct zint_symbol *src) {
+    struct zint_stats *stats = dst->stats; /* Keep own, as not to be shared between symbols (or threads) */
+
+    /* Input fields all precede `text`, the first output-only field */
+    memcpy(dst, src, offsetof(struct zint_symbol, text));
+    dst->fgcolor = &dst->fgcolour[0];
+    dst->bgcolor = &dst->bgcolour[0];
+    dst->stats = stats;
+}
+
+/* Check the options of `symbol` and set `*p_prepared` on success. Any error/warning message is copied to `errtxt`
+   if non-NULL */
+static int prepare(const struct zint_symbol *symbol, const int output_type, const int rotate_angle,
+            struct zint_prepared **p_prepared, char *errtxt) {
+    struct zint_symbol *options;
+    struct zint_prepared *prepared;
+    int error_number, warn_number;
+
+    if (!(options = ZBarcode_Create_Compact())) {
+        if (errtxt) {
+            strcpy(errtxt, "783: Insufficient memory for prepared options");
+        }
+        return ZINT_ERROR_MEMORY;
+    }
+    copy_symbol_options(options, symbol);
+
+    if ((options->input_mode & 0x07) > 2) {
+        options->input_mode = DATA_MODE; /* As `ZBarcode_Encode_Segs()` */
+    }
+    error_number = warn_number = check_symbology(options);
+    if (error_number < ZINT_ERROR) {
+        error_number = check_options(options);
+    }
+    if (error_number == 0 && output_type != ZINT_BATCH_ENCODE) {
+        if ((error_number = check_output_args(options, rotate_angle)) == 0) {
+            error_number = error_tag(options, out_check_colour_options(options), NULL);
+        }
+    }
+    if (errtxt) {
+        strcpy(errtxt, options->errtxt);
+    }
+    if (error_number >= ZINT_ERROR) {
+        ZBarcode_Delete(options);
+        return error_number;
+    }
+
+    if (!(prepared = (struct zint_prepared *) z_malloc(sizeof(struct zint_prepared)))) {
+        ZBarcode_Delete(options);
+        if (errtxt) {
+            strcpy(errtxt, "783: Insufficient memory for prepared options");
+        }
+        return ZINT_ERROR_MEMORY;
+    }
+    prepared->options = options;
+    prepared->output_type = output_type;
+    prepared->rotate_angle = rotate_angle;
+    prepared->warn_number = warn_number;
+    *p_prepared = prepared;
+
+    return warn_number;
+}
+
+/* Check the options of `symbol` once, for repeated encoding and output with `ZBarcode_Encode_Prepared()` */
+int ZBarcode_Prepare(struct zint_symbol *symbol, int output_type, int rotate_angle,
+            struct zint_prepared **p_prepared) {
+
+    if (!symbol) return ZINT_ERROR_INVALID_DATA;
+
+    if (!p_prepared) {
+        return error_tag(symbol, ZINT_ERROR_INVALID_DATA, "784: Prepared options argument NULL");
+    }
+    *p_prepared = NULL;
+
+    if (output_type < ZINT_BATCH_ENCODE || output_type > ZINT_BATCH_BUFFER_VECTOR) {
+        return error_tag(symbol, ZINT_ERROR_INVALID_OPTION, "782: Invalid output type");
+    }
+
+    return prepare(symbol, output_type, rotate_angle, p_prepared, symbol->errtxt); /* Already tagged */
+}
+
+/* Encode `source` using the options of `prepared` into `symbol`, which is first cleared, and output as prepared */
+int ZBarcode_Encode_Prepared(const struct zint_prepared *prepared, struct zint_symbol *symbol,
+            const unsigned char *source, int length) {
+    struct zint_symbol_private local_priv;
+    struct zint_seg segs[1];
+    int error_number;
+    int first_err;
+
+    if (!symbol) return ZINT_ERROR_INVALID_DATA;
+
+    ZBarcode_Clear(symbol);
+
+    if (!prepared) {
+        return error_tag(symbol, ZINT_ERROR_INVALID_DATA, "785: Prepared options NULL");
+    }
+    copy_symbol_options(symbol, prepared->options);
+
+    segs[0].eci = symbol->eci;
+    segs[0].source = (unsigned char *) source;
+    segs[0].length = length;
+
+    error_number = encode_segs(symbol, segs, 1, prepared);
+    if (error_number >= ZINT_ERROR || prepared->output_type == ZINT_BATCH_ENCODE) {
+        return error_number;
+    }
+
+    /* Output args and colour options already checked */
+    first_err = error_number;
+    priv_attach(symbol, &local_priv);
+    error_number = plot_buffer(symbol, prepared->rotate_angle,
+                                prepared->output_type == ZINT_BATCH_BUFFER_VECTOR /*is_vector*/);
+    priv_detach(symbol, &local_priv);
+    error_number = error_tag(symbol, error_number, NULL);
+    if (error_number == 0) {
+        error_number = first_err;
+    }
+
+    return error_number;
+}
+
+/* Free prepared options */
+void ZBarcode_Delete_Prepared(struct zint_prepared *prepared) {
+    if (!prepared) return;
+
+    ZBarcode_Delete(prepared->options);
+    z_free(prepared);
+}
+
+/* Create an encode result cache holding up to `max_memory` bytes (0 for default 16 MiB) */
+struct zint_cache *ZBarcode_Cache_Create(unsigned long max_memory) {
+    return cache_create(max_memory);
+}
+
+/* Discard all entries of `cache`, leaving its statistics as is */
+void ZBarcode_Cache_Clear(struct zint_cache *cache) {
+    if (!cache) return;
+
+    cache_clear(cache);
+}
+
+/* Copy the statistics of `cache` into `stats` */
+void ZBarcode_Cache_Stats(struct zint_cache *cache, struct zint_cache_stats *stats) {
+    if (!stats) return;
+
+    if (!cache) {
+        memset(stats, 0, sizeof(struct zint_cache_stats));
+        return;
+    }
+    cache_stats(cache, stats);
+}
+
+/* Free `cache` */
+void ZBarcode_Cache_Delete(struct zint_cache *cache) {
+    if (!cache) return;
+
+    cache_delete(cache);
+}
+
+/* State shared between `ZBarcode_Encode_Batch()` workers */
+struct batch_ctx {
+    const struct zint_symbol *template_symbol;
+    const struct zint_prepared *prepared; /* Options checked once, or NULL if check failed */
+    struct zint_batch_item *items;
+    int item_count;
+    int output_type;
+    int rotate_angle;
+    zint_batch_callback_t callback;
+    void *callback_ctx;
+    z_mutex_t mutex;    /* Protects the following fields */
+    int next_item;      /* Next item to be claimed by a worker */
+    int next_callback;  /* Next item to be passed to `callback` */
+    int in_callback;    /* Set while a worker is passing completed items to `callback` */
+    unsigned char *done; /* Per-item completion flags (`callback` only) */
+};
+
+/* Create a symbol for batch item `item`, encode and output it */
+static void batch_encode_item(const struct batch_ctx *ctx, struct zint_batch_item *item) {
+    struct zint_symbol *symbol;
+
+    if (!(symbol = ZBarcode_Create())) {
+        item->error_number = ZINT_ERROR_MEMORY;
+        return;
+    }
+    item->symbol = symbol;
+
+    if (ctx->prepared) {
+        item->error_number = ZBarcode_Encode_Prepared(ctx->prepared, symbol, item->source, item->length);
+        return;
+    }
+
+    /* Options bad, so encode the normal way to get per-item errors */
+    copy_symbol_options(symbol, ctx->template_symbol);
+    if (ctx->output_type == ZINT_BATCH_BUFFER) {
+        item->error_number = ZBarcode_Encode_and_Buffer(symbol, item->source, item->length, ctx->rotate_angle);
+    } else if (ctx->output_type == ZINT_BATCH_BUFFER_VECTOR) {
+        item->error_number = ZBarcode_Encode_and_Buffer_Vector(symbol, item->source, item->length,
+                                                                ctx->rotate_angle);
+    } else {
+        item->error_number = ZBarcode_Encode(symbol, item->source, item->length);
+    }
+}
+
+/* Batch worker - claims and processes items until none left. Completed items are passed to any callback in input
+   order by whichever worker completes the next item due, one worker at a time */
+static void batch_worker(void *arg) {
+    struct batch_ctx *ctx = (struct batch_ctx *) arg;
+    int i;
+
+    for (;;) {
+        z_mutex_lock(&ctx->mutex);
+        i = ctx->next_item < ctx->item_count ? ctx->next_item++ : -1;
+        z_mutex_unlock(&ctx->mutex);
+        if (i == -1) {
+            break;
+        }
+
+        batch_encode_item(ctx, &ctx->items[i]);
+
+        if (ctx->callback) {
+            z_mutex_lock(&ctx->mutex);
+            ctx->done[i] = 1;
+            if (!ctx->in_callback) {
+                ctx->in_callback = 1;
+                while (ctx->next_callback < ctx->item_count && ctx->done[ctx->next_callback]) {
+                    const int j = ctx->next_callback++;
+                    z_mutex_unlock(&ctx->mutex);
+                    ctx->callback(ctx->callback_ctx, &ctx->items[j], j);
+                    z_mutex_lock(&ctx->mutex);
+                }
+                ctx->in_callback = 0;
+            }
+            z_mutex_unlock(&ctx->mutex);
+        }
+    }
+}
+
+/* Encode `item_count` items using `symbol` as a template for their options, using up to `num_threads` worker
+   threads (0 for one per processor), and output each as `output_type` to its own symbol `items[i].symbol` */
+int ZBarcode_Encode_Batch(const struct zint_symbol *symbol, struct zint_batch_item items[], const int item_count,
+            const int output_type, const int rotate_angle, const int num_threads, zint_batch_callback_t callback,
+            void *callback_ctx) {
+    struct batch_ctx ctx;
+    struct zint_prepared *prepared = NULL;
+    z_thread_t *threads = NULL;
+    int thread_count;
+    int started = 0;
+    int error_number = 0;
+    int i;
+
+    if (!symbol || item_count < 0 || (item_count && !items)) {
+        return ZINT_ERROR_INVALID_DATA;
+    }
+    if (output_type < ZINT_BATCH_ENCODE || output_type > ZINT_BATCH_BUFFER_VECTOR || num_threads < 0) {
+        return ZINT_ERROR_INVALID_OPTION;
+    }
+
+    for (i = 0; i < item_count; i++) {
+        items[i].symbol = NULL;
+        items[i].error_number = 0;
+    }
+    if (item_count == 0) {
+        return 0;
+    }
+
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.template_symbol = symbol;
+    ctx.items = items;
+    ctx.item_count = item_count;
+    ctx.output_type = output_type;
+    ctx.rotate_angle = rotate_angle;
+    ctx.callback = callback;
+    ctx.callback_ctx = callback_ctx;
+
+    if (callback && !(ctx.done = (unsigned char *) z_calloc(item_count, 1))) {
+        return ZINT_ERROR_MEMORY;
+    }
+    if (!z_mutex_init(&ctx.mutex)) {
+        z_free(ctx.done);
+        return ZINT_ERROR_MEMORY;
+    }
+    /* Check options once - if bad `prepared` left NULL and items encoded individually */
+    (void) prepare(symbol, output_type, rotate_angle, &prepared, NULL /*errtxt*/);
+    ctx.prepared = prepared;
+
+    thread_count = num_threads ? num_threads : z_thread_cpu_count();
+    if (thread_count > item_count) {
+        thread_count = item_count;
+    }
+    /* The calling thread is also a worker, so start one less; if any fail to start just make do with fewer */
+    if (thread_count > 1 && (threads = (z_thread_t *) z_malloc(sizeof(z_thread_t) * (thread_count - 1)))) {
+        while (started < thread_count - 1 && z_thread_create(&threads[started], batch_worker, &ctx)) {
+            started++;
+        }
+    }
+
+    batch_worker(&ctx);
+
+    for (i = 0; i < started; i++) {
+        z_thread_join(&threads[i]);
+    }
+    z_free(threads);
+    z_mutex_destroy(&ctx.mutex);
+    z_free(ctx.done);
+    ZBarcode_Delete_Prepared(prepared);
+
+    for (i = 0; i < item_count; i++) {
+        if (items[i].error_number > error_number) {
+            error_number = items[i].error_number;
+        }
+    }
+
+    return error_number;
+}
+
 /* Checks whether a symbology is supported */
 int ZBarcode_ValidID(int symbol_id) {
 
@@ -1917,6 +2777,45 @@ unsigned int ZBarcode_Cap(int symbol_id, unsigned int cap_flag) {
     return result;
 }
 
+/* Return the maximum number of characters of `char_type` that `symbol_id` can hold at ECC level `option_1` and size
+   `option_2`, or 0 if not supported */
+int ZBarcode_Capacity(int symbol_id, int option_1, int option_2, int char_type) {
+
+    if (char_type < ZINT_CAPACITY_NUMERIC || char_type > ZINT_CAPACITY_KANJI) {
+        return 0;
+    }
+
+    switch (symbol_id) {
+        case BARCODE_QRCODE:
+        case BARCODE_MICROQR:
+        case BARCODE_RMQR:
+            return qr_capacity(symbol_id, option_1, option_2, char_type);
+            break;
+        case BARCODE_DATAMATRIX:
+            return dm_capacity(option_1, option_2, char_type);
+            break;
+        case BARCODE_AZTEC:
+            return azt_capacity(option_1, option_2, char_type);
+            break;
+        case BARCODE_PDF417:
+        case BARCODE_PDF417COMP:
+        case BARCODE_MICROPDF417:
+            return pdf_capacity(symbol_id, option_1, option_2, char_type);
+            break;
+        case BARCODE_HANXIN:
+            return hx_capacity(option_1, option_2, char_type);
+            break;
+        case BARCODE_GRIDMATRIX:
+            return gm_capacity(option_1, option_2, char_type);
+            break;
+        case BARCODE_CODEONE:
+            return c1_capacity(option_2, char_type);
+            break;
+    }
+
+    return 0;
+}
+
 /* Return default X-dimension in mm for symbology `symbol_id`. Returns 0 on error (invalid `symbol_id`) */
 float ZBarcode_Default_Xdim(int symbol_id) {
     float x_dim_mm;
@@ -2170,6 +3069,40 @@ int ZBarcode_NoPng(void) {
 #endif
 }
 
+/* Route all heap allocations through `malloc_fn`, `realloc_fn` and `free_fn` (all NULL for standard library) */
+int ZBarcode_SetAllocator(void *(*malloc_fn)(size_t size), void *(*realloc_fn)(void *ptr, size_t size),
+            void (*free_fn)(void *ptr)) {
+    return z_set_allocator(malloc_fn, realloc_fn, free_fn) ? ZINT_ERROR_INVALID_OPTION : 0;
+}
+
+/* Take large encoding scratch buffers from a per-symbol arena initially of `size` bytes (0 to free) */
+int ZBarcode_SetArena(struct zint_symbol *symbol, size_t size) {
+
+    if (!symbol) return ZINT_ERROR_INVALID_DATA;
+
+    if (!symbol->priv) {
+        return error_tag(symbol, ZINT_ERROR_INVALID_OPTION, "799: Symbol not created by ZBarcode_Create()");
+    }
+
+    arena_free(symbol->priv->arena);
+    symbol->priv->arena = NULL;
+
+    if (size && !(symbol->priv->arena = arena_create(size))) {
+        return error_tag(symbol, ZINT_ERROR_MEMORY, "789: Insufficient memory for arena");
+    }
+
+    return 0;
+}
+
+/* Whether Zint built with per-phase timing instrumentation (ZINT_STATS) */
+int ZBarcode_HaveStats(void) {
+#ifdef ZINT_STATS
+    return 1;
+#else
+    return 0;
+#endif
+}
+
 /* Return the version of Zint linked to */
 int ZBarcode_Version(void) {
     if (ZINT_VERSION_BUILD) {
@@ -38,6 +38,7 @@
 #include <fcntl.h>
 #endif
 #include "common.h"
+#include "filemem.h"
 #include "output.h"
 #include "pcx.h"        /* PCX header structure */
 
@@ -46,7 +47,8 @@ INTERNAL int pcx_pixel_plot(struct zint_symbol *symbol, const unsigned char *pix
     unsigned char fgred, fggrn, fgblu, fgalpha, bgred, bggrn, bgblu, bgalpha;
     int row, column, i, colour;
     int run_count;
-    FILE *pcx_file;
+    struct filemem fm;
+    struct filemem *const fmp = &fm;
     pcx_header_t header;
     int bytes_per_line = symbol->bitmap_width + (symbol->bitmap_width & 1); /* Must be even */
     unsigned char previous;
@@ -87,22 +89,20 @@ INTERNAL int pcx_pixel_plot(struct zint_symbol *symbol, const unsigned char *pix
     }
 
     /* Open output file in binary mode */
-    if (output_to_stdout) {
 #ifdef _MSC_VER
+    if (output_to_stdout) {
         if (-1 == _setmode(_fileno(stdout), _O_BINARY)) {
             sprintf(symbol->errtxt, "620: Could not set stdout to binary (%d: %.30s)", errno, strerror(errno));
             return ZINT_ERROR_FILE_ACCESS;
         }
+    }
 #endif
-        pcx_file = stdout;
-    } else {
-        if (!(pcx_file = out_fopen(symbol->outfile, "wb"))) {
-            sprintf(symbol->errtxt, "621: Could not open output file (%d: %.30s)", errno, strerror(errno));
-            return ZINT_ERROR_FILE_ACCESS;
-        }
+    if (!fm_open(fmp, symbol, "wb")) {
+        sprintf(symbol->errtxt, "621: Could not open output file (%d: %.30s)", errno, strerror(errno));
+        return ZINT_ERROR_FILE_ACCESS;
     }
 
-    fwrite(&header, sizeof(pcx_header_t), 1, pcx_file);
+    fm_write(&header, sizeof(pcx_header_t), 1, fmp);
 
     for (row = 0; row < symbol->bitmap_height; row++) {
         const unsigned char *const pb = pixelbuf + row * symbol->bitmap_width;
@@ -192,9 +192,9 @@ INTERNAL int pcx_pixel_plot(struct zint_symbol *symbol, const unsigned char *pix
                 } else {
                     if (run_count > 1 || (previous & 0xc0) == 0xc0) {
                         run_count += 0xc0;
-                        fputc(run_count, pcx_file);
+                        fm_putc(run_count, fmp);
                     }
-                    fputc(previous, pcx_file);
+                    fm_putc(previous, fmp);
                     previous = rle_row[column];
                     run_count = 1;
                 }
@@ -202,30 +202,27 @@ INTERNAL int pcx_pixel_plot(struct zint_symbol *symbol, const unsigned char *pix
 
             if (run_count > 1 || (previous & 0xc0) == 0xc0) {
                 run_count += 0xc0;
-                fputc(run_count, pcx_file);
+                fm_putc(run_count, fmp);
             }
-            fputc(previous, pcx_file);
+            fm_putc(previous, fmp);
         }
     }
 
-    if (ferror(pcx_file)) {
-        sprintf(symbol->errtxt, "622: Incomplete write to output (%d: %.30s)", errno, strerror(errno));
-        if (!output_to_stdout) {
-            (void) fclose(pcx_file);
-        }
+    if (fm_error(fmp)) {
+        sprintf(symbol->errtxt, "622: Incomplete write to output (%d: %.30s)", fm_error(fmp),
+                strerror(fm_error(fmp)));
+        fm_discard(fmp, symbol);
         return ZINT_ERROR_FILE_WRITE;
     }
 
-    if (output_to_stdout) {
-        if (fflush(pcx_file) != 0) {
-            sprintf(symbol->errtxt, "623: Incomplete flush to output (%d: %.30s)", errno, strerror(errno));
-            return ZINT_ERROR_FILE_WRITE;
-        }
-    } else {
-        if (fclose(pcx_file) != 0) {
-            sprintf(symbol->errtxt, "624: Failure on closing output file (%d: %.30s)", errno, strerror(errno));
-            return ZINT_ERROR_FILE_WRITE;
+    if (!fm_close(fmp, symbol)) {
+        if (output_to_stdout) {
+            sprintf(symbol->errtxt, "623: Incomplete flush to output (%d: %.30s)", fmp->err, strerror(fmp->err));
+        } else {
+            sprintf(symbol->errtxt, "624: Failure on closing output file (%d: %.30s)", fmp->err,
+                    strerror(fmp->err));
         }
+        return ZINT_ERROR_FILE_WRITE;
     }
 
     return 0;
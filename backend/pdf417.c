@@ -903,15 +903,16 @@ static void pdf_addEdges(const unsigned char source[], const int length, const i
 }
 
 /* Calculate optimized encoding modes */
-static int pdf_define_mode(int liste[3][PDF_MAX_LEN], int *p_indexliste, const unsigned char source[],
-            const int length, const int lastmode, const int debug_print) {
+static int pdf_define_mode(struct zint_symbol *symbol, int liste[3][PDF_MAX_LEN], int *p_indexliste,
+            const unsigned char source[], const int length, const int lastmode, const int debug_print) {
 
     int i, j, v_i;
     int minimalJ, minimalSize;
     struct pdf_edge *edge;
     int mode_start, mode_len;
 
-    struct pdf_edge *edges = (struct pdf_edge *) calloc((length + 1) * PDF_NUM_MODES, sizeof(struct pdf_edge));
+    struct pdf_edge *edges = (struct pdf_edge *) z_scratch_calloc(symbol, (length + 1) * PDF_NUM_MODES,
+                                                                    sizeof(struct pdf_edge));
     if (!edges) {
         return 0;
     }
@@ -980,7 +981,7 @@ static int pdf_define_mode(int liste[3][PDF_MAX_LEN], int *p_indexliste, const u
         printf("\n");
     }
 
-    free(edges);
+    z_scratch_free(symbol, edges);
 
     return 1;
 }
@@ -1021,10 +1022,12 @@ static int pdf_initial(struct zint_symbol *symbol, const unsigned char chaine[],
 
         pdf_appendix_d_encode(chaine, liste, &indexliste, debug_print);
      } else {
-        if (!pdf_define_mode(liste, &indexliste, chaine, length, *p_lastmode, debug_print)) {
+        STATS_BEGIN(symbol, ZINT_PHASE_MODE);
+        if (!pdf_define_mode(symbol, liste, &indexliste, chaine, length, *p_lastmode, debug_print)) {
             strcpy(symbol->errtxt, "749: Insufficient memory for mode buffers");
             return ZINT_ERROR_MEMORY;
         }
+        STATS_END(symbol, ZINT_PHASE_MODE);
     }
 
     if (debug_print) {
@@ -1186,6 +1189,17 @@ static int pdf_initial_segs(struct zint_symbol *symbol, struct zint_seg segs[],
     return error_number;
 }
 
+/* Set PDF417 row heights, ISO/IEC 15438:2015 Section 5.8.2 3X minimum, returning any warning, or `error_number` if
+   already set */
+static int pdf_set_height(struct zint_symbol *symbol, int error_number) {
+    if (error_number) {
+        (void) set_height(symbol, 3.0f, 0.0f, 0.0f, 1 /*no_errtxt*/);
+    } else {
+        error_number = set_height(symbol, 3.0f, 0.0f, 0.0f, 0 /*no_errtxt*/);
+    }
+    return error_number;
+}
+
 /* 366 */
 /* Encode PDF417 */
 static int pdf_enc(struct zint_symbol *symbol, struct zint_seg segs[], const int seg_count) {
@@ -1306,6 +1320,15 @@ static int pdf_enc(struct zint_symbol *symbol, struct zint_seg segs[], const int
     }
     assert(rows * cols >= longueur);
 
+    if (symbol->priv->geometry) { /* Sizing only, so skip ECC and row patterns */
+        symbol->priv->geometry->version = cols;
+        symbol->priv->geometry->ecc_level = ecc;
+        /* Start, left and right row indicators, stop (less for compact) */
+        symbol->width = 17 * cols + (symbol->symbology != BARCODE_PDF417COMP ? 69 : 35);
+        symbol->rows = rows;
+        return pdf_set_height(symbol, error_number);
+    }
+
     /* 781 - Padding calculation */
     padding = rows * cols - longueur;
 
@@ -1347,6 +1370,7 @@ static int pdf_enc(struct zint_symbol *symbol, struct zint_seg segs[], const int
             break;
     }
 
+    STATS_BEGIN(symbol, ZINT_PHASE_RS);
     for (i = 0; i < mclength; i++) {
         total = (chainemc[i] + mccorrection[ecc_cws - 1]) % 929;
         for (j = ecc_cws - 1; j > 0; j--) {
@@ -1354,6 +1378,9 @@ static int pdf_enc(struct zint_symbol *symbol, struct zint_seg segs[], const int
         }
         mccorrection[0] = (929 - (total * pdf_coefrs[offset]) % 929) % 929;
     }
+    STATS_END(symbol, ZINT_PHASE_RS);
+    STATS_SET(symbol, version, cols);
+    STATS_SET(symbol, ecc_level, ecc);
 
     /* we add these codes to the string */
     for (i = ecc_cws - 1; i >= 0; i--) {
@@ -1428,15 +1455,8 @@ static int pdf_enc(struct zint_symbol *symbol, struct zint_seg segs[], const int
     symbol->width = bp;
     symbol->rows = rows;
 
-    /* ISO/IEC 15438:2015 Section 5.8.2 3X minimum row height */
-    if (error_number) {
-        (void) set_height(symbol, 3.0f, 0.0f, 0.0f, 1 /*no_errtxt*/);
-    } else {
-        error_number = set_height(symbol, 3.0f, 0.0f, 0.0f, 0 /*no_errtxt*/);
-    }
-
     /* 843 */
-    return error_number;
+    return pdf_set_height(symbol, error_number);
 }
 
 /* 345 */
@@ -1814,4 +1834,60 @@ INTERNAL int micropdf417(struct zint_symbol *symbol, struct zint_seg segs[], con
 #undef T_ALWMX
 #undef T_MXPNC
 
+/* Return the maximum number of characters of `char_type` (ZINT_CAPACITY_XXX) that `cws` data codewords can hold */
+static int pdf_cws_capacity(const int cws, const int is_micro, const int char_type) {
+    switch (char_type) {
+        case ZINT_CAPACITY_NUMERIC: /* Latch then 44 digits per 15 codewords, 3n - 1 digits per n otherwise */
+            if (cws < 2) {
+                return 0;
+            }
+            return ((cws - 1) / 15) * 44 + ((cws - 1) % 15 ? ((cws - 1) % 15) * 3 - 1 : 0);
+            break;
+        case ZINT_CAPACITY_ALPHANUMERIC: /* Text Compaction Alpha sub-mode 2 per codeword, latched if MicroPDF417 */
+            return (cws - is_micro) * 2;
+            break;
+        case ZINT_CAPACITY_BYTE: /* Latch then 6 bytes per 5 codewords, 1 per codeword otherwise */
+            if (cws < 2) {
+                return 0;
+            }
+            return ((cws - 1) / 5) * 6 + (cws - 1) % 5;
+            break;
+    }
+    return 0;
+}
+
+/* Return the maximum number of characters of `char_type` (ZINT_CAPACITY_XXX) that PDF417 or MicroPDF417 can hold at
+   ECC level `option_1` (PDF417 only) and columns `option_2` (minimum for PDF417, as columns increased as needed), or
+   0 if not supported (`ZBarcode_Capacity()`) */
+INTERNAL int pdf_capacity(const int symbology, const int option_1, const int option_2, const int char_type) {
+    static const short micro_max_cws[5] = { 126, 20, 37, 82, 126 }; /* By columns, 0 (automatic) to 4 */
+    int cws, cols, capacity;
+
+    if (symbology == BARCODE_MICROPDF417) {
+        if (option_2 < 0 || option_2 > 4) {
+            return 0;
+        }
+        capacity = pdf_cws_capacity(micro_max_cws[option_2], 1 /*is_micro*/, char_type);
+        return capacity > MICRO_PDF_MAX_LEN ? MICRO_PDF_MAX_LEN : capacity;
+    }
+
+    if (option_1 < -1 || option_1 > 8 || option_2 < 0 || option_2 > 30) {
+        return 0;
+    }
+    /* Columns only ever increased, so most codewords is largest columns x rows (up to 90) within 928, which is 928
+       (29 x 32) unless 30 columns given (900) */
+    for (cols = option_2 ? option_2 : 1, cws = 0; cols <= 30; cols++) {
+        const int rows = 928 / cols > 90 ? 90 : 928 / cols;
+        if (cols * rows > cws) {
+            cws = cols * rows;
+        }
+    }
+    /* Less length descriptor and ECC codewords, ECC level if not given set by number of data codewords (see
+       `pdf_enc()`), which is level 5 (64 codewords) at most, as level 6 (128 codewords) for over 863 leaves only
+       799 */
+    cws -= 1 + (2 << (option_1 >= 0 ? option_1 : 5));
+    capacity = pdf_cws_capacity(cws, 0 /*is_micro*/, char_type);
+    return capacity > PDF_MAX_LEN ? PDF_MAX_LEN : capacity;
+}
+
 /* vim: set ts=4 sw=4 et : */
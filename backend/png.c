@@ -43,6 +43,7 @@
 #include <zlib.h>
 #include <setjmp.h>
 #include "common.h"
+#include "filemem.h"
 #include "output.h"
 
 /* Note if change this need to change "backend/tests/test_png.c" definition also */
@@ -66,6 +67,20 @@ static void wpng_error_handler(png_structp png_ptr, png_const_charp msg) {
     longjmp(wpng_error_ptr->jmpbuf, 1);
 }
 
+/* Write callback for `png_set_write_fn()`, outputting to `filemem` */
+static void wpng_write(png_structp png_ptr, png_bytep data, size_t length) {
+    struct filemem *fmp = (struct filemem *) png_get_io_ptr(png_ptr);
+
+    if (!fm_write(data, 1, length, fmp)) {
+        png_error(png_ptr, "Write Error");
+    }
+}
+
+/* Flush callback for `png_set_write_fn()`, a no-op as `filemem` only writes out on `fm_close()` */
+static void wpng_flush(png_structp png_ptr) {
+    (void) png_ptr;
+}
+
 #ifdef ZINT_TEST /* Wrapper for direct testing */
 INTERNAL void wpng_error_handler_test(png_structp png_ptr, png_const_charp msg) {
 	wpng_error_handler(png_ptr, msg);
@@ -94,7 +109,8 @@ static int guess_compression_strategy(struct zint_symbol *symbol, const unsigned
 
 INTERNAL int png_pixel_plot(struct zint_symbol *symbol, const unsigned char *pixelbuf) {
     struct wpng_error_type wpng_error;
-    FILE *outfile;
+    struct filemem fm;
+    struct filemem *const fmp = &fm;
     png_structp png_ptr;
     png_infop info_ptr;
     int i;
@@ -209,28 +225,24 @@ INTERNAL int png_pixel_plot(struct zint_symbol *symbol, const unsigned char *pix
     }
 
     /* Open output file in binary mode */
-    if (output_to_stdout) {
 #ifdef _MSC_VER
+    if (output_to_stdout) {
         if (-1 == _setmode(_fileno(stdout), _O_BINARY)) {
             sprintf(symbol->errtxt, "631: Could not set stdout to binary (%d: %.30s)", errno, strerror(errno));
             return ZINT_ERROR_FILE_ACCESS;
         }
+    }
 #endif
-        outfile = stdout;
-    } else {
-        if (!(outfile = out_fopen(symbol->outfile, "wb"))) {
-            sprintf(symbol->errtxt, "632: Could not open output file (%d: %.30s)", errno, strerror(errno));
-            return ZINT_ERROR_FILE_ACCESS;
-        }
+    if (!fm_open(fmp, symbol, "wb")) {
+        sprintf(symbol->errtxt, "632: Could not open output file (%d: %.30s)", errno, strerror(errno));
+        return ZINT_ERROR_FILE_ACCESS;
     }
 
     /* Set up error handling routine as proc() above */
     png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, &wpng_error, wpng_error_handler, NULL);
     if (!png_ptr) {
         strcpy(symbol->errtxt, "633: Insufficient memory for PNG write structure buffer");
-        if (!output_to_stdout) {
-            (void) fclose(outfile);
-        }
+        fm_discard(fmp, symbol);
         return ZINT_ERROR_MEMORY;
     }
 
@@ -238,23 +250,19 @@ INTERNAL int png_pixel_plot(struct zint_symbol *symbol, const unsigned char *pix
     if (!info_ptr) {
         png_destroy_write_struct(&png_ptr, NULL);
         strcpy(symbol->errtxt, "634: Insufficient memory for PNG info structure buffer");
-        if (!output_to_stdout) {
-            (void) fclose(outfile);
-        }
+        fm_discard(fmp, symbol);
         return ZINT_ERROR_MEMORY;
     }
 
     /* catch jumping here */
     if (setjmp(wpng_error.jmpbuf)) {
         png_destroy_write_struct(&png_ptr, &info_ptr);
-        if (!output_to_stdout) {
-            (void) fclose(outfile);
-        }
+        fm_discard(fmp, symbol);
         return ZINT_ERROR_MEMORY;
     }
 
-    /* open output file with libpng */
-    png_init_io(png_ptr, outfile);
+    /* set output to filemem */
+    png_set_write_fn(png_ptr, fmp, wpng_write, wpng_flush);
 
     /* set compression */
     png_set_compression_level(png_ptr, 9);
@@ -327,24 +335,21 @@ INTERNAL int png_pixel_plot(struct zint_symbol *symbol, const unsigned char *pix
     /* make sure we have disengaged */
     png_destroy_write_struct(&png_ptr, &info_ptr);
 
-    if (ferror(outfile)) {
-        sprintf(symbol->errtxt, "638: Incomplete write to output (%d: %.30s)", errno, strerror(errno));
-        if (!output_to_stdout) {
-            (void) fclose(outfile);
-        }
+    if (fm_error(fmp)) {
+        sprintf(symbol->errtxt, "638: Incomplete write to output (%d: %.30s)", fm_error(fmp),
+                strerror(fm_error(fmp)));
+        fm_discard(fmp, symbol);
         return ZINT_ERROR_FILE_WRITE;
     }
 
-    if (output_to_stdout) {
-        if (fflush(outfile) != 0) {
-            sprintf(symbol->errtxt, "639: Incomplete flush to output (%d: %.30s)", errno, strerror(errno));
-            return ZINT_ERROR_FILE_WRITE;
-        }
-    } else {
-        if (fclose(outfile) != 0) {
-            sprintf(symbol->errtxt, "960: Failure on closing output file (%d: %.30s)", errno, strerror(errno));
-            return ZINT_ERROR_FILE_WRITE;
+    if (!fm_close(fmp, symbol)) {
+        if (output_to_stdout) {
+            sprintf(symbol->errtxt, "639: Incomplete flush to output (%d: %.30s)", fmp->err, strerror(fmp->err));
+        } else {
+            sprintf(symbol->errtxt, "960: Failure on closing output file (%d: %.30s)", fmp->err,
+                    strerror(fmp->err));
         }
+        return ZINT_ERROR_FILE_WRITE;
     }
 
     return 0;
@@ -31,10 +31,10 @@
 /* SPDX-License-Identifier: BSD-3-Clause */
 
 #include <errno.h>
-#include <locale.h>
 #include <math.h>
 #include <stdio.h>
 #include "common.h"
+#include "filemem.h"
 #include "output.h"
 
 static void colour_to_pscolor(int option, int colour, char *output) {
@@ -135,8 +135,52 @@ INTERNAL void ps_convert_test(const unsigned char *string, unsigned char *ps_str
 }
 #endif
 
+/* Output RGB colour "r g b setrgbcolor" line */
+static void ps_put_rgbcolor(const float red, const float green, const float blue, struct filemem *const fmp) {
+    fm_putsf("", 2, red, fmp);
+    fm_putsf(" ", 2, green, fmp);
+    fm_putsf(" ", 2, blue, fmp);
+    fm_puts(" setrgbcolor\n", fmp);
+}
+
+/* Output CMYK colour "c m y k setcmykcolor" line */
+static void ps_put_cmykcolor(const float cyan, const float magenta, const float yellow, const float black,
+            struct filemem *const fmp) {
+    fm_putsf("", 2, cyan, fmp);
+    fm_putsf(" ", 2, magenta, fmp);
+    fm_putsf(" ", 2, yellow, fmp);
+    fm_putsf(" ", 2, black, fmp);
+    fm_puts(" setcmykcolor\n", fmp);
+}
+
+/* Output rectangle "h y TB x w TR TE" lines */
+static void ps_put_rect(const struct zint_symbol *symbol, const struct zint_vector_rect *rect,
+            struct filemem *const fmp) {
+    fm_putsf("", 2, rect->height, fmp);
+    fm_putsf(" ", 2, (symbol->vector->height - rect->y) - rect->height, fmp);
+    fm_putsf(" TB ", 2, rect->x, fmp);
+    fm_putsf(" ", 2, rect->width, fmp);
+    fm_puts(" TR\nTE\n", fmp);
+}
+
+/* Output circle "x y radius width TC" (ring) or "x y radius TD" (disc) line */
+static void ps_put_circle(const struct zint_symbol *symbol, const struct zint_vector_circle *circle,
+            const float radius, struct filemem *const fmp) {
+    fm_putsf("", 2, circle->x, fmp);
+    fm_putsf(" ", 2, symbol->vector->height - circle->y, fmp);
+    if (circle->width) {
+        fm_putsf(" ", 3, radius, fmp);
+        fm_putsf(" ", 3, circle->width, fmp);
+        fm_puts(" TC\n", fmp);
+    } else {
+        fm_putsf(" ", 2, radius, fmp);
+        fm_puts(" TD\n", fmp);
+    }
+}
+
 INTERNAL int ps_plot(struct zint_symbol *symbol) {
-    FILE *feps;
+    struct filemem fm;
+    struct filemem *const fmp = &fm;
     unsigned char fgred, fggrn, fgblu, bgred, bggrn, bgblu, bgalpha;
     int fgcyan, fgmagenta, fgyellow, fgblack, bgcyan, bgmagenta, bgyellow, bgblack;
     float red_ink = 0.0f, green_ink = 0.0f, blue_ink = 0.0f; /* Suppress `-Wmaybe-uninitialized` */
@@ -154,7 +198,6 @@ INTERNAL int ps_plot(struct zint_symbol *symbol) {
     struct zint_vector_hexagon *hex;
     struct zint_vector_circle *circle;
     struct zint_vector_string *string;
-    const char *locale = NULL;
     const char *font;
     int i, len;
     int ps_len = 0;
@@ -168,17 +211,11 @@ INTERNAL int ps_plot(struct zint_symbol *symbol) {
         return ZINT_ERROR_INVALID_DATA;
     }
 
-    if (output_to_stdout) {
-        feps = stdout;
-    } else {
-        if (!(feps = out_fopen(symbol->outfile, "w"))) {
-            sprintf(symbol->errtxt, "645: Could not open output file (%d: %.30s)", errno, strerror(errno));
-            return ZINT_ERROR_FILE_ACCESS;
-        }
+    if (!fm_open(fmp, symbol, "w")) {
+        sprintf(symbol->errtxt, "645: Could not open output file (%d: %.30s)", errno, strerror(errno));
+        return ZINT_ERROR_FILE_ACCESS;
     }
 
-    locale = setlocale(LC_ALL, "C");
-
     if ((symbol->output_options & CMYK_COLOUR) == 0) {
         (void) out_colour_get_rgb(symbol->fgcolour, &fgred, &fggrn, &fgblu, NULL /*alpha*/);
         red_ink = fgred / 255.0f;
@@ -234,58 +271,59 @@ INTERNAL int ps_plot(struct zint_symbol *symbol) {
     }
 
     /* Start writing the header */
-    fputs("%!PS-Adobe-3.0 EPSF-3.0\n", feps);
+    fm_puts("%!PS-Adobe-3.0 EPSF-3.0\n", fmp);
+    fm_putsi("%%Creator: Zint ", ZINT_VERSION_MAJOR, fmp);
+    fm_putsi(".", ZINT_VERSION_MINOR, fmp);
+    fm_putsi(".", ZINT_VERSION_RELEASE, fmp);
     if (ZINT_VERSION_BUILD) {
-        fprintf(feps, "%%%%Creator: Zint %d.%d.%d.%d\n",
-                ZINT_VERSION_MAJOR, ZINT_VERSION_MINOR, ZINT_VERSION_RELEASE, ZINT_VERSION_BUILD);
-    } else {
-        fprintf(feps, "%%%%Creator: Zint %d.%d.%d\n", ZINT_VERSION_MAJOR, ZINT_VERSION_MINOR, ZINT_VERSION_RELEASE);
+        fm_putsi(".", ZINT_VERSION_BUILD, fmp);
     }
-    fputs("%%Title: Zint Generated Symbol\n"
-          "%%Pages: 0\n", feps);
-    fprintf(feps, "%%%%BoundingBox: 0 0 %d %d\n",
-            (int) ceilf(symbol->vector->width), (int) ceilf(symbol->vector->height));
-    fputs("%%EndComments\n", feps);
+    fm_puts("\n%%Title: Zint Generated Symbol\n"
+            "%%Pages: 0\n", fmp);
+    fm_putsi("%%BoundingBox: 0 0 ", (int) ceilf(symbol->vector->width), fmp);
+    fm_putsi(" ", (int) ceilf(symbol->vector->height), fmp);
+    fm_puts("\n%%EndComments\n", fmp);
 
     /* Definitions */
     if (have_circles_without_width) {
         /* Disc: x y radius TD */
-        fputs("/TD { newpath 0 360 arc fill } bind def\n", feps);
+        fm_puts("/TD { newpath 0 360 arc fill } bind def\n", fmp);
     }
     if (have_circles_with_width) {
         /* Circle (ring): x y radius width TC (adapted from BWIPP renmaxicode.ps) */
-        fputs("/TC { newpath 4 1 roll 3 copy 0 360 arc closepath 4 -1 roll add 360 0 arcn closepath fill }"
-                " bind def\n", feps);
+        fm_puts("/TC { newpath 4 1 roll 3 copy 0 360 arc closepath 4 -1 roll add 360 0 arcn closepath fill }"
+                  " bind def\n", fmp);
     }
     if (symbol->vector->hexagons) {
-        fputs("/TH { 0 setlinewidth moveto lineto lineto lineto lineto lineto closepath fill } bind def\n", feps);
+        fm_puts("/TH { 0 setlinewidth moveto lineto lineto lineto lineto lineto closepath fill } bind def\n", fmp);
     }
-    fputs("/TB { 2 copy } bind def\n"
-          "/TR { newpath 4 1 roll exch moveto 1 index 0 rlineto 0 exch rlineto neg 0 rlineto closepath fill }"
-            " bind def\n"
-          "/TE { pop pop } bind def\n", feps);
+    fm_puts("/TB { 2 copy } bind def\n"
+            "/TR { newpath 4 1 roll exch moveto 1 index 0 rlineto 0 exch rlineto neg 0 rlineto closepath fill }"
+              " bind def\n"
+            "/TE { pop pop } bind def\n", fmp);
 
-    fputs("newpath\n", feps);
+    fm_puts("newpath\n", fmp);
 
     /* Now the actual representation */
 
     /* Background */
     if (draw_background) {
         if ((symbol->output_options & CMYK_COLOUR) == 0) {
-            fprintf(feps, "%.2f %.2f %.2f setrgbcolor\n", red_paper, green_paper, blue_paper);
+            ps_put_rgbcolor(red_paper, green_paper, blue_paper, fmp);
         } else {
-            fprintf(feps, "%.2f %.2f %.2f %.2f setcmykcolor\n", cyan_paper, magenta_paper, yellow_paper, black_paper);
+            ps_put_cmykcolor(cyan_paper, magenta_paper, yellow_paper, black_paper, fmp);
         }
 
-        fprintf(feps, "%.2f 0.00 TB 0.00 %.2f TR\n", symbol->vector->height, symbol->vector->width);
-        fputs("TE\n", feps);
+        fm_putsf("", 2, symbol->vector->height, fmp);
+        fm_putsf(" 0.00 TB 0.00 ", 2, symbol->vector->width, fmp);
+        fm_puts(" TR\nTE\n", fmp);
     }
 
     if (symbol->symbology != BARCODE_ULTRA) {
         if ((symbol->output_options & CMYK_COLOUR) == 0) {
-            fprintf(feps, "%.2f %.2f %.2f setrgbcolor\n", red_ink, green_ink, blue_ink);
+            ps_put_rgbcolor(red_ink, green_ink, blue_ink, fmp);
         } else {
-            fprintf(feps, "%.2f %.2f %.2f %.2f setcmykcolor\n", cyan_ink, magenta_ink, yellow_ink, black_ink);
+            ps_put_cmykcolor(cyan_ink, magenta_ink, yellow_ink, black_ink, fmp);
         }
     }
 
@@ -298,16 +336,13 @@ INTERNAL int ps_plot(struct zint_symbol *symbol) {
                 if (colour_rect_flag == 0) {
                     /* Set foreground colour */
                     if ((symbol->output_options & CMYK_COLOUR) == 0) {
-                        fprintf(feps, "%.2f %.2f %.2f setrgbcolor\n", red_ink, green_ink, blue_ink);
+                        ps_put_rgbcolor(red_ink, green_ink, blue_ink, fmp);
                     } else {
-                        fprintf(feps, "%.2f %.2f %.2f %.2f setcmykcolor\n",
-                                cyan_ink, magenta_ink, yellow_ink, black_ink);
+                        ps_put_cmykcolor(cyan_ink, magenta_ink, yellow_ink, black_ink, fmp);
                     }
                     colour_rect_flag = 1;
                 }
-                fprintf(feps, "%.2f %.2f TB %.2f %.2f TR\n",
-                        rect->height, (symbol->vector->height - rect->y) - rect->height, rect->x, rect->width);
-                fputs("TE\n", feps);
+                ps_put_rect(symbol, rect, fmp);
             }
             rect = rect->next;
         }
@@ -319,12 +354,11 @@ INTERNAL int ps_plot(struct zint_symbol *symbol) {
                     if (colour_rect_flag == 0) {
                         /* Set new colour */
                         colour_to_pscolor(symbol->output_options, colour_index, ps_color);
-                        fprintf(feps, "%s\n", ps_color);
+                        fm_puts(ps_color, fmp);
+                        fm_putc('\n', fmp);
                         colour_rect_flag = 1;
                     }
-                    fprintf(feps, "%.2f %.2f TB %.2f %.2f TR\n",
-                            rect->height, (symbol->vector->height - rect->y) - rect->height, rect->x, rect->width);
-                    fputs("TE\n", feps);
+                    ps_put_rect(symbol, rect, fmp);
                 }
                 rect = rect->next;
             }
@@ -332,9 +366,7 @@ INTERNAL int ps_plot(struct zint_symbol *symbol) {
     } else {
         rect = symbol->vector->rectangles;
         while (rect) {
-            fprintf(feps, "%.2f %.2f TB %.2f %.2f TR\n",
-                    rect->height, (symbol->vector->height - rect->y) - rect->height, rect->x, rect->width);
-            fputs("TE\n", feps);
+            ps_put_rect(symbol, rect, fmp);
             rect = rect->next;
         }
     }
@@ -376,8 +408,19 @@ INTERNAL int ps_plot(struct zint_symbol *symbol) {
             ex = hex->x + half_radius;
             fx = hex->x - half_radius;
         }
-        fprintf(feps, "%.2f %.2f %.2f %.2f %.2f %.2f %.2f %.2f %.2f %.2f %.2f %.2f TH\n",
-                ax, ay, bx, by, cx, cy, dx, dy, ex, ey, fx, fy);
+        fm_putsf("", 2, ax, fmp);
+        fm_putsf(" ", 2, ay, fmp);
+        fm_putsf(" ", 2, bx, fmp);
+        fm_putsf(" ", 2, by, fmp);
+        fm_putsf(" ", 2, cx, fmp);
+        fm_putsf(" ", 2, cy, fmp);
+        fm_putsf(" ", 2, dx, fmp);
+        fm_putsf(" ", 2, dy, fmp);
+        fm_putsf(" ", 2, ex, fmp);
+        fm_putsf(" ", 2, ey, fmp);
+        fm_putsf(" ", 2, fx, fmp);
+        fm_putsf(" ", 2, fy, fmp);
+        fm_puts(" TH\n", fmp);
         hex = hex->next;
     }
 
@@ -392,32 +435,21 @@ INTERNAL int ps_plot(struct zint_symbol *symbol) {
         if (circle->colour) { /* Legacy - no longer used */
             /* A 'white' circle */
             if ((symbol->output_options & CMYK_COLOUR) == 0) {
-                fprintf(feps, "%.2f %.2f %.2f setrgbcolor\n", red_paper, green_paper, blue_paper);
-            } else {
-                fprintf(feps, "%.2f %.2f %.2f %.2f setcmykcolor\n",
-                        cyan_paper, magenta_paper, yellow_paper, black_paper);
-            }
-            if (circle->width) {
-                fprintf(feps, "%.2f %.2f %.3f %.3f TC\n",
-                        circle->x, (symbol->vector->height - circle->y), radius, circle->width);
+                ps_put_rgbcolor(red_paper, green_paper, blue_paper, fmp);
             } else {
-                fprintf(feps, "%.2f %.2f %.2f TD\n", circle->x, (symbol->vector->height - circle->y), radius);
+                ps_put_cmykcolor(cyan_paper, magenta_paper, yellow_paper, black_paper, fmp);
             }
+            ps_put_circle(symbol, circle, radius, fmp);
             if (circle->next) {
                 if ((symbol->output_options & CMYK_COLOUR) == 0) {
-                    fprintf(feps, "%.2f %.2f %.2f setrgbcolor\n", red_ink, green_ink, blue_ink);
+                    ps_put_rgbcolor(red_ink, green_ink, blue_ink, fmp);
                 } else {
-                    fprintf(feps, "%.2f %.2f %.2f %.2f setcmykcolor\n", cyan_ink, magenta_ink, yellow_ink, black_ink);
+                    ps_put_cmykcolor(cyan_ink, magenta_ink, yellow_ink, black_ink, fmp);
                 }
             }
         } else {
             /* A 'black' circle */
-            if (circle->width) {
-                fprintf(feps, "%.2f %.2f %.3f %.3f TC\n",
-                        circle->x, (symbol->vector->height - circle->y), radius, circle->width);
-            } else {
-                fprintf(feps, "%.2f %.2f %.2f TD\n", circle->x, (symbol->vector->height - circle->y), radius);
-            }
+            ps_put_circle(symbol, circle, radius, fmp);
         }
         circle = circle->next;
     }
@@ -434,63 +466,68 @@ INTERNAL int ps_plot(struct zint_symbol *symbol) {
         }
         if (iso_latin1) {
             /* Change encoding to ISO 8859-1, see Postscript Language Reference Manual 2nd Edition Example 5.6 */
-            fprintf(feps, "/%s findfont\n", font);
-            fputs("dup length dict begin\n"
-                  "{1 index /FID ne {def} {pop pop} ifelse} forall\n"
-                  "/Encoding ISOLatin1Encoding def\n"
-                  "currentdict\n"
-                  "end\n"
-                  "/Helvetica-ISOLatin1 exch definefont pop\n", feps);
+            fm_putc('/', fmp);
+            fm_puts(font, fmp);
+            fm_puts(" findfont\n", fmp);
+            fm_puts("dup length dict begin\n"
+                    "{1 index /FID ne {def} {pop pop} ifelse} forall\n"
+                    "/Encoding ISOLatin1Encoding def\n"
+                    "currentdict\n"
+                    "end\n"
+                    "/Helvetica-ISOLatin1 exch definefont pop\n", fmp);
             font = "Helvetica-ISOLatin1";
         }
         do {
             ps_convert(string->text, ps_string);
-            fputs("matrix currentmatrix\n", feps);
-            fprintf(feps, "/%s findfont\n", font);
-            fprintf(feps, "%.2f scalefont setfont\n", string->fsize);
-            fprintf(feps, " 0 0 moveto %.2f %.2f translate 0.00 rotate 0 0 moveto\n",
-                    string->x, (symbol->vector->height - string->y));
+            fm_puts("matrix currentmatrix\n/", fmp);
+            fm_puts(font, fmp);
+            fm_puts(" findfont\n", fmp);
+            fm_putsf("", 2, string->fsize, fmp);
+            fm_puts(" scalefont setfont\n", fmp);
+            fm_putsf(" 0 0 moveto ", 2, string->x, fmp);
+            fm_putsf(" ", 2, symbol->vector->height - string->y, fmp);
+            fm_puts(" translate 0.00 rotate 0 0 moveto\n", fmp);
             if (string->halign == 0 || string->halign == 2) { /* Need width for middle or right align */
-                fprintf(feps, " (%s) stringwidth\n", ps_string);
+                fm_puts(" (", fmp);
+                fm_puts((const char *) ps_string, fmp);
+                fm_puts(") stringwidth\n", fmp);
             }
             if (string->rotation != 0) {
-                fputs("gsave\n", feps);
-                fprintf(feps, "%d rotate\n", 360 - string->rotation);
+                fm_puts("gsave\n", fmp);
+                fm_putsi("", 360 - string->rotation, fmp);
+                fm_puts(" rotate\n", fmp);
             }
             if (string->halign == 0 || string->halign == 2) {
-                fputs("pop\n", feps);
-                fprintf(feps, "%s 0 rmoveto\n", string->halign == 2 ? "neg" : "-2 div");
+                fm_puts("pop\n", fmp);
+                fm_puts(string->halign == 2 ? "neg" : "-2 div", fmp);
+                fm_puts(" 0 rmoveto\n", fmp);
             }
-            fprintf(feps, " (%s) show\n", ps_string);
+            fm_puts(" (", fmp);
+            fm_puts((const char *) ps_string, fmp);
+            fm_puts(") show\n", fmp);
             if (string->rotation != 0) {
-                fputs("grestore\n", feps);
+                fm_puts("grestore\n", fmp);
             }
-            fputs("setmatrix\n", feps);
+            fm_puts("setmatrix\n", fmp);
             string = string->next;
         } while (string);
     }
 
-    if (locale)
-        setlocale(LC_ALL, locale);
-
-    if (ferror(feps)) {
-        sprintf(symbol->errtxt, "647: Incomplete write to output (%d: %.30s)", errno, strerror(errno));
-        if (!output_to_stdout) {
-            (void) fclose(feps);
-        }
+    if (fm_error(fmp)) {
+        sprintf(symbol->errtxt, "647: Incomplete write to output (%d: %.30s)", fm_error(fmp),
+                strerror(fm_error(fmp)));
+        fm_discard(fmp, symbol);
         return ZINT_ERROR_FILE_WRITE;
     }
 
-    if (output_to_stdout) {
-        if (fflush(feps) != 0) {
-            sprintf(symbol->errtxt, "648: Incomplete flush to output (%d: %.30s)", errno, strerror(errno));
-            return ZINT_ERROR_FILE_WRITE;
-        }
-    } else {
-        if (fclose(feps) != 0) {
-            sprintf(symbol->errtxt, "649: Failure on closing output file (%d: %.30s)", errno, strerror(errno));
-            return ZINT_ERROR_FILE_WRITE;
+    if (!fm_close(fmp, symbol)) {
+        if (output_to_stdout) {
+            sprintf(symbol->errtxt, "648: Incomplete flush to output (%d: %.30s)", fmp->err, strerror(fmp->err));
+        } else {
+            sprintf(symbol->errtxt, "649: Failure on closing output file (%d: %.30s)", fmp->err,
+                    strerror(fmp->err));
         }
+        return ZINT_ERROR_FILE_WRITE;
     }
 
     return error_number;
@@ -371,7 +371,7 @@ static int qr_terminator_bits(const int version) {
 }
 
 /* Convert input data to a binary stream and add padding */
-static int qr_binary(char binary[], int bp, const int version, const char mode[],
+static int qr_binary(unsigned char binary[], int bp, const int version, const char mode[],
             const unsigned int ddata[], const int length, const int gs1,
             const int eci, const int debug_print) {
     int position = 0;
@@ -381,13 +381,13 @@ static int qr_binary(char binary[], int bp, const int version, const char mode[]
     int percent_count;
 
     if (eci != 0) { /* Not applicable to MICROQR */
-        bp = bin_append_posn(7, version < RMQR_VERSION ? 4 : 3, binary, bp); /* ECI (Table 4) */
+        bp = bits_append_posn(7, version < RMQR_VERSION ? 4 : 3, binary, bp); /* ECI (Table 4) */
         if (eci <= 127) {
-            bp = bin_append_posn(eci, 8, binary, bp); /* 000000 to 000127 */
+            bp = bits_append_posn(eci, 8, binary, bp); /* 000000 to 000127 */
         } else if (eci <= 16383) {
-            bp = bin_append_posn(0x8000 + eci, 16, binary, bp); /* 000128 to 016383 */
+            bp = bits_append_posn(0x8000 + eci, 16, binary, bp); /* 000128 to 016383 */
         } else {
-            bp = bin_append_posn(0xC00000 + eci, 24, binary, bp); /* 016384 to 999999 */
+            bp = bits_append_posn(0xC00000 + eci, 24, binary, bp); /* 016384 to 999999 */
         }
     }
 
@@ -407,7 +407,7 @@ static int qr_binary(char binary[], int bp, const int version, const char mode[]
 
         /* Mode indicator */
         if (modebits) {
-            bp = bin_append_posn(qr_mode_indicator(version, data_block), modebits, binary, bp);
+            bp = bits_append_posn(qr_mode_indicator(version, data_block), modebits, binary, bp);
         }
 
         switch (data_block) {
@@ -415,7 +415,7 @@ static int qr_binary(char binary[], int bp, const int version, const char mode[]
                 /* Kanji mode */
 
                 /* Character count indicator */
-                bp = bin_append_posn(short_data_block_length, qr_cci_bits(version, data_block), binary, bp);
+                bp = bits_append_posn(short_data_block_length, qr_cci_bits(version, data_block), binary, bp);
 
                 if (debug_print) {
                     printf("Kanji block (length %d)\n\t", short_data_block_length);
@@ -434,7 +434,7 @@ static int qr_binary(char binary[], int bp, const int version, const char mode[]
 
                     prod = ((jis >> 8) * 0xc0) + (jis & 0xff);
 
-                    bp = bin_append_posn(prod, 13, binary, bp);
+                    bp = bits_append_posn(prod, 13, binary, bp);
 
                     if (debug_print) {
                         printf("0x%04X ", prod);
@@ -450,7 +450,7 @@ static int qr_binary(char binary[], int bp, const int version, const char mode[]
                 /* Byte mode */
 
                 /* Character count indicator */
-                bp = bin_append_posn(short_data_block_length + double_byte, qr_cci_bits(version, data_block), binary,
+                bp = bits_append_posn(short_data_block_length + double_byte, qr_cci_bits(version, data_block), binary,
                                     bp);
 
                 if (debug_print) {
@@ -465,7 +465,7 @@ static int qr_binary(char binary[], int bp, const int version, const char mode[]
                         byte = 0x1d; /* FNC1 */
                     }
 
-                    bp = bin_append_posn(byte, byte > 0xFF ? 16 : 8, binary, bp);
+                    bp = bits_append_posn(byte, byte > 0xFF ? 16 : 8, binary, bp);
 
                     if (debug_print) {
                         printf("0x%02X(%d) ", byte, (int) byte);
@@ -490,7 +490,7 @@ static int qr_binary(char binary[], int bp, const int version, const char mode[]
                 }
 
                 /* Character count indicator */
-                bp = bin_append_posn(short_data_block_length + percent_count, qr_cci_bits(version, data_block),
+                bp = bits_append_posn(short_data_block_length + percent_count, qr_cci_bits(version, data_block),
                                     binary, bp);
 
                 if (debug_print) {
@@ -564,7 +564,7 @@ static int qr_binary(char binary[], int bp, const int version, const char mode[]
                         }
                     }
 
-                    bp = bin_append_posn(prod, 1 + (5 * count), binary, bp);
+                    bp = bits_append_posn(prod, 1 + (5 * count), binary, bp);
 
                     if (debug_print) {
                         printf("0x%X ", prod);
@@ -580,7 +580,7 @@ static int qr_binary(char binary[], int bp, const int version, const char mode[]
                 /* Numeric mode */
 
                 /* Character count indicator */
-                bp = bin_append_posn(short_data_block_length, qr_cci_bits(version, data_block), binary, bp);
+                bp = bits_append_posn(short_data_block_length, qr_cci_bits(version, data_block), binary, bp);
 
                 if (debug_print) {
                     printf("Number block (length %d)\n\t", short_data_block_length);
@@ -608,7 +608,7 @@ static int qr_binary(char binary[], int bp, const int version, const char mode[]
                         }
                     }
 
-                    bp = bin_append_posn(prod, 1 + (3 * count), binary, bp);
+                    bp = bits_append_posn(prod, 1 + (3 * count), binary, bp);
 
                     if (debug_print) {
                         printf("0x%X(%d) ", prod, prod);
@@ -634,30 +634,28 @@ static int qr_binary(char binary[], int bp, const int version, const char mode[]
 static int qr_binary_segs(unsigned char datastream[], const int version, const int target_codewords,
             const char mode[], const unsigned int ddata[], const struct zint_seg segs[], const int seg_count,
             const struct zint_structapp *p_structapp, const int gs1, const int est_binlen, const int debug_print) {
-    int i, j;
+    int i;
     const unsigned int *dd = ddata;
     const char *m = mode;
     int bp = 0;
     int termbits, padbits;
     int current_bytes;
     int toggle;
-    char *binary = (char *) z_alloca(est_binlen + 12);
-
-    *binary = '\0';
+    unsigned char *binary = (unsigned char *) z_alloca(BITS_SIZE(est_binlen + 12));
 
     if (p_structapp) {
-        bp = bin_append_posn(3, 4, binary, bp); /* Structured Append indicator */
-        bp = bin_append_posn(p_structapp->index - 1, 4, binary, bp);
-        bp = bin_append_posn(p_structapp->count - 1, 4, binary, bp);
-        bp = bin_append_posn(to_int((const unsigned char *) p_structapp->id, (int) strlen(p_structapp->id)), 8,
+        bp = bits_append_posn(3, 4, binary, bp); /* Structured Append indicator */
+        bp = bits_append_posn(p_structapp->index - 1, 4, binary, bp);
+        bp = bits_append_posn(p_structapp->count - 1, 4, binary, bp);
+        bp = bits_append_posn(to_int((const unsigned char *) p_structapp->id, (int) strlen(p_structapp->id)), 8,
                 binary, bp); /* Parity */
     }
 
     if (gs1) { /* Not applicable to MICROQR */
         if (version < RMQR_VERSION) {
-            bp = bin_append_posn(5, 4, binary, bp); /* FNC1 */
+            bp = bits_append_posn(5, 4, binary, bp); /* FNC1 */
         } else {
-            bp = bin_append_posn(5, 3, binary, bp);
+            bp = bits_append_posn(5, 3, binary, bp);
         }
     }
 
@@ -669,7 +667,7 @@ static int qr_binary_segs(unsigned char datastream[], const int version, const i
 
     if (version >= MICROQR_VERSION && version < MICROQR_VERSION + 4) {
         /* MICROQR does its own terminating/padding */
-        memcpy(datastream, binary, bp);
+        memcpy(datastream, binary, BITS_SIZE(bp));
         return bp;
     }
 
@@ -682,7 +680,7 @@ static int qr_binary_segs(unsigned char datastream[], const int version, const i
     if (termbits || current_bytes < target_codewords) {
         int max_termbits = qr_terminator_bits(version);
         termbits = termbits < max_termbits && current_bytes == target_codewords ? termbits : max_termbits;
-        bp = bin_append_posn(0, termbits, binary, bp);
+        bp = bits_append_posn(0, termbits, binary, bp);
     }
 
     /* Padding bits */
@@ -692,23 +690,17 @@ static int qr_binary_segs(unsigned char datastream[], const int version, const i
     }
     if (padbits) {
         current_bytes = (bp + padbits) / 8;
-        (void) bin_append_posn(0, padbits, binary, bp); /* Last use so not setting bp */
+        (void) bits_append_posn(0, padbits, binary, bp); /* Last use so not setting bp */
     }
 
-    if (debug_print) printf("Terminated binary (%d): %.*s (padbits %d)\n", bp, bp, binary, padbits);
-
-    /* Put data into 8-bit codewords */
-    for (i = 0; i < current_bytes; i++) {
-        int p;
-        j = i * 8;
-        datastream[i] = 0x00;
-        for (p = 0; p < 8; p++) {
-            if (binary[j + p] == '1') {
-                datastream[i] |= (0x80 >> p);
-            }
-        }
+    if (debug_print) {
+        printf("Terminated binary (%d): %s (padbits %d)\n", bp, bits_dump(binary, bp, (char *) z_alloca(bp + 1)),
+                padbits);
     }
 
+    /* Data is already in 8-bit codewords */
+    memcpy(datastream, binary, current_bytes);
+
     /* Add pad codewords */
     toggle = 0;
     for (i = current_bytes; i < target_codewords; i++) {
@@ -740,12 +732,8 @@ static void qr_add_ecc(unsigned char fullstream[], const unsigned char datastrea
     int qty_long_blocks;
     int qty_short_blocks;
     int ecc_block_length;
-    int i, j, length_this_block, in_posn;
+    int i, j, in_posn;
     rs_t rs;
-    unsigned char *data_block;
-    unsigned char *ecc_block;
-    unsigned char *interleaved_data;
-    unsigned char *interleaved_ecc;
 
     if (version < RMQR_VERSION) {
         ecc_cw = qr_total_codewords[version - 1] - data_cw;
@@ -764,72 +752,49 @@ static void qr_add_ecc(unsigned char fullstream[], const unsigned char datastrea
     assert(short_data_block_length > 0);
     assert(ecc_block_length * blocks == ecc_cw);
 
-    data_block = (unsigned char *) z_alloca(short_data_block_length + 1);
-    ecc_block = (unsigned char *) z_alloca(ecc_block_length);
-    interleaved_data = (unsigned char *) z_alloca(data_cw);
-    interleaved_ecc = (unsigned char *) z_alloca(ecc_cw);
-
     rs_init_gf(&rs, 0x11d);
     rs_init_code(&rs, ecc_block_length, 0);
 
+    /* Interleave the data, short blocks first, with the extra codewords of the long blocks at the end */
     in_posn = 0;
-
     for (i = 0; i < blocks; i++) {
-        if (i < qty_short_blocks) {
-            length_this_block = short_data_block_length;
-        } else {
-            length_this_block = short_data_block_length + 1;
-        }
-
-        for (j = 0; j < ecc_block_length; j++) {
-            ecc_block[j] = 0;
+        for (j = 0; j < short_data_block_length; j++) {
+            fullstream[(j * blocks) + i] = datastream[in_posn + j];
         }
-
-        for (j = 0; j < length_this_block; j++) {
-            data_block[j] = datastream[in_posn + j]; /* NOLINT false-positive popped up with clang-tidy 14.0.1 */
+        in_posn += short_data_block_length;
+        if (i >= qty_short_blocks) {
+            fullstream[(short_data_block_length * blocks) + (i - qty_short_blocks)] = datastream[in_posn++];
         }
+    }
 
-        rs_encode(&rs, length_this_block, data_block, ecc_block);
+    /* Encode each run of equal length blocks straight into their interleaved ECC positions */
+    rs_encode_blocks(&rs, qty_short_blocks, short_data_block_length, datastream, short_data_block_length, 1,
+                    fullstream + data_cw, 1 /*res_block_step*/, blocks /*res_step*/);
+    if (qty_long_blocks) {
+        rs_encode_blocks(&rs, qty_long_blocks, short_data_block_length + 1,
+                        datastream + qty_short_blocks * short_data_block_length, short_data_block_length + 1, 1,
+                        fullstream + data_cw + qty_short_blocks, 1 /*res_block_step*/, blocks /*res_step*/);
+    }
 
-        if (debug_print) {
+    if (debug_print) {
+        in_posn = 0;
+        for (i = 0; i < blocks; i++) {
+            const int length_this_block = short_data_block_length + (i >= qty_short_blocks);
             printf("Block %d: ", i + 1);
             for (j = 0; j < length_this_block; j++) {
-                printf("%2X ", data_block[j]);
+                printf("%2X ", datastream[in_posn + j]);
             }
             if (i < qty_short_blocks) {
                 printf("   ");
             }
             printf(" // ");
             for (j = 0; j < ecc_block_length; j++) {
-                printf("%2X ", ecc_block[ecc_block_length - j - 1]);
+                printf("%2X ", fullstream[data_cw + (j * blocks) + i]);
             }
             printf("\n");
+            in_posn += length_this_block;
         }
 
-        for (j = 0; j < short_data_block_length; j++) {
-            interleaved_data[(j * blocks) + i] = data_block[j]; /* NOLINT and another with clang-tidy 14.0.6 */
-        }
-
-        if (i >= qty_short_blocks) {
-            interleaved_data[(short_data_block_length * blocks) + (i - qty_short_blocks)]
-                            = data_block[short_data_block_length];
-        }
-
-        for (j = 0; j < ecc_block_length; j++) {
-            interleaved_ecc[(j * blocks) + i] = ecc_block[ecc_block_length - j - 1];
-        }
-
-        in_posn += length_this_block;
-    }
-
-    for (j = 0; j < data_cw; j++) {
-        fullstream[j] = interleaved_data[j];
-    }
-    for (j = 0; j < ecc_cw; j++) {
-        fullstream[j + data_cw] = interleaved_ecc[j]; /* NOLINT ditto clang-tidy 14.0.6 */
-    }
-
-    if (debug_print) {
         printf("\nData Stream: \n");
         for (j = 0; j < (data_cw + ecc_cw); j++) {
             printf("%2X ", fullstream[j]);
@@ -1028,15 +993,82 @@ static int write_log(char log[]) {
 }
 #endif
 
-static int qr_evaluate(unsigned char *local, const int size) {
-    static const unsigned char h1011101[7] = { 1, 0, 1, 1, 1, 0, 1 };
+/* Mask evaluation works on bit-packed rows and columns ("bitboards"), each held in `QR_BB_STRIDE` 64-bit words,
+   the first and last of which are always zero so that shifts across word boundaries need no special-casing. Module
+   `i` of a row (column) is bit `i & 63` of word `1 + (i >> 6)`, with bits beyond the symbol size zero */
+#define QR_BB_WORDS     3 /* Enough for version 40 (177 modules) */
+#define QR_BB_STRIDE    (QR_BB_WORDS + 2)
+
+/* Word `w` of bitboard `b` shifted down `s` (1-63) modules, i.e. bit `i` is module `i + s` */
+#define QR_BB_SHR(b, w, s)  (((b)[w] >> (s)) | ((b)[(w) + 1] << (64 - (s))))
+/* Word `w` of bitboard `b` shifted up `s` (1-63) modules, i.e. bit `i` is module `i - s` */
+#define QR_BB_SHL(b, w, s)  (((b)[w] << (s)) | ((b)[(w) - 1] >> (64 - (s))))
+
+/* Set module `i` of bitboard `b` */
+#define QR_BB_SET(b, i)     ((b)[1 + ((i) >> 6)] |= ((uint64_t) 1) << ((i) & 63))
+
+/* Number of set bits in `v` */
+static int qr_popcount(uint64_t v) {
+#if defined(__GNUC__)
+    return __builtin_popcountll(v);
+#else
+    unsigned int lo = (unsigned int) (v & 0xFFFFFFFF);
+    unsigned int hi = (unsigned int) (v >> 32);
+
+    lo = lo - ((lo >> 1) & 0x55555555);
+    hi = hi - ((hi >> 1) & 0x55555555);
+    lo = (lo & 0x33333333) + ((lo >> 2) & 0x33333333);
+    hi = (hi & 0x33333333) + ((hi >> 2) & 0x33333333);
+    lo = (lo + (lo >> 4)) & 0x0F0F0F0F;
+    hi = (hi + (hi >> 4)) & 0x0F0F0F0F;
+    return (int) (((lo * 0x01010101) >> 24) + ((hi * 0x01010101) >> 24));
+#endif
+}
+
+/* Test 1 penalty (runs of 5 or more same colour modules) of row/column bitboard `b`, adding the number of Test 3
+   1:1:3:1:1 patterns to `p_finders` and setting `eq` (whose first and last words must be zero) to its same colour
+   neighbours (bit `i` set if modules `i` and `i + 1` same colour) */
+static int qr_bb_line_penalty(const uint64_t b[], const uint64_t pair_mask[], uint64_t eq[], int *p_finders) {
+    int w;
+    int runs = 0, starts = 0, finders = 0;
+
+    for (w = 1; w <= QR_BB_WORDS; w++) {
+        eq[w] = ~(b[w] ^ QR_BB_SHR(b, w, 1)) & pair_mask[w];
+    }
+    for (w = 1; w <= QR_BB_WORDS; w++) {
+        /* Bit `i` set if modules `i` to `i + 4` same colour */
+        const uint64_t run5 = eq[w] & QR_BB_SHR(eq, w, 1) & QR_BB_SHR(eq, w, 2) & QR_BB_SHR(eq, w, 3);
+        /* Bit `i` set if modules `i` to `i + 6` are 1011101 (no need to check for `i + 6` beyond size as zero) */
+        const uint64_t finder = b[w] & ~QR_BB_SHR(b, w, 1) & QR_BB_SHR(b, w, 2) & QR_BB_SHR(b, w, 3)
+                                & QR_BB_SHR(b, w, 4) & ~QR_BB_SHR(b, w, 5) & QR_BB_SHR(b, w, 6);
+        if (run5) {
+            /* A run of length `n` gives `n - 4` bits, and scores `n - 2`, so add 2 for each run start */
+            runs += qr_popcount(run5);
+            starts += qr_popcount(run5 & ~QR_BB_SHL(eq, w, 1));
+        }
+        if (finder) {
+            /* Preceded or followed by 4 light modules, counting modules beyond the edges as light */
+            const uint64_t before = QR_BB_SHL(b, w, 1) | QR_BB_SHL(b, w, 2) | QR_BB_SHL(b, w, 3) | QR_BB_SHL(b, w, 4);
+            const uint64_t after = QR_BB_SHR(b, w, 7) | QR_BB_SHR(b, w, 8) | QR_BB_SHR(b, w, 9)
+                                    | QR_BB_SHR(b, w, 10);
+            finders += qr_popcount(finder & ~(before & after));
+        }
+    }
+    *p_finders += finders;
+
+    return runs + starts * 2;
+}
 
-    int x, y, r, k, block;
+/* Evaluate penalty of masked symbol given as row and column bitboards */
+static int qr_evaluate(const uint64_t *rows, const uint64_t *cols, const int size) {
+    int x, y, w, k;
     int result = 0;
-    char state;
-    int dark_mods;
+    int dark_mods = 0;
+    int finders = 0;
+    int blocks = 0;
     double percentage;
-    int a, b, afterCount, beforeCount;
+    uint64_t pair_mask[QR_BB_STRIDE];
+    uint64_t eq[2][QR_BB_STRIDE];
 #ifdef ZINTLOG
     int result_b = 0;
     char str[15];
@@ -1048,60 +1080,41 @@ static int qr_evaluate(unsigned char *local, const int size) {
 #ifdef ZINTLOG
     /* bitmask output */
     for (y = 0; y < size; y++) {
-        strcpy(str, "");
         for (x = 0; x < size; x++) {
-            state = local[(y * size) + x];
-            append_log(state);
+            append_log((char) ((rows[y * QR_BB_STRIDE + 1 + (x >> 6)] >> (x & 63)) & 1));
         }
         write_log("");
     }
     write_log("");
 #endif
 
+    /* Modules 0 to `size - 2`, i.e. those with a right/lower neighbour */
+    memset(pair_mask, 0, sizeof(pair_mask));
+    for (x = 0; x < size - 1; x++) {
+        QR_BB_SET(pair_mask, x);
+    }
+    memset(eq, 0, sizeof(eq));
+
     /* Test 1: Adjacent modules in row/column in same colour */
     /* Vertical */
     for (x = 0; x < size; x++) {
-        block = 0;
-        state = 0;
-        for (y = 0; y < size; y++) {
-            if (local[(y * size) + x] == state) {
-                block++;
-            } else {
-                if (block >= 5) {
-                    result += block - 2;
-                }
-                block = 1;
-                state = local[(y * size) + x];
-            }
-        }
-        if (block >= 5) {
-            result += block - 2;
-        }
+        result += qr_bb_line_penalty(cols + x * QR_BB_STRIDE, pair_mask, eq[0], &finders);
     }
 
-    /* Horizontal */
-    dark_mods = 0; /* Count dark mods simultaneously (see Test 4 below) */
+    /* Horizontal, doing Test 2 (see below) and counting dark mods (see Test 4 below) simultaneously */
     for (y = 0; y < size; y++) {
-        r = y * size;
-        block = 0;
-        state = 0;
-        for (x = 0; x < size; x++) {
-            if (local[r + x] == state) {
-                block++;
-            } else {
-                if (block >= 5) {
-                    result += block - 2;
-                }
-                block = 1;
-                state = local[r + x];
-            }
-            if (state) {
-                dark_mods++;
+        const uint64_t *row = rows + y * QR_BB_STRIDE;
+        uint64_t *row_eq = eq[y & 1];
+
+        result += qr_bb_line_penalty(row, pair_mask, row_eq, &finders);
+
+        for (w = 1; w <= QR_BB_WORDS; w++) {
+            dark_mods += qr_popcount(row[w]);
+            if (y) {
+                /* Test 2: Block of modules in same color */
+                blocks += qr_popcount(row_eq[w] & eq[!(y & 1)][w] & ~(row[w] ^ row[w - QR_BB_STRIDE]));
             }
         }
-        if (block >= 5) {
-            result += block - 2;
-        }
     }
 
 #ifdef ZINTLOG
@@ -1112,16 +1125,7 @@ static int qr_evaluate(unsigned char *local, const int size) {
 #endif
 
     /* Test 2: Block of modules in same color */
-    for (x = 0; x < size - 1; x++) {
-        for (y = 0; y < size - 1; y++) {
-            k = local[(y * size) + x];
-            if (((k == local[((y + 1) * size) + x]) &&
-                    (k == local[(y * size) + (x + 1)])) &&
-                    (k == local[((y + 1) * size) + (x + 1)])) {
-                result += 3;
-            }
-        }
-    }
+    result += blocks * 3;
 
 #ifdef ZINTLOG
     /* output Test 2 */
@@ -1131,91 +1135,7 @@ static int qr_evaluate(unsigned char *local, const int size) {
 #endif
 
     /* Test 3: 1:1:3:1:1 ratio pattern in row/column */
-    /* Vertical */
-    for (x = 0; x < size; x++) {
-        for (y = 0; y <= (size - 7); y++) {
-            if (local[y * size + x] && !local[(y + 1) * size + x] && local[(y + 2) * size + x] &&
-                    local[(y + 3) * size + x] && local[(y + 4) * size + x] &&
-                    !local[(y + 5) * size + x] && local[(y + 6) * size + x]) {
-                /* Pattern found, check before and after */
-                beforeCount = 0;
-                for (b = (y - 1); b >= (y - 4); b--) {
-                    if (b < 0) { /* Count < edge as whitespace */
-                        beforeCount = 4;
-                        break;
-                    }
-                    if (local[(b * size) + x]) {
-                        break;
-                    }
-                    beforeCount++;
-                }
-                if (beforeCount == 4) {
-                    /* Pattern is preceded by light area 4 modules wide */
-                    result += 40;
-                } else {
-                    afterCount = 0;
-                    for (a = (y + 7); a <= (y + 10); a++) {
-                        if (a >= size) { /* Count > edge as whitespace */
-                            afterCount = 4;
-                            break;
-                        }
-                        if (local[(a * size) + x]) {
-                            break;
-                        }
-                        afterCount++;
-                    }
-                    if (afterCount == 4) {
-                        /* Pattern is followed by light area 4 modules wide */
-                        result += 40;
-                    }
-                }
-                y += 3; /* Skip to next possible match */
-            }
-        }
-    }
-
-    /* Horizontal */
-    for (y = 0; y < size; y++) {
-        r = y * size;
-        for (x = 0; x <= (size - 7); x++) {
-            if (memcmp(local + r + x, h1011101, 7) == 0) {
-                /* Pattern found, check before and after */
-                beforeCount = 0;
-                for (b = (x - 1); b >= (x - 4); b--) {
-                    if (b < 0) { /* Count < edge as whitespace */
-                        beforeCount = 4;
-                        break;
-                    }
-                    if (local[r + b]) {
-                        break;
-                    }
-                    beforeCount++;
-                }
-
-                if (beforeCount == 4) {
-                    /* Pattern is preceded by light area 4 modules wide */
-                    result += 40;
-                } else {
-                    afterCount = 0;
-                    for (a = (x + 7); a <= (x + 10); a++) {
-                        if (a >= size) { /* Count > edge as whitespace */
-                            afterCount = 4;
-                            break;
-                        }
-                        if (local[r + a]) {
-                            break;
-                        }
-                        afterCount++;
-                    }
-                    if (afterCount == 4) {
-                        /* Pattern is followed by light area 4 modules wide */
-                        result += 40;
-                    }
-                }
-                x += 3; /* Skip to next possible match */
-            }
-        }
-    }
+    result += finders * 40;
 
 #ifdef ZINTLOG
     /* output Test 3 */
@@ -1280,55 +1200,128 @@ static void qr_add_format_info(unsigned char *grid, const int size, const int ec
     grid[(8 * size) + 7] |= (seq >> 8) & 0x01;
 }
 
-static int qr_apply_bitmask(unsigned char *grid, const int size, const int ecc_level, const int user_mask,
-            const int fast_encode, const int debug_print) {
-    int x, y;
+/* Add format information to row and column bitboards (as `qr_add_format_info()`, which see) */
+static void qr_bb_add_format_info(uint64_t *rows, uint64_t *cols, const int size, const int ecc_level,
+            const int pattern) {
+    int format = pattern;
+    unsigned int seq;
+    int i;
+
+    switch (ecc_level) {
+        case QR_LEVEL_L: format |= 0x08;
+            break;
+        case QR_LEVEL_Q: format |= 0x18;
+            break;
+        case QR_LEVEL_H: format |= 0x10;
+            break;
+    }
+
+    seq = qr_annex_c[format];
+
+    for (i = 0; i < 15; i++) {
+        if ((seq >> i) & 0x01) {
+            int x, y;
+            if (i < 6) {
+                x = 8;
+                y = i;
+            } else if (i < 8) {
+                x = 8;
+                y = i + 1; /* Skip timing row */
+            } else if (i == 8) {
+                x = 7;
+                y = 8;
+            } else {
+                x = 14 - i; /* Skip timing column */
+                y = 8;
+            }
+            QR_BB_SET(rows + y * QR_BB_STRIDE, x);
+            QR_BB_SET(cols + x * QR_BB_STRIDE, y);
+            if (i < 8) {
+                x = size - i - 1;
+                y = 8;
+            } else {
+                x = 8;
+                y = size - 15 + i;
+            }
+            QR_BB_SET(rows + y * QR_BB_STRIDE, x);
+            QR_BB_SET(cols + x * QR_BB_STRIDE, y);
+        }
+    }
+}
+
+/* Whether mask `pattern` inverts module at `x`, `y` (if not a function module) */
+static int qr_mask_bit(const int pattern, const int y, const int x) {
+    switch (pattern) {
+        case 0: return ((y + x) & 1) == 0;
+        case 1: return (y & 1) == 0;
+        case 2: return (x % 3) == 0;
+        case 3: return ((y + x) % 3) == 0;
+        case 4: return (((y / 2) + (x / 3)) & 1) == 0;
+        case 5: return ((y * x) % 6) == 0; /* Equivalent to (y * x) % 2 + (y * x) % 3 == 0 */
+        case 6: return ((((y * x) & 1) + ((y * x) % 3)) & 1) == 0;
+    }
+    return ((((y + x) & 1) + ((y * x) % 3)) & 1) == 0;
+}
+
+/* All mask patterns repeat every 12 rows and every 12 columns (at most, 6 for most) */
+#define QR_MASK_PERIOD 12
+
+/* Set `row_bits` to the modules of mask `pattern` in rows 0 to `QR_MASK_PERIOD - 1`, and `col_bits` to those in
+   columns 0 to `QR_MASK_PERIOD - 1` */
+static void qr_mask_bits(const int pattern, const int size, uint64_t row_bits[][QR_BB_STRIDE],
+            uint64_t col_bits[][QR_BB_STRIDE]) {
+    int i, j;
+
+    memset(row_bits, 0, sizeof(uint64_t) * QR_BB_STRIDE * QR_MASK_PERIOD);
+    memset(col_bits, 0, sizeof(uint64_t) * QR_BB_STRIDE * QR_MASK_PERIOD);
+    for (i = 0; i < QR_MASK_PERIOD; i++) {
+        for (j = 0; j < size; j++) {
+            if (qr_mask_bit(pattern, i, j)) {
+                QR_BB_SET(row_bits[i], j);
+            }
+            if (qr_mask_bit(pattern, j, i)) {
+                QR_BB_SET(col_bits[i], j);
+            }
+        }
+    }
+}
+
+static int qr_apply_bitmask(struct zint_symbol *symbol, unsigned char *grid, const int size, const int ecc_level,
+            const int user_mask, const int fast_encode, const int debug_print) {
+    int x, y, w;
     int r, k;
-    int bit;
     int pattern, penalty[8];
     int best_pattern;
-    int size_squared = size * size;
-    unsigned char *mask = (unsigned char *) z_alloca(size_squared);
-    unsigned char *local = (unsigned char *) z_alloca(size_squared);
-
-    /* Perform data masking */
-    memset(mask, 0, size_squared);
+    const int bb_size = size * QR_BB_STRIDE;
+    const size_t bb_bytes = sizeof(uint64_t) * bb_size * 6;
+    /* Dark modules, maskable modules and masked symbol, as rows then columns */
+    uint64_t *bb, *dark_rows, *dark_cols, *data_rows, *data_cols, *rows, *cols;
+    uint64_t row_bits[QR_MASK_PERIOD][QR_BB_STRIDE], col_bits[QR_MASK_PERIOD][QR_BB_STRIDE];
+
+    assert(size <= QR_BB_WORDS * 64);
+
+    if (!(bb = (uint64_t *) z_scratch(symbol, bb_bytes))) {
+        bb = (uint64_t *) z_alloca(bb_bytes);
+    }
+    dark_rows = bb;
+    dark_cols = bb + bb_size;
+    data_rows = bb + bb_size * 2;
+    data_cols = bb + bb_size * 3;
+    rows = bb + bb_size * 4;
+    cols = bb + bb_size * 5;
+
+    /* Pack the grid into bitboards */
+    memset(bb, 0, bb_bytes);
     for (y = 0; y < size; y++) {
         r = y * size;
         for (x = 0; x < size; x++) {
-
-            /* all eight bitmask variants are encoded in the 8 bits of the bytes that make up the mask array. */
+            if (grid[r + x] & 0x01) {
+                QR_BB_SET(dark_rows + y * QR_BB_STRIDE, x);
+                QR_BB_SET(dark_cols + x * QR_BB_STRIDE, y);
+            }
             if (!(grid[r + x] & 0xf0)) { /* exclude areas not to be masked. */
-                if (((y + x) & 1) == 0) {
-                    mask[r + x] |= 0x01;
-                }
-                if (!fast_encode) {
-                    if ((y & 1) == 0) {
-                        mask[r + x] |= 0x02;
-                    }
-                }
-                if ((x % 3) == 0) {
-                    mask[r + x] |= 0x04;
-                }
-                if (!fast_encode) {
-                    if (((y + x) % 3) == 0) {
-                        mask[r + x] |= 0x08;
-                    }
-                }
-                if ((((y / 2) + (x / 3)) & 1) == 0) {
-                    mask[r + x] |= 0x10;
-                }
-                if (!fast_encode) {
-                    if ((y * x) % 6 == 0) { /* Equivalent to (y * x) % 2 + (y * x) % 3 == 0 */
-                        mask[r + x] |= 0x20;
-                    }
-                    if (((((y * x) & 1) + ((y * x) % 3)) & 1) == 0) {
-                        mask[r + x] |= 0x40;
-                    }
-                }
-                if (((((y + x) & 1) + ((y * x) % 3)) & 1) == 0) {
-                    mask[r + x] |= 0x80;
-                }
+                QR_BB_SET(data_rows + y * QR_BB_STRIDE, x);
+                QR_BB_SET(data_cols + x * QR_BB_STRIDE, y);
             }
         }
     }
@@ -1336,25 +1329,24 @@ static int qr_apply_bitmask(unsigned char *grid, const int size, const int ecc_l
     if (user_mask) {
         best_pattern = user_mask - 1;
     } else {
-        /* all eight bitmask variants have been encoded in the 8 bits of the bytes
-         * that make up the mask array. select them for evaluation according to the
-         * desired pattern.*/
+        /* Apply each mask by XOR-ing its bits (restricted to maskable modules) onto the rows and columns */
         best_pattern = 0;
         for (pattern = 0; pattern < 8; pattern++) {
             if (fast_encode && pattern != 0 && pattern != 2 && pattern != 4 && pattern != 7) {
                 continue;
             }
-            bit = 1 << pattern;
-            for (k = 0; k < size_squared; k++) {
-                if (mask[k] & bit) {
-                    local[k] = grid[k] ^ 0x01;
-                } else {
-                    local[k] = grid[k] & 0x0f;
+            qr_mask_bits(pattern, size, row_bits, col_bits);
+            for (k = 0; k < size; k++) {
+                const int offset = k * QR_BB_STRIDE;
+                const uint64_t *row_bit = row_bits[k % QR_MASK_PERIOD], *col_bit = col_bits[k % QR_MASK_PERIOD];
+                for (w = 1; w <= QR_BB_WORDS; w++) {
+                    rows[offset + w] = dark_rows[offset + w] ^ (data_rows[offset + w] & row_bit[w]);
+                    cols[offset + w] = dark_cols[offset + w] ^ (data_cols[offset + w] & col_bit[w]);
                 }
             }
-            qr_add_format_info(local, size, ecc_level, pattern);
+            qr_bb_add_format_info(rows, cols, size, ecc_level, pattern);
 
-            penalty[pattern] = qr_evaluate(local, size);
+            penalty[pattern] = qr_evaluate(rows, cols, size);
 
             if (penalty[pattern] < penalty[best_pattern]) {
                 best_pattern = pattern;
@@ -1376,20 +1368,19 @@ static int qr_apply_bitmask(unsigned char *grid, const int size, const int ecc_l
 
 #ifdef ZINTLOG
     char str[15];
-    sprintf(str, "%d", best_val);
+    sprintf(str, "%d", best_pattern);
     write_log("chose pattern:");
     write_log(str);
 #endif
 
     /* Apply mask */
-    if (!user_mask && best_pattern == 7) { /* Reuse last */
-        memcpy(grid, local, size_squared);
-    } else {
-        bit = 1 << best_pattern;
-        for (y = 0; y < size_squared; y++) {
-            if (mask[y] & bit) {
-                grid[y] ^= 0x01;
-            }
+    qr_mask_bits(best_pattern, size, row_bits, col_bits);
+    for (y = 0; y < size; y++) {
+        const uint64_t *data_row = data_rows + y * QR_BB_STRIDE;
+        const uint64_t *row_bit = row_bits[y % QR_MASK_PERIOD];
+        r = y * size;
+        for (x = 0; x < size; x++) {
+            grid[r + x] ^= (unsigned char) ((data_row[1 + (x >> 6)] & row_bit[1 + (x >> 6)]) >> (x & 63)) & 0x01;
         }
     }
 
@@ -1601,14 +1592,27 @@ INTERNAL int qrcode(struct zint_symbol *symbol, struct zint_seg segs[], const in
     const int fast_encode = symbol->input_mode & FAST_MODE;
     const int debug_print = symbol->debug & ZINT_DEBUG_PRINT;
     const int eci_length_segs = get_eci_length_segs(segs, seg_count);
-    struct zint_seg *local_segs = (struct zint_seg *) z_alloca(sizeof(struct zint_seg) * seg_count);
-    unsigned int *ddata = (unsigned int *) z_alloca(sizeof(unsigned int) * eci_length_segs);
-    char *mode = (char *) z_alloca(eci_length_segs);
-    char *prev_mode = (char *) z_alloca(eci_length_segs);
+    struct zint_seg *local_segs;
+    unsigned int *ddata;
+    char *mode;
+    char *prev_mode;
     unsigned char *datastream;
     unsigned char *fullstream;
     unsigned char *grid;
 
+    if (!(local_segs = (struct zint_seg *) z_scratch(symbol, sizeof(struct zint_seg) * seg_count))) {
+        local_segs = (struct zint_seg *) z_alloca(sizeof(struct zint_seg) * seg_count);
+    }
+    if (!(ddata = (unsigned int *) z_scratch(symbol, sizeof(unsigned int) * eci_length_segs))) {
+        ddata = (unsigned int *) z_alloca(sizeof(unsigned int) * eci_length_segs);
+    }
+    if (!(mode = (char *) z_scratch(symbol, eci_length_segs))) {
+        mode = (char *) z_alloca(eci_length_segs);
+    }
+    if (!(prev_mode = (char *) z_scratch(symbol, eci_length_segs))) {
+        prev_mode = (char *) z_alloca(eci_length_segs);
+    }
+
     user_mask = (symbol->option_3 >> 8) & 0x0F; /* User mask is pattern + 1, so >= 1 and <= 8 */
     if (user_mask > 8) {
         user_mask = 0; /* Ignore */
@@ -1669,6 +1673,7 @@ INTERNAL int qrcode(struct zint_symbol *symbol, struct zint_seg segs[], const in
         }
     }
 
+    STATS_BEGIN(symbol, ZINT_PHASE_MODE);
     est_binlen = qr_calc_binlen_segs(40, mode, ddata, local_segs, seg_count, p_structapp, 0 /*mode_preset*/, gs1,
                     debug_print);
 
@@ -1789,6 +1794,7 @@ INTERNAL int qrcode(struct zint_symbol *symbol, struct zint_seg segs[], const in
             return ZINT_ERROR_TOO_LONG;
         }
     }
+    STATS_END(symbol, ZINT_PHASE_MODE);
 
     /* Ensure maxium error correction capacity unless user-specified */
     if (symbol->option_1 == -1 || symbol->option_1 != ecc_level) {
@@ -1825,20 +1831,33 @@ INTERNAL int qrcode(struct zint_symbol *symbol, struct zint_seg segs[], const in
         printf("Number of ECC blocks: %d\n", blocks);
     }
 
-    datastream = (unsigned char *) z_alloca(target_codewords + 1);
-    fullstream = (unsigned char *) z_alloca(qr_total_codewords[version - 1] + 1);
+    if (symbol->priv->geometry) { /* Sizing only, so skip codewords, placement and masking */
+        set_geometry(symbol, qr_sizes[version - 1], version, ecc_level);
+        return warn_number;
+    }
+
+    if (!(datastream = (unsigned char *) z_scratch(symbol, target_codewords + 1))) {
+        datastream = (unsigned char *) z_alloca(target_codewords + 1);
+    }
+    if (!(fullstream = (unsigned char *) z_scratch(symbol, qr_total_codewords[version - 1] + 1))) {
+        fullstream = (unsigned char *) z_alloca(qr_total_codewords[version - 1] + 1);
+    }
 
     (void) qr_binary_segs(datastream, version, target_codewords, mode, ddata, local_segs, seg_count, p_structapp, gs1,
                     est_binlen, debug_print);
 #ifdef ZINT_TEST
     if (symbol->debug & ZINT_DEBUG_TEST) debug_test_codeword_dump(symbol, datastream, target_codewords);
 #endif
+    STATS_BEGIN(symbol, ZINT_PHASE_RS);
     qr_add_ecc(fullstream, datastream, version, target_codewords, blocks, debug_print);
+    STATS_END(symbol, ZINT_PHASE_RS);
 
     size = qr_sizes[version - 1];
     size_squared = size * size;
 
-    grid = (unsigned char *) z_alloca(size_squared);
+    if (!(grid = (unsigned char *) z_scratch(symbol, size_squared))) {
+        grid = (unsigned char *) z_alloca(size_squared);
+    }
     memset(grid, 0, size_squared);
 
     qr_setup_grid(grid, size, version);
@@ -1848,7 +1867,12 @@ INTERNAL int qrcode(struct zint_symbol *symbol, struct zint_seg segs[], const in
         qr_add_version_info(grid, size, version);
     }
 
-    bitmask = qr_apply_bitmask(grid, size, ecc_level, user_mask, fast_encode, debug_print);
+    STATS_BEGIN(symbol, ZINT_PHASE_MASK);
+    bitmask = qr_apply_bitmask(symbol, grid, size, ecc_level, user_mask, fast_encode, debug_print);
+    STATS_END(symbol, ZINT_PHASE_MASK);
+    STATS_SET(symbol, version, version);
+    STATS_SET(symbol, ecc_level, ecc_level);
+    STATS_SET(symbol, mask, bitmask);
 
     qr_add_format_info(grid, size, ecc_level, bitmask);
 
@@ -1869,8 +1893,8 @@ INTERNAL int qrcode(struct zint_symbol *symbol, struct zint_seg segs[], const in
     return warn_number;
 }
 
-static int micro_qr_m1(struct zint_symbol *symbol, char binary_data[], int bp) {
-    int i, j, latch;
+static int micro_qr_m1(struct zint_symbol *symbol, unsigned char binary_data[], int bp) {
+    int i, latch;
     int bits_total, bits_left;
     int data_codewords, ecc_codewords;
     unsigned char data_blocks[4], ecc_blocks[3];
@@ -1883,15 +1907,16 @@ static int micro_qr_m1(struct zint_symbol *symbol, char binary_data[], int bp) {
     bits_left = bits_total - bp;
     if (bits_left <= 3) {
         if (bits_left) {
-            bp = bin_append_posn(0, bits_left, binary_data, bp);
+            bp = bits_append_posn(0, bits_left, binary_data, bp);
         }
         latch = 1;
     } else {
-        bp = bin_append_posn(0, 3, binary_data, bp);
+        bp = bits_append_posn(0, 3, binary_data, bp);
     }
 
     if (symbol->debug & ZINT_DEBUG_PRINT) {
-        printf("M1 Terminated binary (%d): %.*s (bits_left %d)\n", bp, bp, binary_data, bits_left);
+        printf("M1 Terminated binary (%d): %s (bits_left %d)\n", bp,
+                bits_dump(binary_data, bp, (char *) z_alloca(bp + 1)), bits_left);
     }
 
     if (latch == 0) {
@@ -1899,7 +1924,7 @@ static int micro_qr_m1(struct zint_symbol *symbol, char binary_data[], int bp) {
         bits_left = bits_total - bp;
         if (bits_left <= 4) {
             if (bits_left) {
-                bp = bin_append_posn(0, bits_left, binary_data, bp);
+                bp = bits_append_posn(0, bits_left, binary_data, bp);
             }
             latch = 1;
         }
@@ -1909,7 +1934,7 @@ static int micro_qr_m1(struct zint_symbol *symbol, char binary_data[], int bp) {
         /* Complete current byte */
         int remainder = 8 - (bp % 8);
         if (remainder != 8) {
-            bp = bin_append_posn(0, remainder, binary_data, bp);
+            bp = bits_append_posn(0, remainder, binary_data, bp);
         }
 
         /* Add padding */
@@ -1917,10 +1942,10 @@ static int micro_qr_m1(struct zint_symbol *symbol, char binary_data[], int bp) {
         if (bits_left > 4) {
             remainder = (bits_left - 4) / 8;
             for (i = 0; i < remainder; i++) {
-                bp = bin_append_posn(i & 1 ? 0x11 : 0xEC, 8, binary_data, bp);
+                bp = bits_append_posn(i & 1 ? 0x11 : 0xEC, 8, binary_data, bp);
             }
         }
-        bp = bin_append_posn(0, 4, binary_data, bp);
+        bp = bits_append_posn(0, 4, binary_data, bp);
     }
 
     data_codewords = 3;
@@ -1928,19 +1953,9 @@ static int micro_qr_m1(struct zint_symbol *symbol, char binary_data[], int bp) {
 
     /* Copy data into codewords */
     for (i = 0; i < (data_codewords - 1); i++) {
-        data_blocks[i] = 0;
-        for (j = 0; j < 8; j++) {
-            if (binary_data[(i * 8) + j] == '1') {
-                data_blocks[i] |= 0x80 >> j;
-            }
-        }
-    }
-    data_blocks[2] = 0;
-    for (j = 0; j < 4; j++) {
-        if (binary_data[16 + j] == '1') {
-            data_blocks[2] |= 0x80 >> j;
-        }
+        data_blocks[i] = (unsigned char) bits_get_posn(binary_data, i * 8, 8);
     }
+    data_blocks[2] = (unsigned char) (bits_get_posn(binary_data, 16, 4) << 4);
 #ifdef ZINT_TEST
     if (symbol->debug & ZINT_DEBUG_TEST) debug_test_codeword_dump(symbol, data_blocks, data_codewords);
 #endif
@@ -1952,14 +1967,14 @@ static int micro_qr_m1(struct zint_symbol *symbol, char binary_data[], int bp) {
 
     /* Add Reed-Solomon codewords to binary data */
     for (i = 0; i < ecc_codewords; i++) {
-        bp = bin_append_posn(ecc_blocks[ecc_codewords - i - 1], 8, binary_data, bp);
+        bp = bits_append_posn(ecc_blocks[ecc_codewords - i - 1], 8, binary_data, bp);
     }
 
     return bp;
 }
 
-static int micro_qr_m2(struct zint_symbol *symbol, char binary_data[], int bp, const int ecc_mode) {
-    int i, j, latch;
+static int micro_qr_m2(struct zint_symbol *symbol, unsigned char binary_data[], int bp, const int ecc_mode) {
+    int i, latch;
     int bits_total = 0, bits_left;
     int data_codewords = 0, ecc_codewords = 0;
     unsigned char data_blocks[6], ecc_blocks[7];
@@ -1979,29 +1994,30 @@ static int micro_qr_m2(struct zint_symbol *symbol, char binary_data[], int bp, c
     bits_left = bits_total - bp;
     if (bits_left <= 5) {
         if (bits_left) {
-            bp = bin_append_posn(0, bits_left, binary_data, bp);
+            bp = bits_append_posn(0, bits_left, binary_data, bp);
         }
         latch = 1;
     } else {
-        bp = bin_append_posn(0, 5, binary_data, bp);
+        bp = bits_append_posn(0, 5, binary_data, bp);
     }
 
     if (symbol->debug & ZINT_DEBUG_PRINT) {
-        printf("M2 Terminated binary (%d): %.*s (bits_left %d)\n", bp, bp, binary_data, bits_left);
+        printf("M2 Terminated binary (%d): %s (bits_left %d)\n", bp,
+                bits_dump(binary_data, bp, (char *) z_alloca(bp + 1)), bits_left);
     }
 
     if (latch == 0) {
         /* Complete current byte */
         int remainder = 8 - (bp % 8);
         if (remainder != 8) {
-            bp = bin_append_posn(0, remainder, binary_data, bp);
+            bp = bits_append_posn(0, remainder, binary_data, bp);
         }
 
         /* Add padding */
         bits_left = bits_total - bp;
         remainder = bits_left / 8;
         for (i = 0; i < remainder; i++) {
-            bp = bin_append_posn(i & 1 ? 0x11 : 0xEC, 8, binary_data, bp);
+            bp = bits_append_posn(i & 1 ? 0x11 : 0xEC, 8, binary_data, bp);
         }
     }
 
@@ -2017,13 +2033,7 @@ static int micro_qr_m2(struct zint_symbol *symbol, char binary_data[], int bp, c
 
     /* Copy data into codewords */
     for (i = 0; i < data_codewords; i++) {
-        data_blocks[i] = 0;
-
-        for (j = 0; j < 8; j++) {
-            if (binary_data[(i * 8) + j] == '1') {
-                data_blocks[i] |= 0x80 >> j;
-            }
-        }
+        data_blocks[i] = (unsigned char) bits_get_posn(binary_data, i * 8, 8);
     }
 #ifdef ZINT_TEST
     if (symbol->debug & ZINT_DEBUG_TEST) debug_test_codeword_dump(symbol, data_blocks, data_codewords);
@@ -2036,14 +2046,14 @@ static int micro_qr_m2(struct zint_symbol *symbol, char binary_data[], int bp, c
 
     /* Add Reed-Solomon codewords to binary data */
     for (i = 0; i < ecc_codewords; i++) {
-        bp = bin_append_posn(ecc_blocks[ecc_codewords - i - 1], 8, binary_data, bp);
+        bp = bits_append_posn(ecc_blocks[ecc_codewords - i - 1], 8, binary_data, bp);
     }
 
     return bp;
 }
 
-static int micro_qr_m3(struct zint_symbol *symbol, char binary_data[], int bp, const int ecc_mode) {
-    int i, j, latch;
+static int micro_qr_m3(struct zint_symbol *symbol, unsigned char binary_data[], int bp, const int ecc_mode) {
+    int i, latch;
     int bits_total = 0, bits_left;
     int data_codewords = 0, ecc_codewords = 0;
     unsigned char data_blocks[12], ecc_blocks[9];
@@ -2063,15 +2073,16 @@ static int micro_qr_m3(struct zint_symbol *symbol, char binary_data[], int bp, c
     bits_left = bits_total - bp;
     if (bits_left <= 7) {
         if (bits_left) {
-            bp = bin_append_posn(0, bits_left, binary_data, bp);
+            bp = bits_append_posn(0, bits_left, binary_data, bp);
         }
         latch = 1;
     } else {
-        bp = bin_append_posn(0, 7, binary_data, bp);
+        bp = bits_append_posn(0, 7, binary_data, bp);
     }
 
     if (symbol->debug & ZINT_DEBUG_PRINT) {
-        printf("M3 Terminated binary (%d): %.*s (bits_left %d)\n", bp, bp, binary_data, bits_left);
+        printf("M3 Terminated binary (%d): %s (bits_left %d)\n", bp,
+                bits_dump(binary_data, bp, (char *) z_alloca(bp + 1)), bits_left);
     }
 
     if (latch == 0) {
@@ -2079,7 +2090,7 @@ static int micro_qr_m3(struct zint_symbol *symbol, char binary_data[], int bp, c
         bits_left = bits_total - bp;
         if (bits_left <= 4) {
             if (bits_left) {
-                bp = bin_append_posn(0, bits_left, binary_data, bp);
+                bp = bits_append_posn(0, bits_left, binary_data, bp);
             }
             latch = 1;
         }
@@ -2089,7 +2100,7 @@ static int micro_qr_m3(struct zint_symbol *symbol, char binary_data[], int bp, c
         /* Complete current byte */
         int remainder = 8 - (bp % 8);
         if (remainder != 8) {
-            bp = bin_append_posn(0, remainder, binary_data, bp);
+            bp = bits_append_posn(0, remainder, binary_data, bp);
         }
 
         /* Add padding */
@@ -2097,10 +2108,10 @@ static int micro_qr_m3(struct zint_symbol *symbol, char binary_data[], int bp, c
         if (bits_left > 4) {
             remainder = (bits_left - 4) / 8;
             for (i = 0; i < remainder; i++) {
-                bp = bin_append_posn(i & 1 ? 0x11 : 0xEC, 8, binary_data, bp);
+                bp = bits_append_posn(i & 1 ? 0x11 : 0xEC, 8, binary_data, bp);
             }
         }
-        bp = bin_append_posn(0, 4, binary_data, bp);
+        bp = bits_append_posn(0, 4, binary_data, bp);
     }
 
     if (ecc_mode == QR_LEVEL_L) {
@@ -2115,31 +2126,15 @@ static int micro_qr_m3(struct zint_symbol *symbol, char binary_data[], int bp, c
 
     /* Copy data into codewords */
     for (i = 0; i < (data_codewords - 1); i++) {
-        data_blocks[i] = 0;
-
-        for (j = 0; j < 8; j++) {
-            if (binary_data[(i * 8) + j] == '1') {
-                data_blocks[i] |= 0x80 >> j;
-            }
-        }
+        data_blocks[i] = (unsigned char) bits_get_posn(binary_data, i * 8, 8);
     }
 
     if (ecc_mode == QR_LEVEL_L) {
-        data_blocks[10] = 0;
-        for (j = 0; j < 4; j++) {
-            if (binary_data[80 + j] == '1') {
-                data_blocks[10] |= 0x80 >> j;
-            }
-        }
+        data_blocks[10] = (unsigned char) (bits_get_posn(binary_data, 80, 4) << 4);
     }
 
     if (ecc_mode == QR_LEVEL_M) {
-        data_blocks[8] = 0;
-        for (j = 0; j < 4; j++) {
-            if (binary_data[64 + j] == '1') {
-                data_blocks[8] |= 0x80 >> j;
-            }
-        }
+        data_blocks[8] = (unsigned char) (bits_get_posn(binary_data, 64, 4) << 4);
     }
 #ifdef ZINT_TEST
     if (symbol->debug & ZINT_DEBUG_TEST) debug_test_codeword_dump(symbol, data_blocks, data_codewords);
@@ -2152,14 +2147,14 @@ static int micro_qr_m3(struct zint_symbol *symbol, char binary_data[], int bp, c
 
     /* Add Reed-Solomon codewords to binary data */
     for (i = 0; i < ecc_codewords; i++) {
-        bp = bin_append_posn(ecc_blocks[ecc_codewords - i - 1], 8, binary_data, bp);
+        bp = bits_append_posn(ecc_blocks[ecc_codewords - i - 1], 8, binary_data, bp);
     }
 
     return bp;
 }
 
-static int micro_qr_m4(struct zint_symbol *symbol, char binary_data[], int bp, const int ecc_mode) {
-    int i, j, latch;
+static int micro_qr_m4(struct zint_symbol *symbol, unsigned char binary_data[], int bp, const int ecc_mode) {
+    int i, latch;
     int bits_total = 0, bits_left;
     int data_codewords = 0, ecc_codewords = 0;
     unsigned char data_blocks[17], ecc_blocks[15];
@@ -2182,29 +2177,30 @@ static int micro_qr_m4(struct zint_symbol *symbol, char binary_data[], int bp, c
     bits_left = bits_total - bp;
     if (bits_left <= 9) {
         if (bits_left) {
-            bp = bin_append_posn(0, bits_left, binary_data, bp);
+            bp = bits_append_posn(0, bits_left, binary_data, bp);
         }
         latch = 1;
     } else {
-        bp = bin_append_posn(0, 9, binary_data, bp);
+        bp = bits_append_posn(0, 9, binary_data, bp);
     }
 
     if (symbol->debug & ZINT_DEBUG_PRINT) {
-        printf("M4 Terminated binary (%d): %.*s (bits_left %d)\n", bp, bp, binary_data, bits_left);
+        printf("M4 Terminated binary (%d): %s (bits_left %d)\n", bp,
+                bits_dump(binary_data, bp, (char *) z_alloca(bp + 1)), bits_left);
     }
 
     if (latch == 0) {
         /* Complete current byte */
         int remainder = 8 - (bp % 8);
         if (remainder != 8) {
-            bp = bin_append_posn(0, remainder, binary_data, bp);
+            bp = bits_append_posn(0, remainder, binary_data, bp);
         }
 
         /* Add padding */
         bits_left = bits_total - bp;
         remainder = bits_left / 8;
         for (i = 0; i < remainder; i++) {
-            bp = bin_append_posn(i & 1 ? 0x11 : 0xEC, 8, binary_data, bp);
+            bp = bits_append_posn(i & 1 ? 0x11 : 0xEC, 8, binary_data, bp);
         }
     }
 
@@ -2224,13 +2220,7 @@ static int micro_qr_m4(struct zint_symbol *symbol, char binary_data[], int bp, c
 
     /* Copy data into codewords */
     for (i = 0; i < data_codewords; i++) {
-        data_blocks[i] = 0;
-
-        for (j = 0; j < 8; j++) {
-            if (binary_data[(i * 8) + j] == '1') {
-                data_blocks[i] |= 0x80 >> j;
-            }
-        }
+        data_blocks[i] = (unsigned char) bits_get_posn(binary_data, i * 8, 8);
     }
 #ifdef ZINT_TEST
     if (symbol->debug & ZINT_DEBUG_TEST) debug_test_codeword_dump(symbol, data_blocks, data_codewords);
@@ -2243,7 +2233,7 @@ static int micro_qr_m4(struct zint_symbol *symbol, char binary_data[], int bp, c
 
     /* Add Reed-Solomon codewords to binary data */
     for (i = 0; i < ecc_codewords; i++) {
-        bp = bin_append_posn(ecc_blocks[ecc_codewords - i - 1], 8, binary_data, bp);
+        bp = bits_append_posn(ecc_blocks[ecc_codewords - i - 1], 8, binary_data, bp);
     }
 
     return bp;
@@ -2284,7 +2274,7 @@ static void micro_setup_grid(unsigned char *grid, const int size) {
     grid[(8 * size) + 8] |= 20;
 }
 
-static void micro_populate_grid(unsigned char *grid, const int size, const char full_stream[], int bp) {
+static void micro_populate_grid(unsigned char *grid, const int size, const unsigned char full_stream[], int bp) {
     int direction = 1; /* up */
     int row = 0; /* right hand side */
     int i;
@@ -2296,21 +2286,13 @@ static void micro_populate_grid(unsigned char *grid, const int size, const char
         int x = (size - 2) - (row * 2);
 
         if (!(grid[(y * size) + (x + 1)] & 0xf0)) {
-            if (full_stream[i] == '1') {
-                grid[(y * size) + (x + 1)] = 0x01;
-            } else {
-                grid[(y * size) + (x + 1)] = 0x00;
-            }
+            grid[(y * size) + (x + 1)] = (unsigned char) bits_get_posn(full_stream, i, 1);
             i++;
         }
 
         if (i < bp) {
             if (!(grid[(y * size) + x] & 0xf0)) {
-                if (full_stream[i] == '1') {
-                    grid[(y * size) + x] = 0x01;
-                } else {
-                    grid[(y * size) + x] = 0x00;
-                }
+                grid[(y * size) + x] = (unsigned char) bits_get_posn(full_stream, i, 1);
                 i++;
             }
         }
@@ -2452,7 +2434,7 @@ static int micro_apply_bitmask(unsigned char *grid, const int size, const int us
 
 INTERNAL int microqr(struct zint_symbol *symbol, unsigned char source[], int length) {
     int i, size, j;
-    char full_stream[200];
+    unsigned char full_stream[BITS_SIZE(200)];
     int bp;
     int full_multibyte;
     int user_mask;
@@ -2646,13 +2628,16 @@ INTERNAL int microqr(struct zint_symbol *symbol, unsigned char source[], int len
         }
     }
 
+    STATS_BEGIN(symbol, ZINT_PHASE_MODE);
     qr_define_mode(mode, ddata, length, 0 /*gs1*/, MICROQR_VERSION + version, debug_print);
+    STATS_END(symbol, ZINT_PHASE_MODE);
 
-    bp = qr_binary_segs((unsigned char *) full_stream, MICROQR_VERSION + version, 0 /*target_codewords*/, mode, ddata,
+    bp = qr_binary_segs(full_stream, MICROQR_VERSION + version, 0 /*target_codewords*/, mode, ddata,
                     segs, seg_count, NULL /*p_structapp*/, 0 /*gs1*/, binary_count[version], debug_print);
 
-    if (debug_print) printf("Binary (%d): %.*s\n", bp, bp, full_stream);
+    if (debug_print) printf("Binary (%d): %s\n", bp, bits_dump(full_stream, bp, (char *) z_alloca(bp + 1)));
 
+    STATS_BEGIN(symbol, ZINT_PHASE_RS);
     switch (version) {
         case 0: bp = micro_qr_m1(symbol, full_stream, bp);
             break;
@@ -2663,16 +2648,24 @@ INTERNAL int microqr(struct zint_symbol *symbol, unsigned char source[], int len
         case 3: bp = micro_qr_m4(symbol, full_stream, bp, ecc_level);
             break;
     }
+    STATS_END(symbol, ZINT_PHASE_RS);
 
     size = micro_qr_sizes[version];
     size_squared = size * size;
 
-    grid = (unsigned char *) z_alloca(size_squared);
+    if (!(grid = (unsigned char *) z_scratch(symbol, size_squared))) {
+        grid = (unsigned char *) z_alloca(size_squared);
+    }
     memset(grid, 0, size_squared);
 
     micro_setup_grid(grid, size);
     micro_populate_grid(grid, size, full_stream, bp);
+    STATS_BEGIN(symbol, ZINT_PHASE_MASK);
     bitmask = micro_apply_bitmask(grid, size, user_mask, debug_print);
+    STATS_END(symbol, ZINT_PHASE_MASK);
+    STATS_SET(symbol, version, version + 1);
+    STATS_SET(symbol, ecc_level, ecc_level);
+    STATS_SET(symbol, mask, bitmask);
 
     /* Add format data */
     format = 0;
@@ -2785,9 +2778,19 @@ INTERNAL int upnqr(struct zint_symbol *symbol, unsigned char source[], int lengt
     unsigned char *datastream;
     unsigned char *fullstream;
     unsigned char *grid;
-    unsigned int *ddata = (unsigned int *) z_alloca(sizeof(unsigned int) * length);
-    char *mode = (char *) z_alloca(length + 1);
-    unsigned char *preprocessed = (unsigned char *) z_alloca(length + 1);
+    unsigned int *ddata;
+    char *mode;
+    unsigned char *preprocessed;
+
+    if (!(ddata = (unsigned int *) z_scratch(symbol, sizeof(unsigned int) * length))) {
+        ddata = (unsigned int *) z_alloca(sizeof(unsigned int) * length);
+    }
+    if (!(mode = (char *) z_scratch(symbol, length + 1))) {
+        mode = (char *) z_alloca(length + 1);
+    }
+    if (!(preprocessed = (unsigned char *) z_scratch(symbol, length + 1))) {
+        preprocessed = (unsigned char *) z_alloca(length + 1);
+    }
 
     symbol->eci = 4; /* Set before any processing */
 
@@ -2840,20 +2843,28 @@ INTERNAL int upnqr(struct zint_symbol *symbol, unsigned char source[], int lengt
     target_codewords = qr_data_codewords_M[version - 1];
     blocks = qr_blocks_M[version - 1];
 
-    datastream = (unsigned char *) z_alloca(target_codewords + 1);
-    fullstream = (unsigned char *) z_alloca(qr_total_codewords[version - 1] + 1);
+    if (!(datastream = (unsigned char *) z_scratch(symbol, target_codewords + 1))) {
+        datastream = (unsigned char *) z_alloca(target_codewords + 1);
+    }
+    if (!(fullstream = (unsigned char *) z_scratch(symbol, qr_total_codewords[version - 1] + 1))) {
+        fullstream = (unsigned char *) z_alloca(qr_total_codewords[version - 1] + 1);
+    }
 
     (void) qr_binary_segs(datastream, version, target_codewords, mode, ddata, segs, seg_count, NULL /*p_structapp*/,
                     0 /*gs1*/, est_binlen, debug_print);
 #ifdef ZINT_TEST
     if (symbol->debug & ZINT_DEBUG_TEST) debug_test_codeword_dump(symbol, datastream, target_codewords);
 #endif
+    STATS_BEGIN(symbol, ZINT_PHASE_RS);
     qr_add_ecc(fullstream, datastream, version, target_codewords, blocks, debug_print);
+    STATS_END(symbol, ZINT_PHASE_RS);
 
     size = qr_sizes[version - 1];
     size_squared = size * size;
 
-    grid = (unsigned char *) z_alloca(size_squared);
+    if (!(grid = (unsigned char *) z_scratch(symbol, size_squared))) {
+        grid = (unsigned char *) z_alloca(size_squared);
+    }
     memset(grid, 0, size_squared);
 
     qr_setup_grid(grid, size, version);
@@ -2861,7 +2872,12 @@ INTERNAL int upnqr(struct zint_symbol *symbol, unsigned char source[], int lengt
 
     qr_add_version_info(grid, size, version);
 
-    bitmask = qr_apply_bitmask(grid, size, ecc_level, user_mask, fast_encode, debug_print);
+    STATS_BEGIN(symbol, ZINT_PHASE_MASK);
+    bitmask = qr_apply_bitmask(symbol, grid, size, ecc_level, user_mask, fast_encode, debug_print);
+    STATS_END(symbol, ZINT_PHASE_MASK);
+    STATS_SET(symbol, version, version);
+    STATS_SET(symbol, ecc_level, ecc_level);
+    STATS_SET(symbol, mask, bitmask);
 
     qr_add_format_info(grid, size, ecc_level, bitmask);
 
@@ -3006,13 +3022,23 @@ INTERNAL int rmqr(struct zint_symbol *symbol, struct zint_seg segs[], const int
     const int gs1 = ((symbol->input_mode & 0x07) == GS1_MODE);
     const int debug_print = symbol->debug & ZINT_DEBUG_PRINT;
     const int eci_length_segs = get_eci_length_segs(segs, seg_count);
-    struct zint_seg *local_segs = (struct zint_seg *) z_alloca(sizeof(struct zint_seg) * seg_count);
-    unsigned int *ddata = (unsigned int *) z_alloca(sizeof(unsigned int) * eci_length_segs);
-    char *mode = (char *) z_alloca(eci_length_segs);
+    struct zint_seg *local_segs;
+    unsigned int *ddata;
+    char *mode;
     unsigned char *datastream;
     unsigned char *fullstream;
     unsigned char *grid;
 
+    if (!(local_segs = (struct zint_seg *) z_scratch(symbol, sizeof(struct zint_seg) * seg_count))) {
+        local_segs = (struct zint_seg *) z_alloca(sizeof(struct zint_seg) * seg_count);
+    }
+    if (!(ddata = (unsigned int *) z_scratch(symbol, sizeof(unsigned int) * eci_length_segs))) {
+        ddata = (unsigned int *) z_alloca(sizeof(unsigned int) * eci_length_segs);
+    }
+    if (!(mode = (char *) z_scratch(symbol, eci_length_segs))) {
+        mode = (char *) z_alloca(eci_length_segs);
+    }
+
     segs_cpy(symbol, segs, seg_count, local_segs);
 
     warn_number = qr_prep_data(symbol, local_segs, seg_count, ddata);
@@ -3032,6 +3058,7 @@ INTERNAL int rmqr(struct zint_symbol *symbol, struct zint_seg segs[], const int
         }
     }
 
+    STATS_BEGIN(symbol, ZINT_PHASE_MODE);
     est_binlen = qr_calc_binlen_segs(RMQR_VERSION + 31, mode, ddata, local_segs, seg_count, NULL /*p_structapp*/,
                     0 /*mode_preset*/, gs1, debug_print);
 
@@ -3119,6 +3146,7 @@ INTERNAL int rmqr(struct zint_symbol *symbol, struct zint_seg segs[], const int
         est_binlen = qr_calc_binlen_segs(RMQR_VERSION + version, mode, ddata, local_segs, seg_count,
                         NULL /*p_structapp*/, 0 /*mode_preset*/, gs1, debug_print);
     }
+    STATS_END(symbol, ZINT_PHASE_MODE);
 
     if (symbol->option_1 == -1) {
         /* Detect if there is enough free space to increase ECC level */
@@ -3149,20 +3177,30 @@ INTERNAL int rmqr(struct zint_symbol *symbol, struct zint_seg segs[], const int
         printf("Number of ECC blocks: %d\n", blocks);
     }
 
-    datastream = (unsigned char *) z_alloca(target_codewords + 1);
-    fullstream = (unsigned char *) z_alloca(rmqr_total_codewords[version] + 1);
+    if (!(datastream = (unsigned char *) z_scratch(symbol, target_codewords + 1))) {
+        datastream = (unsigned char *) z_alloca(target_codewords + 1);
+    }
+    if (!(fullstream = (unsigned char *) z_scratch(symbol, rmqr_total_codewords[version] + 1))) {
+        fullstream = (unsigned char *) z_alloca(rmqr_total_codewords[version] + 1);
+    }
 
     (void) qr_binary_segs(datastream, RMQR_VERSION + version, target_codewords, mode, ddata, local_segs, seg_count,
                     NULL /*p_structapp*/, gs1, est_binlen, debug_print);
 #ifdef ZINT_TEST
     if (symbol->debug & ZINT_DEBUG_TEST) debug_test_codeword_dump(symbol, datastream, target_codewords);
 #endif
+    STATS_BEGIN(symbol, ZINT_PHASE_RS);
     qr_add_ecc(fullstream, datastream, RMQR_VERSION + version, target_codewords, blocks, debug_print);
+    STATS_END(symbol, ZINT_PHASE_RS);
+    STATS_SET(symbol, version, version + 1);
+    STATS_SET(symbol, ecc_level, ecc_level);
 
     h_size = rmqr_width[version];
     v_size = rmqr_height[version];
 
-    grid = (unsigned char *) z_alloca(h_size * v_size);
+    if (!(grid = (unsigned char *) z_scratch(symbol, h_size * v_size))) {
+        grid = (unsigned char *) z_alloca(h_size * v_size);
+    }
     memset(grid, 0, h_size * v_size);
 
     rmqr_setup_grid(grid, h_size, v_size);
@@ -3225,4 +3263,93 @@ INTERNAL int rmqr(struct zint_symbol *symbol, struct zint_seg segs[], const int
     return warn_number;
 }
 
+/* Return the maximum number of characters of `char_type` (ZINT_CAPACITY_XXX) that fit in `data_bits` when encoded in
+   a single mode segment */
+static int qr_mode_capacity(const int version, const int data_bits, const int char_type) {
+    const char mode = qr_mode_types[char_type - 1];
+    const int cci_bits = qr_cci_bits(version, mode);
+    const int bits = data_bits - qr_mode_bits(version) - cci_bits;
+    int capacity;
+
+    if (cci_bits == 0 || bits <= 0) { /* Mode not available in this version */
+        return 0;
+    }
+    switch (mode) {
+        case 'N': /* 3 digits in 10 bits, 2 in 7, 1 in 4 */
+            capacity = (bits / 10) * 3 + (bits % 10 >= 7 ? 2 : bits % 10 >= 4);
+            break;
+        case 'A': /* 2 characters in 11 bits, 1 in 6 */
+            capacity = (bits / 11) * 2 + (bits % 11 >= 6);
+            break;
+        case 'B':
+            capacity = bits / 8;
+            break;
+        default: /* 'K' */
+            capacity = bits / 13;
+            break;
+    }
+
+    /* Bound by character count indicator */
+    return capacity < (1 << cci_bits) ? capacity : (1 << cci_bits) - 1;
+}
+
+/* Return the maximum number of characters of `char_type` (ZINT_CAPACITY_XXX) that QR Code, Micro QR Code or rMQR
+   can hold at ECC level `option_1` and size `option_2`, or 0 if not supported (`ZBarcode_Capacity()`) */
+INTERNAL int qr_capacity(const int symbology, const int option_1, const int option_2, const int char_type) {
+    /* ISO/IEC 18004:2015 Table 7 Number of data bits for M1 to M4, by ECC level (L, M, Q) */
+    static const unsigned char microqr_data_bits[4][3] = {
+        { 20, 0, 0 }, { 40, 32, 0 }, { 84, 68, 0 }, { 128, 112, 80 }
+    };
+    int version, data_cw;
+
+    if (char_type < ZINT_CAPACITY_NUMERIC || char_type > ZINT_CAPACITY_KANJI) {
+        return 0;
+    }
+
+    if (symbology == BARCODE_MICROQR) {
+        const int ecc_level = option_1 >= 1 && option_1 <= 4 ? option_1 : QR_LEVEL_L;
+        if (option_2 < 0 || option_2 > 4 || ecc_level == QR_LEVEL_H) {
+            return 0;
+        }
+        version = option_2 ? option_2 - 1 : 3;
+        if (version == 0 && ecc_level != QR_LEVEL_L) { /* M1 error detection only */
+            return 0;
+        }
+        return qr_mode_capacity(MICROQR_VERSION + version, microqr_data_bits[version][ecc_level - 1], char_type);
+    }
+
+    if (symbology == BARCODE_RMQR) {
+        if (option_2 < 0 || option_2 > 38 || (option_1 != -1 && option_1 != 0 && option_1 != QR_LEVEL_M
+                && option_1 != QR_LEVEL_H)) {
+            return 0;
+        }
+        if (option_2 == 0) {
+            version = 31; /* R17x139, the largest */
+        } else if (option_2 > 32) {
+            version = rmqr_fixed_height_upper_bound[option_2 - 32]; /* Largest of height */
+        } else {
+            version = option_2 - 1;
+        }
+        data_cw = option_1 == QR_LEVEL_H ? rmqr_data_codewords_H[version] : rmqr_data_codewords_M[version];
+        return qr_mode_capacity(RMQR_VERSION + version, data_cw * 8, char_type);
+    }
+
+    /* QR Code */
+    if (option_2 < 0 || option_2 > 40) {
+        return 0;
+    }
+    version = option_2 ? option_2 : 40;
+    switch (option_1) {
+        case QR_LEVEL_M: data_cw = qr_data_codewords_M[version - 1];
+            break;
+        case QR_LEVEL_Q: data_cw = qr_data_codewords_Q[version - 1];
+            break;
+        case QR_LEVEL_H: data_cw = qr_data_codewords_H[version - 1];
+            break;
+        default: data_cw = qr_data_codewords_L[version - 1];
+            break;
+    }
+    return qr_mode_capacity(version, data_cw * 8, char_type);
+}
+
 /* vim: set ts=4 sw=4 et : */
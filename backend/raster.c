@@ -88,22 +88,22 @@ static int buffer_plot(struct zint_symbol *symbol, const unsigned char *pixelbuf
 
     /* Free any previous bitmap */
     if (symbol->bitmap != NULL) {
-        free(symbol->bitmap);
+        z_free(symbol->bitmap);
         symbol->bitmap = NULL;
     }
     if (symbol->alphamap != NULL) {
-        free(symbol->alphamap);
+        z_free(symbol->alphamap);
         symbol->alphamap = NULL;
     }
 
-    symbol->bitmap = (unsigned char *) malloc(bm_bitmap_width * symbol->bitmap_height);
+    symbol->bitmap = (unsigned char *) z_malloc(bm_bitmap_width * symbol->bitmap_height);
     if (symbol->bitmap == NULL) {
         strcpy(symbol->errtxt, "661: Insufficient memory for bitmap buffer");
         return ZINT_ERROR_MEMORY;
     }
 
     if (plot_alpha) {
-        symbol->alphamap = (unsigned char *) malloc((size_t) symbol->bitmap_width * symbol->bitmap_height);
+        symbol->alphamap = (unsigned char *) z_malloc((size_t) symbol->bitmap_width * symbol->bitmap_height);
         if (symbol->alphamap == NULL) {
             strcpy(symbol->errtxt, "662: Insufficient memory for alphamap buffer");
             return ZINT_ERROR_MEMORY;
@@ -163,9 +163,12 @@ static int save_raster_image_to_file(struct zint_symbol *symbol, const int image
             symbol->bitmap_height = image_width;
             break;
     }
+    if (file_type == OUT_SIZE_ONLY) {
+        return 0;
+    }
 
     if (rotate_angle) {
-        if (!(rotated_pixbuf = (unsigned char *) malloc((size_t) image_width * image_height))) {
+        if (!(rotated_pixbuf = (unsigned char *) z_malloc((size_t) image_width * image_height))) {
             strcpy(symbol->errtxt, "650: Insufficient memory for pixel buffer");
             return ZINT_ERROR_MEMORY;
         }
@@ -202,15 +205,16 @@ static int save_raster_image_to_file(struct zint_symbol *symbol, const int image
             break;
     }
 
+    STATS_BEGIN(symbol, ZINT_PHASE_OUTPUT);
     switch (file_type) {
         case OUT_BUFFER:
             if (symbol->output_options & OUT_BUFFER_INTERMEDIATE) {
                 if (symbol->bitmap != NULL) {
-                    free(symbol->bitmap);
+                    z_free(symbol->bitmap);
                     symbol->bitmap = NULL;
                 }
                 if (symbol->alphamap != NULL) {
-                    free(symbol->alphamap);
+                    z_free(symbol->alphamap);
                     symbol->alphamap = NULL;
                 }
                 symbol->bitmap = rotated_pixbuf;
@@ -225,8 +229,9 @@ static int save_raster_image_to_file(struct zint_symbol *symbol, const int image
             error_number = png_pixel_plot(symbol, rotated_pixbuf);
 #else
             if (rotate_angle) {
-                free(rotated_pixbuf);
+                z_free(rotated_pixbuf);
             }
+            STATS_END(symbol, ZINT_PHASE_OUTPUT);
             return ZINT_ERROR_INVALID_OPTION;
 #endif
             break;
@@ -243,9 +248,10 @@ static int save_raster_image_to_file(struct zint_symbol *symbol, const int image
             error_number = bmp_pixel_plot(symbol, rotated_pixbuf);
             break;
     }
+    STATS_END(symbol, ZINT_PHASE_OUTPUT);
 
     if (rotate_angle) {
-        free(rotated_pixbuf);
+        z_free(rotated_pixbuf);
     }
     return error_number;
 }
@@ -745,15 +751,19 @@ static int plot_raster_maxicode(struct zint_symbol *symbol, const int rotate_ang
     image_height = (int) ceilf(hex_image_height + yoffset_si + boffset_si);
     assert(image_width && image_height);
 
-    if (!(pixelbuf = (unsigned char *) malloc((size_t) image_width * image_height))) {
+    if (file_type == OUT_SIZE_ONLY) {
+        return save_raster_image_to_file(symbol, image_height, image_width, NULL, rotate_angle, file_type);
+    }
+
+    if (!(pixelbuf = (unsigned char *) z_malloc((size_t) image_width * image_height))) {
         strcpy(symbol->errtxt, "655: Insufficient memory for pixel buffer");
         return ZINT_ERROR_MEMORY;
     }
     memset(pixelbuf, DEFAULT_PAPER, (size_t) image_width * image_height);
 
-    if (!(scaled_hexagon = (unsigned char *) malloc((size_t) hex_width * hex_height))) {
+    if (!(scaled_hexagon = (unsigned char *) z_malloc((size_t) hex_width * hex_height))) {
         strcpy(symbol->errtxt, "656: Insufficient memory for pixel buffer");
-        free(pixelbuf);
+        z_free(pixelbuf);
         return ZINT_ERROR_MEMORY;
     }
     memset(scaled_hexagon, DEFAULT_PAPER, (size_t) hex_width * hex_height);
@@ -780,9 +790,9 @@ static int plot_raster_maxicode(struct zint_symbol *symbol, const int rotate_ang
                 image_width, image_height, (int) scaler);
 
     error_number = save_raster_image_to_file(symbol, image_height, image_width, pixelbuf, rotate_angle, file_type);
-    free(scaled_hexagon);
+    z_free(scaled_hexagon);
     if (rotate_angle || file_type != OUT_BUFFER || !(symbol->output_options & OUT_BUFFER_INTERMEDIATE)) {
-        free(pixelbuf);
+        z_free(pixelbuf);
     }
     if (error_number == 0) {
         /* Check whether size is compliant */
@@ -835,8 +845,12 @@ static int plot_raster_dotty(struct zint_symbol *symbol, const int rotate_angle,
     scale_width = (int) (symbol->width * scaler + xoffset_si + roffset_si + dot_overspill_si);
     scale_height = (int) (symbol_height_si + yoffset_si + boffset_si + dot_overspill_si);
 
+    if (file_type == OUT_SIZE_ONLY) {
+        return save_raster_image_to_file(symbol, scale_height, scale_width, NULL, rotate_angle, file_type);
+    }
+
     /* Apply scale options by creating another pixel buffer */
-    if (!(scaled_pixelbuf = (unsigned char *) malloc((size_t) scale_width * scale_height))) {
+    if (!(scaled_pixelbuf = (unsigned char *) z_malloc((size_t) scale_width * scale_height))) {
         strcpy(symbol->errtxt, "657: Insufficient memory for pixel buffer");
         return ZINT_ERROR_MEMORY;
     }
@@ -860,7 +874,7 @@ static int plot_raster_dotty(struct zint_symbol *symbol, const int rotate_angle,
     error_number = save_raster_image_to_file(symbol, scale_height, scale_width, scaled_pixelbuf, rotate_angle,
                                             file_type);
     if (rotate_angle || file_type != OUT_BUFFER || !(symbol->output_options & OUT_BUFFER_INTERMEDIATE)) {
-        free(scaled_pixelbuf);
+        z_free(scaled_pixelbuf);
     }
 
     return error_number;
@@ -992,7 +1006,15 @@ static int plot_raster_default(struct zint_symbol *symbol, const int rotate_angl
     image_height = symbol_height_si + textoffset * si + yoffset_si + boffset_si;
     assert(image_width && image_height);
 
-    if (!(pixelbuf = (unsigned char *) malloc((size_t) image_width * image_height))) {
+    if (file_type == OUT_SIZE_ONLY) {
+        if (!half_int_scaling) {
+            return save_raster_image_to_file(symbol, (int) stripf(image_height * scaler),
+                                            (int) stripf(image_width * scaler), NULL, rotate_angle, file_type);
+        }
+        return save_raster_image_to_file(symbol, image_height, image_width, NULL, rotate_angle, file_type);
+    }
+
+    if (!(pixelbuf = (unsigned char *) z_malloc((size_t) image_width * image_height))) {
         strcpy(symbol->errtxt, "658: Insufficient memory for pixel buffer");
         return ZINT_ERROR_MEMORY;
     }
@@ -1258,8 +1280,8 @@ static int plot_raster_default(struct zint_symbol *symbol, const int rotate_angl
         const int scale_height = (int) stripf(image_height * scaler);
 
         /* Apply scale options by creating another pixel buffer */
-        if (!(scaled_pixelbuf = (unsigned char *) malloc((size_t) scale_width * scale_height))) {
-            free(pixelbuf);
+        if (!(scaled_pixelbuf = (unsigned char *) z_malloc((size_t) scale_width * scale_height))) {
+            z_free(pixelbuf);
             strcpy(symbol->errtxt, "659: Insufficient memory for pixel buffer");
             return ZINT_ERROR_MEMORY;
         }
@@ -1283,14 +1305,14 @@ static int plot_raster_default(struct zint_symbol *symbol, const int rotate_angl
         error_number = save_raster_image_to_file(symbol, scale_height, scale_width, scaled_pixelbuf, rotate_angle,
                                                 file_type);
         if (rotate_angle || file_type != OUT_BUFFER || !(symbol->output_options & OUT_BUFFER_INTERMEDIATE)) {
-            free(scaled_pixelbuf);
+            z_free(scaled_pixelbuf);
         }
-        free(pixelbuf);
+        z_free(pixelbuf);
     } else {
         error_number = save_raster_image_to_file(symbol, image_height, image_width, pixelbuf, rotate_angle,
                                                 file_type);
         if (rotate_angle || file_type != OUT_BUFFER || !(symbol->output_options & OUT_BUFFER_INTERMEDIATE)) {
-            free(pixelbuf);
+            z_free(pixelbuf);
         }
     }
     return error_number;
@@ -1306,11 +1328,6 @@ INTERNAL int plot_raster(struct zint_symbol *symbol, int rotate_angle, int file_
     }
 #endif /* ZINT_NO_PNG */
 
-    error = out_check_colour_options(symbol);
-    if (error != 0) {
-        return error;
-    }
-
     if (symbol->symbology == BARCODE_MAXICODE) {
         error = plot_raster_maxicode(symbol, rotate_angle, file_type);
     } else if (symbol->output_options & BARCODE_DOTTY_MODE) {
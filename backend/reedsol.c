@@ -47,17 +47,74 @@
 // replaced with constants in the obvious way, and additionally
 // malloc/free can be avoided by using static arrays of a suitable
 // size.
-// Note: use of statics has been done for (up to) 8-bit tables.
+// Note: use of statics has been done for (up to) 8-bit tables and for the 10 and 12-bit tables used by Aztec.
 */
 
 #include "common.h"
 #include "reedsol.h"
 #include "reedsol_logs.h"
 
+/* Use 128-bit vectors for the product table shift register if baseline for the target */
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RS_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define RS_NEON
+#include <arm_neon.h>
+#endif
+
+/* Minimum `nsym` and total number of data codewords for which `rs_encode()` etc. set up tables of products on the
+   fly, as building them costs about 32 * `nsym` shifts and XORs */
+#define RS_MUL_MIN_NSYM     8
+#define RS_MUL_MIN_DATALEN  32
+
+/* Length of a product table row, `nsym` padded to whole vectors */
+#define RS_MUL_LEN(nsym)    (((nsym) + 15) & ~15)
+
+/* Maximum number of blocks `rs_encode_blocks()` steps through together */
+#define RS_LANES 4
+
+/* Generator polys and their logs are cached per field, `index` (0 or 1) and `nsym` if atomic operations available.
+   Entries are packed into a fixed static pool, which holds all those used by the fixed-size symbologies (QR Code,
+   Micro QR, rMQR, Data Matrix, Han Xin, Grid Matrix, MaxiCode, Code One etc. take about 6KB between them), so the
+   cache is bounded, needs no freeing and doesn't allocate. Only many different Aztec sizes could fill it, after
+   which generators are built in `rs_t` as before */
+#define RS_GEN_FIELDS 7
+#define RS_GEN_POOL 8192 /* In bytes, must be < 65535 as entries are `unsigned short` offsets (plus 1) */
+#define RS_GEN_SIZE(nsym) (1 + 2 * ((nsym) + 1)) /* Zero coeff flag, poly and logs of poly */
+
+#if defined(__ATOMIC_ACQUIRE) /* GCC >= 4.7, clang */
+#define RS_GEN_LOAD(p_entry)            __atomic_load_n(p_entry, __ATOMIC_ACQUIRE)
+#define RS_GEN_PUBLISH(p_entry, entry)  rs_gen_publish(p_entry, entry)
+#define RS_GEN_USED()                   __atomic_load_n(&rs_gen_used, __ATOMIC_RELAXED)
+#define RS_GEN_CLAIM(size)              __atomic_fetch_add(&rs_gen_used, size, __ATOMIC_RELAXED)
+static int rs_gen_publish(unsigned short *p_entry, unsigned short entry) {
+    unsigned short expected = 0;
+    return __atomic_compare_exchange_n(p_entry, &expected, entry, 0 /*weak*/, __ATOMIC_RELEASE, __ATOMIC_ACQUIRE);
+}
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#pragma intrinsic(_InterlockedCompareExchange16, _InterlockedCompareExchange, _InterlockedExchangeAdd)
+#define RS_GEN_LOAD(p_entry) \
+            ((unsigned short) _InterlockedCompareExchange16((short volatile *) (p_entry), 0, 0))
+#define RS_GEN_PUBLISH(p_entry, entry) \
+            (_InterlockedCompareExchange16((short volatile *) (p_entry), (short) (entry), 0) == 0)
+#define RS_GEN_USED()                   _InterlockedCompareExchange(&rs_gen_used, 0, 0)
+#define RS_GEN_CLAIM(size)              _InterlockedExchangeAdd(&rs_gen_used, size)
+#else
+#define RS_NO_GEN_CACHE
+#endif
+
+#ifndef RS_NO_GEN_CACHE
+static unsigned short rs_gen_cache[RS_GEN_FIELDS][2][256]; /* Offsets (plus 1) of entries in `rs_gen_pool` */
+static unsigned char rs_gen_pool[RS_GEN_POOL];
+static long rs_gen_used; /* Number of `rs_gen_pool` bytes claimed (may overshoot by number of threads) */
+#endif
+
 /* rs_init_gf(&rs, prime_poly) initialises the parameters for the Galois Field.
 // The symbol size is determined from the highest bit set in poly
 // This implementation will support sizes up to 8 bits (see rs_uint_init_gf()
-// for sizes > 8 bits and <= 30 bits) - bit sizes of 8 or 4 are typical
+// for sizes > 8 bits and <= 12 bits) - bit sizes of 8 or 4 are typical
 //
 // The poly is the bit pattern representing the GF characteristic
 // polynomial.  e.g. for ECC200 (8-bit symbols) the polynomial is
@@ -68,23 +125,25 @@ INTERNAL void rs_init_gf(rs_t *rs, const unsigned int prime_poly) {
     struct item {
         const unsigned char *logt;
         const unsigned char *alog;
+        int field; /* Index in generator cache */
     };
     /* To add a new prime poly of degree <= 8 add its details to this table and to the table in `test_generate()`
        in "backend/tests/test_reedsol.c" and regenerate the log tables by running
-       "backend/tests/test_reedsol -f generate -g". Paste the result in "reedsol_logs.h" */
+       "backend/tests/test_reedsol -f generate -g". Paste the result in "reedsol_logs.h". Also bump
+       `RS_GEN_FIELDS` */
     static const struct item data[] = {
-        { logt_0x13, alog_0x13 },   /* 0 000- */
-        { logt_0x25, alog_0x25 },   /* 0 001- */
-        { logt_0x43, alog_0x43 },   /* 0 010- */
-        { NULL, NULL },
-        { logt_0x89, alog_0x89 },   /* 0 100- */
-        { NULL, NULL },
-        { NULL, NULL },
-        { NULL, NULL },
-        { logt_0x11d, alog_0x11d }, /* 1 000- */
-        { logt_0x12d, alog_0x12d }, /* 1 001- */
-        { NULL, NULL },
-        { logt_0x163, alog_0x163 }, /* 1 011- */
+        { logt_0x13, alog_0x13, 0 },   /* 0 000- */
+        { logt_0x25, alog_0x25, 1 },   /* 0 001- */
+        { logt_0x43, alog_0x43, 2 },   /* 0 010- */
+        { NULL, NULL, 0 },
+        { logt_0x89, alog_0x89, 3 },   /* 0 100- */
+        { NULL, NULL, 0 },
+        { NULL, NULL, 0 },
+        { NULL, NULL, 0 },
+        { logt_0x11d, alog_0x11d, 4 }, /* 1 000- */
+        { logt_0x12d, alog_0x12d, 5 }, /* 1 001- */
+        { NULL, NULL, 0 },
+        { logt_0x163, alog_0x163, 6 }, /* 1 011- */
     };
 
     /* Using bits 9-6 as hash to save a few cycles */
@@ -93,6 +152,48 @@ INTERNAL void rs_init_gf(rs_t *rs, const unsigned int prime_poly) {
 
     rs->logt = data[hash].logt;
     rs->alog = data[hash].alog;
+    rs->field = data[hash].field;
+    rs->prime_poly = prime_poly;
+}
+
+/* Set up the tables of products of the poly coeffs with each possible low (rows 0-15) and high (rows 16-31) nibble
+   of the feedback in `mul`, rows `len` apart, so that `rs_encode()` etc. can update all the parity symbols with 2
+   table rows and XORs, padded to whole vectors */
+static void rs_init_mul(const rs_t *rs, unsigned char *mul, const int len) {
+    const unsigned int prime_poly = rs->prime_poly;
+    const int nsym = rs->nsym;
+    unsigned int top_bit = 0x80; /* Top bit of field element */
+    int n, k;
+
+    while (!(prime_poly & (top_bit << 1))) {
+        top_bit >>= 1;
+    }
+
+    memset(mul, 0, len); /* Low 0 */
+    memset(mul + 16 * len, 0, len); /* High 0 */
+
+    /* Single-bit multipliers 1, 2, 4, 8 (low) and 0x10, 0x20, 0x40, 0x80 (high) by successive doubling, reducing by
+       the prime poly if the top bit overflows (no lookups so vectorizable) */
+    memcpy(mul + len, rs->rspoly, nsym);
+    memset(mul + len + nsym, 0, len - nsym);
+    for (n = 2; n <= 0x80; n <<= 1) {
+        const unsigned char *const prev = mul + (n < 0x10 ? n >> 1 : n == 0x10 ? 8 : 16 + (n >> 5)) * len;
+        unsigned char *const row = mul + (n < 0x10 ? n : 16 + (n >> 4)) * len;
+        for (k = 0; k < len; k++) {
+            row[k] = (unsigned char) ((prev[k] << 1) ^ (prev[k] & top_bit ? prime_poly : 0));
+        }
+    }
+
+    /* The rest by linearity, e.g. 3 * g = 1 * g ^ 2 * g */
+    for (n = 3; n < 16; n++) {
+        const int low_bit = n & -n;
+        if (n != low_bit) {
+            for (k = 0; k < len; k++) {
+                mul[n * len + k] = mul[(n - low_bit) * len + k] ^ mul[low_bit * len + k];
+                mul[(16 + n) * len + k] = mul[(16 + n - low_bit) * len + k] ^ mul[(16 + low_bit) * len + k];
+            }
+        }
+    }
 }
 
 /* rs_init_code(&rs, nsym, index) initialises the Reed-Solomon encoder
@@ -103,14 +204,13 @@ INTERNAL void rs_init_gf(rs_t *rs, const unsigned int prime_poly) {
 // For ECC200, index is 1.
 */
 
-INTERNAL void rs_init_code(rs_t *rs, const int nsym, int index) {
+/* Build the generator poly and its logs into `rspoly` and `log_rspoly`. Returns 1 if poly has a zero coeff */
+static int rs_gen_build(const rs_t *rs, unsigned char *rspoly, unsigned char *log_rspoly, const int nsym,
+            int index) {
     int i, k;
+    int zero = 0;
     const unsigned char *const logt = rs->logt;
     const unsigned char *const alog = rs->alog;
-    unsigned char *rspoly = rs->rspoly;
-    unsigned char *log_rspoly = rs->log_rspoly;
-
-    rs->nsym = nsym;
 
     rspoly[0] = 1;
     for (i = 1; i <= nsym; i++) {
@@ -125,10 +225,111 @@ INTERNAL void rs_init_code(rs_t *rs, const int nsym, int index) {
     }
 
     /* Set logs of poly and check if have zero coeffs */
-    rs->zero = 0;
     for (i = 0; i <= nsym; i++) {
         log_rspoly[i] = logt[rspoly[i]]; /* For simplicity allow log of 0 */
-        rs->zero |= rspoly[i] == 0;
+        zero |= rspoly[i] == 0;
+    }
+
+    return zero;
+}
+
+INTERNAL void rs_init_code(rs_t *rs, const int nsym, int index) {
+    rs->nsym = nsym;
+#ifndef RS_NO_GEN_CACHE
+    if (nsym >= 1 && nsym <= 256 && (index == 0 || index == 1)) {
+        unsigned short *const p_entry = &rs_gen_cache[rs->field][index][nsym - 1];
+        unsigned short entry = RS_GEN_LOAD(p_entry);
+
+        if (!entry) {
+            const long size = RS_GEN_SIZE(nsym);
+            long offset;
+            /* Check before claiming so that the count can't run away once the pool is full */
+            if (RS_GEN_USED() + size <= RS_GEN_POOL && (offset = RS_GEN_CLAIM(size)) + size <= RS_GEN_POOL) {
+                unsigned char *const gen = rs_gen_pool + offset;
+                gen[0] = (unsigned char) rs_gen_build(rs, gen + 1, gen + 1 + nsym + 1, nsym, index);
+                entry = (unsigned short) (offset + 1);
+                /* If lost race with another thread use theirs (space wasted) */
+                if (!RS_GEN_PUBLISH(p_entry, entry)) {
+                    entry = RS_GEN_LOAD(p_entry);
+                }
+            }
+        }
+        if (entry) {
+            const unsigned char *const gen = rs_gen_pool + entry - 1;
+            rs->zero = gen[0];
+            rs->rspoly = gen + 1;
+            rs->log_rspoly = gen + 1 + nsym + 1;
+            return;
+        }
+    }
+#endif
+    rs->zero = rs_gen_build(rs, rs->local, rs->local + nsym + 1, nsym, index);
+    rs->rspoly = rs->local;
+    rs->log_rspoly = rs->local + nsym + 1;
+}
+
+#ifdef ZINT_TEST
+/* Empties the generator cache (for use in testing, not thread-safe). Returns the size of the pool in bytes */
+INTERNAL int rs_gen_cache_reset(void) {
+#ifndef RS_NO_GEN_CACHE
+    memset(rs_gen_cache, 0, sizeof(rs_gen_cache));
+    rs_gen_used = 0;
+    return RS_GEN_POOL;
+#else
+    return 0;
+#endif
+}
+#endif
+
+/* Shift the register `reg` (with `reg[-1]` zero) up one and XOR in the 2 product table rows of `mul` selected by
+   the feedback `m`, going a vector at a time from the top down so that each chunk reads `reg[k - 1]` before it's
+   overwritten. `top` is the start of the last vector */
+static void rs_mul_step(const unsigned char *mul, const int len, unsigned char *reg, const unsigned int m,
+            const int top) {
+    const unsigned char *const lo = mul + (m & 0x0F) * len;
+    const unsigned char *const hi = mul + (16 + (m >> 4)) * len;
+    int k;
+
+    for (k = top; k >= 0; k -= 16) {
+#if defined(RS_SSE2)
+        const __m128i v = _mm_xor_si128(_mm_loadu_si128((const __m128i *) (lo + k)),
+                                        _mm_loadu_si128((const __m128i *) (hi + k)));
+        _mm_storeu_si128((__m128i *) (reg + k), _mm_xor_si128(_mm_loadu_si128((const __m128i *) (reg + k - 1)), v));
+#elif defined(RS_NEON)
+        vst1q_u8(reg + k, veorq_u8(vld1q_u8(reg + k - 1), veorq_u8(vld1q_u8(lo + k), vld1q_u8(hi + k))));
+#else
+        int j;
+        for (j = 15; j >= 0; j--) {
+            reg[k + j] = reg[k + j - 1] ^ lo[k + j] ^ hi[k + j];
+        }
+#endif
+    }
+}
+
+/* Encode using product tables set up on the fly, with either `data` or `data_uint` set, and either `res` or
+   `res_uint` */
+static void rs_encode_mul(const rs_t *rs, const int datalen, const unsigned char *data,
+            const unsigned int *data_uint, unsigned char *res, unsigned int *res_uint) {
+    const int nsym = rs->nsym;
+    const int len = RS_MUL_LEN(nsym);
+    const int top = (nsym - 1) & ~15;
+    unsigned char *const mul = (unsigned char *) z_alloca(32 * len);
+    unsigned char buf[16 + 256];
+    unsigned char *const reg = buf + 16; /* `reg[-1]` stays zero */
+    int i, k;
+
+    rs_init_mul(rs, mul, len);
+
+    memset(buf, 0, 16 + top + 16);
+    for (i = 0; i < datalen; i++) {
+        rs_mul_step(mul, len, reg, reg[nsym - 1] ^ (data ? data[i] : data_uint[i]), top);
+    }
+    if (res) {
+        memcpy(res, reg, nsym);
+    } else {
+        for (k = 0; k < nsym; k++) {
+            res_uint[k] = reg[k];
+        }
     }
 }
 
@@ -142,6 +343,10 @@ INTERNAL void rs_encode(const rs_t *rs, const int datalen, const unsigned char *
     const unsigned char *const log_rspoly = rs->log_rspoly;
     const int nsym = rs->nsym;
 
+    if (nsym >= RS_MUL_MIN_NSYM && datalen >= RS_MUL_MIN_DATALEN) {
+        rs_encode_mul(rs, datalen, data, NULL /*data_uint*/, res, NULL /*res_uint*/);
+        return;
+    }
     memset(res, 0, nsym);
     if (rs->zero) { /* Poly has a zero coeff so need to check in inner loop */
         for (i = 0; i < datalen; i++) {
@@ -187,6 +392,10 @@ INTERNAL void rs_encode_uint(const rs_t *rs, const int datalen, const unsigned i
     const unsigned char *const log_rspoly = rs->log_rspoly;
     const int nsym = rs->nsym;
 
+    if (nsym >= RS_MUL_MIN_NSYM && datalen >= RS_MUL_MIN_DATALEN) {
+        rs_encode_mul(rs, datalen, NULL /*data*/, data, NULL /*res*/, res);
+        return;
+    }
     memset(res, 0, sizeof(unsigned int) * nsym);
     if (rs->zero) { /* Poly has a zero coeff so need to check in inner loop */
         for (i = 0; i < datalen; i++) {
@@ -222,42 +431,120 @@ INTERNAL void rs_encode_uint(const rs_t *rs, const int datalen, const unsigned i
     }
 }
 
-/* Versions of the above for bitlengths > 8 and <= 30 and unsigned int data and results - Aztec code compatible */
+/* rs_encode_blocks(&rs, blocks, datalen, data, data_block_step, data_step, res, res_block_step, res_step) encodes
+ * `blocks` blocks of `datalen` codewords each, where codeword `i` of block `b` is
+ * `data[b * data_block_step + i * data_step]`, and places the nsym Reed-Solomon codes of each block in
+ * transmission order (i.e. not reversed) at `res[b * res_block_step + j * res_step]`, so blocks can be read from
+ * and written to their interleaved positions directly. Up to `RS_LANES` blocks are stepped through together so that
+ * their feedback latencies overlap */
+INTERNAL void rs_encode_blocks(const rs_t *rs, const int blocks, const int datalen, const unsigned char *data,
+                const int data_block_step, const int data_step, unsigned char *res, const int res_block_step,
+                const int res_step) {
+    const int nsym = rs->nsym;
+    const int len = RS_MUL_LEN(nsym);
+    const int top = (nsym - 1) & ~15;
+    unsigned char *mul = NULL;
+    unsigned char buf[RS_LANES][16 + 256];
+    int b, i, k, l;
+
+    if (nsym >= RS_MUL_MIN_NSYM && blocks * datalen >= RS_MUL_MIN_DATALEN) {
+        mul = (unsigned char *) z_alloca(32 * len);
+        rs_init_mul(rs, mul, len);
+    }
+
+    for (b = 0; b < blocks; b += RS_LANES) {
+        const int lanes = blocks - b < RS_LANES ? blocks - b : RS_LANES;
+        const unsigned char *const lane_data = data + b * data_block_step;
+        unsigned char *const lane_res = res + b * res_block_step;
+
+        for (l = 0; l < lanes; l++) {
+            memset(buf[l], 0, 16 + top + 16);
+        }
+        if (mul) {
+            for (i = 0; i < datalen; i++) {
+                for (l = 0; l < lanes; l++) {
+                    unsigned char *const reg = buf[l] + 16;
+                    rs_mul_step(mul, len, reg, reg[nsym - 1] ^ lane_data[l * data_block_step + i * data_step],
+                                top);
+                }
+            }
+        } else {
+            const unsigned char *const logt = rs->logt;
+            const unsigned char *const alog = rs->alog;
+            const unsigned char *const rspoly = rs->rspoly;
+            const unsigned char *const log_rspoly = rs->log_rspoly;
+            for (l = 0; l < lanes; l++) {
+                unsigned char *const reg = buf[l] + 16;
+                for (i = 0; i < datalen; i++) {
+                    const unsigned int m = reg[nsym - 1] ^ lane_data[l * data_block_step + i * data_step];
+                    for (k = nsym - 1; k >= 0; k--) {
+                        reg[k] = (unsigned char) (m && rspoly[k]
+                                    ? reg[k - 1] ^ alog[logt[m] + log_rspoly[k]] : reg[k - 1]);
+                    }
+                }
+            }
+        }
+        for (l = 0; l < lanes; l++) {
+            const unsigned char *const reg = buf[l] + 16;
+            for (k = 0; k < nsym; k++) {
+                lane_res[l * res_block_step + k * res_step] = reg[nsym - 1 - k];
+            }
+        }
+    }
+}
+
+/* Versions of the above for bitlengths > 8 and <= 12 and unsigned int data and results - Aztec code compatible.
+   The log/antilog tables are unsigned short, so would hold up to 16 bits, but `rs_uint_t.rspoly` is sized for 12 */
 
 /* Usage:
 // First call rs_uint_init_gf(&rs_uint, prime_poly, logmod) to set up the Galois Field parameters.
 // Then  call rs_uint_init_code(&rs_uint, nsym, index) to set the encoding size
 // Then  call rs_uint_encode(&rs_uint, datalen, data, out) to encode the data.
-// Then  call rs_uint_free(&rs_uint) to free the log tables.
+// Then  call rs_uint_free(&rs_uint) to free the log tables (if not static).
 */
 
-/* `logmod` (field characteristic) will be 2**bitlength - 1, eg 1023 for bitlength 10, 4095 for bitlength 12 */
+/* `logmod` (field characteristic) will be 2**bitlength - 1, eg 1023 for bitlength 10, 4095 for bitlength 12.
+   Uses static tables for the prime polys in "reedsol_logs.h", so only fails (returning 0) on malloc() failure for
+   others */
 INTERNAL int rs_uint_init_gf(rs_uint_t *rs_uint, const unsigned int prime_poly, const int logmod) {
     int b, p, v;
-    unsigned int *logt, *alog;
+    unsigned short *logt, *alog;
+
+    rs_uint->malloced = NULL;
+
+    /* To add a new prime poly of degree > 8 add its details to the table in `test_generate()` in
+       "backend/tests/test_reedsol.c" and regenerate the log tables as described in `rs_init_gf()` */
+    if (prime_poly == 0x409 && logmod == 1023) {
+        rs_uint->logt = logt_0x409;
+        rs_uint->alog = alog_0x409;
+        return 1;
+    }
+    if (prime_poly == 0x1069 && logmod == 4095) {
+        rs_uint->logt = logt_0x1069;
+        rs_uint->alog = alog_0x1069;
+        return 1;
+    }
 
     b = logmod + 1;
 
     rs_uint->logt = NULL;
     rs_uint->alog = NULL;
 
-    if (!(logt = (unsigned int *) calloc(b, sizeof(unsigned int)))) {
-        return 0;
-    }
-    if (!(alog = (unsigned int *) calloc(b * 2, sizeof(unsigned int)))) {
-        free(logt);
+    if (!(logt = (unsigned short *) z_calloc(b * 3, sizeof(unsigned short)))) {
         return 0;
     }
+    alog = logt + b;
 
     /* Calculate the log/alog tables */
     for (p = 1, v = 0; v < logmod; v++) {
-        alog[v] = p;
-        alog[logmod + v] = p; /* Double up, avoids mod */
-        logt[p] = v;
+        alog[v] = (unsigned short) p;
+        alog[logmod + v] = (unsigned short) p; /* Double up, avoids mod */
+        logt[p] = (unsigned short) v;
         p <<= 1;
         if (p & b) /* If overflow */
             p ^= prime_poly; /* Subtract prime poly */
     }
+    rs_uint->malloced = logt;
     rs_uint->logt = logt;
     rs_uint->alog = alog;
     return 1;
@@ -265,8 +552,8 @@ INTERNAL int rs_uint_init_gf(rs_uint_t *rs_uint, const unsigned int prime_poly,
 
 INTERNAL void rs_uint_init_code(rs_uint_t *rs_uint, const int nsym, int index) {
     int i, k;
-    const unsigned int *const logt = rs_uint->logt;
-    const unsigned int *const alog = rs_uint->alog;
+    const unsigned short *const logt = rs_uint->logt;
+    const unsigned short *const alog = rs_uint->alog;
     unsigned short *rspoly = rs_uint->rspoly;
     unsigned int *log_rspoly = rs_uint->log_rspoly;
 
@@ -298,8 +585,8 @@ INTERNAL void rs_uint_init_code(rs_uint_t *rs_uint, const int nsym, int index) {
 INTERNAL void rs_uint_encode(const rs_uint_t *rs_uint, const int datalen, const unsigned int *data,
                 unsigned int *res) {
     int i, k;
-    const unsigned int *const logt = rs_uint->logt;
-    const unsigned int *const alog = rs_uint->alog;
+    const unsigned short *const logt = rs_uint->logt;
+    const unsigned short *const alog = rs_uint->alog;
     const unsigned short *const rspoly = rs_uint->rspoly;
     const unsigned int *const log_rspoly = rs_uint->log_rspoly;
     const int nsym = rs_uint->nsym;
@@ -343,14 +630,12 @@ INTERNAL void rs_uint_encode(const rs_uint_t *rs_uint, const int datalen, const
 }
 
 INTERNAL void rs_uint_free(rs_uint_t *rs_uint) {
-    if (rs_uint->logt) {
-        free(rs_uint->logt);
-        rs_uint->logt = NULL;
-    }
-    if (rs_uint->alog) {
-        free(rs_uint->alog);
-        rs_uint->alog = NULL;
+    if (rs_uint->malloced) {
+        z_free(rs_uint->malloced);
+        rs_uint->malloced = NULL;
     }
+    rs_uint->logt = NULL;
+    rs_uint->alog = NULL;
 }
 
 /* vim: set ts=4 sw=4 et : */
@@ -44,15 +44,19 @@ extern "C" {
 typedef struct {
     const unsigned char *logt; /* These are static */
     const unsigned char *alog;
-    unsigned char rspoly[256]; /* Generated poly */
-    unsigned char log_rspoly[256]; /* Logs of poly */
+    const unsigned char *rspoly; /* Generated poly, either cached or in `local` */
+    const unsigned char *log_rspoly; /* Logs of poly, ditto */
+    unsigned int prime_poly; /* Field's characteristic poly */
+    int field; /* Index of field in generator cache */
     int nsym; /* Degree of poly */
     int zero; /* Set if poly has a zero coeff */
+    unsigned char local[2 * 257]; /* Poly and logs of poly if not cached */
 } rs_t;
 
 typedef struct {
-    unsigned int *logt; /* These are malloced */
-    unsigned int *alog;
+    const unsigned short *logt; /* Static if prime poly in "reedsol_logs.h", else in `malloced` */
+    const unsigned short *alog;
+    unsigned short *malloced; /* Runtime generated log/antilog tables (if any) */
     unsigned short rspoly[4096]; /* Generated poly, 12-bit max - needs to be enlarged if > 12-bit used */
     unsigned int log_rspoly[4096]; /* Logs of poly */
     int nsym; /* Degree of poly */
@@ -63,6 +67,9 @@ INTERNAL void rs_init_gf(rs_t *rs, const unsigned int prime_poly);
 INTERNAL void rs_init_code(rs_t *rs, const int nsym, int index);
 INTERNAL void rs_encode(const rs_t *rs, const int datalen, const unsigned char *data, unsigned char *res);
 INTERNAL void rs_encode_uint(const rs_t *rs, const int datalen, const unsigned int *data, unsigned int *res);
+INTERNAL void rs_encode_blocks(const rs_t *rs, const int blocks, const int datalen, const unsigned char *data,
+                const int data_block_step, const int data_step, unsigned char *res, const int res_block_step,
+                const int res_step);
 /* No free needed as log tables static */
 
 INTERNAL int rs_uint_init_gf(rs_uint_t *rs_uint, const unsigned int prime_poly, const int logmod);
@@ -71,6 +78,11 @@ INTERNAL void rs_uint_encode(const rs_uint_t *rs_uint, const int datalen, const
                 unsigned int *res);
 INTERNAL void rs_uint_free(rs_uint_t *rs_uint);
 
+#ifdef ZINT_TEST
+/* Empties the generator cache (for use in testing, not thread-safe). Returns the size of the pool in bytes */
+INTERNAL int rs_gen_cache_reset(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -370,82 +370,76 @@ static const unsigned short sjis_uro_mb_ind[1307] = {
      6785,  6786,  6789,
 };
 
-/* Unicode codepoints sorted */
-static const unsigned short sjis_u[588] = {
-    0x005C, 0x00A2, 0x00A3, 0x00A5, 0x00A7, 0x00A8, 0x00AC, 0x00B0,
-    0x00B1, 0x00B4, 0x00B6, 0x00D7, 0x00F7, 0x0391, 0x0392, 0x0393,
-    0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039A, 0x039B,
-    0x039C, 0x039D, 0x039E, 0x039F, 0x03A0, 0x03A1, 0x03A3, 0x03A4,
-    0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x03B1, 0x03B2, 0x03B3,
-    0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB,
-    0x03BC, 0x03BD, 0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C3, 0x03C4,
-    0x03C5, 0x03C6, 0x03C7, 0x03C8, 0x03C9, 0x0401, 0x0410, 0x0411,
-    0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417, 0x0418, 0x0419,
-    0x041A, 0x041B, 0x041C, 0x041D, 0x041E, 0x041F, 0x0420, 0x0421,
-    0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429,
-    0x042A, 0x042B, 0x042C, 0x042D, 0x042E, 0x042F, 0x0430, 0x0431,
-    0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0439,
-    0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F, 0x0440, 0x0441,
-    0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449,
-    0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F, 0x0451, 0x2010,
-    0x2015, 0x2016, 0x2018, 0x2019, 0x201C, 0x201D, 0x2020, 0x2021,
-    0x2025, 0x2026, 0x2030, 0x2032, 0x2033, 0x203B, 0x203E, 0x2103,
-    0x212B, 0x2190, 0x2191, 0x2192, 0x2193, 0x21D2, 0x21D4, 0x2200,
-    0x2202, 0x2203, 0x2207, 0x2208, 0x220B, 0x2212, 0x221A, 0x221D,
-    0x221E, 0x2220, 0x2227, 0x2228, 0x2229, 0x222A, 0x222B, 0x222C,
-    0x2234, 0x2235, 0x223D, 0x2252, 0x2260, 0x2261, 0x2266, 0x2267,
-    0x226A, 0x226B, 0x2282, 0x2283, 0x2286, 0x2287, 0x22A5, 0x2312,
-    0x2500, 0x2501, 0x2502, 0x2503, 0x250C, 0x250F, 0x2510, 0x2513,
-    0x2514, 0x2517, 0x2518, 0x251B, 0x251C, 0x251D, 0x2520, 0x2523,
-    0x2524, 0x2525, 0x2528, 0x252B, 0x252C, 0x252F, 0x2530, 0x2533,
-    0x2534, 0x2537, 0x2538, 0x253B, 0x253C, 0x253F, 0x2542, 0x254B,
-    0x25A0, 0x25A1, 0x25B2, 0x25B3, 0x25BC, 0x25BD, 0x25C6, 0x25C7,
-    0x25CB, 0x25CE, 0x25CF, 0x25EF, 0x2605, 0x2606, 0x2640, 0x2642,
-    0x266A, 0x266D, 0x266F, 0x3000, 0x3001, 0x3002, 0x3003, 0x3005,
-    0x3006, 0x3007, 0x3008, 0x3009, 0x300A, 0x300B, 0x300C, 0x300D,
-    0x300E, 0x300F, 0x3010, 0x3011, 0x3012, 0x3013, 0x3014, 0x3015,
-    0x301C, 0x3041, 0x3042, 0x3043, 0x3044, 0x3045, 0x3046, 0x3047,
-    0x3048, 0x3049, 0x304A, 0x304B, 0x304C, 0x304D, 0x304E, 0x304F,
-    0x3050, 0x3051, 0x3052, 0x3053, 0x3054, 0x3055, 0x3056, 0x3057,
-    0x3058, 0x3059, 0x305A, 0x305B, 0x305C, 0x305D, 0x305E, 0x305F,
-    0x3060, 0x3061, 0x3062, 0x3063, 0x3064, 0x3065, 0x3066, 0x3067,
-    0x3068, 0x3069, 0x306A, 0x306B, 0x306C, 0x306D, 0x306E, 0x306F,
-    0x3070, 0x3071, 0x3072, 0x3073, 0x3074, 0x3075, 0x3076, 0x3077,
-    0x3078, 0x3079, 0x307A, 0x307B, 0x307C, 0x307D, 0x307E, 0x307F,
-    0x3080, 0x3081, 0x3082, 0x3083, 0x3084, 0x3085, 0x3086, 0x3087,
-    0x3088, 0x3089, 0x308A, 0x308B, 0x308C, 0x308D, 0x308E, 0x308F,
-    0x3090, 0x3091, 0x3092, 0x3093, 0x309B, 0x309C, 0x309D, 0x309E,
-    0x30A1, 0x30A2, 0x30A3, 0x30A4, 0x30A5, 0x30A6, 0x30A7, 0x30A8,
-    0x30A9, 0x30AA, 0x30AB, 0x30AC, 0x30AD, 0x30AE, 0x30AF, 0x30B0,
-    0x30B1, 0x30B2, 0x30B3, 0x30B4, 0x30B5, 0x30B6, 0x30B7, 0x30B8,
-    0x30B9, 0x30BA, 0x30BB, 0x30BC, 0x30BD, 0x30BE, 0x30BF, 0x30C0,
-    0x30C1, 0x30C2, 0x30C3, 0x30C4, 0x30C5, 0x30C6, 0x30C7, 0x30C8,
-    0x30C9, 0x30CA, 0x30CB, 0x30CC, 0x30CD, 0x30CE, 0x30CF, 0x30D0,
-    0x30D1, 0x30D2, 0x30D3, 0x30D4, 0x30D5, 0x30D6, 0x30D7, 0x30D8,
-    0x30D9, 0x30DA, 0x30DB, 0x30DC, 0x30DD, 0x30DE, 0x30DF, 0x30E0,
-    0x30E1, 0x30E2, 0x30E3, 0x30E4, 0x30E5, 0x30E6, 0x30E7, 0x30E8,
-    0x30E9, 0x30EA, 0x30EB, 0x30EC, 0x30ED, 0x30EE, 0x30EF, 0x30F0,
-    0x30F1, 0x30F2, 0x30F3, 0x30F4, 0x30F5, 0x30F6, 0x30FB, 0x30FC,
-    0x30FD, 0x30FE, 0xFF01, 0xFF03, 0xFF04, 0xFF05, 0xFF06, 0xFF08,
-    0xFF09, 0xFF0A, 0xFF0B, 0xFF0C, 0xFF0E, 0xFF0F, 0xFF10, 0xFF11,
-    0xFF12, 0xFF13, 0xFF14, 0xFF15, 0xFF16, 0xFF17, 0xFF18, 0xFF19,
-    0xFF1A, 0xFF1B, 0xFF1C, 0xFF1D, 0xFF1E, 0xFF1F, 0xFF20, 0xFF21,
-    0xFF22, 0xFF23, 0xFF24, 0xFF25, 0xFF26, 0xFF27, 0xFF28, 0xFF29,
-    0xFF2A, 0xFF2B, 0xFF2C, 0xFF2D, 0xFF2E, 0xFF2F, 0xFF30, 0xFF31,
-    0xFF32, 0xFF33, 0xFF34, 0xFF35, 0xFF36, 0xFF37, 0xFF38, 0xFF39,
-    0xFF3A, 0xFF3B, 0xFF3D, 0xFF3E, 0xFF3F, 0xFF40, 0xFF41, 0xFF42,
-    0xFF43, 0xFF44, 0xFF45, 0xFF46, 0xFF47, 0xFF48, 0xFF49, 0xFF4A,
-    0xFF4B, 0xFF4C, 0xFF4D, 0xFF4E, 0xFF4F, 0xFF50, 0xFF51, 0xFF52,
-    0xFF53, 0xFF54, 0xFF55, 0xFF56, 0xFF57, 0xFF58, 0xFF59, 0xFF5A,
-    0xFF5B, 0xFF5C, 0xFF5D, 0xFF61, 0xFF62, 0xFF63, 0xFF64, 0xFF65,
-    0xFF66, 0xFF67, 0xFF68, 0xFF69, 0xFF6A, 0xFF6B, 0xFF6C, 0xFF6D,
-    0xFF6E, 0xFF6F, 0xFF70, 0xFF71, 0xFF72, 0xFF73, 0xFF74, 0xFF75,
-    0xFF76, 0xFF77, 0xFF78, 0xFF79, 0xFF7A, 0xFF7B, 0xFF7C, 0xFF7D,
-    0xFF7E, 0xFF7F, 0xFF80, 0xFF81, 0xFF82, 0xFF83, 0xFF84, 0xFF85,
-    0xFF86, 0xFF87, 0xFF88, 0xFF89, 0xFF8A, 0xFF8B, 0xFF8C, 0xFF8D,
-    0xFF8E, 0xFF8F, 0xFF90, 0xFF91, 0xFF92, 0xFF93, 0xFF94, 0xFF95,
-    0xFF96, 0xFF97, 0xFF98, 0xFF99, 0xFF9A, 0xFF9B, 0xFF9C, 0xFF9D,
-    0xFF9E, 0xFF9F, 0xFFE3, 0xFFE5,
+/* Page (U+xx00-xxFF) blocks of `sjis_page_u[]` & `sjis_page_mb_ind[]`, 1-based, 0 if none */
+static const unsigned char sjis_page[256] = {
+      1,   0,   0,   2,   3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      4,   5,   6,   7,   0,   8,   9,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+     10,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  11,
+};
+
+/* Unicode usage bit-flags for pages in blocks of 16 */
+static const unsigned short sjis_page_u[176] = {
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x11AC, 0x0053, 0x0000, 0x0080, 0x0000, 0x0080,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xFFFE, 0x03FB, 0xFFFE, 0x03FB, 0x0000, 0x0000, 0x0000,
+    0x0002, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0002, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x3361, 0x0063, 0x480D, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0008, 0x0000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x000F, 0x0000, 0x0000, 0x0000, 0x0014, 0x0000, 0x0000,
+    0x098D, 0x6404, 0x1F81, 0x2030, 0x0000, 0x0004, 0x0CC3, 0x0000,
+    0x00CC, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x900F, 0x3999, 0x9939, 0x9999, 0x0804, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0003, 0x300C, 0xC8C0, 0x0000, 0x8000, 0x0000,
+    0x0060, 0x0000, 0x0000, 0x0000, 0x0005, 0x0000, 0xA400, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xFFEF, 0x103F, 0x0000, 0x0000, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x780F, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x787F,
+    0xDF7A, 0xFFFF, 0xFFFF, 0xEFFF, 0xFFFF, 0x3FFF, 0xFFFE, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0028, 0x0000,
+};
+
+/* Multibyte indexes for pages in blocks of 16 */
+static const unsigned short sjis_page_mb_ind[176] = {
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     1,     7,     0,    11,     0,    12,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,    13,    28,    37,    52,     0,     0,     0,
+       61,    62,    78,    94,   110,   126,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,   127,   134,   138,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+      143,     0,   144,     0,     0,     0,     0,     0,
+        0,   145,     0,     0,     0,   149,     0,     0,
+      151,   157,   161,   168,     0,   171,   172,     0,
+      178,     0,   182,     0,     0,     0,     0,     0,
+        0,   183,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+      184,   190,   198,   206,   214,     0,     0,     0,
+        0,     0,   216,   218,   222,     0,   227,     0,
+      228,     0,     0,     0,   230,     0,   232,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+      235,   250,     0,     0,   257,   272,   288,   304,
+      320,   336,   344,   359,   375,   391,   407,   423,
+     6790,  6802,  6818,  6834,  6849,  6865,  6879,  6894,
+     6910,  6926,     0,     0,     0,     0,  6942,     0,
 };
 
 /* Multibyte values sorted in Unicode order */
@@ -31,11 +31,11 @@
 /* SPDX-License-Identifier: BSD-3-Clause */
 
 #include <errno.h>
-#include <locale.h>
 #include <math.h>
 #include <stdio.h>
 
 #include "common.h"
+#include "filemem.h"
 #include "output.h"
 
 static void pick_colour(int colour, char colour_code[]) {
@@ -114,9 +114,9 @@ static void make_html_friendly(unsigned char *string, char *html_version) {
 
 INTERNAL int svg_plot(struct zint_symbol *symbol) {
     static const char font_family[] = "Helvetica, sans-serif";
-    FILE *fsvg;
+    struct filemem fm;
+    struct filemem *const fmp = &fm;
     int error_number = 0;
-    const char *locale = NULL;
     float ax, ay, bx, by, cx, cy, dx, dy, ex, ey, fx, fy;
     float previous_diameter;
     float radius, half_radius, half_sqrt3_radius;
@@ -173,49 +173,56 @@ INTERNAL int svg_plot(struct zint_symbol *symbol) {
         strcpy(symbol->errtxt, "681: Vector header NULL");
         return ZINT_ERROR_INVALID_DATA;
     }
-    if (output_to_stdout) {
-        fsvg = stdout;
-    } else {
-        if (!(fsvg = out_fopen(symbol->outfile, "w"))) {
-            sprintf(symbol->errtxt, "680: Could not open output file (%d: %.30s)", errno, strerror(errno));
-            return ZINT_ERROR_FILE_ACCESS;
-        }
+    if (!fm_open(fmp, symbol, "w")) {
+        sprintf(symbol->errtxt, "680: Could not open output file (%d: %.30s)", errno, strerror(errno));
+        return ZINT_ERROR_FILE_ACCESS;
     }
 
-    locale = setlocale(LC_ALL, "C");
-
     /* Start writing the header */
-    fputs("<?xml version=\"1.0\" standalone=\"no\"?>\n"
-          "<!DOCTYPE svg PUBLIC \"-//W3C//DTD SVG 1.1//EN\"\n"
-          "   \"http://www.w3.org/Graphics/SVG/1.1/DTD/svg11.dtd\">\n", fsvg);
-    fprintf(fsvg, "<svg width=\"%d\" height=\"%d\" version=\"1.1\"\n",
-            (int) ceilf(symbol->vector->width), (int) ceilf(symbol->vector->height));
-    fputs("   xmlns=\"http://www.w3.org/2000/svg\">\n"
-          "   <desc>Zint Generated Symbol\n"
-          "   </desc>\n", fsvg);
-    fprintf(fsvg, "\n   <g id=\"barcode\" fill=\"#%s\">\n", fgcolour_string);
+    fm_puts("<?xml version=\"1.0\" standalone=\"no\"?>\n"
+            "<!DOCTYPE svg PUBLIC \"-//W3C//DTD SVG 1.1//EN\"\n"
+            "   \"http://www.w3.org/Graphics/SVG/1.1/DTD/svg11.dtd\">\n", fmp);
+    fm_putsi("<svg width=\"", (int) ceilf(symbol->vector->width), fmp);
+    fm_putsi("\" height=\"", (int) ceilf(symbol->vector->height), fmp);
+    fm_puts("\" version=\"1.1\"\n"
+            "   xmlns=\"http://www.w3.org/2000/svg\">\n"
+            "   <desc>Zint Generated Symbol\n"
+            "   </desc>\n", fmp);
+    fm_puts("\n   <g id=\"barcode\" fill=\"#", fmp);
+    fm_puts(fgcolour_string, fmp);
+    fm_puts("\">\n", fmp);
 
     if (bg_alpha != 0) {
-        fprintf(fsvg, "      <rect x=\"0\" y=\"0\" width=\"%d\" height=\"%d\" fill=\"#%s\"",
-                (int) ceilf(symbol->vector->width), (int) ceilf(symbol->vector->height), bgcolour_string);
+        fm_putsi("      <rect x=\"0\" y=\"0\" width=\"", (int) ceilf(symbol->vector->width), fmp);
+        fm_putsi("\" height=\"", (int) ceilf(symbol->vector->height), fmp);
+        fm_puts("\" fill=\"#", fmp);
+        fm_puts(bgcolour_string, fmp);
+        fm_putc('"', fmp);
         if (bg_alpha != 0xff) {
-            fprintf(fsvg, " opacity=\"%.3f\"", bg_alpha_opacity);
+            fm_putsf(" opacity=\"", 3, bg_alpha_opacity, fmp);
+            fm_putc('"', fmp);
         }
-        fputs(" />\n", fsvg);
+        fm_puts(" />\n", fmp);
     }
 
     rect = symbol->vector->rectangles;
     while (rect) {
-        fprintf(fsvg, "      <rect x=\"%.2f\" y=\"%.2f\" width=\"%.2f\" height=\"%.2f\"",
-                rect->x, rect->y, rect->width, rect->height);
+        fm_putsf("      <rect x=\"", 2, rect->x, fmp);
+        fm_putsf("\" y=\"", 2, rect->y, fmp);
+        fm_putsf("\" width=\"", 2, rect->width, fmp);
+        fm_putsf("\" height=\"", 2, rect->height, fmp);
+        fm_putc('"', fmp);
         if (rect->colour != -1) {
             pick_colour(rect->colour, colour_code);
-            fprintf(fsvg, " fill=\"#%s\"", colour_code);
+            fm_puts(" fill=\"#", fmp);
+            fm_puts(colour_code, fmp);
+            fm_putc('"', fmp);
         }
         if (fg_alpha != 0xff) {
-            fprintf(fsvg, " opacity=\"%.3f\"", fg_alpha_opacity);
+            fm_putsf(" opacity=\"", 3, fg_alpha_opacity, fmp);
+            fm_putc('"', fmp);
         }
-        fputs(" />\n", fsvg);
+        fm_puts(" />\n", fmp);
         rect = rect->next;
     }
 
@@ -255,12 +262,24 @@ INTERNAL int svg_plot(struct zint_symbol *symbol) {
             ex = hex->x + half_radius;
             fx = hex->x - half_radius;
         }
-        fprintf(fsvg, "      <path d=\"M %.2f %.2f L %.2f %.2f L %.2f %.2f L %.2f %.2f L %.2f %.2f L %.2f %.2f Z\"",
-                ax, ay, bx, by, cx, cy, dx, dy, ex, ey, fx, fy);
+        fm_putsf("      <path d=\"M ", 2, ax, fmp);
+        fm_putsf(" ", 2, ay, fmp);
+        fm_putsf(" L ", 2, bx, fmp);
+        fm_putsf(" ", 2, by, fmp);
+        fm_putsf(" L ", 2, cx, fmp);
+        fm_putsf(" ", 2, cy, fmp);
+        fm_putsf(" L ", 2, dx, fmp);
+        fm_putsf(" ", 2, dy, fmp);
+        fm_putsf(" L ", 2, ex, fmp);
+        fm_putsf(" ", 2, ey, fmp);
+        fm_putsf(" L ", 2, fx, fmp);
+        fm_putsf(" ", 2, fy, fmp);
+        fm_puts(" Z\"", fmp);
         if (fg_alpha != 0xff) {
-            fprintf(fsvg, " opacity=\"%.3f\"", fg_alpha_opacity);
+            fm_putsf(" opacity=\"", 3, fg_alpha_opacity, fmp);
+            fm_putc('"', fmp);
         }
-        fputs(" />\n", fsvg);
+        fm_puts(" />\n", fmp);
         hex = hex->next;
     }
 
@@ -271,28 +290,40 @@ INTERNAL int svg_plot(struct zint_symbol *symbol) {
             previous_diameter = circle->diameter;
             radius = (float) (0.5 * previous_diameter);
         }
-        fprintf(fsvg, "      <circle cx=\"%.2f\" cy=\"%.2f\" r=\"%.*f\"",
-                circle->x, circle->y, circle->width ? 3 : 2, radius);
+        fm_putsf("      <circle cx=\"", 2, circle->x, fmp);
+        fm_putsf("\" cy=\"", 2, circle->y, fmp);
+        fm_putsf("\" r=\"", circle->width ? 3 : 2, radius, fmp);
+        fm_putc('"', fmp);
 
         if (circle->colour) { /* Legacy - no longer used */
             if (circle->width) {
-                fprintf(fsvg, " stroke=\"#%s\" stroke-width=\"%.3f\" fill=\"none\"", bgcolour_string, circle->width);
+                fm_puts(" stroke=\"#", fmp);
+                fm_puts(bgcolour_string, fmp);
+                fm_putsf("\" stroke-width=\"", 3, circle->width, fmp);
+                fm_puts("\" fill=\"none\"", fmp);
             } else {
-                fprintf(fsvg, " fill=\"#%s\"", bgcolour_string);
+                fm_puts(" fill=\"#", fmp);
+                fm_puts(bgcolour_string, fmp);
+                fm_putc('"', fmp);
             }
             if (bg_alpha != 0xff) {
                 /* This doesn't work how the user is likely to expect - more work needed! */
-                fprintf(fsvg, " opacity=\"%.3f\"", bg_alpha_opacity);
+                fm_putsf(" opacity=\"", 3, bg_alpha_opacity, fmp);
+                fm_putc('"', fmp);
             }
         } else {
             if (circle->width) {
-                fprintf(fsvg, " stroke=\"#%s\" stroke-width=\"%.3f\" fill=\"none\"", fgcolour_string, circle->width);
+                fm_puts(" stroke=\"#", fmp);
+                fm_puts(fgcolour_string, fmp);
+                fm_putsf("\" stroke-width=\"", 3, circle->width, fmp);
+                fm_puts("\" fill=\"none\"", fmp);
             }
             if (fg_alpha != 0xff) {
-                fprintf(fsvg, " opacity=\"%.3f\"", fg_alpha_opacity);
+                fm_putsf(" opacity=\"", 3, fg_alpha_opacity, fmp);
+                fm_putc('"', fmp);
             }
         }
-        fputs(" />\n", fsvg);
+        fm_puts(" />\n", fmp);
         circle = circle->next;
     }
 
@@ -300,48 +331,53 @@ INTERNAL int svg_plot(struct zint_symbol *symbol) {
     string = symbol->vector->strings;
     while (string) {
         const char *const halign = string->halign == 2 ? "end" : string->halign == 1 ? "start" : "middle";
-        fprintf(fsvg, "      <text x=\"%.2f\" y=\"%.2f\" text-anchor=\"%s\"\n", string->x, string->y, halign);
-        fprintf(fsvg, "         font-family=\"%s\" font-size=\"%.1f\"", font_family, string->fsize);
+        fm_putsf("      <text x=\"", 2, string->x, fmp);
+        fm_putsf("\" y=\"", 2, string->y, fmp);
+        fm_puts("\" text-anchor=\"", fmp);
+        fm_puts(halign, fmp);
+        fm_puts("\"\n         font-family=\"", fmp);
+        fm_puts(font_family, fmp);
+        fm_putsf("\" font-size=\"", 1, string->fsize, fmp);
+        fm_putc('"', fmp);
         if (bold) {
-            fputs(" font-weight=\"bold\"", fsvg);
+            fm_puts(" font-weight=\"bold\"", fmp);
         }
         if (fg_alpha != 0xff) {
-            fprintf(fsvg, " opacity=\"%.3f\"", fg_alpha_opacity);
+            fm_putsf(" opacity=\"", 3, fg_alpha_opacity, fmp);
+            fm_putc('"', fmp);
         }
         if (string->rotation != 0) {
-            fprintf(fsvg, " transform=\"rotate(%d,%.2f,%.2f)\"", string->rotation, string->x, string->y);
+            fm_putsi(" transform=\"rotate(", string->rotation, fmp);
+            fm_putsf(",", 2, string->x, fmp);
+            fm_putsf(",", 2, string->y, fmp);
+            fm_puts(")\"", fmp);
         }
-        fputs(" >\n", fsvg);
+        fm_puts(" >\n", fmp);
         make_html_friendly(string->text, html_string);
-        fprintf(fsvg, "         %s\n", html_string);
-        fputs("      </text>\n", fsvg);
+        fm_puts("         ", fmp);
+        fm_puts(html_string, fmp);
+        fm_puts("\n      </text>\n", fmp);
         string = string->next;
     }
 
-    fputs("   </g>\n"
-          "</svg>\n", fsvg);
+    fm_puts("   </g>\n"
+            "</svg>\n", fmp);
 
-    if (locale)
-        setlocale(LC_ALL, locale);
-
-    if (ferror(fsvg)) {
-        sprintf(symbol->errtxt, "682: Incomplete write to output (%d: %.30s)", errno, strerror(errno));
-        if (!output_to_stdout) {
-            (void) fclose(fsvg);
-        }
+    if (fm_error(fmp)) {
+        sprintf(symbol->errtxt, "682: Incomplete write to output (%d: %.30s)", fm_error(fmp),
+                strerror(fm_error(fmp)));
+        fm_discard(fmp, symbol);
         return ZINT_ERROR_FILE_WRITE;
     }
 
-    if (output_to_stdout) {
-        if (fflush(fsvg) != 0) {
-            sprintf(symbol->errtxt, "683: Incomplete flush to output (%d: %.30s)", errno, strerror(errno));
-            return ZINT_ERROR_FILE_WRITE;
-        }
-    } else {
-        if (fclose(fsvg) != 0) {
-            sprintf(symbol->errtxt, "684: Failure on closing output file (%d: %.30s)", errno, strerror(errno));
-            return ZINT_ERROR_FILE_WRITE;
+    if (!fm_close(fmp, symbol)) {
+        if (output_to_stdout) {
+            sprintf(symbol->errtxt, "683: Incomplete flush to output (%d: %.30s)", fmp->err, strerror(fmp->err));
+        } else {
+            sprintf(symbol->errtxt, "684: Failure on closing output file (%d: %.30s)", fmp->err,
+                    strerror(fmp->err));
         }
+        return ZINT_ERROR_FILE_WRITE;
     }
 
     return error_number;
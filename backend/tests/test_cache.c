@@ -0,0 +1,529 @@
+/*
+    libzint - the open source barcode library
+    Copyright (C) 2023 Robin Stuart <rstuart114@gmail.com>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+    3. Neither the name of the project nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+ */
+/* SPDX-License-Identifier: BSD-3-Clause */
+
+
+#include "testcommon.h"
+
+/* Encode `data` into a new symbol (compact if `compact`) using `cache` */
+static struct zint_symbol *encode_symbol(const struct zint_cache *cache, int symbology, int input_mode,
+            int option_1, int option_2, int output_options, const char *primary, const char *data, int compact,
+            int *p_ret, int debug) {
+    struct zint_symbol *symbol = compact ? ZBarcode_Create_Compact() : ZBarcode_Create();
+    int length;
+
+    if (!symbol) return NULL;
+
+    length = testUtilSetSymbol(symbol, symbology, input_mode, -1 /*eci*/, option_1, option_2, -1,
+                output_options, data, -1, debug);
+    if (primary && primary[0]) {
+        strcpy(symbol->primary, primary);
+    }
+    symbol->cache = (struct zint_cache *) cache;
+
+    *p_ret = ZBarcode_Encode(symbol, TU(data), length);
+
+    return symbol;
+}
+
+/* Compare the encode results of `a` and `b` */
+static int encode_cmp(const struct zint_symbol *a, const struct zint_symbol *b) {
+    int ret;
+
+    if ((ret = testUtilSymbolCmp(a, b))) {
+        return ret;
+    }
+    if (a->option_1 != b->option_1 || a->option_2 != b->option_2 || a->option_3 != b->option_3) {
+        return 20;
+    }
+    if (strcmp((const char *) a->text, (const char *) b->text) != 0) {
+        return 21;
+    }
+    if (memcmp(a->row_height, b->row_height, sizeof(float) * a->rows) != 0) {
+        return 22;
+    }
+    if (strcmp(a->errtxt, b->errtxt) != 0) {
+        return 23;
+    }
+    if (strcmp(a->primary, b->primary) != 0) {
+        return 24;
+    }
+
+    return 0;
+}
+
+static void test_encode(const testCtx *const p_ctx) {
+    int debug = p_ctx->debug;
+
+    struct item {
+        int symbology;
+        int input_mode;
+        int option_1;
+        int option_2;
+        int output_options;
+        const char *primary;
+        const char *data;
+        int compact;
+        int ret;
+        int expected_hits;
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    struct item data[] = {
+        /*  0*/ { BARCODE_CODE128, -1, -1, -1, -1, "", "1234567890", 0, 0, 1 },
+        /*  1*/ { BARCODE_CODE128, -1, -1, -1, -1, "", "1234567890", 1, 0, 1 },
+        /*  2*/ { BARCODE_EANX, -1, -1, -1, -1, "", "123456789012", 0, 0, 1 },
+        /*  3*/ { BARCODE_EANX, -1, -1, -1, -1, "", "12345678901", 1, 0, 1 },
+        /*  4*/ { BARCODE_QRCODE, UNICODE_MODE, 2, -1, -1, "", "€1234", 0, ZINT_WARN_USES_ECI, 1 },
+        /*  5*/ { BARCODE_QRCODE, UNICODE_MODE, 2, -1, -1, "", "€1234", 1, ZINT_WARN_USES_ECI, 1 },
+        /*  6*/ { BARCODE_DATAMATRIX, GS1_MODE, -1, -1, -1, "", "[01]12345678901231[10]AB", 1, 0, 1 },
+        /*  7*/ { BARCODE_PDF417, -1, -1, -1, -1, "", "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789", 0, 0, 1 },
+        /*  8*/ { BARCODE_MAXICODE, -1, 2, -1, -1, "152382802840001", "Maxi", 0, 0, 1 },
+        /*  9*/ { BARCODE_ULTRA, -1, -1, -1, -1, "", "ULTRACODE_123456789!", 0, 0, 1 },
+        /* 10*/ { BARCODE_ULTRA, -1, -1, -1, -1, "", "ULTRACODE_123456789!", 1, 0, 1 },
+        /* 11*/ { BARCODE_EANX_CC, -1, 1, -1, -1, "331234567890", "[91]12345678901234567890", 1, 0, 1 },
+        /* 12*/ { BARCODE_DBAR_EXPSTK, -1, -1, 2, -1, "", "[01]98898765432106[3202]012345[15]991231", 0, 0, 1 },
+        /* 13*/ { BARCODE_CODE39, -1, -1, -1, -1, "", "!", 0, ZINT_ERROR_INVALID_DATA, 0 }, /* Errors not cached */
+        /* 14*/ { 10, -1, -1, -1, -1, "", "12345", 0, 0, 1 }, /* Legacy symbology mapped */
+        /* 15*/ { 0, -1, -1, -1, -1, "", "12345", 0, ZINT_WARN_INVALID_OPTION, 1 }, /* Warning cached */
+        /* 16*/ { BARCODE_CODE128, ESCAPE_MODE, -1, -1, -1, "", "\\d0651234", 1, 0, 1 },
+    };
+    int data_size = ARRAY_SIZE(data);
+    int i, ret;
+    struct zint_symbol *symbol_ref, *symbol1, *symbol2;
+    struct zint_cache *cache;
+    struct zint_cache_stats stats;
+
+    testStart("test_encode");
+
+    for (i = 0; i < data_size; i++) {
+
+        if (testContinue(p_ctx, i)) continue;
+
+        cache = ZBarcode_Cache_Create(0);
+        assert_nonnull(cache, "i:%d ZBarcode_Cache_Create NULL\n", i);
+
+        symbol_ref = encode_symbol(NULL, data[i].symbology, data[i].input_mode, data[i].option_1, data[i].option_2,
+                        data[i].output_options, data[i].primary, data[i].data, data[i].compact, &ret, debug);
+        assert_nonnull(symbol_ref, "i:%d symbol_ref not created\n", i);
+        assert_equal(ret, data[i].ret, "i:%d ZBarcode_Encode ret %d != %d (%s)\n",
+                    i, ret, data[i].ret, symbol_ref->errtxt);
+
+        /* Miss */
+        symbol1 = encode_symbol(cache, data[i].symbology, data[i].input_mode, data[i].option_1, data[i].option_2,
+                        data[i].output_options, data[i].primary, data[i].data, data[i].compact, &ret, debug);
+        assert_nonnull(symbol1, "i:%d symbol1 not created\n", i);
+        assert_equal(ret, data[i].ret, "i:%d symbol1 ret %d != %d (%s)\n", i, ret, data[i].ret, symbol1->errtxt);
+
+        /* Hit, using the other kind of symbol */
+        symbol2 = encode_symbol(cache, data[i].symbology, data[i].input_mode, data[i].option_1, data[i].option_2,
+                        data[i].output_options, data[i].primary, data[i].data, !data[i].compact, &ret, debug);
+        assert_nonnull(symbol2, "i:%d symbol2 not created\n", i);
+        assert_equal(ret, data[i].ret, "i:%d symbol2 ret %d != %d (%s)\n", i, ret, data[i].ret, symbol2->errtxt);
+
+        ret = encode_cmp(symbol1, symbol_ref);
+        assert_zero(ret, "i:%d encode_cmp(symbol1, symbol_ref) %d != 0\n", i, ret);
+        ret = encode_cmp(symbol2, symbol_ref);
+        assert_zero(ret, "i:%d encode_cmp(symbol2, symbol_ref) %d != 0\n", i, ret);
+
+        ZBarcode_Cache_Stats(cache, &stats);
+        assert_equal((int) stats.hits, data[i].expected_hits, "i:%d hits %d != %d\n",
+                    i, (int) stats.hits, data[i].expected_hits);
+        assert_equal((int) stats.misses, 2 - (int) stats.hits, "i:%d misses %d != %d\n",
+                    i, (int) stats.misses, 2 - (int) stats.hits);
+        assert_equal((int) stats.entries, data[i].ret < ZINT_ERROR, "i:%d entries %d != %d\n",
+                    i, (int) stats.entries, data[i].ret < ZINT_ERROR);
+        assert_equal((int) stats.evictions, 0, "i:%d evictions %d != 0\n", i, (int) stats.evictions);
+        assert_nonzero(stats.memory || data[i].ret >= ZINT_ERROR, "i:%d memory zero\n", i);
+
+        ZBarcode_Delete(symbol_ref);
+        ZBarcode_Delete(symbol1);
+        ZBarcode_Delete(symbol2);
+        ZBarcode_Cache_Delete(cache);
+    }
+
+    testFinish();
+}
+
+/* Any option affecting encoding must miss, and stacking or debugging is not cached */
+static void test_encode_key(const testCtx *const p_ctx) {
+    int debug = p_ctx->debug;
+
+    struct item {
+        int option;
+        int value;
+        int expected_hits;
+        int expected_misses;
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    struct item data[] = {
+        /*  0*/ { 0, 0, 1, 1 }, /* None */
+        /*  1*/ { 1, 3, 0, 2 }, /* option_1 */
+        /*  2*/ { 2, BARCODE_BOX, 0, 2 }, /* output_options */
+        /*  3*/ { 3, 2, 0, 2 }, /* scale */
+        /*  4*/ { 4, 26, 0, 2 }, /* ECI */
+        /*  5*/ { 5, 0, 1, 1 }, /* outfile (ignored) */
+        /*  6*/ { 6, 0, 0, 1 }, /* Stacked (not cached) */
+        /*  7*/ { 7, ZINT_DEBUG_TEST, 0, 1 }, /* Debug (not cached) */
+        /*  8*/ { 8, 0, 0, 2 }, /* Data */
+        /*  9*/ { 9, 0, 1, 1 }, /* Pointer fields (ignored, and kept on hit) */
+    };
+    int data_size = ARRAY_SIZE(data);
+    int i, ret;
+    struct zint_symbol *symbol;
+    struct zint_cache *cache;
+    struct zint_cache_stats stats;
+
+    testStart("test_encode_key");
+
+    for (i = 0; i < data_size; i++) {
+
+        if (testContinue(p_ctx, i)) continue;
+
+        cache = ZBarcode_Cache_Create(0);
+        assert_nonnull(cache, "i:%d ZBarcode_Cache_Create NULL\n", i);
+
+        symbol = encode_symbol(cache, BARCODE_QRCODE, -1, -1, -1, -1, "", "12345", 0, &ret, debug);
+        assert_nonnull(symbol, "i:%d symbol not created\n", i);
+        assert_zero(ret, "i:%d ZBarcode_Encode ret %d != 0 (%s)\n", i, ret, symbol->errtxt);
+
+        if (data[i].option != 6) {
+            /* Fresh symbol, as encoding may update options */
+            ZBarcode_Delete(symbol);
+            symbol = ZBarcode_Create();
+            assert_nonnull(symbol, "i:%d symbol not created\n", i);
+            (void) testUtilSetSymbol(symbol, BARCODE_QRCODE, -1 /*input_mode*/, -1 /*eci*/, -1 /*option_1*/, -1, -1,
+                        -1 /*output_options*/, "", -1, debug);
+            symbol->cache = cache;
+        }
+        switch (data[i].option) {
+            case 1: symbol->option_1 = data[i].value; break;
+            case 2: symbol->output_options = data[i].value; break;
+            case 3: symbol->scale = (float) data[i].value; break;
+            case 4: symbol->eci = data[i].value; break;
+            case 5: strcpy(symbol->outfile, "other.svg"); break;
+            case 7: symbol->debug = data[i].value; break;
+            case 9: symbol->write_ctx = symbol; break;
+        }
+        ret = ZBarcode_Encode(symbol, TU(data[i].option == 8 ? "12346" : "12345"), -1);
+        assert_zero(ret, "i:%d ZBarcode_Encode ret %d != 0 (%s)\n", i, ret, symbol->errtxt);
+        if (data[i].option == 5) {
+            assert_zero(strcmp(symbol->outfile, "other.svg"), "i:%d outfile %s != other.svg\n", i, symbol->outfile);
+        }
+        assert_equal(symbol->cache, cache, "i:%d cache %p != %p\n", i, (void *) symbol->cache, (void *) cache);
+        assert_equal(symbol->write_ctx, data[i].option == 9 ? symbol : NULL, "i:%d write_ctx %p != %p\n",
+                    i, symbol->write_ctx, data[i].option == 9 ? (void *) symbol : NULL);
+        assert_equal(symbol->fgcolor, symbol->fgcolour, "i:%d fgcolor != fgcolour\n", i);
+
+        ZBarcode_Cache_Stats(cache, &stats);
+        assert_equal((int) stats.hits, data[i].expected_hits, "i:%d hits %d != %d\n",
+                    i, (int) stats.hits, data[i].expected_hits);
+        assert_equal((int) stats.misses, data[i].expected_misses, "i:%d misses %d != %d\n",
+                    i, (int) stats.misses, data[i].expected_misses);
+
+        ZBarcode_Delete(symbol);
+        ZBarcode_Cache_Delete(cache);
+    }
+
+    testFinish();
+}
+
+static void test_buffer(const testCtx *const p_ctx) {
+    int debug = p_ctx->debug;
+
+    struct item {
+        int symbology;
+        int output_options;
+        const char *fgcolour;
+        int rotate_angle;
+        int is_vector;
+        int compact;
+        const char *data;
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    struct item data[] = {
+        /*  0*/ { BARCODE_CODE128, -1, "", 0, 0, 0, "1234567890" },
+        /*  1*/ { BARCODE_CODE128, -1, "", 0, 1, 1, "1234567890" },
+        /*  2*/ { BARCODE_EANX, -1, "", 90, 0, 1, "123456789012+12" },
+        /*  3*/ { BARCODE_EANX, -1, "", 90, 1, 0, "123456789012+12" },
+        /*  4*/ { BARCODE_QRCODE, BARCODE_BOX, "11223380", 180, 0, 0, "12345" }, /* Alpha */
+        /*  5*/ { BARCODE_QRCODE, OUT_BUFFER_INTERMEDIATE, "", 270, 0, 1, "12345" },
+        /*  6*/ { BARCODE_MAXICODE, -1, "", 0, 0, 0, "12345" },
+        /*  7*/ { BARCODE_MAXICODE, -1, "", 0, 1, 0, "12345" }, /* Hexagons, circles */
+        /*  8*/ { BARCODE_DATAMATRIX, BARCODE_DOTTY_MODE, "", 0, 1, 1, "12345" },
+        /*  9*/ { BARCODE_ULTRA, -1, "", 0, 0, 1, "12345" },
+        /* 10*/ { BARCODE_ULTRA, -1, "", 0, 1, 1, "12345" },
+    };
+    int data_size = ARRAY_SIZE(data);
+    int i, j, ret;
+    struct zint_symbol *symbols[3];
+    struct zint_cache *cache;
+    struct zint_cache_stats stats;
+
+    testStart("test_buffer");
+
+    for (i = 0; i < data_size; i++) {
+
+        if (testContinue(p_ctx, i)) continue;
+
+        cache = ZBarcode_Cache_Create(0);
+        assert_nonnull(cache, "i:%d ZBarcode_Cache_Create NULL\n", i);
+
+        /* Reference (uncached), miss, hit */
+        for (j = 0; j < 3; j++) {
+            struct zint_symbol *symbol = symbols[j] = data[i].compact ? ZBarcode_Create_Compact()
+                                                                    : ZBarcode_Create();
+            int length;
+            assert_nonnull(symbol, "i:%d j:%d symbol not created\n", i, j);
+
+            length = testUtilSetSymbol(symbol, data[i].symbology, -1 /*input_mode*/, -1 /*eci*/, -1 /*option_1*/,
+                        -1, -1, data[i].output_options, data[i].data, -1, debug);
+            if (data[i].fgcolour[0]) {
+                strcpy(symbol->fgcolour, data[i].fgcolour);
+            }
+            symbol->cache = j ? cache : NULL;
+
+            if (data[i].is_vector) {
+                ret = ZBarcode_Encode_and_Buffer_Vector(symbol, TU(data[i].data), length, data[i].rotate_angle);
+            } else {
+                ret = ZBarcode_Encode_and_Buffer(symbol, TU(data[i].data), length, data[i].rotate_angle);
+            }
+            assert_zero(ret, "i:%d j:%d ret %d != 0 (%s)\n", i, j, ret, symbol->errtxt);
+        }
+
+        for (j = 1; j < 3; j++) {
+            if (data[i].is_vector) {
+                assert_nonnull(symbols[j]->vector, "i:%d j:%d vector NULL\n", i, j);
+                ret = testUtilVectorCmp(symbols[j]->vector, symbols[0]->vector);
+                assert_zero(ret, "i:%d j:%d testUtilVectorCmp ret %d != 0\n", i, j, ret);
+            } else {
+                const size_t size = (size_t) symbols[0]->bitmap_width * symbols[0]->bitmap_height;
+                assert_equal(symbols[j]->bitmap_width, symbols[0]->bitmap_width, "i:%d j:%d bitmap_width %d != %d\n",
+                            i, j, symbols[j]->bitmap_width, symbols[0]->bitmap_width);
+                assert_equal(symbols[j]->bitmap_height, symbols[0]->bitmap_height,
+                            "i:%d j:%d bitmap_height %d != %d\n",
+                            i, j, symbols[j]->bitmap_height, symbols[0]->bitmap_height);
+                assert_zero(memcmp(symbols[j]->bitmap, symbols[0]->bitmap,
+                            data[i].output_options == OUT_BUFFER_INTERMEDIATE ? size : size * 3),
+                            "i:%d j:%d bitmap mismatch\n", i, j);
+                assert_equal(symbols[j]->alphamap != NULL, symbols[0]->alphamap != NULL,
+                            "i:%d j:%d alphamap presence mismatch\n", i, j);
+                if (symbols[0]->alphamap) {
+                    assert_zero(memcmp(symbols[j]->alphamap, symbols[0]->alphamap, size),
+                                "i:%d j:%d alphamap mismatch\n", i, j);
+                }
+            }
+        }
+
+        ZBarcode_Cache_Stats(cache, &stats);
+        assert_equal((int) stats.hits, 2, "i:%d hits %d != 2\n", i, (int) stats.hits);
+        assert_equal((int) stats.misses, 2, "i:%d misses %d != 2\n", i, (int) stats.misses);
+        assert_equal((int) stats.entries, 2, "i:%d entries %d != 2\n", i, (int) stats.entries);
+
+        /* Output options not affecting encoding miss output only */
+        symbols[2]->scale = 2.0f;
+        if (data[i].is_vector) {
+            ret = ZBarcode_Buffer_Vector(symbols[2], data[i].rotate_angle);
+        } else {
+            ret = ZBarcode_Buffer(symbols[2], data[i].rotate_angle);
+        }
+        assert_zero(ret, "i:%d scale 2 ret %d != 0 (%s)\n", i, ret, symbols[2]->errtxt);
+        ZBarcode_Cache_Stats(cache, &stats);
+        assert_equal((int) stats.misses, 3, "i:%d misses %d != 3\n", i, (int) stats.misses);
+        assert_equal((int) stats.entries, 3, "i:%d entries %d != 3\n", i, (int) stats.entries);
+
+        for (j = 0; j < 3; j++) {
+            ZBarcode_Delete(symbols[j]);
+        }
+        ZBarcode_Cache_Delete(cache);
+    }
+
+    testFinish();
+}
+
+static void test_evict(const testCtx *const p_ctx) {
+    int debug = p_ctx->debug;
+
+    int i, ret;
+    struct zint_symbol *symbol;
+    struct zint_cache *cache;
+    struct zint_cache_stats stats;
+    unsigned long max_memory = 16 * 4096;
+    char data[32];
+
+    testStart("test_evict");
+
+    cache = ZBarcode_Cache_Create(max_memory);
+    assert_nonnull(cache, "ZBarcode_Cache_Create NULL\n");
+
+    symbol = ZBarcode_Create();
+    assert_nonnull(symbol, "Symbol not created\n");
+
+    for (i = 0; i < 500; i++) {
+        ZBarcode_Clear(symbol);
+        (void) testUtilSetSymbol(symbol, BARCODE_QRCODE, -1 /*input_mode*/, -1 /*eci*/, -1 /*option_1*/, -1, -1,
+                    -1 /*output_options*/, "", -1, debug);
+        symbol->cache = cache;
+        sprintf(data, "%d", i);
+        ret = ZBarcode_Encode(symbol, TU(data), -1);
+        assert_zero(ret, "i:%d ZBarcode_Encode ret %d != 0 (%s)\n", i, ret, symbol->errtxt);
+    }
+
+    ZBarcode_Cache_Stats(cache, &stats);
+    assert_equal((int) stats.misses, 500, "misses %d != 500\n", (int) stats.misses);
+    assert_nonzero(stats.evictions, "evictions zero\n");
+    assert_equal((int) (stats.entries + stats.evictions), 500, "entries %d + evictions %d != 500\n",
+                (int) stats.entries, (int) stats.evictions);
+    assert_nonzero(stats.memory <= max_memory, "memory %lu > max_memory %lu\n", stats.memory, max_memory);
+    assert_equal(stats.max_memory, max_memory, "max_memory %lu != %lu\n", stats.max_memory, max_memory);
+
+    /* Most recent still held */
+    ZBarcode_Clear(symbol);
+    ret = ZBarcode_Encode(symbol, TU("499"), -1);
+    assert_zero(ret, "ZBarcode_Encode ret %d != 0 (%s)\n", ret, symbol->errtxt);
+    ZBarcode_Cache_Stats(cache, &stats);
+    assert_equal((int) stats.hits, 1, "hits %d != 1\n", (int) stats.hits);
+
+    ZBarcode_Cache_Clear(cache);
+    ZBarcode_Cache_Stats(cache, &stats);
+    assert_zero(stats.entries, "entries %lu != 0\n", stats.entries);
+    assert_zero(stats.memory, "memory %lu != 0\n", stats.memory);
+    assert_equal((int) stats.hits, 1, "hits %d != 1 after clear\n", (int) stats.hits);
+
+    /* Entry bigger than a shard's share of memory not held */
+    ZBarcode_Cache_Delete(cache);
+    cache = ZBarcode_Cache_Create(16 * 64);
+    assert_nonnull(cache, "ZBarcode_Cache_Create(1024) NULL\n");
+    ZBarcode_Clear(symbol);
+    symbol->cache = cache;
+    ret = ZBarcode_Encode(symbol, TU("12345"), -1);
+    assert_zero(ret, "ZBarcode_Encode ret %d != 0 (%s)\n", ret, symbol->errtxt);
+    ZBarcode_Cache_Stats(cache, &stats);
+    assert_zero(stats.entries, "entries %lu != 0\n", stats.entries);
+    assert_zero(stats.evictions, "evictions %lu != 0\n", stats.evictions);
+
+    ZBarcode_Delete(symbol);
+    ZBarcode_Cache_Delete(cache);
+
+    /* NULL args */
+    ZBarcode_Cache_Stats(NULL, &stats);
+    assert_zero(stats.hits, "NULL cache hits %lu != 0\n", stats.hits);
+    ZBarcode_Cache_Stats(NULL, NULL);
+    ZBarcode_Cache_Clear(NULL);
+    ZBarcode_Cache_Delete(NULL);
+
+    testFinish();
+}
+
+#define BATCH_COUNT 64
+
+/* Cache shared between batch worker threads */
+static void test_batch(const testCtx *const p_ctx) {
+    int debug = p_ctx->debug;
+
+    int i, ret;
+    struct zint_symbol *template_symbol;
+    struct zint_batch_item items[BATCH_COUNT], ref_items[BATCH_COUNT];
+    struct zint_cache *cache;
+    struct zint_cache_stats stats;
+    static const char *sources[] = { "SSCC 1", "SSCC 2", "SSCC 3", "SSCC 4" };
+
+    testStart("test_batch");
+
+    cache = ZBarcode_Cache_Create(0);
+    assert_nonnull(cache, "ZBarcode_Cache_Create NULL\n");
+
+    template_symbol = ZBarcode_Create();
+    assert_nonnull(template_symbol, "Symbol not created\n");
+    (void) testUtilSetSymbol(template_symbol, BARCODE_DATAMATRIX, -1 /*input_mode*/, -1 /*eci*/, -1 /*option_1*/,
+                -1, -1, -1 /*output_options*/, "", -1, debug);
+
+    memset(items, 0, sizeof(items));
+    memset(ref_items, 0, sizeof(ref_items));
+    for (i = 0; i < BATCH_COUNT; i++) {
+        items[i].source = ref_items[i].source = TU(sources[i % ARRAY_SIZE(sources)]);
+    }
+
+    ret = ZBarcode_Encode_Batch(template_symbol, ref_items, BATCH_COUNT, ZINT_BATCH_BUFFER, 0, 0 /*num_threads*/,
+                NULL, NULL);
+    assert_zero(ret, "ZBarcode_Encode_Batch ref ret %d != 0\n", ret);
+
+    template_symbol->cache = cache;
+    ret = ZBarcode_Encode_Batch(template_symbol, items, BATCH_COUNT, ZINT_BATCH_BUFFER, 0, 0 /*num_threads*/,
+                NULL, NULL);
+    assert_zero(ret, "ZBarcode_Encode_Batch ret %d != 0\n", ret);
+
+    for (i = 0; i < BATCH_COUNT; i++) {
+        const struct zint_symbol *symbol = items[i].symbol, *ref_symbol = ref_items[i].symbol;
+        assert_zero(items[i].error_number, "i:%d error_number %d != 0\n", i, items[i].error_number);
+        ret = encode_cmp(symbol, ref_symbol);
+        assert_zero(ret, "i:%d encode_cmp %d != 0\n", i, ret);
+        assert_equal(symbol->bitmap_width, ref_symbol->bitmap_width, "i:%d bitmap_width %d != %d\n",
+                    i, symbol->bitmap_width, ref_symbol->bitmap_width);
+        assert_equal(symbol->bitmap_height, ref_symbol->bitmap_height, "i:%d bitmap_height %d != %d\n",
+                    i, symbol->bitmap_height, ref_symbol->bitmap_height);
+        assert_zero(memcmp(symbol->bitmap, ref_symbol->bitmap,
+                    (size_t) symbol->bitmap_width * symbol->bitmap_height * 3), "i:%d bitmap mismatch\n", i);
+        ZBarcode_Delete(items[i].symbol);
+        ZBarcode_Delete(ref_items[i].symbol);
+    }
+
+    /* Each distinct source encoded and output at least once, depending on thread timing */
+    ZBarcode_Cache_Stats(cache, &stats);
+    assert_equal((int) (stats.hits + stats.misses), BATCH_COUNT * 2, "hits %d + misses %d != %d\n",
+                (int) stats.hits, (int) stats.misses, BATCH_COUNT * 2);
+    assert_nonzero((int) stats.misses >= ARRAY_SIZE(sources) * 2, "misses %d < %d\n",
+                (int) stats.misses, ARRAY_SIZE(sources) * 2);
+    assert_equal((int) stats.entries, ARRAY_SIZE(sources) * 2, "entries %d != %d\n",
+                (int) stats.entries, ARRAY_SIZE(sources) * 2);
+
+    ZBarcode_Delete(template_symbol);
+    ZBarcode_Cache_Delete(cache);
+
+    testFinish();
+}
+
+int main(int argc, char *argv[]) {
+
+    testFunction funcs[] = { /* name, func */
+        { "test_encode", test_encode },
+        { "test_encode_key", test_encode_key },
+        { "test_buffer", test_buffer },
+        { "test_evict", test_evict },
+        { "test_batch", test_batch },
+    };
+
+    testRun(argc, argv, funcs, ARRAY_SIZE(funcs));
+
+    testReport();
+
+    return 0;
+}
+
+/* vim: set ts=4 sw=4 et : */
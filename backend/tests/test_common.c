@@ -229,6 +229,70 @@ static void test_is_sane_lookup(const testCtx *const p_ctx) {
     testFinish();
 }
 
+static void test_bits_append_posn(const testCtx *const p_ctx) {
+
+    struct item {
+        unsigned int arg;
+        int length;
+        int bit_posn;
+        unsigned char fill;
+        int ret;
+        unsigned char expected[4];
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    struct item data[] = {
+        /*  0*/ { 0x1, 1, 0, 0x00, 1, { 0x80, 0x00, 0x00, 0x00 } },
+        /*  1*/ { 0x1, 1, 7, 0x00, 8, { 0x01, 0x00, 0x00, 0x00 } },
+        /*  2*/ { 0x5, 3, 2, 0x00, 5, { 0x28, 0x00, 0x00, 0x00 } },
+        /*  3*/ { 0x5, 3, 2, 0xFF, 5, { 0xEF, 0xFF, 0xFF, 0xFF } },
+        /*  4*/ { 0xAB, 8, 0, 0x00, 8, { 0xAB, 0x00, 0x00, 0x00 } },
+        /*  5*/ { 0xAB, 8, 4, 0x00, 12, { 0x0A, 0xB0, 0x00, 0x00 } },
+        /*  6*/ { 0x000, 9, 5, 0xFF, 14, { 0xF8, 0x03, 0xFF, 0xFF } },
+        /*  7*/ { 0x1FFF, 13, 6, 0x00, 19, { 0x03, 0xFF, 0xE0, 0x00 } },
+        /*  8*/ { 0x1FFFFF, 21, 3, 0x00, 24, { 0x1F, 0xFF, 0xFF, 0x00 } },
+        /*  9*/ { 0xABCDEF, 24, 4, 0x00, 28, { 0x0A, 0xBC, 0xDE, 0xF0 } },
+        /* 10*/ { 0xFFFF5, 4, 1, 0x00, 5, { 0x28, 0x00, 0x00, 0x00 } }, /* Only `length` bits used */
+        /* 11*/ { 0x0, 0, 3, 0xFF, 3, { 0xFF, 0xFF, 0xFF, 0xFF } },
+    };
+    int data_size = ARRAY_SIZE(data);
+    int i, j, ret;
+
+    unsigned char bits[4];
+    char binary[32];
+    unsigned int val;
+
+    testStart("test_bits_append_posn");
+
+    for (i = 0; i < data_size; i++) {
+
+        if (testContinue(p_ctx, i)) continue;
+
+        memset(bits, data[i].fill, sizeof(bits));
+
+        ret = bits_append_posn(data[i].arg, data[i].length, bits, data[i].bit_posn);
+        assert_equal(ret, data[i].ret, "i:%d ret %d != %d\n", i, ret, data[i].ret);
+        for (j = 0; j < 4; j++) {
+            assert_equal(bits[j], data[i].expected[j], "i:%d bits[%d] 0x%02X != 0x%02X\n",
+                        i, j, bits[j], data[i].expected[j]);
+        }
+
+        if (data[i].length) {
+            val = bits_get_posn(bits, data[i].bit_posn, data[i].length);
+            assert_equal(val, data[i].arg & ((1u << data[i].length) - 1), "i:%d bits_get_posn 0x%X != 0x%X\n",
+                        i, val, data[i].arg & ((1u << data[i].length) - 1));
+
+            /* Same as character version */
+            (void) bin_append_posn((int) data[i].arg, data[i].length, binary, 0);
+            for (j = 0; j < data[i].length; j++) {
+                assert_equal(binary[j] == '1', (int) bits_get_posn(bits, data[i].bit_posn + j, 1),
+                            "i:%d binary[%d] %c != bit\n", i, j, binary[j]);
+            }
+        }
+    }
+
+    testFinish();
+}
+
 static void test_is_valid_utf8(const testCtx *const p_ctx) {
 
     struct item {
@@ -249,6 +313,14 @@ static void test_is_valid_utf8(const testCtx *const p_ctx) {
         /*  6*/ { "a\200b", -1, 0, "Orphan continuation 0x80" },
         /*  7*/ { "\300\201", -1, 0, "Overlong 0xC081" },
         /*  8*/ { "\355\240\200", -1, 0, "Surrogate 0xEDA080" },
+        /*  9*/ { "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789", -1, 1, "Long ASCII" },
+        /* 10*/ { "ABCDEFGHIJKLMNOé", -1, 1, "Non-ASCII at offset 15" },
+        /* 11*/ { "ABCDEFGHIJKLMNOPé", -1, 1, "Non-ASCII at offset 16" },
+        /* 12*/ { "ABCDEFGHIJKLMNOPQé", -1, 1, "Non-ASCII at offset 17" },
+        /* 13*/ { "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefé0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZé", -1, 1, "Mixed long" },
+        /* 14*/ { "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdef\2000123456789", -1, 0, "Orphan continuation after long ASCII" },
+        /* 15*/ { "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdef0123456789\340\240", -1, 0, "Truncated after long ASCII" },
+        /* 16*/ { "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdef\000ghijklmnopqrstuvwxyz", 53, 1, "Embedded nul in long ASCII" },
     };
     int data_size = ARRAY_SIZE(data);
     int i, length, ret;
@@ -277,7 +349,7 @@ static void test_utf8_to_unicode(const testCtx *const p_ctx) {
         int disallow_4byte;
         int ret;
         int ret_length;
-        unsigned int expected_vals[20];
+        unsigned int expected_vals[40];
         char *comment;
     };
     /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
@@ -287,11 +359,13 @@ static void test_utf8_to_unicode(const testCtx *const p_ctx) {
         /*  2*/ { "\357\277\277", -1, 1, 0, 1, { 0xFFFF }, "EFBFBF" },
         /*  3*/ { "\360\220\200\200", -1, 1, ZINT_ERROR_INVALID_DATA, -1, {0}, "Four-byte F0908080" },
         /*  4*/ { "a\200b", -1, 1, ZINT_ERROR_INVALID_DATA, -1, {0}, "Orphan continuation 0x80" },
+        /*  5*/ { "ABCDEFGHIJKLMNOPQ\302\200RSTUVWXYZabcdefghijk\340\240\200", -1, 1, 0, 39, { 'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 0x80, 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 0x800 }, "Mixed long" },
+        /*  6*/ { "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdef\200", -1, 1, ZINT_ERROR_INVALID_DATA, -1, {0}, "Orphan continuation after long ASCII" },
     };
     int data_size = ARRAY_SIZE(data);
     int i, length, ret;
 
-    unsigned int vals[20];
+    unsigned int vals[40];
     struct zint_symbol symbol = {0};
 
     testStart("test_utf8_to_unicode");
@@ -417,15 +491,94 @@ static void test_debug_test_codeword_dump_int(const testCtx *const p_ctx) {
     testFinish();
 }
 
+#include <time.h>
+
+#define TEST_PERF_ITERATIONS    1000
+#define TEST_PERF_TIME(arg)     ((arg) * 1000.0 / CLOCKS_PER_SEC)
+
+/* Not a real test, just performance indicator for UTF-8 validation & decoding */
+static void test_perf(const testCtx *const p_ctx) {
+    int debug = p_ctx->debug;
+
+    struct item {
+        const char *data;
+        const char *comment;
+    };
+    struct item data[] = {
+        /*  0*/ { "The quick brown fox jumps over the lazy dog 0123456789. ", "ASCII" },
+        /*  1*/ { "Falsches Üben von Xylophonmusik quält jeden größeren Zwerg. ", "Latin-1 mixed" },
+        /*  2*/ { "Съешь же ещё этих мягких французских булок, да выпей чаю. ", "Cyrillic" },
+        /*  3*/ { "色は匂へど散りぬるを我が世誰ぞ常ならむ有為の奥山今日越えて浅き夢見じ酔ひもせず。", "Kanji" },
+    };
+    int data_size = ARRAY_SIZE(data);
+    int i, length, ret;
+
+    unsigned char source[16384];
+    unsigned int vals[16384];
+    struct zint_symbol symbol = {0};
+
+    clock_t start;
+    clock_t total_valid = 0, total_decode = 0, diff_valid, diff_decode;
+    int comment_max = 0;
+
+    if (!(debug & ZINT_DEBUG_TEST_PERFORMANCE)) { /* -d 256 */
+        return;
+    }
+
+    for (i = 0; i < data_size; i++) if ((int) strlen(data[i].comment) > comment_max) comment_max = (int) strlen(data[i].comment);
+
+    printf("Iterations %d\n", TEST_PERF_ITERATIONS);
+
+    for (i = 0; i < data_size; i++) {
+        int j, data_len;
+
+        if (testContinue(p_ctx, i)) continue;
+
+        /* Repeat to fill most of `source` */
+        data_len = (int) strlen(data[i].data);
+        for (length = 0; length + data_len < (int) sizeof(source); length += data_len) {
+            memcpy(source + length, data[i].data, data_len);
+        }
+
+        diff_valid = diff_decode = 0;
+
+        for (j = 0; j < TEST_PERF_ITERATIONS; j++) {
+            int ret_length = length;
+
+            start = clock();
+            ret = is_valid_utf8(source, length);
+            diff_valid += clock() - start;
+            assert_equal(ret, 1, "i:%d is_valid_utf8 ret %d != 1\n", i, ret);
+
+            start = clock();
+            ret = utf8_to_unicode(&symbol, source, vals, &ret_length, 1 /*disallow_4byte*/);
+            diff_decode += clock() - start;
+            assert_zero(ret, "i:%d utf8_to_unicode ret %d != 0\n", i, ret);
+        }
+
+        printf("%*s: valid % 8gms, decode % 8gms (%d bytes)\n", comment_max, data[i].comment,
+                TEST_PERF_TIME(diff_valid), TEST_PERF_TIME(diff_decode), length);
+
+        total_valid += diff_valid;
+        total_decode += diff_decode;
+    }
+    if (p_ctx->index == -1) {
+        printf("%*s: valid % 8gms, decode % 8gms\n", comment_max, "totals", TEST_PERF_TIME(total_valid),
+                TEST_PERF_TIME(total_decode));
+    }
+}
+
 int main(int argc, char *argv[]) {
 
     testFunction funcs[] = { /* name, func */
         { "test_is_sane", test_is_sane },
         { "test_is_sane_lookup", test_is_sane_lookup },
+        { "test_bits_append_posn", test_bits_append_posn },
         { "test_is_valid_utf8", test_is_valid_utf8 },
         { "test_utf8_to_unicode", test_utf8_to_unicode },
         { "test_set_height", test_set_height },
         { "test_debug_test_codeword_dump_int", test_debug_test_codeword_dump_int },
+        { "test_perf", test_perf },
     };
 
     testRun(argc, argv, funcs, ARRAY_SIZE(funcs));
@@ -1372,6 +1372,70 @@ static void test_is_eci_convertible_segs(const testCtx *const p_ctx) {
     testFinish();
 }
 
+static void test_get_eci_sb_mask(const testCtx *const p_ctx) {
+
+    struct item {
+        const char *data;
+        int length;
+        unsigned int ret;
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    struct item data[] = {
+        /*  0*/ { "", -1, 0x1E7BFF8 },
+        /*  1*/ { "AB", -1, 0x1E7BFF8 },
+        /*  2*/ { "\300\301", -1, 0 },
+        /*  3*/ { "AB\200", -1, 0 },
+        /*  4*/ { "AB\303", -1, 0 }, /* Truncated */
+        /*  5*/ { "\302\200", -1, 0 }, /* U+0080 */
+        /*  6*/ { "ÀÁ", -1, 0x0870828 },
+        /*  7*/ { "Ђ", -1, 0x0400080 },
+        /*  8*/ { "βЂ", -1, 0 },
+        /*  9*/ { "€", -1, 0x1E60200 },
+    };
+    int data_size = ARRAY_SIZE(data);
+    int i, length;
+    unsigned int ret;
+
+    unsigned char source[5];
+    unsigned char dest[2] = {0};
+
+    testStart("test_get_eci_sb_mask");
+
+    for (i = 0; i < data_size; i++) {
+
+        if (testContinue(p_ctx, i)) continue;
+
+        length = data[i].length == -1 ? (int) strlen(data[i].data) : data[i].length;
+
+        ret = get_eci_sb_mask((const unsigned char *) data[i].data, length);
+        assert_equal(ret, data[i].ret, "i:%d get_eci_sb_mask ret 0x%X != 0x%X\n", i, ret, data[i].ret);
+    }
+
+    if (p_ctx->index == -1) { /* Check against `utf8_to_eci()` for all of the BMP */
+        unsigned int u;
+        for (u = 0; u < 0x10000; u++) {
+            int eci;
+            if (u >= 0xD800 && u <= 0xDFFF) { /* Surrogates */
+                continue;
+            }
+            length = to_utf8(u, source);
+            ret = get_eci_sb_mask(source, length);
+            for (eci = 3; eci <= 24; eci++) {
+                int ret_eci, ret_length = length;
+                if (eci == 14 || eci == 19 || eci == 20) {
+                    assert_zero(ret & (1 << eci), "u:0x%04X eci:%d mask 0x%X\n", u, eci, ret);
+                    continue;
+                }
+                ret_eci = utf8_to_eci(eci, source, dest, &ret_length);
+                assert_equal(!(ret & (1 << eci)), !!ret_eci, "u:0x%04X eci:%d mask 0x%X, utf8_to_eci ret %d\n",
+                            u, eci, ret, ret_eci);
+            }
+        }
+    }
+
+    testFinish();
+}
+
 static void test_get_best_eci(const testCtx *const p_ctx) {
 
     struct item {
@@ -1456,6 +1520,132 @@ static void test_get_best_eci_segs(const testCtx *const p_ctx) {
     testFinish();
 }
 
+static void test_is_eci_needed_segs(const testCtx *const p_ctx) {
+
+    struct item {
+        int symbology;
+        struct zint_seg segs[3];
+        int ret;
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    struct item data[] = {
+        /*  0*/ { BARCODE_DATAMATRIX, { { TU("A"), -1, 0 }, { TU(""), 0, 0 }, { TU(""), 0, 0 } }, 0 },
+        /*  1*/ { BARCODE_DATAMATRIX, { { TU("AÿÀ"), -1, 0 }, { TU(""), 0, 0 }, { TU(""), 0, 0 } }, 0 }, /* ISO/IEC 8859-1 */
+        /*  2*/ { BARCODE_DATAMATRIX, { { TU("AĀ"), -1, 0 }, { TU(""), 0, 0 }, { TU(""), 0, 0 } }, 1 }, /* U+0100 */
+        /*  3*/ { BARCODE_DATAMATRIX, { { TU("A"), -1, 0 }, { TU("Ђ"), -1, 7 }, { TU(""), 0, 0 } }, 0 },
+        /*  4*/ { BARCODE_DATAMATRIX, { { TU("A"), -1, 7 }, { TU("Ђ"), -1, 0 }, { TU(""), 0, 0 } }, 1 },
+        /*  5*/ { BARCODE_AZTEC, { { TU("β"), -1, 0 }, { TU(""), 0, 0 }, { TU(""), 0, 0 } }, 1 },
+        /*  6*/ { BARCODE_QRCODE, { { TU("Aé"), -1, 0 }, { TU(""), 0, 0 }, { TU(""), 0, 0 } }, 0 },
+        /*  7*/ { BARCODE_QRCODE, { { TU("点β"), -1, 0 }, { TU(""), 0, 0 }, { TU(""), 0, 0 } }, 0 }, /* Shift JIS */
+        /*  8*/ { BARCODE_QRCODE, { { TU("点é"), -1, 0 }, { TU(""), 0, 0 }, { TU(""), 0, 0 } }, 1 }, /* Neither */
+        /*  9*/ { BARCODE_QRCODE, { { TU("点"), -1, 0 }, { TU("A"), -1, 0 }, { TU(""), 0, 0 } }, 1 }, /* Not single seg */
+        /* 10*/ { BARCODE_RMQR, { { TU("点\\"), -1, 0 }, { TU(""), 0, 0 }, { TU(""), 0, 0 } }, 0 }, /* Backslash goes to 2 byte */
+        /* 11*/ { BARCODE_RMQR, { { TU("点"), -1, 0 }, { TU(""), 0, 0 }, { TU(""), 0, 0 } }, 0 },
+        /* 12*/ { BARCODE_HANXIN, { { TU("点é😀"), -1, 0 }, { TU(""), 0, 0 }, { TU(""), 0, 0 } }, 0 }, /* GB 18030 */
+        /* 13*/ { BARCODE_HANXIN, { { TU("é"), -1, 0 }, { TU("点"), -1, 0 }, { TU(""), 0, 0 } }, 1 },
+        /* 14*/ { BARCODE_GRIDMATRIX, { { TU("A点"), -1, 0 }, { TU(""), 0, 0 }, { TU(""), 0, 0 } }, 0 }, /* GB 2312 */
+        /* 15*/ { BARCODE_GRIDMATRIX, { { TU("Aé"), -1, 0 }, { TU(""), 0, 0 }, { TU(""), 0, 0 } }, 0 }, /* é in GB 2312 */
+        /* 16*/ { BARCODE_GRIDMATRIX, { { TU("Aÿ"), -1, 0 }, { TU(""), 0, 0 }, { TU(""), 0, 0 } }, 1 }, /* ÿ not */
+    };
+    int data_size = ARRAY_SIZE(data);
+    int i, j, seg_count, ret;
+
+    testStart("test_is_eci_needed_segs");
+
+    for (i = 0; i < data_size; i++) {
+
+        if (testContinue(p_ctx, i)) continue;
+
+        for (j = 0, seg_count = 0; j < 3 && data[i].segs[j].length; j++, seg_count++);
+        for (j = 0; j < seg_count; j++) {
+            if (data[i].segs[j].length < 0) data[i].segs[j].length = (int) ustrlen(data[i].segs[j].source);
+        }
+
+        ret = is_eci_needed_segs(data[i].symbology, data[i].segs, seg_count);
+        assert_equal(ret, data[i].ret, "i:%d is_eci_needed_segs ret %d != %d\n", i, ret, data[i].ret);
+    }
+
+    testFinish();
+}
+
+#include <time.h>
+
+#define TEST_PERF_ITERATIONS    1000
+#define TEST_PERF_TIME(arg)     ((arg) * 1000.0 / CLOCKS_PER_SEC)
+
+/* Not a real test, just performance indicator for single-byte & multibyte conversion of non-ISO/IEC 8859-1 text */
+static void test_perf(const testCtx *const p_ctx) {
+    int debug = p_ctx->debug;
+
+    struct item {
+        int eci;
+        const char *data;
+        const char *comment;
+    };
+    struct item data[] = {
+        /*  0*/ { 7, "Съешь же ещё этих мягких французских булок, да выпей чаю. ", "ISO/IEC 8859-5 Cyrillic" },
+        /*  1*/ { 8, "نص حكيم له سر قاطع وذو شأن عظيم مكتوب على ثوب أخضر ومغلف بجلد أزرق ", "ISO/IEC 8859-6 Arabic" },
+        /*  2*/ { 9, "Ξεσκεπάζω την ψυχοφθόρα βδελυγμία. ", "ISO/IEC 8859-7 Greek" },
+        /*  3*/ { 10, "דג סקרן שט בים מאוכזב ולפתע מצא חברה ", "ISO/IEC 8859-8 Hebrew" },
+        /*  4*/ { 4, "Příliš žluťoučký kůň úpěl ďábelské ódy. ", "ISO/IEC 8859-2 Latin-2" },
+        /*  5*/ { 22, "Съешь же ещё этих мягких французских булок, да выпей чаю. ", "Windows-1251 Cyrillic" },
+        /*  6*/ { 24, "نص حكيم له سر قاطع وذو شأن عظيم مكتوب على ثوب أخضر ومغلف بجلد أزرق ", "Windows-1256 Arabic" },
+        /*  7*/ { 20, "いろはにほへと　ちりぬるを　わかよたれそ　つねならむ　ウヰノオクヤマ　ケフコエテ。", "Shift JIS kana" },
+        /*  8*/ { 20, "色は匂へど散りぬるを我が世誰ぞ常ならむ有為の奥山今日越えて浅き夢見じ酔ひもせず。", "Shift JIS kanji" },
+        /*  9*/ { 28, "「臺灣」，「中華民國」：ＡＢＣ１２３（全形）　…　※　○●", "Big5 symbols" },
+        /* 10*/ { 29, "天地玄黄，宇宙洪荒。日月盈昃，辰宿列张。ＡＢＣ１２３《》、“”", "GB 2312 mixed" },
+        /* 11*/ { 30, "다람쥐 헌 쳇바퀴에 타고파. 키스의 고유조건은 입술끼리 만나야 하고 특별한 기술은 필요치 않다. ", "EUC-KR Hangul" },
+        /* 12*/ { 31, "天地玄黄，宇宙洪荒。日月盈昃，辰宿列张。ＡＢＣ１２３《》、“”", "GBK mixed" },
+        /* 13*/ { 32, "天地玄黄，宇宙洪荒。日月盈昃，辰宿列张。ＡＢＣ１２３《》、“”", "GB 18030 mixed" },
+    };
+    int data_size = ARRAY_SIZE(data);
+    int i, length, ret;
+
+    unsigned char source[4096];
+    unsigned char dest[4096 * 2];
+
+    clock_t start;
+    clock_t total = 0, diff;
+    int comment_max = 0;
+
+    if (!(debug & ZINT_DEBUG_TEST_PERFORMANCE)) { /* -d 256 */
+        return;
+    }
+
+    for (i = 0; i < data_size; i++) if ((int) strlen(data[i].comment) > comment_max) comment_max = (int) strlen(data[i].comment);
+
+    printf("Iterations %d\n", TEST_PERF_ITERATIONS);
+
+    for (i = 0; i < data_size; i++) {
+        int j, data_len;
+
+        if (testContinue(p_ctx, i)) continue;
+
+        /* Repeat to fill most of `source` */
+        data_len = (int) strlen(data[i].data);
+        for (length = 0; length + data_len < (int) sizeof(source); length += data_len) {
+            memcpy(source + length, data[i].data, data_len);
+        }
+
+        diff = 0;
+
+        for (j = 0; j < TEST_PERF_ITERATIONS; j++) {
+            int out_length = length;
+            start = clock();
+            ret = utf8_to_eci(data[i].eci, source, dest, &out_length);
+            diff += clock() - start;
+            assert_zero(ret, "i:%d utf8_to_eci ret %d != 0\n", i, ret);
+        }
+
+        printf("%*s: convert % 8gms (%d bytes)\n", comment_max, data[i].comment, TEST_PERF_TIME(diff), length);
+
+        total += diff;
+    }
+    if (p_ctx->index == -1) {
+        printf("%*s: convert % 8gms\n", comment_max, "totals", TEST_PERF_TIME(total));
+    }
+}
+
 int main(int argc, char *argv[]) {
 
     testFunction funcs[] = { /* name, func */
@@ -1475,8 +1665,11 @@ int main(int argc, char *argv[]) {
         { "test_utf8_to_eci_gbk", test_utf8_to_eci_gbk },
         { "test_utf8_to_eci_gb18030", test_utf8_to_eci_gb18030 },
         { "test_is_eci_convertible_segs", test_is_eci_convertible_segs },
+        { "test_get_eci_sb_mask", test_get_eci_sb_mask },
         { "test_get_best_eci", test_get_best_eci },
         { "test_get_best_eci_segs", test_get_best_eci_segs },
+        { "test_is_eci_needed_segs", test_is_eci_needed_segs },
+        { "test_perf", test_perf },
     };
 
     testRun(argc, argv, funcs, ARRAY_SIZE(funcs));
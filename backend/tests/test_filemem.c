@@ -0,0 +1,890 @@
+/*
+    libzint - the open source barcode library
+    Copyright (C) 2023 Robin Stuart <rstuart114@gmail.com>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+    3. Neither the name of the project nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+ */
+/* SPDX-License-Identifier: BSD-3-Clause */
+
+
+#include <math.h>
+#include <locale.h>
+#include "testcommon.h"
+#include "../filemem.h"
+
+static void test_putsf(const testCtx *const p_ctx) {
+
+    struct item {
+        const char *prefix;
+        int dp;
+        float arg;
+        const char *expected;
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    struct item data[] = {
+        /*  0*/ { "", 2, 0.0f, "0.00" },
+        /*  1*/ { "", 2, -0.0f, "-0.00" },
+        /*  2*/ { "", 2, 1.0f, "1.00" },
+        /*  3*/ { "", 2, 1.125f, "1.12" }, /* Exact tie rounds to even */
+        /*  4*/ { "", 2, 1.375f, "1.38" },
+        /*  5*/ { "", 2, 0.005f, "0.00" }, /* Not an exact tie (0.004999999888...) */
+        /*  6*/ { "", 2, -0.004f, "-0.00" },
+        /*  7*/ { "", 2, -12.345f, "-12.35" },
+        /*  8*/ { "", 0, 0.5f, "0" },
+        /*  9*/ { "", 0, 1.5f, "2" },
+        /* 10*/ { "", 0, 2.5f, "2" },
+        /* 11*/ { "", 1, 9.95f, "9.9" }, /* 9.9499998... */
+        /* 12*/ { "", 1, 9.96f, "10.0" },
+        /* 13*/ { "", 3, 0.0625f, "0.062" },
+        /* 14*/ { "", 3, 0.1875f, "0.188" },
+        /* 15*/ { "", 4, 123.45678f, "123.4568" },
+        /* 16*/ { "x=", 2, 3.14159f, "x=3.14" },
+        /* 17*/ { NULL, 2, 3.14159f, "3.14" },
+        /* 18*/ { "", 2, 123456789.0f, "123456792.00" },
+        /* 19*/ { "", 2, 1e20f, "100000002004087734272.00" }, /* Too big for fast path */
+        /* 20*/ { "", 4, 429496.75f, "429496.7500" }, /* Too big for fast path, < 2^53 */
+        /* 21*/ { "", 4, -500000.03125f, "-500000.0312" }, /* Exact tie rounds to even */
+        /* 22*/ { "", 1, 1e15f, "999999986991104.0" },
+        /* 23*/ { "", 0, 3.0e38f, "300000000549775575777803994281145270272" },
+        /* 24*/ { "", 4, -3.4028235e38f, "-340282346638528859811704183484516925440.0000" }, /* -FLT_MAX */
+        /* 25*/ { "", 3, 16777217.0f, "16777216.000" },
+    };
+    int data_size = ARRAY_SIZE(data);
+    int i, ret;
+    struct filemem fm;
+    char buf[64];
+
+    testStart("test_putsf");
+
+    for (i = 0; i < data_size; i++) {
+
+        if (testContinue(p_ctx, i)) continue;
+
+        memset(&fm, 0, sizeof(fm));
+        ret = fm_putsf(data[i].prefix, data[i].dp, data[i].arg, &fm);
+        assert_equal(ret, 1, "i:%d fm_putsf ret %d != 1\n", i, ret);
+        assert_equal((int) fm.mempos, (int) strlen(data[i].expected), "i:%d mempos %d != %d (%.*s)\n",
+                    i, (int) fm.mempos, (int) strlen(data[i].expected), (int) fm.mempos, fm.mem);
+        assert_zero(memcmp(fm.mem, data[i].expected, fm.mempos), "i:%d memcmp(%.*s, %s) != 0\n",
+                    i, (int) fm.mempos, fm.mem, data[i].expected);
+
+        /* Check against printf() */
+        sprintf(buf, "%s%.*f", data[i].prefix ? data[i].prefix : "", data[i].dp, data[i].arg);
+        assert_zero(strcmp(buf, data[i].expected), "i:%d sprintf %s != %s\n", i, buf, data[i].expected);
+
+        free(fm.mem);
+    }
+
+    testFinish();
+}
+
+static void test_putsf_random(const testCtx *const p_ctx) {
+    int debug = p_ctx->debug;
+
+    int i, dp;
+    int iterations = 100000;
+    struct filemem fm;
+    char buf[64];
+    float arg;
+
+    testStart("test_putsf_random");
+
+    if (debug & ZINT_DEBUG_TEST_PERFORMANCE) {
+        iterations *= 100;
+    }
+
+    srand(1);
+    for (i = 0; i < iterations; i++) {
+        arg = (float) ((rand() % 2000001) - 1000000) / (float) (1 << (rand() % 16));
+        if ((i & 3) == 0) { /* Large values too, beyond the fast path */
+            arg = (float) ldexp(arg, rand() % 100);
+        }
+        dp = rand() % 5;
+        memset(&fm, 0, sizeof(fm));
+        (void) fm_putsf("", dp, arg, &fm);
+        sprintf(buf, "%.*f", dp, arg);
+        assert_equal((int) fm.mempos, (int) strlen(buf), "i:%d %.9g dp %d mempos %d != %d (%.*s, %s)\n",
+                    i, arg, dp, (int) fm.mempos, (int) strlen(buf), (int) fm.mempos, fm.mem, buf);
+        assert_zero(memcmp(fm.mem, buf, fm.mempos), "i:%d %.9g dp %d memcmp(%.*s, %s) != 0\n",
+                    i, arg, dp, (int) fm.mempos, fm.mem, buf);
+        free(fm.mem);
+    }
+
+    testFinish();
+}
+
+static void test_putsi(const testCtx *const p_ctx) {
+
+    struct item {
+        const char *prefix;
+        int arg;
+        const char *expected;
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    struct item data[] = {
+        /*  0*/ { "", 0, "0" },
+        /*  1*/ { "", 1, "1" },
+        /*  2*/ { "", -1, "-1" },
+        /*  3*/ { "w=", 1234567890, "w=1234567890" },
+        /*  4*/ { "", -2147483647 - 1, "-2147483648" },
+        /*  5*/ { NULL, 2147483647, "2147483647" },
+    };
+    int data_size = ARRAY_SIZE(data);
+    int i, ret;
+    struct filemem fm;
+
+    testStart("test_putsi");
+
+    for (i = 0; i < data_size; i++) {
+
+        if (testContinue(p_ctx, i)) continue;
+
+        memset(&fm, 0, sizeof(fm));
+        ret = fm_putsi(data[i].prefix, data[i].arg, &fm);
+        assert_equal(ret, 1, "i:%d fm_putsi ret %d != 1\n", i, ret);
+        assert_equal((int) fm.mempos, (int) strlen(data[i].expected), "i:%d mempos %d != %d (%.*s)\n",
+                    i, (int) fm.mempos, (int) strlen(data[i].expected), (int) fm.mempos, fm.mem);
+        assert_zero(memcmp(fm.mem, data[i].expected, fm.mempos), "i:%d memcmp(%.*s, %s) != 0\n",
+                    i, (int) fm.mempos, fm.mem, data[i].expected);
+        free(fm.mem);
+    }
+
+    testFinish();
+}
+
+static void test_file(const testCtx *const p_ctx) {
+    int i, ret;
+    struct zint_symbol *symbol;
+    struct filemem fm;
+    struct filemem *const fmp = &fm;
+    const char filename[] = "test_filemem.txt";
+    char expected[0x6000 + 1];
+    char buf[0x6000 + 1];
+    FILE *fp;
+    size_t len;
+
+    (void)p_ctx;
+
+    testStart("test_file");
+
+    symbol = ZBarcode_Create();
+    assert_nonnull(symbol, "Symbol not created\n");
+    strcpy(symbol->outfile, filename);
+
+    ret = fm_open(fmp, symbol, "wb");
+    assert_equal(ret, 1, "fm_open ret %d != 1\n", ret);
+
+    /* Write enough to grow buffer a couple of times and flush a chunk */
+    for (i = 0; i < 0x2000; i++) {
+        expected[i * 3] = 'a' + i % 26;
+        expected[i * 3 + 1] = 'b';
+        expected[i * 3 + 2] = 'c';
+        ret = fm_putc(expected[i * 3], fmp);
+        assert_equal(ret, 1, "i:%d fm_putc ret %d != 1\n", i, ret);
+        ret = fm_puts("b", fmp);
+        assert_equal(ret, 1, "i:%d fm_puts ret %d != 1\n", i, ret);
+        ret = (int) fm_write("c", 1, 1, fmp);
+        assert_equal(ret, 1, "i:%d fm_write ret %d != 1\n", i, ret);
+    }
+    expected[0x6000] = '\0';
+    assert_zero(fm_error(fmp), "fm_error %d != 0\n", fm_error(fmp));
+    /* Not held whole */
+    assert_nonzero(fmp->flushed, "fmp->flushed zero\n");
+    assert_nonzero(fmp->memsize <= 0x4000, "fmp->memsize 0x%X > 0x4000\n", (int) fmp->memsize);
+
+    ret = fm_close(fmp, symbol);
+    assert_equal(ret, 1, "fm_close ret %d != 1\n", ret);
+    assert_null(fmp->mem, "fmp->mem not NULL\n");
+
+    fp = fopen(filename, "rb");
+    assert_nonnull(fp, "fopen(%s) failed\n", filename);
+    len = fread(buf, 1, sizeof(buf), fp);
+    assert_equal((int) len, 0x6000, "fread len %d != 0x6000\n", (int) len);
+    assert_zero(memcmp(buf, expected, len), "memcmp(buf, expected) != 0\n");
+    fclose(fp);
+
+    assert_zero(remove(filename), "remove(%s) != 0\n", filename);
+
+    ZBarcode_Delete(symbol);
+
+    testFinish();
+}
+
+/* Check output discarded on error, with nothing written, handed over or passed on */
+static void test_discard(const testCtx *const p_ctx) {
+    int ret;
+    struct zint_symbol *symbol;
+    struct filemem fm;
+    struct filemem *const fmp = &fm;
+    const char filename[] = "test_filemem_discard.txt";
+    unsigned char *memfile;
+
+    (void)p_ctx;
+
+    testStart("test_discard");
+
+    symbol = ZBarcode_Create();
+    assert_nonnull(symbol, "Symbol not created\n");
+    strcpy(symbol->outfile, filename);
+
+    /* File removed */
+    ret = fm_open(fmp, symbol, "wb");
+    assert_equal(ret, 1, "fm_open ret %d != 1\n", ret);
+    assert_nonzero(testUtilExists(filename), "testUtilExists(%s) == 0\n", filename);
+    ret = fm_puts("partial", fmp);
+    assert_equal(ret, 1, "fm_puts ret %d != 1\n", ret);
+    fm_discard(fmp, symbol);
+    assert_null(fmp->mem, "fmp->mem not NULL\n");
+    assert_null(fmp->fp, "fmp->fp not NULL\n");
+    assert_zero(testUtilExists(filename), "testUtilExists(%s) != 0\n", filename);
+
+    /* Memory file left as was */
+    symbol->output_options |= BARCODE_MEMORY_FILE;
+    ret = fm_open(fmp, symbol, "wb");
+    assert_equal(ret, 1, "fm_open ret %d != 1\n", ret);
+    ret = fm_puts("first", fmp);
+    assert_equal(ret, 1, "fm_puts ret %d != 1\n", ret);
+    ret = fm_close(fmp, symbol);
+    assert_equal(ret, 1, "fm_close ret %d != 1\n", ret);
+    memfile = symbol->memfile;
+    assert_nonnull(memfile, "memfile NULL\n");
+
+    ret = fm_open(fmp, symbol, "wb");
+    assert_equal(ret, 1, "fm_open ret %d != 1\n", ret);
+    ret = fm_puts("partial", fmp);
+    assert_equal(ret, 1, "fm_puts ret %d != 1\n", ret);
+    fm_discard(fmp, symbol);
+    assert_null(fmp->mem, "fmp->mem not NULL\n");
+    assert_equal(symbol->memfile, memfile, "memfile changed\n");
+    assert_equal(symbol->memfile_size, 5, "memfile_size %d != 5\n", symbol->memfile_size);
+    assert_zero(memcmp(symbol->memfile, "first", 5), "memcmp(memfile, first) != 0\n");
+    assert_zero(testUtilExists(filename), "testUtilExists(%s) != 0\n", filename);
+
+    ZBarcode_Delete(symbol);
+
+    testFinish();
+}
+
+/* Stream callback context for tests */
+struct stream_ctx {
+    unsigned char *buf;
+    size_t len;
+    int calls;
+    size_t fail_after; /* Fail with ENOSPC if output would exceed this many bytes (0 never) */
+};
+
+static int stream_write(void *ctx, const void *buf, size_t len) {
+    struct stream_ctx *sctx = (struct stream_ctx *) ctx;
+
+    if (sctx->fail_after && sctx->len + len > sctx->fail_after) {
+        return ENOSPC;
+    }
+    if (!(sctx->buf = (unsigned char *) realloc(sctx->buf, sctx->len + len))) {
+        return ENOMEM;
+    }
+    memcpy(sctx->buf + sctx->len, buf, len);
+    sctx->len += len;
+    sctx->calls++;
+    return 0;
+}
+
+/* Same as `stream_write()`, but a different callback */
+static int stream_write_other(void *ctx, const void *buf, size_t len) {
+    return stream_write(ctx, buf, len);
+}
+
+/* Check output seeking */
+static void test_seek(const testCtx *const p_ctx) {
+    int i, ret;
+    long pos;
+    struct zint_symbol *symbol;
+    struct filemem fm;
+    struct filemem *const fmp = &fm;
+    struct stream_ctx sctx;
+    const char filename[] = "test_filemem_seek.bin";
+    unsigned char buf[0x4002 + 1];
+    FILE *fp;
+    size_t len;
+
+    (void)p_ctx;
+
+    testStart("test_seek");
+
+    symbol = ZBarcode_Create();
+    assert_nonnull(symbol, "Symbol not created\n");
+    symbol->output_options |= BARCODE_MEMORY_FILE;
+
+    ret = fm_open(fmp, symbol, "wb");
+    assert_equal(ret, 1, "fm_open ret %d != 1\n", ret);
+    assert_null(fmp->fp, "fmp->fp not NULL\n");
+
+    ret = fm_puts("abcdefgh", fmp);
+    assert_equal(ret, 1, "fm_puts ret %d != 1\n", ret);
+    pos = fm_tell(fmp);
+    assert_equal(pos, 8, "fm_tell %ld != 8\n", pos);
+
+    ret = fm_seek(fmp, 2, SEEK_SET);
+    assert_equal(ret, 1, "fm_seek SEEK_SET ret %d != 1\n", ret);
+    ret = fm_puts("CD", fmp);
+    assert_equal(ret, 1, "fm_puts ret %d != 1\n", ret);
+    pos = fm_tell(fmp);
+    assert_equal(pos, 4, "fm_tell %ld != 4\n", pos);
+
+    ret = fm_seek(fmp, 1, SEEK_CUR);
+    assert_equal(ret, 1, "fm_seek SEEK_CUR ret %d != 1\n", ret);
+    ret = fm_putc('F', fmp);
+    assert_equal(ret, 1, "fm_putc ret %d != 1\n", ret);
+
+    ret = fm_seek(fmp, -1, SEEK_END);
+    assert_equal(ret, 1, "fm_seek SEEK_END ret %d != 1\n", ret);
+    ret = fm_puts("HIJ", fmp); /* Extends output */
+    assert_equal(ret, 1, "fm_puts ret %d != 1\n", ret);
+    pos = fm_tell(fmp);
+    assert_equal(pos, 10, "fm_tell %ld != 10\n", pos);
+    assert_zero(fm_error(fmp), "fm_error %d != 0\n", fm_error(fmp));
+
+    ret = fm_close(fmp, symbol);
+    assert_equal(ret, 1, "fm_close ret %d != 1\n", ret);
+    assert_nonnull(symbol->memfile, "memfile NULL\n");
+    assert_equal(symbol->memfile_size, 10, "memfile_size %d != 10\n", symbol->memfile_size);
+    assert_zero(memcmp(symbol->memfile, "abCDeFgHIJ", 10), "memcmp(%.*s, abCDeFgHIJ) != 0\n",
+                symbol->memfile_size, symbol->memfile);
+
+    /* Out of range */
+    ret = fm_open(fmp, symbol, "wb");
+    assert_equal(ret, 1, "fm_open ret %d != 1\n", ret);
+    ret = fm_puts("abc", fmp);
+    assert_equal(ret, 1, "fm_puts ret %d != 1\n", ret);
+    ret = fm_seek(fmp, 4, SEEK_SET);
+    assert_zero(ret, "fm_seek beyond end ret %d != 0\n", ret);
+    assert_equal(fm_error(fmp), EINVAL, "fm_error %d != EINVAL (%d)\n", fm_error(fmp), EINVAL);
+    pos = fm_tell(fmp);
+    assert_equal(pos, -1, "fm_tell %ld != -1\n", pos);
+    ret = fm_close(fmp, symbol);
+    assert_zero(ret, "fm_close ret %d != 0\n", ret);
+    /* Previous memfile left untouched on failure */
+    assert_equal(symbol->memfile_size, 10, "memfile_size %d != 10\n", symbol->memfile_size);
+
+    ret = fm_open(fmp, symbol, "wb");
+    assert_equal(ret, 1, "fm_open ret %d != 1\n", ret);
+    ret = fm_seek(fmp, -1, SEEK_CUR);
+    assert_zero(ret, "fm_seek before start ret %d != 0\n", ret);
+    assert_equal(fm_error(fmp), EINVAL, "fm_error %d != EINVAL (%d)\n", fm_error(fmp), EINVAL);
+    (void) fm_close(fmp, symbol);
+
+    /* Streaming, can only seek within chunk not yet passed to callback */
+    memset(&sctx, 0, sizeof(sctx));
+    symbol->output_options = BARCODE_STREAM_WRITE;
+    symbol->write_fn = stream_write;
+    symbol->write_ctx = &sctx;
+    ret = fm_open(fmp, symbol, "wb");
+    assert_equal(ret, 1, "fm_open ret %d != 1\n", ret);
+    for (i = 0; i < 0x4000; i++) {
+        ret = fm_putc('a', fmp);
+        assert_equal(ret, 1, "i:%d fm_putc ret %d != 1\n", i, ret);
+    }
+    assert_zero(sctx.calls, "calls %d != 0\n", sctx.calls);
+    ret = fm_puts("bb", fmp);
+    assert_equal(ret, 1, "fm_puts ret %d != 1\n", ret);
+    assert_equal(sctx.calls, 1, "calls %d != 1\n", sctx.calls);
+    assert_equal((int) sctx.len, 0x4000, "len 0x%X != 0x4000\n", (int) sctx.len);
+    pos = fm_tell(fmp);
+    assert_equal(pos, 0x4002, "fm_tell 0x%lX != 0x4002\n", pos);
+    ret = fm_seek(fmp, 0x4001, SEEK_SET);
+    assert_equal(ret, 1, "fm_seek unflushed ret %d != 1\n", ret);
+    ret = fm_putc('c', fmp);
+    assert_equal(ret, 1, "fm_putc ret %d != 1\n", ret);
+    ret = fm_close(fmp, symbol);
+    assert_equal(ret, 1, "fm_close ret %d != 1\n", ret);
+    assert_equal(sctx.calls, 2, "calls %d != 2\n", sctx.calls);
+    assert_equal((int) sctx.len, 0x4002, "len 0x%X != 0x4002\n", (int) sctx.len);
+    assert_zero(memcmp(sctx.buf + 0x3FFF, "abc", 3), "memcmp(%.3s, abc) != 0\n", sctx.buf + 0x3FFF);
+    assert_equal(symbol->memfile_size, 10, "memfile_size %d != 10\n", symbol->memfile_size);
+    free(sctx.buf);
+
+    memset(&sctx, 0, sizeof(sctx));
+    ret = fm_open(fmp, symbol, "wb");
+    assert_equal(ret, 1, "fm_open ret %d != 1\n", ret);
+    for (i = 0; i < 0x4001; i++) {
+        ret = fm_putc('a', fmp);
+        assert_equal(ret, 1, "i:%d fm_putc ret %d != 1\n", i, ret);
+    }
+    ret = fm_seek(fmp, 0x3FFF, SEEK_SET);
+    assert_zero(ret, "fm_seek flushed ret %d != 0\n", ret);
+    assert_equal(fm_error(fmp), EINVAL, "fm_error %d != EINVAL (%d)\n", fm_error(fmp), EINVAL);
+    ret = fm_close(fmp, symbol);
+    assert_zero(ret, "fm_close ret %d != 0\n", ret);
+    free(sctx.buf);
+
+    /* File, can seek back into flushed output */
+    symbol->output_options = 0;
+    strcpy(symbol->outfile, filename);
+    ret = fm_open(fmp, symbol, "wb");
+    assert_equal(ret, 1, "fm_open ret %d != 1\n", ret);
+    for (i = 0; i < 0x4001; i++) {
+        ret = fm_putc('a', fmp);
+        assert_equal(ret, 1, "i:%d fm_putc ret %d != 1\n", i, ret);
+    }
+    assert_nonzero(fmp->flushed, "fmp->flushed zero\n");
+    ret = fm_seek(fmp, 1, SEEK_SET);
+    assert_equal(ret, 1, "fm_seek flushed ret %d != 1 (%d)\n", ret, fm_error(fmp));
+    ret = fm_putc('b', fmp);
+    assert_equal(ret, 1, "fm_putc ret %d != 1\n", ret);
+    pos = fm_tell(fmp);
+    assert_equal(pos, 2, "fm_tell %ld != 2\n", pos);
+    ret = fm_seek(fmp, 0, SEEK_END);
+    assert_equal(ret, 1, "fm_seek SEEK_END ret %d != 1 (%d)\n", ret, fm_error(fmp));
+    pos = fm_tell(fmp);
+    assert_equal(pos, 0x4001, "fm_tell 0x%lX != 0x4001\n", pos);
+    ret = fm_puts("c", fmp);
+    assert_equal(ret, 1, "fm_puts ret %d != 1\n", ret);
+    ret = fm_close(fmp, symbol);
+    assert_equal(ret, 1, "fm_close ret %d != 1\n", ret);
+
+    fp = fopen(filename, "rb");
+    assert_nonnull(fp, "fopen(%s) failed\n", filename);
+    len = fread(buf, 1, sizeof(buf), fp);
+    fclose(fp);
+    assert_equal((int) len, 0x4002, "fread len 0x%X != 0x4002\n", (int) len);
+    assert_zero(memcmp(buf, "aba", 3), "memcmp(%.3s, aba) != 0\n", buf);
+    assert_zero(memcmp(buf + 0x3FFF, "aac", 3), "memcmp(%.3s, aac) != 0\n", buf + 0x3FFF);
+    assert_zero(remove(filename), "remove(%s) != 0\n", filename);
+
+    ZBarcode_Clear(symbol);
+    assert_null(symbol->memfile, "memfile not NULL after ZBarcode_Clear()\n");
+    assert_zero(symbol->memfile_size, "memfile_size %d != 0 after ZBarcode_Clear()\n", symbol->memfile_size);
+
+    ZBarcode_Delete(symbol);
+
+    testFinish();
+}
+
+/* Check BARCODE_MEMORY_FILE output same as file output for all formats */
+static void test_memfile(const testCtx *const p_ctx) {
+    int debug = p_ctx->debug;
+
+    struct item {
+        int symbology;
+        int output_options;
+        float scale;
+        const char *outfile;
+        int is_text;
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    struct item data[] = {
+        /*  0*/ { BARCODE_CODE128, -1, 0, "test_filemem_mem.bmp", 0 },
+        /*  1*/ { BARCODE_QRCODE, -1, 0, "test_filemem_mem.emf", 0 },
+        /*  2*/ { BARCODE_DATAMATRIX, -1, 0, "test_filemem_mem.eps", 1 },
+        /*  3*/ { BARCODE_ULTRA, -1, 0, "test_filemem_mem.eps", 1 },
+        /*  4*/ { BARCODE_AZTEC, -1, 0, "test_filemem_mem.gif", 0 },
+        /*  5*/ { BARCODE_PDF417, -1, 0, "test_filemem_mem.pcx", 0 },
+        /*  6*/ { BARCODE_MAXICODE, -1, 0, "test_filemem_mem.png", 0 },
+        /*  7*/ { BARCODE_DOTCODE, -1, 0, "test_filemem_mem.svg", 1 },
+        /*  8*/ { BARCODE_CODE128, -1, 0, "test_filemem_mem.tif", 0 },
+        /*  9*/ { BARCODE_ULTRA, CMYK_COLOUR, 0, "test_filemem_mem.tif", 0 },
+        /* 10*/ { BARCODE_CODE16K, -1, 0, "test_filemem_mem.txt", 1 },
+        /* 11*/ { BARCODE_PDF417, -1, 10, "test_filemem_mem.bmp", 0 }, /* File output flushed in chunks */
+        /* 12*/ { BARCODE_PDF417, -1, 20, "test_filemem_mem.tif", 0 }, /* LZW seeks back into flushed output */
+    };
+    int data_size = ARRAY_SIZE(data);
+    int i, ret;
+    struct zint_symbol *symbol;
+    FILE *fp;
+    unsigned char *buf;
+    int len;
+
+    testStart("test_memfile");
+
+    for (i = 0; i < data_size; i++) {
+
+        if (testContinue(p_ctx, i)) continue;
+
+        if (ZBarcode_NoPng() && strcmp(data[i].outfile + strlen(data[i].outfile) - 3, "png") == 0) {
+            if (debug & ZINT_DEBUG_TEST_PRINT) printf("i:%d PNG not available, skipping\n", i);
+            continue;
+        }
+
+        symbol = ZBarcode_Create();
+        assert_nonnull(symbol, "Symbol not created\n");
+        (void) testUtilSetSymbol(symbol, data[i].symbology, -1 /*input_mode*/, -1 /*eci*/, -1 /*option_1*/, -1,
+                    -1, data[i].output_options, "1234", -1, debug);
+        if (data[i].scale) {
+            symbol->scale = data[i].scale;
+        }
+        strcpy(symbol->outfile, data[i].outfile);
+        ret = ZBarcode_Encode_and_Print(symbol, TU("1234"), 0, 0);
+        assert_zero(ret, "i:%d ZBarcode_Encode_and_Print(%s) ret %d != 0 (%s)\n",
+                    i, data[i].outfile, ret, symbol->errtxt);
+        assert_null(symbol->memfile, "i:%d memfile not NULL\n", i);
+
+        symbol->output_options |= BARCODE_MEMORY_FILE;
+        ret = ZBarcode_Print(symbol, 0);
+        assert_zero(ret, "i:%d ZBarcode_Print(%s) memory ret %d != 0 (%s)\n",
+                    i, data[i].outfile, ret, symbol->errtxt);
+        assert_nonnull(symbol->memfile, "i:%d memfile NULL\n", i);
+        assert_nonzero(symbol->memfile_size, "i:%d memfile_size zero\n", i);
+
+        /* Text formats may have had line endings translated */
+        fp = fopen(data[i].outfile, data[i].is_text ? "r" : "rb");
+        assert_nonnull(fp, "i:%d fopen(%s) failed\n", i, data[i].outfile);
+        buf = (unsigned char *) malloc(symbol->memfile_size + 1);
+        assert_nonnull(buf, "i:%d malloc failed\n", i);
+        len = (int) fread(buf, 1, symbol->memfile_size + 1, fp);
+        fclose(fp);
+        assert_equal(len, symbol->memfile_size, "i:%d file len %d != memfile_size %d\n",
+                    i, len, symbol->memfile_size);
+        assert_zero(memcmp(buf, symbol->memfile, len), "i:%d memcmp(file, memfile) != 0\n", i);
+        free(buf);
+
+        /* Printing again replaces buffer */
+        len = symbol->memfile_size;
+        ret = ZBarcode_Print(symbol, 0);
+        assert_zero(ret, "i:%d ZBarcode_Print(%s) memory 2nd ret %d != 0 (%s)\n",
+                    i, data[i].outfile, ret, symbol->errtxt);
+        assert_nonnull(symbol->memfile, "i:%d memfile NULL\n", i);
+        assert_equal(symbol->memfile_size, len, "i:%d memfile_size %d != %d\n", i, symbol->memfile_size, len);
+
+        if (!(debug & ZINT_DEBUG_TEST_KEEP_OUTFILE)) {
+            assert_zero(remove(data[i].outfile), "i:%d remove(%s) != 0\n", i, data[i].outfile);
+        }
+
+        ZBarcode_Delete(symbol);
+    }
+
+    testFinish();
+}
+
+/* Check BARCODE_STREAM_WRITE output same as file output */
+static void test_stream(const testCtx *const p_ctx) {
+    int debug = p_ctx->debug;
+
+    struct item {
+        int symbology;
+        int output_options;
+        float scale;
+        const char *outfile;
+        int is_text;
+        size_t fail_after;
+        int ret;
+        int min_calls;
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    struct item data[] = {
+        /*  0*/ { BARCODE_CODE128, -1, 0, "test_filemem_stream.bmp", 0, 0, 0, 1 },
+        /*  1*/ { BARCODE_PDF417, -1, 10, "test_filemem_stream.bmp", 0, 0, 0, 1 },
+        /*  2*/ { BARCODE_QRCODE, -1, 0, "test_filemem_stream.emf", 0, 0, 0, 1 },
+        /*  3*/ { BARCODE_DATAMATRIX, -1, 0, "test_filemem_stream.eps", 1, 0, 0, 1 },
+        /*  4*/ { BARCODE_AZTEC, -1, 0, "test_filemem_stream.gif", 0, 0, 0, 1 },
+        /*  5*/ { BARCODE_PDF417, -1, 5, "test_filemem_stream.pcx", 0, 0, 0, 2 },
+        /*  6*/ { BARCODE_MAXICODE, -1, 0, "test_filemem_stream.png", 0, 0, 0, 1 },
+        /*  7*/ { BARCODE_DOTCODE, -1, 0, "test_filemem_stream.svg", 1, 0, 0, 1 },
+        /*  8*/ { BARCODE_CODE16K, -1, 0, "test_filemem_stream.txt", 1, 0, 0, 1 },
+        /*  9*/ { BARCODE_PDF417, -1, 10, "test_filemem_stream.bmp", 0, 1000, ZINT_ERROR_FILE_WRITE, 0 },
+        /* 10*/ { BARCODE_PDF417, -1, 0, "test_filemem_stream.svg", 0, 100, ZINT_ERROR_FILE_WRITE, 0 },
+        /* 11*/ { BARCODE_CODE128, -1, 0, "test_filemem_stream.png", 0, 10, ZINT_ERROR_FILE_WRITE, 0 },
+    };
+    int data_size = ARRAY_SIZE(data);
+    int i, ret;
+    struct zint_symbol *symbol;
+    struct stream_ctx sctx;
+    FILE *fp;
+    unsigned char *buf;
+    int len;
+
+    testStart("test_stream");
+
+    for (i = 0; i < data_size; i++) {
+
+        if (testContinue(p_ctx, i)) continue;
+
+        if (ZBarcode_NoPng() && strcmp(data[i].outfile + strlen(data[i].outfile) - 3, "png") == 0) {
+            if (debug & ZINT_DEBUG_TEST_PRINT) printf("i:%d PNG not available, skipping\n", i);
+            continue;
+        }
+
+        symbol = ZBarcode_Create();
+        assert_nonnull(symbol, "Symbol not created\n");
+        (void) testUtilSetSymbol(symbol, data[i].symbology, -1 /*input_mode*/, -1 /*eci*/, -1 /*option_1*/, -1,
+                    -1, data[i].output_options, "1234", -1, debug);
+        if (data[i].scale) {
+            symbol->scale = data[i].scale;
+        }
+        strcpy(symbol->outfile, data[i].outfile);
+        ret = ZBarcode_Encode_and_Print(symbol, TU("1234"), 0, 0);
+        assert_zero(ret, "i:%d ZBarcode_Encode_and_Print(%s) ret %d != 0 (%s)\n",
+                    i, data[i].outfile, ret, symbol->errtxt);
+
+        memset(&sctx, 0, sizeof(sctx));
+        sctx.fail_after = data[i].fail_after;
+        symbol->output_options |= BARCODE_STREAM_WRITE;
+        symbol->write_fn = stream_write;
+        symbol->write_ctx = &sctx;
+        ret = ZBarcode_Print(symbol, 0);
+        assert_equal(ret, data[i].ret, "i:%d ZBarcode_Print(%s) stream ret %d != %d (%s)\n",
+                    i, data[i].outfile, ret, data[i].ret, symbol->errtxt);
+        assert_null(symbol->memfile, "i:%d memfile not NULL\n", i);
+
+        if (ret) {
+            assert_nonnull(strstr(symbol->errtxt, strerror(ENOSPC)), "i:%d errtxt \"%s\" no \"%s\"\n",
+                        i, symbol->errtxt, strerror(ENOSPC));
+        } else {
+            assert_nonzero(sctx.calls >= data[i].min_calls, "i:%d calls %d < %d\n",
+                        i, sctx.calls, data[i].min_calls);
+
+            /* Text formats may have had line endings translated */
+            fp = fopen(data[i].outfile, data[i].is_text ? "r" : "rb");
+            assert_nonnull(fp, "i:%d fopen(%s) failed\n", i, data[i].outfile);
+            buf = (unsigned char *) malloc(sctx.len + 1);
+            assert_nonnull(buf, "i:%d malloc failed\n", i);
+            len = (int) fread(buf, 1, sctx.len + 1, fp);
+            fclose(fp);
+            assert_equal(len, (int) sctx.len, "i:%d file len %d != stream len %d\n", i, len, (int) sctx.len);
+            assert_zero(memcmp(buf, sctx.buf, len), "i:%d memcmp(file, stream) != 0\n", i);
+            free(buf);
+        }
+        free(sctx.buf);
+
+        if (!(debug & ZINT_DEBUG_TEST_KEEP_OUTFILE)) {
+            assert_zero(remove(data[i].outfile), "i:%d remove(%s) != 0\n", i, data[i].outfile);
+        }
+
+        ZBarcode_Delete(symbol);
+    }
+
+    testFinish();
+}
+
+/* TIF doesn't use LZW compression when streaming, so check separately */
+static void test_stream_tif(const testCtx *const p_ctx) {
+    int debug = p_ctx->debug;
+    int ret;
+    struct zint_symbol *symbol;
+    struct stream_ctx sctx;
+    static const unsigned char header[4] = { 0x49, 0x49, 0x2A, 0x00 }; /* "II*\0" little-endian */
+    static const unsigned char header_be[4] = { 0x4D, 0x4D, 0x00, 0x2A }; /* "MM\0*" big-endian */
+
+    testStart("test_stream_tif");
+
+    symbol = ZBarcode_Create();
+    assert_nonnull(symbol, "Symbol not created\n");
+    (void) testUtilSetSymbol(symbol, BARCODE_CODABLOCKF, -1 /*input_mode*/, -1 /*eci*/, -1 /*option_1*/, -1,
+                -1, BARCODE_STREAM_WRITE, "1234", -1, debug);
+    symbol->scale = 5;
+    strcpy(symbol->outfile, "test_filemem_stream.tif");
+
+    /* No callback */
+    ret = ZBarcode_Encode_and_Print(symbol, TU("ABCDEFGHIJKLMNOPQRSTUVWXYZ1234567890"), 0, 0);
+    assert_equal(ret, ZINT_ERROR_INVALID_OPTION, "ZBarcode_Encode_and_Print ret %d != ZINT_ERROR_INVALID_OPTION\n",
+                ret);
+    assert_zero(strcmp(symbol->errtxt, "Error 786: Stream write callback NULL"), "errtxt %s\n", symbol->errtxt);
+
+    memset(&sctx, 0, sizeof(sctx));
+    symbol->write_fn = stream_write;
+    symbol->write_ctx = &sctx;
+    ret = ZBarcode_Print(symbol, 0);
+    assert_zero(ret, "ZBarcode_Print ret %d != 0 (%s)\n", ret, symbol->errtxt);
+    assert_nonzero(sctx.calls > 1, "calls %d <= 1\n", sctx.calls);
+    assert_nonzero(sctx.len > 4, "len %d <= 4\n", (int) sctx.len);
+    assert_nonzero(memcmp(sctx.buf, header, 4) == 0 || memcmp(sctx.buf, header_be, 4) == 0,
+                "header %02X %02X %02X %02X\n", sctx.buf[0], sctx.buf[1], sctx.buf[2], sctx.buf[3]);
+    if (debug & ZINT_DEBUG_TEST_PRINT) printf("len %d, calls %d\n", (int) sctx.len, sctx.calls);
+    free(sctx.buf);
+
+    assert_nonzero(testUtilExists("test_filemem_stream.tif") == 0, "test_filemem_stream.tif exists\n");
+
+    ZBarcode_Delete(symbol);
+
+    testFinish();
+}
+
+/* Symbols sharing a cache must each stream to their own callback */
+static void test_stream_cache(const testCtx *const p_ctx) {
+    int debug = p_ctx->debug;
+    int ret;
+    struct zint_cache *cache;
+    struct zint_symbol *symbol_a, *symbol_b;
+    struct stream_ctx sctx_a, sctx_b;
+    struct zint_cache_stats stats;
+
+    testStart("test_stream_cache");
+
+    cache = ZBarcode_Cache_Create(0);
+    assert_nonnull(cache, "ZBarcode_Cache_Create NULL\n");
+
+    symbol_a = ZBarcode_Create();
+    assert_nonnull(symbol_a, "Symbol A not created\n");
+    (void) testUtilSetSymbol(symbol_a, BARCODE_QRCODE, -1 /*input_mode*/, -1 /*eci*/, -1 /*option_1*/, -1, -1,
+                BARCODE_STREAM_WRITE, "1234", -1, debug);
+    strcpy(symbol_a->outfile, "test_filemem_stream_cache.svg");
+    symbol_a->cache = cache;
+    memset(&sctx_a, 0, sizeof(sctx_a));
+    symbol_a->write_fn = stream_write;
+    symbol_a->write_ctx = &sctx_a;
+
+    symbol_b = ZBarcode_Create();
+    assert_nonnull(symbol_b, "Symbol B not created\n");
+    (void) testUtilSetSymbol(symbol_b, BARCODE_QRCODE, -1 /*input_mode*/, -1 /*eci*/, -1 /*option_1*/, -1, -1,
+                BARCODE_STREAM_WRITE, "1234", -1, debug);
+    strcpy(symbol_b->outfile, "test_filemem_stream_cache.svg");
+    symbol_b->cache = cache;
+    memset(&sctx_b, 0, sizeof(sctx_b));
+    symbol_b->write_fn = stream_write_other;
+    symbol_b->write_ctx = &sctx_b;
+
+    ret = ZBarcode_Encode_and_Print(symbol_a, TU("1234"), 0, 0);
+    assert_zero(ret, "ZBarcode_Encode_and_Print(A) ret %d != 0 (%s)\n", ret, symbol_a->errtxt);
+    assert_nonzero(sctx_a.len, "A len zero\n");
+
+    ret = ZBarcode_Encode_and_Print(symbol_b, TU("1234"), 0, 0);
+    assert_zero(ret, "ZBarcode_Encode_and_Print(B) ret %d != 0 (%s)\n", ret, symbol_b->errtxt);
+
+    ZBarcode_Cache_Stats(cache, &stats);
+    assert_equal((int) stats.hits, 1, "hits %d != 1\n", (int) stats.hits);
+
+    assert_equal(symbol_b->write_fn, stream_write_other, "B write_fn changed\n");
+    assert_equal(symbol_b->write_ctx, &sctx_b, "B write_ctx changed\n");
+    assert_equal((int) sctx_b.len, (int) sctx_a.len, "B len %d != A len %d\n", (int) sctx_b.len, (int) sctx_a.len);
+    assert_zero(memcmp(sctx_b.buf, sctx_a.buf, sctx_a.len), "memcmp(B, A) != 0\n");
+
+    assert_nonzero(testUtilExists("test_filemem_stream_cache.svg") == 0, "test_filemem_stream_cache.svg exists\n");
+
+    free(sctx_a.buf);
+    free(sctx_b.buf);
+    ZBarcode_Delete(symbol_a);
+    ZBarcode_Delete(symbol_b);
+    ZBarcode_Cache_Delete(cache);
+
+    testFinish();
+}
+
+/* Check vector output unaffected by (non-"C") locale */
+static void test_locale(const testCtx *const p_ctx) {
+    int debug = p_ctx->debug;
+
+    struct item {
+        int symbology;
+        const char *outfile;
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    struct item data[] = {
+        /*  0*/ { BARCODE_MAXICODE, "test_filemem_locale.svg" },
+        /*  1*/ { BARCODE_DOTCODE, "test_filemem_locale.eps" },
+        /*  2*/ { BARCODE_CODE128, "test_filemem_locale.svg" },
+        /*  3*/ { BARCODE_ULTRA, "test_filemem_locale.eps" },
+    };
+    int data_size = ARRAY_SIZE(data);
+    int i, ret;
+    struct zint_symbol *symbol;
+    char c_outfile[64];
+    const char *locales[] = { "de_DE.UTF-8", "de_DE", "fr_FR.UTF-8", "fr_FR", "German", "French" };
+    const char *locale = NULL;
+    char *prev_locale;
+
+    testStart("test_locale");
+
+    prev_locale = setlocale(LC_ALL, NULL);
+    if (prev_locale) {
+        prev_locale = strcpy((char *) malloc(strlen(prev_locale) + 1), prev_locale);
+    }
+    for (i = 0; i < ARRAY_SIZE(locales) && !locale; i++) {
+        if (setlocale(LC_ALL, locales[i]) && localeconv()->decimal_point[0] == ',') {
+            locale = locales[i];
+        }
+    }
+    if (prev_locale) {
+        setlocale(LC_ALL, prev_locale);
+    }
+    if (!locale) {
+        free(prev_locale);
+        testSkip("No comma decimal point locale available");
+        return;
+    }
+
+    for (i = 0; i < data_size; i++) {
+
+        if (testContinue(p_ctx, i)) continue;
+
+        /* "C" locale */
+        symbol = ZBarcode_Create();
+        assert_nonnull(symbol, "Symbol not created\n");
+        (void) testUtilSetSymbol(symbol, data[i].symbology, -1 /*input_mode*/, -1 /*eci*/, -1 /*option_1*/, -1,
+                    -1, -1 /*output_options*/, "1234", -1, debug);
+        sprintf(c_outfile, "c_%s", data[i].outfile);
+        strcpy(symbol->outfile, c_outfile);
+        ret = ZBarcode_Encode_and_Print(symbol, TU("1234"), 0, 0);
+        assert_zero(ret, "i:%d ZBarcode_Encode_and_Print(%s) ret %d != 0 (%s)\n",
+                    i, c_outfile, ret, symbol->errtxt);
+        ZBarcode_Delete(symbol);
+
+        /* Comma decimal point locale */
+        setlocale(LC_ALL, locale);
+        symbol = ZBarcode_Create();
+        assert_nonnull(symbol, "Symbol not created\n");
+        (void) testUtilSetSymbol(symbol, data[i].symbology, -1 /*input_mode*/, -1 /*eci*/, -1 /*option_1*/, -1,
+                    -1, -1 /*output_options*/, "1234", -1, debug);
+        strcpy(symbol->outfile, data[i].outfile);
+        ret = ZBarcode_Encode_and_Print(symbol, TU("1234"), 0, 0);
+        setlocale(LC_ALL, prev_locale ? prev_locale : "C");
+        assert_zero(ret, "i:%d ZBarcode_Encode_and_Print(%s) ret %d != 0 (%s)\n",
+                    i, data[i].outfile, ret, symbol->errtxt);
+        ZBarcode_Delete(symbol);
+
+        ret = testUtilCmpBins(c_outfile, data[i].outfile);
+        assert_zero(ret, "i:%d testUtilCmpBins(%s, %s) %d != 0\n", i, c_outfile, data[i].outfile, ret);
+
+        assert_zero(remove(c_outfile), "i:%d remove(%s) != 0\n", i, c_outfile);
+        assert_zero(remove(data[i].outfile), "i:%d remove(%s) != 0\n", i, data[i].outfile);
+    }
+
+    free(prev_locale);
+
+    testFinish();
+}
+
+int main(int argc, char *argv[]) {
+
+    testFunction funcs[] = { /* name, func */
+        { "test_putsf", test_putsf },
+        { "test_putsf_random", test_putsf_random },
+        { "test_putsi", test_putsi },
+        { "test_file", test_file },
+        { "test_discard", test_discard },
+        { "test_seek", test_seek },
+        { "test_memfile", test_memfile },
+        { "test_stream", test_stream },
+        { "test_stream_tif", test_stream_tif },
+        { "test_stream_cache", test_stream_cache },
+        { "test_locale", test_locale },
+    };
+
+    testRun(argc, argv, funcs, ARRAY_SIZE(funcs));
+
+    testReport();
+
+    return 0;
+}
+
+/* vim: set ts=4 sw=4 et : */
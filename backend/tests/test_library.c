@@ -32,6 +32,7 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <math.h>
+#include <stddef.h>
 #include <sys/stat.h>
 #include "testcommon.h"
 #include "../common.h"
@@ -558,6 +559,14 @@ static void test_escape_char_process(const testCtx *const p_ctx) {
         /* 78*/ { BARCODE_CODE128, DATA_MODE | EXTRA_ESCAPE_MODE, -1, "\\^A1", "", 0, 46, "(4) 103 17 17 106", 0, "" },
         /* 79*/ { BARCODE_CODE128, EXTRA_ESCAPE_MODE, -1, "\\^", "", 0, 57, "(5) 104 60 62 82 106", 0, "Partial special escape '\\^' at end allowed" },
         /* 80*/ { BARCODE_CODE128, EXTRA_ESCAPE_MODE, -1, "\\^D1", "", 0, 79, "(7) 104 60 62 36 17 52 106", 0, "Unknown special escapes passed straight thu" },
+        /* 81*/ { BARCODE_DATAMATRIX, DATA_MODE, -1, "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789", "", 0, 22, "(50) E6 59 E9 6D 24 80 5F 93 9A A6 D5 BA 10 CD 4B E0 86 FE 5A 5B 83 99 AF C5 DB 81 68 FE", 0, "No escapes" },
+        /* 82*/ { BARCODE_DATAMATRIX, DATA_MODE, -1, "ABCDEFGHIJ\\x4BLMNOPQRSTUV\\d087XYZ0123456789", "", 0, 22, "(50) E6 59 E9 6D 24 80 5F 93 9A A6 D5 BA 10 CD 4B E0 86 FE 5A 5B 83 99 AF C5 DB 81 68 FE", 1, "Runs between escapes" },
+        /* 83*/ { BARCODE_DATAMATRIX, DATA_MODE, -1, "\\x41BCDEFGHIJKLMNOPQRSTUVWXYZ012345678\\o071", "", 0, 22, "(50) E6 59 E9 6D 24 80 5F 93 9A A6 D5 BA 10 CD 4B E0 86 FE 5A 5B 83 99 AF C5 DB 81 68 FE", 1, "Escapes at start & end" },
+        /* 84*/ { BARCODE_DATAMATRIX, UNICODE_MODE, -1, "ABCDEFGHIJKLMNOPQRSTUVWXYZ\\u00E9", "", 0, 20, "(40) E6 59 E9 6D 24 80 5F 93 9A A6 D5 BA 10 CD 4B E0 86 FE 5A 5B EB 6A E6 A8 EC 0D 56 48", 0, "" },
+        /* 85*/ { BARCODE_DATAMATRIX, UNICODE_MODE, -1, "ABCDEFGHIJKLMNOPQRSTUVWXYZé", "", 0, 20, "(40) E6 59 E9 6D 24 80 5F 93 9A A6 D5 BA 10 CD 4B E0 86 FE 5A 5B EB 6A E6 A8 EC 0D 56 48", 1, "" },
+        /* 86*/ { BARCODE_DATAMATRIX, DATA_MODE, -1, "ABCDEFGHIJKLMNOPQRSTUVWXYZ\\", "", ZINT_ERROR_INVALID_DATA, 0, "Error 236: Incomplete escape character in input data", 0, "" },
+        /* 87*/ { BARCODE_CODE128, DATA_MODE | EXTRA_ESCAPE_MODE, -1, "ABC\\^A1DEF\\G", "", 0, 134, "(12) 104 33 34 35 101 17 36 37 38 93 46 106", 0, "" },
+        /* 88*/ { BARCODE_GS1_128_CC, GS1_MODE, -1, "[20]1\\c", "[10]A", ZINT_ERROR_INVALID_DATA, 0, "Error 234: Unrecognised escape character '\\c' in input data", 0, "Primary left untouched on error" },
     };
     int data_size = ARRAY_SIZE(data);
     int i, length, ret;
@@ -592,6 +601,9 @@ static void test_escape_char_process(const testCtx *const p_ctx) {
 
         ret = ZBarcode_Encode(symbol, TU(text), length);
         assert_equal(ret, data[i].ret, "i:%d ZBarcode_Encode ret %d != %d (%s)\n", i, ret, data[i].ret, symbol->errtxt);
+        if (ret >= ZINT_ERROR && data[i].composite[0]) {
+            assert_zero(strcmp(symbol->primary, data[i].data), "i:%d strcmp(%s, %s) != 0\n", i, symbol->primary, data[i].data);
+        }
 
         if (p_ctx->generate) {
             printf("        /*%3d*/ { %s, %s, %d, \"%s\", \"%s\", %s, %d, \"%s\", %d, \"%s\" },\n",
@@ -1588,6 +1600,1335 @@ static void test_xdimdp_from_scale(const testCtx *const p_ctx) {
     testFinish();
 }
 
+struct batch_cb_ctx {
+    int count;
+    int in_order;
+};
+
+static void batch_cb(void *ctx, struct zint_batch_item *item, int index) {
+    struct batch_cb_ctx *cb_ctx = (struct batch_cb_ctx *) ctx;
+    if (index != cb_ctx->count || !item->symbol) {
+        cb_ctx->in_order = 0;
+    }
+    cb_ctx->count++;
+}
+
+static void test_encode_batch(const testCtx *const p_ctx) {
+    int debug = p_ctx->debug;
+
+    struct item {
+        int symbology;
+        int output_type;
+        int num_threads;
+        int use_callback;
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    struct item data[] = {
+        /*  0*/ { BARCODE_CODE128, ZINT_BATCH_ENCODE, 1, 0 },
+        /*  1*/ { BARCODE_CODE128, ZINT_BATCH_BUFFER, 4, 1 },
+        /*  2*/ { BARCODE_CODE128, ZINT_BATCH_BUFFER_VECTOR, 0, 1 },
+        /*  3*/ { BARCODE_QRCODE, ZINT_BATCH_ENCODE, 4, 1 },
+        /*  4*/ { BARCODE_QRCODE, ZINT_BATCH_BUFFER, 0, 0 },
+        /*  5*/ { BARCODE_QRCODE, ZINT_BATCH_BUFFER_VECTOR, 3, 1 },
+        /*  6*/ { BARCODE_DATAMATRIX, ZINT_BATCH_BUFFER, 2, 1 },
+        /*  7*/ { BARCODE_EANX, ZINT_BATCH_BUFFER_VECTOR, 4, 1 },
+        /*  8*/ { BARCODE_MAXICODE, ZINT_BATCH_BUFFER, 4, 0 },
+        /*  9*/ { BARCODE_ULTRA, ZINT_BATCH_BUFFER_VECTOR, 100, 1 },
+    };
+    int data_size = ARRAY_SIZE(data);
+    int i, j, ret, ret_batch, ret_single;
+    struct zint_symbol *template_symbol, *symbol;
+    struct batch_cb_ctx cb_ctx;
+    struct zint_stats template_stats;
+
+    static char *sources[] = {
+        "1234567", "12345678901", "ABCDEFG", "1", "123456789012", "9876543210", "12345", "67890",
+        "123", "0000000", "1234567890", "ABC123",
+    };
+#define BATCH_COUNT ARRAY_SIZE(sources)
+    struct zint_batch_item items[BATCH_COUNT];
+
+    testStart("test_encode_batch");
+
+    template_symbol = ZBarcode_Create();
+    assert_nonnull(template_symbol, "Symbol not created\n");
+
+    for (i = 0; i < data_size; i++) {
+
+        if (testContinue(p_ctx, i)) continue;
+
+        (void) testUtilSetSymbol(template_symbol, data[i].symbology, -1 /*input_mode*/, -1 /*eci*/,
+                    -1 /*option_1*/, -1, -1, -1 /*output_options*/, sources[0], -1, debug);
+        template_symbol->scale = 2.0f;
+        strcpy(template_symbol->fgcolour, "112233");
+        memset(&template_stats, 0xFF, sizeof(template_stats)); /* Not to be shared with (or touched by) workers */
+        template_symbol->stats = &template_stats;
+
+        for (j = 0; j < BATCH_COUNT; j++) {
+            items[j].source = (const unsigned char *) sources[j];
+            items[j].length = j & 1 ? (int) strlen(sources[j]) : 0; /* Test both explicit and NUL-terminated */
+        }
+        memset(&cb_ctx, 0, sizeof(cb_ctx));
+        cb_ctx.in_order = 1;
+
+        ret_batch = ZBarcode_Encode_Batch(template_symbol, items, BATCH_COUNT, data[i].output_type,
+                    0 /*rotate_angle*/, data[i].num_threads, data[i].use_callback ? batch_cb : NULL, &cb_ctx);
+
+        if (data[i].use_callback) {
+            assert_equal(cb_ctx.count, BATCH_COUNT, "i:%d callback count %d != %d\n",
+                        i, cb_ctx.count, (int) BATCH_COUNT);
+            assert_equal(cb_ctx.in_order, 1, "i:%d callback not in order\n", i);
+        } else {
+            assert_zero(cb_ctx.count, "i:%d callback count %d non-zero\n", i, cb_ctx.count);
+        }
+        assert_equal(template_stats.rows, -1, "i:%d template_stats.rows %d != -1\n", i, template_stats.rows);
+
+        for (j = 0; j < BATCH_COUNT; j++) {
+            assert_nonnull(items[j].symbol, "i:%d j:%d items[j].symbol NULL\n", i, j);
+            assert_null(items[j].symbol->stats, "i:%d j:%d items[j].symbol->stats not NULL\n", i, j);
+            assert_equal(ret_batch >= items[j].error_number, 1, "i:%d j:%d ret_batch %d < items[j].error_number %d\n",
+                        i, j, ret_batch, items[j].error_number);
+
+            symbol = ZBarcode_Create();
+            assert_nonnull(symbol, "Symbol not created\n");
+            (void) testUtilSetSymbol(symbol, data[i].symbology, -1 /*input_mode*/, -1 /*eci*/, -1 /*option_1*/,
+                        -1, -1, -1 /*output_options*/, sources[j], -1, debug);
+            symbol->scale = 2.0f;
+            strcpy(symbol->fgcolour, "112233");
+
+            if (data[i].output_type == ZINT_BATCH_BUFFER) {
+                ret_single = ZBarcode_Encode_and_Buffer(symbol, TU(sources[j]), (int) strlen(sources[j]), 0);
+            } else if (data[i].output_type == ZINT_BATCH_BUFFER_VECTOR) {
+                ret_single = ZBarcode_Encode_and_Buffer_Vector(symbol, TU(sources[j]), (int) strlen(sources[j]),
+                                0);
+            } else {
+                ret_single = ZBarcode_Encode(symbol, TU(sources[j]), (int) strlen(sources[j]));
+            }
+            assert_equal(items[j].error_number, ret_single, "i:%d j:%d items[j].error_number %d != %d (%s, %s)\n",
+                        i, j, items[j].error_number, ret_single, items[j].symbol->errtxt, symbol->errtxt);
+            assert_zero(strcmp(items[j].symbol->errtxt, symbol->errtxt), "i:%d j:%d errtxt \"%s\" != \"%s\"\n",
+                        i, j, items[j].symbol->errtxt, symbol->errtxt);
+
+            if (ret_single < ZINT_ERROR) {
+                ret = testUtilSymbolCmp(items[j].symbol, symbol);
+                assert_zero(ret, "i:%d j:%d testUtilSymbolCmp ret %d != 0\n", i, j, ret);
+                if (data[i].output_type == ZINT_BATCH_BUFFER) {
+                    assert_equal(items[j].symbol->bitmap_width, symbol->bitmap_width,
+                                "i:%d j:%d bitmap_width %d != %d\n",
+                                i, j, items[j].symbol->bitmap_width, symbol->bitmap_width);
+                    assert_equal(items[j].symbol->bitmap_height, symbol->bitmap_height,
+                                "i:%d j:%d bitmap_height %d != %d\n",
+                                i, j, items[j].symbol->bitmap_height, symbol->bitmap_height);
+                    ret = memcmp(items[j].symbol->bitmap, symbol->bitmap,
+                                symbol->bitmap_width * symbol->bitmap_height * 3);
+                    assert_zero(ret, "i:%d j:%d memcmp(bitmap) %d != 0\n", i, j, ret);
+                } else if (data[i].output_type == ZINT_BATCH_BUFFER_VECTOR) {
+                    ret = testUtilVectorCmp(items[j].symbol->vector, symbol->vector);
+                    assert_zero(ret, "i:%d j:%d testUtilVectorCmp ret %d != 0\n", i, j, ret);
+                }
+            }
+
+            ZBarcode_Delete(symbol);
+            ZBarcode_Delete(items[j].symbol);
+        }
+    }
+#undef BATCH_COUNT
+
+    ZBarcode_Delete(template_symbol);
+
+    testFinish();
+}
+
+static void test_encode_batch_bad_args(const testCtx *const p_ctx) {
+    int ret;
+    struct zint_symbol *template_symbol;
+    struct zint_batch_item items[2];
+
+    (void)p_ctx;
+
+    testStart("test_encode_batch_bad_args");
+
+    template_symbol = ZBarcode_Create();
+    assert_nonnull(template_symbol, "Symbol not created\n");
+
+    items[0].source = TU("1234");
+    items[0].length = 0;
+    items[1].source = TU("12345678901234"); /* Too long for EAN */
+    items[1].length = 0;
+
+    ret = ZBarcode_Encode_Batch(NULL, items, 2, ZINT_BATCH_ENCODE, 0, 0, NULL, NULL);
+    assert_equal(ret, ZINT_ERROR_INVALID_DATA, "ZBarcode_Encode_Batch(NULL) ret %d != ZINT_ERROR_INVALID_DATA\n",
+                ret);
+    ret = ZBarcode_Encode_Batch(template_symbol, NULL, 2, ZINT_BATCH_ENCODE, 0, 0, NULL, NULL);
+    assert_equal(ret, ZINT_ERROR_INVALID_DATA,
+                "ZBarcode_Encode_Batch(items NULL) ret %d != ZINT_ERROR_INVALID_DATA\n", ret);
+    ret = ZBarcode_Encode_Batch(template_symbol, items, -1, ZINT_BATCH_ENCODE, 0, 0, NULL, NULL);
+    assert_equal(ret, ZINT_ERROR_INVALID_DATA, "ZBarcode_Encode_Batch(-1) ret %d != ZINT_ERROR_INVALID_DATA\n",
+                ret);
+    ret = ZBarcode_Encode_Batch(template_symbol, items, 2, ZINT_BATCH_BUFFER_VECTOR + 1, 0, 0, NULL, NULL);
+    assert_equal(ret, ZINT_ERROR_INVALID_OPTION,
+                "ZBarcode_Encode_Batch(output_type) ret %d != ZINT_ERROR_INVALID_OPTION\n", ret);
+    ret = ZBarcode_Encode_Batch(template_symbol, items, 2, ZINT_BATCH_ENCODE, 0, -1, NULL, NULL);
+    assert_equal(ret, ZINT_ERROR_INVALID_OPTION,
+                "ZBarcode_Encode_Batch(num_threads) ret %d != ZINT_ERROR_INVALID_OPTION\n", ret);
+
+    ret = ZBarcode_Encode_Batch(template_symbol, NULL, 0, ZINT_BATCH_ENCODE, 0, 0, NULL, NULL);
+    assert_zero(ret, "ZBarcode_Encode_Batch(0) ret %d != 0\n", ret);
+
+    /* Per-item errors */
+    template_symbol->symbology = BARCODE_EANX;
+    ret = ZBarcode_Encode_Batch(template_symbol, items, 2, ZINT_BATCH_BUFFER, 0, 2, NULL, NULL);
+    assert_equal(ret, ZINT_ERROR_TOO_LONG, "ZBarcode_Encode_Batch ret %d != ZINT_ERROR_TOO_LONG\n", ret);
+    assert_zero(items[0].error_number, "items[0].error_number %d != 0 (%s)\n", items[0].error_number,
+                items[0].symbol->errtxt);
+    assert_nonnull(items[0].symbol->bitmap, "items[0].symbol->bitmap NULL\n");
+    assert_equal(items[1].error_number, ZINT_ERROR_TOO_LONG, "items[1].error_number %d != ZINT_ERROR_TOO_LONG\n",
+                items[1].error_number);
+    assert_nonnull(items[1].symbol, "items[1].symbol NULL\n");
+    assert_nonzero(items[1].symbol->errtxt[0], "items[1].symbol->errtxt empty\n");
+    ZBarcode_Delete(items[0].symbol);
+    ZBarcode_Delete(items[1].symbol);
+
+    ZBarcode_Delete(template_symbol);
+
+    testFinish();
+}
+
+static void test_create_compact(const testCtx *const p_ctx) {
+    int debug = p_ctx->debug;
+
+    struct item {
+        int symbology;
+        int input_mode;
+        int option_2;
+        char *data;
+        char *composite;
+        int encodes; /* > 1 to stack symbols */
+        int ret;
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    struct item data[] = {
+        /*  0*/ { BARCODE_CODE128, -1, -1, "1234", "", 1, 0 },
+        /*  1*/ { BARCODE_EANX, -1, -1, "123456789012", "", 1, 0 },
+        /*  2*/ { BARCODE_CODE128, -1, -1, "ABCDEFGH", "", 3, 0 }, /* Width multiple of 8 */
+        /*  3*/ { BARCODE_CODE39, -1, -1, "12", "", 4, 0 }, /* Width changes */
+        /*  4*/ { BARCODE_QRCODE, -1, -1, "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789", "", 1, 0 },
+        /*  5*/ { BARCODE_DATAMATRIX, -1, -1, "1234567890", "", 1, 0 },
+        /*  6*/ { BARCODE_MAXICODE, -1, -1, "1234", "", 1, 0 },
+        /*  7*/ { BARCODE_PDF417, -1, -1, "ABCDEFGHIJKLMNOPQRSTUVWXYZ", "", 1, 0 },
+        /*  8*/ { BARCODE_CODABLOCKF, -1, -1, "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789", "", 1, 0 },
+        /*  9*/ { BARCODE_DOTCODE, -1, -1, "1234", "", 1, 0 },
+        /* 10*/ { BARCODE_ULTRA, -1, -1, "ABCDEFGHIJKLMNOPQRSTUVWXYZ", "", 1, 0 },
+        /* 11*/ { BARCODE_EANX_CC, -1, -1, "331234567890", "[21]1234", 1, 0 },
+        /* 12*/ { BARCODE_GS1_128_CC, -1, -1, "[01]12345678901231", "[10]121212", 1, 0 },
+        /* 13*/ { BARCODE_DBAR_EXPSTK, -1, 2, "[01]12345678901231[10]121212", "", 1, 0 },
+        /* 14*/ { BARCODE_AZTEC, -1, -1, "1234", "", 1, 0 },
+        /* 15*/ { BARCODE_HANXIN, -1, -1, "1234", "", 1, 0 },
+        /* 16*/ { BARCODE_EANX, -1, -1, "12345678901234", "", 1, ZINT_ERROR_TOO_LONG },
+        /* 17*/ { BARCODE_DATAMATRIX, -1, -1, "ABCDEFGHIJKLMNOPQRSTUVWXYZ", "", 1, 0 }, /* After error */
+    };
+    int data_size = ARRAY_SIZE(data);
+    int i, j, length, ret;
+    struct zint_symbol *symbol, *compact;
+    char *text;
+
+    testStart("test_create_compact");
+
+    /* Reused across items */
+    compact = ZBarcode_Create_Compact();
+    assert_nonnull(compact, "Compact symbol not created\n");
+
+    for (i = 0; i < data_size; i++) {
+
+        if (testContinue(p_ctx, i)) continue;
+
+        symbol = ZBarcode_Create();
+        assert_nonnull(symbol, "Symbol not created\n");
+
+        ZBarcode_Clear(compact);
+
+        if (is_composite(data[i].symbology)) {
+            text = data[i].composite;
+            strcpy(symbol->primary, data[i].data);
+        } else {
+            text = data[i].data;
+        }
+        length = testUtilSetSymbol(symbol, data[i].symbology, data[i].input_mode, -1 /*eci*/, -1 /*option_1*/,
+                    data[i].option_2, -1, -1 /*output_options*/, text, -1, debug);
+        /* Input fields all precede `text` (those set by previous encode, e.g. `height`, are overwritten) */
+        memcpy(compact, symbol, offsetof(struct zint_symbol, text));
+        compact->fgcolor = compact->fgcolour;
+        compact->bgcolor = compact->bgcolour;
+
+        for (j = 0; j < data[i].encodes; j++) {
+            /* Vary data when stacking so that width changes */
+            const int enc_length = length - (j & 1);
+
+            ret = ZBarcode_Encode(symbol, TU(text), enc_length);
+            assert_equal(ret, data[i].ret, "i:%d j:%d ZBarcode_Encode ret %d != %d (%s)\n",
+                        i, j, ret, data[i].ret, symbol->errtxt);
+            ret = ZBarcode_Encode(compact, TU(text), enc_length);
+            assert_equal(ret, data[i].ret, "i:%d j:%d ZBarcode_Encode(compact) ret %d != %d (%s)\n",
+                        i, j, ret, data[i].ret, compact->errtxt);
+            assert_zero(strcmp(compact->errtxt, symbol->errtxt), "i:%d j:%d errtxt %s != %s\n",
+                        i, j, compact->errtxt, symbol->errtxt);
+        }
+        if (data[i].ret < ZINT_ERROR) {
+            assert_nonzero(symbol->rows, "i:%d rows 0\n", i);
+        }
+
+        ret = testUtilSymbolCmp(compact, symbol);
+        assert_zero(ret, "i:%d testUtilSymbolCmp ret %d != 0\n", i, ret);
+        assert_equal(compact->priv->module_stride, data[i].symbology == BARCODE_ULTRA
+                        ? compact->width : (compact->width + 7) / 8 + (compact->width == 0),
+                    "i:%d module_stride %d (width %d)\n", i, compact->priv->module_stride, compact->width);
+        assert_equal(compact->priv->module_alloc, compact->rows * compact->priv->module_stride,
+                    "i:%d module_alloc %d != %d * %d\n",
+                    i, compact->priv->module_alloc, compact->rows, compact->priv->module_stride);
+
+        assert_equal(ZBarcode_Module(compact, -1, 0), -1, "i:%d ZBarcode_Module(-1, 0) != -1\n", i);
+        assert_equal(ZBarcode_Module(compact, 0, compact->width), -1, "i:%d ZBarcode_Module(0, width) != -1\n", i);
+        assert_equal(ZBarcode_Module(compact, compact->rows, 0), -1, "i:%d ZBarcode_Module(rows, 0) != -1\n", i);
+
+        if (data[i].ret < ZINT_ERROR) {
+            ret = ZBarcode_Buffer(symbol, 0);
+            assert_zero(ret, "i:%d ZBarcode_Buffer ret %d != 0 (%s)\n", i, ret, symbol->errtxt);
+            ret = ZBarcode_Buffer(compact, 0);
+            assert_zero(ret, "i:%d ZBarcode_Buffer(compact) ret %d != 0 (%s)\n", i, ret, compact->errtxt);
+            assert_equal(compact->bitmap_width, symbol->bitmap_width, "i:%d bitmap_width %d != %d\n",
+                        i, compact->bitmap_width, symbol->bitmap_width);
+            assert_equal(compact->bitmap_height, symbol->bitmap_height, "i:%d bitmap_height %d != %d\n",
+                        i, compact->bitmap_height, symbol->bitmap_height);
+            assert_zero(memcmp(compact->bitmap, symbol->bitmap, symbol->bitmap_width * symbol->bitmap_height * 3),
+                        "i:%d memcmp(bitmap) != 0\n", i);
+
+            ret = ZBarcode_Buffer_Vector(symbol, 0);
+            assert_zero(ret, "i:%d ZBarcode_Buffer_Vector ret %d != 0 (%s)\n", i, ret, symbol->errtxt);
+            ret = ZBarcode_Buffer_Vector(compact, 0);
+            assert_zero(ret, "i:%d ZBarcode_Buffer_Vector(compact) ret %d != 0 (%s)\n", i, ret, compact->errtxt);
+            assert_equal(compact->vector->width, symbol->vector->width, "i:%d vector->width %g != %g\n",
+                        i, compact->vector->width, symbol->vector->width);
+            assert_equal(compact->vector->height, symbol->vector->height, "i:%d vector->height %g != %g\n",
+                        i, compact->vector->height, symbol->vector->height);
+        }
+
+        ZBarcode_Delete(symbol);
+    }
+
+    ZBarcode_Delete(compact);
+
+    testFinish();
+}
+
+static void test_module(const testCtx *const p_ctx) {
+    int ret;
+    struct zint_symbol *symbol;
+    struct zint_symbol copy;
+
+    (void)p_ctx;
+
+    testStart("test_module");
+
+    ret = ZBarcode_Module(NULL, 0, 0);
+    assert_equal(ret, -1, "ZBarcode_Module(NULL) ret %d != -1\n", ret);
+
+    symbol = ZBarcode_Create();
+    assert_nonnull(symbol, "Symbol not created\n");
+
+    ret = ZBarcode_Module(symbol, 0, 0);
+    assert_equal(ret, -1, "ZBarcode_Module(unencoded) ret %d != -1\n", ret);
+
+    symbol->symbology = BARCODE_CODE128;
+    ret = ZBarcode_Encode(symbol, TU("1234"), 0);
+    assert_zero(ret, "ZBarcode_Encode ret %d != 0 (%s)\n", ret, symbol->errtxt);
+
+    /* Quiet zone-less CODE128 starts with bar and ends with 2X bar */
+    assert_equal(ZBarcode_Module(symbol, 0, 0), 1, "ZBarcode_Module(0, 0) != 1\n");
+    assert_equal(ZBarcode_Module(symbol, 0, 2), 0, "ZBarcode_Module(0, 2) != 0\n");
+    assert_equal(ZBarcode_Module(symbol, 0, symbol->width - 1), 1, "ZBarcode_Module(0, width - 1) != 1\n");
+
+    /* Copied structure (modules pointer refers to original) */
+    memcpy(&copy, symbol, sizeof(copy));
+    ZBarcode_Clear(symbol);
+    assert_equal(ZBarcode_Module(&copy, 0, 0), 1, "ZBarcode_Module(copy, 0, 0) != 1\n");
+    assert_equal(ZBarcode_Module(&copy, 0, 2), 0, "ZBarcode_Module(copy, 0, 2) != 0\n");
+
+    ZBarcode_Delete(symbol);
+
+    testFinish();
+}
+
+static void test_prepare(const testCtx *const p_ctx) {
+    int debug = p_ctx->debug;
+
+    struct item {
+        int symbology;
+        int output_options;
+        float scale;
+        char *fgcolour;
+        int output_type;
+        int rotate_angle;
+        int compact;
+        int ret_prepare;
+        char *expected_prepare;
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    struct item data[] = {
+        /*  0*/ { BARCODE_CODE128, -1, 0.0f, "", ZINT_BATCH_ENCODE, 0, 0, 0, "" },
+        /*  1*/ { BARCODE_CODE128, -1, 2.0f, "112233", ZINT_BATCH_BUFFER, 0, 0, 0, "" },
+        /*  2*/ { BARCODE_EANX, -1, 0.0f, "", ZINT_BATCH_BUFFER_VECTOR, 90, 0, 0, "" },
+        /*  3*/ { BARCODE_QRCODE, BARCODE_BOX, 0.0f, "", ZINT_BATCH_BUFFER, 180, 1, 0, "" },
+        /*  4*/ { BARCODE_DATAMATRIX, BARCODE_DOTTY_MODE, 0.0f, "", ZINT_BATCH_BUFFER, 0, 1, 0, "" },
+        /*  5*/ { BARCODE_ULTRA, -1, 0.0f, "", ZINT_BATCH_BUFFER_VECTOR, 270, 1, 0, "" },
+        /*  6*/ { 10, -1, 0.0f, "", ZINT_BATCH_BUFFER, 0, 0, 0, "" }, /* Legacy mapped to EANX */
+        /*  7*/ { 0, -1, 0.0f, "", ZINT_BATCH_BUFFER, 0, 0, ZINT_WARN_INVALID_OPTION, "Warning 206: Symbology out of range" },
+        /*  8*/ { BARCODE_CODE128, -1, 300.0f, "", ZINT_BATCH_BUFFER, 0, 0, ZINT_ERROR_INVALID_OPTION, "Error 227: Scale out of range (0.01 to 200)" },
+        /*  9*/ { BARCODE_CODE128, -1, 0.0f, "12345", ZINT_BATCH_BUFFER, 0, 0, ZINT_ERROR_INVALID_OPTION, "Error 880: Malformed foreground RGB colour (6 or 8 characters only)" },
+        /* 10*/ { BARCODE_CODE128, -1, 0.0f, "12345", ZINT_BATCH_ENCODE, 0, 0, 0, "" }, /* Colour not checked if not output */
+        /* 11*/ { BARCODE_CODE128, -1, 0.0f, "", ZINT_BATCH_BUFFER, 45, 0, ZINT_ERROR_INVALID_OPTION, "Error 223: Invalid rotation angle" },
+        /* 12*/ { BARCODE_CODE128, BARCODE_DOTTY_MODE, 0.0f, "", ZINT_BATCH_BUFFER_VECTOR, 0, 0, ZINT_ERROR_INVALID_OPTION, "Error 224: Selected symbology cannot be rendered as dots" },
+        /* 13*/ { BARCODE_CODE128, -1, 0.0f, "", ZINT_BATCH_BUFFER_VECTOR + 1, 0, 0, ZINT_ERROR_INVALID_OPTION, "Error 782: Invalid output type" },
+    };
+    int data_size = ARRAY_SIZE(data);
+    int i, j, ret, ret_prepared;
+    struct zint_symbol *template_symbol, *symbol, *out_symbol;
+    struct zint_prepared *prepared;
+
+    static char *sources[] = {
+        "1234567", "12345678901", "123456789012", "1", "", "ABC\001",
+    };
+
+    testStart("test_prepare");
+
+    for (i = 0; i < data_size; i++) {
+
+        if (testContinue(p_ctx, i)) continue;
+
+        template_symbol = ZBarcode_Create();
+        assert_nonnull(template_symbol, "Symbol not created\n");
+
+        (void) testUtilSetSymbol(template_symbol, data[i].symbology, -1 /*input_mode*/, -1 /*eci*/,
+                    -1 /*option_1*/, -1, -1, data[i].output_options, sources[0], -1, debug);
+        if (data[i].scale) {
+            template_symbol->scale = data[i].scale;
+        }
+        if (data[i].fgcolour[0]) {
+            strcpy(template_symbol->fgcolour, data[i].fgcolour);
+        }
+
+        ret = ZBarcode_Prepare(template_symbol, data[i].output_type, data[i].rotate_angle, &prepared);
+        assert_equal(ret, data[i].ret_prepare, "i:%d ZBarcode_Prepare ret %d != %d (%s)\n",
+                    i, ret, data[i].ret_prepare, template_symbol->errtxt);
+        assert_zero(strcmp(template_symbol->errtxt, data[i].expected_prepare), "i:%d errtxt %s != %s\n",
+                    i, template_symbol->errtxt, data[i].expected_prepare);
+        assert_equal(template_symbol->symbology, data[i].symbology, "i:%d symbology %d != %d (changed)\n",
+                    i, template_symbol->symbology, data[i].symbology);
+        if (ret >= ZINT_ERROR) {
+            assert_null(prepared, "i:%d prepared non-NULL\n", i);
+            ZBarcode_Delete(template_symbol);
+            continue;
+        }
+        assert_nonnull(prepared, "i:%d prepared NULL\n", i);
+
+        out_symbol = data[i].compact ? ZBarcode_Create_Compact() : ZBarcode_Create();
+        assert_nonnull(out_symbol, "i:%d out_symbol not created\n", i);
+
+        /* Compare against normal encoding, reusing `out_symbol` */
+        for (j = 0; j < ARRAY_SIZE(sources); j++) {
+            symbol = ZBarcode_Create();
+            assert_nonnull(symbol, "i:%d j:%d symbol not created\n", i, j);
+            memcpy(symbol, template_symbol, offsetof(struct zint_symbol, text));
+            symbol->fgcolor = symbol->fgcolour;
+            symbol->bgcolor = symbol->bgcolour;
+
+            if (data[i].output_type == ZINT_BATCH_BUFFER) {
+                ret = ZBarcode_Encode_and_Buffer(symbol, TU(sources[j]), 0, data[i].rotate_angle);
+            } else if (data[i].output_type == ZINT_BATCH_BUFFER_VECTOR) {
+                ret = ZBarcode_Encode_and_Buffer_Vector(symbol, TU(sources[j]), 0, data[i].rotate_angle);
+            } else {
+                ret = ZBarcode_Encode(symbol, TU(sources[j]), 0);
+            }
+            ret_prepared = ZBarcode_Encode_Prepared(prepared, out_symbol, TU(sources[j]), 0);
+            assert_equal(ret_prepared, ret, "i:%d j:%d ZBarcode_Encode_Prepared ret %d != %d (%s)\n",
+                        i, j, ret_prepared, ret, out_symbol->errtxt);
+            assert_zero(strcmp(out_symbol->errtxt, symbol->errtxt), "i:%d j:%d errtxt %s != %s\n",
+                        i, j, out_symbol->errtxt, symbol->errtxt);
+
+            if (ret_prepared < ZINT_ERROR) { /* Symbology may not have been mapped if normal encoding failed */
+                ret = testUtilSymbolCmp(out_symbol, symbol);
+                assert_zero(ret, "i:%d j:%d testUtilSymbolCmp ret %d != 0\n", i, j, ret);
+            }
+
+            if (ret_prepared < ZINT_ERROR && data[i].output_type == ZINT_BATCH_BUFFER) {
+                assert_nonnull(out_symbol->bitmap, "i:%d j:%d bitmap NULL\n", i, j);
+                assert_equal(out_symbol->bitmap_width, symbol->bitmap_width, "i:%d j:%d bitmap_width %d != %d\n",
+                            i, j, out_symbol->bitmap_width, symbol->bitmap_width);
+                assert_equal(out_symbol->bitmap_height, symbol->bitmap_height,
+                            "i:%d j:%d bitmap_height %d != %d\n",
+                            i, j, out_symbol->bitmap_height, symbol->bitmap_height);
+                assert_zero(memcmp(out_symbol->bitmap, symbol->bitmap,
+                                    symbol->bitmap_width * symbol->bitmap_height * 3),
+                            "i:%d j:%d memcmp(bitmap) != 0\n", i, j);
+            } else if (ret_prepared < ZINT_ERROR && data[i].output_type == ZINT_BATCH_BUFFER_VECTOR) {
+                assert_nonnull(out_symbol->vector, "i:%d j:%d vector NULL\n", i, j);
+                assert_equal(out_symbol->vector->width, symbol->vector->width, "i:%d j:%d vector->width %g != %g\n",
+                            i, j, out_symbol->vector->width, symbol->vector->width);
+                assert_equal(out_symbol->vector->height, symbol->vector->height,
+                            "i:%d j:%d vector->height %g != %g\n",
+                            i, j, out_symbol->vector->height, symbol->vector->height);
+            } else {
+                assert_null(out_symbol->bitmap, "i:%d j:%d bitmap non-NULL\n", i, j);
+                assert_null(out_symbol->vector, "i:%d j:%d vector non-NULL\n", i, j);
+            }
+
+            ZBarcode_Delete(symbol);
+        }
+
+        ZBarcode_Delete(out_symbol);
+        ZBarcode_Delete_Prepared(prepared);
+        ZBarcode_Delete(template_symbol);
+    }
+
+    testFinish();
+}
+
+static void test_prepare_bad_args(const testCtx *const p_ctx) {
+    int ret;
+    struct zint_symbol *symbol;
+    struct zint_prepared *prepared;
+
+    (void)p_ctx;
+
+    testStart("test_prepare_bad_args");
+
+    symbol = ZBarcode_Create();
+    assert_nonnull(symbol, "Symbol not created\n");
+
+    ret = ZBarcode_Prepare(NULL, ZINT_BATCH_ENCODE, 0, &prepared);
+    assert_equal(ret, ZINT_ERROR_INVALID_DATA, "ZBarcode_Prepare(NULL) ret %d != ZINT_ERROR_INVALID_DATA\n", ret);
+
+    ret = ZBarcode_Prepare(symbol, ZINT_BATCH_ENCODE, 0, NULL);
+    assert_equal(ret, ZINT_ERROR_INVALID_DATA,
+                "ZBarcode_Prepare(p_prepared NULL) ret %d != ZINT_ERROR_INVALID_DATA\n", ret);
+    assert_zero(strcmp(symbol->errtxt, "Error 784: Prepared options argument NULL"), "errtxt %s\n",
+                symbol->errtxt);
+
+    ret = ZBarcode_Encode_Prepared(NULL, NULL, TU("1"), 0);
+    assert_equal(ret, ZINT_ERROR_INVALID_DATA,
+                "ZBarcode_Encode_Prepared(NULL, NULL) ret %d != ZINT_ERROR_INVALID_DATA\n", ret);
+
+    ret = ZBarcode_Encode_Prepared(NULL, symbol, TU("1"), 0);
+    assert_equal(ret, ZINT_ERROR_INVALID_DATA,
+                "ZBarcode_Encode_Prepared(NULL) ret %d != ZINT_ERROR_INVALID_DATA\n", ret);
+    assert_zero(strcmp(symbol->errtxt, "Error 785: Prepared options NULL"), "errtxt %s\n", symbol->errtxt);
+
+    ZBarcode_Delete_Prepared(NULL);
+
+    ZBarcode_Delete(symbol);
+
+    testFinish();
+}
+
+static void test_geometry(const testCtx *const p_ctx) {
+    int debug = p_ctx->debug;
+
+    struct item {
+        int symbology;
+        int input_mode;
+        int option_1;
+        int option_2;
+        int output_options;
+        float scale;
+        float dpmm;
+        int compact;
+        char *data;
+        int ret;
+        int expected_rows;
+        int expected_width;
+        int expected_version;
+        int expected_ecc_level;
+        char *expected_errtxt;
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    struct item data[] = {
+        /*  0*/ { BARCODE_CODE128, -1, -1, -1, -1, 0.0f, 0.0f, 0, "1234", 0, 1, 57, -1, -1, "" },
+        /*  1*/ { BARCODE_EANX, -1, -1, -1, -1, 0.0f, 0.0f, 0, "123456789012+12", 0, 1, 122, -1, -1, "" },
+        /*  2*/ { BARCODE_EANX, -1, -1, -1, -1, 2.5f, 12.0f, 0, "123456789012", 0, 1, 95, -1, -1, "" },
+        /*  3*/ { BARCODE_QRCODE, -1, -1, -1, -1, 0.0f, 0.0f, 0, "1234", 0, 21, 21, 1, 4, "" },
+        /*  4*/ { BARCODE_QRCODE, -1, 4, -1, -1, 0.0f, 0.0f, 0, "1234", 0, 21, 21, 1, 4, "" },
+        /*  5*/ { BARCODE_QRCODE, -1, -1, 10, BARCODE_QUIET_ZONES, 1.5f, 0.0f, 1, "1234", 0, 57, 57, 10, 4, "" },
+        /*  6*/ { BARCODE_QRCODE, -1, -1, -1, BARCODE_DOTTY_MODE, 0.0f, 0.0f, 0, "1234", 0, 21, 21, 1, 4, "" },
+        /*  7*/ { BARCODE_QRCODE, -1, 1, 1, -1, 0.0f, 0.0f, 0, "12345678901234567890123456789012345678901234", ZINT_ERROR_TOO_LONG, 0, 0, -1, -1, "Error 569: Input too long for selected symbol size" },
+        /*  8*/ { BARCODE_DATAMATRIX, -1, -1, -1, -1, 0.0f, 0.0f, 0, "1234", 0, 10, 10, 1, -1, "" },
+        /*  9*/ { BARCODE_DATAMATRIX, -1, -1, -1, -1, 0.0f, 0.0f, 1, "12345678901234567890123456789012345678901234567890", 0, 22, 22, 7, -1, "" },
+        /* 10*/ { BARCODE_DATAMATRIX, -1, -1, 25, -1, 0.0f, 0.0f, 0, "1234", 0, 8, 18, 25, -1, "" },
+        /* 11*/ { BARCODE_AZTEC, -1, -1, -1, -1, 0.0f, 0.0f, 0, "1234", 0, 15, 15, 1, 2, "" },
+        /* 12*/ { BARCODE_AZTEC, -1, 4, -1, -1, 0.0f, 0.0f, 0, "1234567890123456789012345678901234567890", 0, 23, 23, 3, 4, "" },
+        /* 13*/ { BARCODE_AZTEC, -1, -1, 8, -1, 0.0f, 0.0f, 0, "1234", 0, 31, 31, 8, -1, "" },
+        /* 14*/ { BARCODE_PDF417, -1, -1, -1, -1, 0.0f, 0.0f, 0, "1234", 0, 6, 103, 2, 2, "" },
+        /* 15*/ { BARCODE_PDF417, -1, 5, 4, -1, 0.0f, 0.0f, 1, "1234", 0, 17, 137, 4, 5, "" },
+        /* 16*/ { BARCODE_PDF417COMP, -1, -1, -1, -1, 0.0f, 0.0f, 0, "1234", 0, 6, 69, 2, 2, "" },
+        /* 17*/ { BARCODE_MAXICODE, -1, -1, -1, -1, 0.0f, 0.0f, 0, "1234", 0, 33, 30, -1, -1, "" },
+        /* 18*/ { BARCODE_MAXICODE, -1, -1, -1, -1, 1.76f, 8.0f, 0, "1234", 0, 33, 30, -1, -1, "" },
+        /* 19*/ { BARCODE_DOTCODE, -1, -1, -1, -1, 0.0f, 0.0f, 0, "1234", 0, 10, 13, -1, -1, "" },
+        /* 20*/ { BARCODE_CODE128, -1, -1, -1, BARCODE_DOTTY_MODE, 0.0f, 0.0f, 0, "1234", ZINT_ERROR_INVALID_OPTION, 0, 0, -1, -1, "Error 224: Selected symbology cannot be rendered as dots" },
+        /* 21*/ { BARCODE_CODE128, UNICODE_MODE, -1, -1, -1, 0.0f, 0.0f, 0, "\302", ZINT_ERROR_INVALID_DATA, 0, 0, -1, -1, "Error 245: Invalid UTF-8 in input data" },
+        /* 22*/ { BARCODE_CEPNET, -1, -1, -1, -1, 0.0f, 0.0f, 0, "12345678", 0, 2, 93, -1, -1, "" }, /* Non-integer height */
+        /* 23*/ { BARCODE_BC412, -1, -1, -1, -1, 0.0f, 0.0f, 0, "1234567", 0, 1, 102, -1, -1, "" }, /* Non-integer height */
+    };
+    int data_size = ARRAY_SIZE(data);
+    int i, length, ret;
+    struct zint_symbol *symbol, *raster_symbol, *vector_symbol;
+    struct zint_geometry geometry;
+
+    testStart("test_geometry");
+
+    for (i = 0; i < data_size; i++) {
+
+        if (testContinue(p_ctx, i)) continue;
+
+        symbol = data[i].compact ? ZBarcode_Create_Compact() : ZBarcode_Create();
+        assert_nonnull(symbol, "Symbol not created\n");
+
+        length = testUtilSetSymbol(symbol, data[i].symbology, data[i].input_mode, -1 /*eci*/,
+                    data[i].option_1, data[i].option_2, -1, data[i].output_options, data[i].data, -1, debug);
+        if (data[i].scale) {
+            symbol->scale = data[i].scale;
+        }
+        symbol->dpmm = data[i].dpmm;
+
+        ret = ZBarcode_Geometry(symbol, TU(data[i].data), length, &geometry);
+        assert_equal(ret, data[i].ret, "i:%d ZBarcode_Geometry ret %d != %d (%s)\n", i, ret, data[i].ret,
+                    symbol->errtxt);
+        assert_zero(strcmp(symbol->errtxt, data[i].expected_errtxt), "i:%d errtxt %s != %s\n",
+                    i, symbol->errtxt, data[i].expected_errtxt);
+        assert_equal(geometry.rows, data[i].expected_rows, "i:%d rows %d != %d\n",
+                    i, geometry.rows, data[i].expected_rows);
+        assert_equal(geometry.width, data[i].expected_width, "i:%d width %d != %d\n",
+                    i, geometry.width, data[i].expected_width);
+        assert_equal(geometry.version, data[i].expected_version, "i:%d version %d != %d\n",
+                    i, geometry.version, data[i].expected_version);
+        assert_equal(geometry.ecc_level, data[i].expected_ecc_level, "i:%d ecc_level %d != %d\n",
+                    i, geometry.ecc_level, data[i].expected_ecc_level);
+
+        /* Symbol left cleared */
+        assert_zero(symbol->rows, "i:%d symbol->rows %d != 0\n", i, symbol->rows);
+        assert_zero(symbol->width, "i:%d symbol->width %d != 0\n", i, symbol->width);
+        assert_null(symbol->bitmap, "i:%d bitmap non-NULL\n", i);
+        assert_null(symbol->vector, "i:%d vector non-NULL\n", i);
+
+        if (ret < ZINT_ERROR) {
+            /* Compare against full encoding and output */
+            raster_symbol = ZBarcode_Create();
+            assert_nonnull(raster_symbol, "i:%d raster_symbol not created\n", i);
+            (void) testUtilSetSymbol(raster_symbol, data[i].symbology, data[i].input_mode, -1 /*eci*/,
+                        data[i].option_1, data[i].option_2, -1, data[i].output_options, data[i].data, -1, debug);
+            if (data[i].scale) {
+                raster_symbol->scale = data[i].scale;
+            }
+            vector_symbol = ZBarcode_Create();
+            assert_nonnull(vector_symbol, "i:%d vector_symbol not created\n", i);
+            memcpy(vector_symbol, raster_symbol, offsetof(struct zint_symbol, text));
+            vector_symbol->fgcolor = vector_symbol->fgcolour;
+            vector_symbol->bgcolor = vector_symbol->bgcolour;
+
+            ret = ZBarcode_Encode_and_Buffer(raster_symbol, TU(data[i].data), length, 0);
+            assert_equal(ret, data[i].ret, "i:%d ZBarcode_Encode_and_Buffer ret %d != %d (%s)\n",
+                        i, ret, data[i].ret, raster_symbol->errtxt);
+            ret = ZBarcode_Encode_and_Buffer_Vector(vector_symbol, TU(data[i].data), length, 0);
+            assert_equal(ret, data[i].ret, "i:%d ZBarcode_Encode_and_Buffer_Vector ret %d != %d (%s)\n",
+                        i, ret, data[i].ret, vector_symbol->errtxt);
+
+            assert_equal(geometry.rows, raster_symbol->rows, "i:%d rows %d != %d\n",
+                        i, geometry.rows, raster_symbol->rows);
+            assert_equal(geometry.width, raster_symbol->width, "i:%d width %d != %d\n",
+                        i, geometry.width, raster_symbol->width);
+            assert_equal(geometry.bitmap_width, raster_symbol->bitmap_width, "i:%d bitmap_width %d != %d\n",
+                        i, geometry.bitmap_width, raster_symbol->bitmap_width);
+            assert_equal(geometry.bitmap_height, raster_symbol->bitmap_height, "i:%d bitmap_height %d != %d\n",
+                        i, geometry.bitmap_height, raster_symbol->bitmap_height);
+            assert_equal(geometry.vector_width, vector_symbol->vector->width, "i:%d vector_width %g != %g\n",
+                        i, geometry.vector_width, vector_symbol->vector->width);
+            assert_equal(geometry.vector_height, vector_symbol->vector->height, "i:%d vector_height %g != %g\n",
+                        i, geometry.vector_height, vector_symbol->vector->height);
+            if (data[i].dpmm) {
+                assert_equal(geometry.width_mm, stripf(geometry.vector_width / data[i].dpmm),
+                            "i:%d width_mm %g != %g\n", i, geometry.width_mm, geometry.vector_width / data[i].dpmm);
+                assert_equal(geometry.height_mm, stripf(geometry.vector_height / data[i].dpmm),
+                            "i:%d height_mm %g != %g\n",
+                            i, geometry.height_mm, geometry.vector_height / data[i].dpmm);
+            } else {
+                assert_zero(geometry.width_mm, "i:%d width_mm %g != 0\n", i, geometry.width_mm);
+                assert_zero(geometry.height_mm, "i:%d height_mm %g != 0\n", i, geometry.height_mm);
+            }
+
+            ZBarcode_Delete(vector_symbol);
+            ZBarcode_Delete(raster_symbol);
+        }
+
+        ZBarcode_Delete(symbol);
+    }
+
+    testFinish();
+}
+
+static void test_geometry_bad_args(const testCtx *const p_ctx) {
+    int ret;
+    struct zint_symbol *symbol;
+    struct zint_geometry geometry;
+
+    (void)p_ctx;
+
+    testStart("test_geometry_bad_args");
+
+    symbol = ZBarcode_Create();
+    assert_nonnull(symbol, "Symbol not created\n");
+
+    ret = ZBarcode_Geometry(NULL, TU("1"), 0, &geometry);
+    assert_equal(ret, ZINT_ERROR_INVALID_DATA, "ZBarcode_Geometry(NULL) ret %d != ZINT_ERROR_INVALID_DATA\n", ret);
+
+    ret = ZBarcode_Geometry(symbol, TU("1"), 0, NULL);
+    assert_equal(ret, ZINT_ERROR_INVALID_DATA,
+                "ZBarcode_Geometry(geometry NULL) ret %d != ZINT_ERROR_INVALID_DATA\n", ret);
+    assert_zero(strcmp(symbol->errtxt, "Error 787: Geometry argument NULL"), "errtxt %s\n", symbol->errtxt);
+
+    ret = ZBarcode_Geometry_Segs(symbol, NULL, 1, &geometry);
+    assert_equal(ret, ZINT_ERROR_INVALID_DATA,
+                "ZBarcode_Geometry_Segs(segs NULL) ret %d != ZINT_ERROR_INVALID_DATA\n", ret);
+
+    ZBarcode_Delete(symbol);
+
+    testFinish();
+}
+
+/* Fill `buf` with `count` copies of `unit`, returning length */
+static int test_fill(char *buf, const char *unit, const int count) {
+    const int unit_len = (int) strlen(unit);
+    int i;
+
+    for (i = 0; i < count; i++) {
+        memcpy(buf + i * unit_len, unit, unit_len);
+    }
+    buf[count * unit_len] = '\0';
+
+    return count * unit_len;
+}
+
+static void test_capacity(const testCtx *const p_ctx) {
+    int debug = p_ctx->debug;
+
+    struct item {
+        int symbology;
+        int option_1;
+        int option_2;
+        int char_type;
+        int expected;
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    struct item data[] = {
+        /*  0*/ { BARCODE_QRCODE, -1, 0, ZINT_CAPACITY_NUMERIC, 7089 }, /* ISO/IEC 18004:2015 Table 7 */
+        /*  1*/ { BARCODE_QRCODE, -1, 0, ZINT_CAPACITY_ALPHANUMERIC, 4296 },
+        /*  2*/ { BARCODE_QRCODE, -1, 0, ZINT_CAPACITY_BYTE, 2953 },
+        /*  3*/ { BARCODE_QRCODE, -1, 0, ZINT_CAPACITY_KANJI, 1817 },
+        /*  4*/ { BARCODE_QRCODE, 1, 1, ZINT_CAPACITY_NUMERIC, 41 },
+        /*  5*/ { BARCODE_QRCODE, 1, 1, ZINT_CAPACITY_ALPHANUMERIC, 25 },
+        /*  6*/ { BARCODE_QRCODE, 1, 1, ZINT_CAPACITY_BYTE, 17 },
+        /*  7*/ { BARCODE_QRCODE, 1, 1, ZINT_CAPACITY_KANJI, 10 },
+        /*  8*/ { BARCODE_QRCODE, 2, 10, ZINT_CAPACITY_ALPHANUMERIC, 311 },
+        /*  9*/ { BARCODE_QRCODE, 4, 40, ZINT_CAPACITY_BYTE, 1273 },
+        /* 10*/ { BARCODE_QRCODE, 1, 41, ZINT_CAPACITY_NUMERIC, 0 }, /* Invalid version */
+        /* 11*/ { BARCODE_QRCODE, 1, 1, 0, 0 }, /* Invalid type */
+        /* 12*/ { BARCODE_QRCODE, 1, 1, ZINT_CAPACITY_KANJI + 1, 0 },
+        /* 13*/ { BARCODE_MICROQR, -1, 1, ZINT_CAPACITY_NUMERIC, 5 },
+        /* 14*/ { BARCODE_MICROQR, -1, 1, ZINT_CAPACITY_ALPHANUMERIC, 0 }, /* Not available in M1 */
+        /* 15*/ { BARCODE_MICROQR, -1, 2, ZINT_CAPACITY_ALPHANUMERIC, 6 },
+        /* 16*/ { BARCODE_MICROQR, -1, 2, ZINT_CAPACITY_BYTE, 0 }, /* Not available in M2 */
+        /* 17*/ { BARCODE_MICROQR, -1, 0, ZINT_CAPACITY_NUMERIC, 35 },
+        /* 18*/ { BARCODE_MICROQR, 1, 4, ZINT_CAPACITY_KANJI, 9 },
+        /* 19*/ { BARCODE_MICROQR, 3, 4, ZINT_CAPACITY_BYTE, 9 },
+        /* 20*/ { BARCODE_MICROQR, 3, 3, ZINT_CAPACITY_NUMERIC, 0 }, /* Q only available in M4 */
+        /* 21*/ { BARCODE_MICROQR, 4, 4, ZINT_CAPACITY_NUMERIC, 0 }, /* No H */
+        /* 22*/ { BARCODE_RMQR, -1, 0, ZINT_CAPACITY_NUMERIC, 361 }, /* ISO/IEC 23941:2022 Table 6 */
+        /* 23*/ { BARCODE_RMQR, -1, 0, ZINT_CAPACITY_ALPHANUMERIC, 219 },
+        /* 24*/ { BARCODE_RMQR, -1, 0, ZINT_CAPACITY_BYTE, 150 },
+        /* 25*/ { BARCODE_RMQR, -1, 0, ZINT_CAPACITY_KANJI, 92 },
+        /* 26*/ { BARCODE_RMQR, 4, 1, ZINT_CAPACITY_NUMERIC, 5 },
+        /* 27*/ { BARCODE_RMQR, 2, 33, ZINT_CAPACITY_BYTE, 42 }, /* Largest of height 7 */
+        /* 28*/ { BARCODE_RMQR, 1, 1, ZINT_CAPACITY_NUMERIC, 0 }, /* L not available */
+        /* 29*/ { BARCODE_DATAMATRIX, -1, 0, ZINT_CAPACITY_NUMERIC, 3116 }, /* ISO/IEC 16022:2006 Table 7 */
+        /* 30*/ { BARCODE_DATAMATRIX, -1, 0, ZINT_CAPACITY_ALPHANUMERIC, 2335 },
+        /* 31*/ { BARCODE_DATAMATRIX, -1, 0, ZINT_CAPACITY_BYTE, 1556 }, /* Note 1 more than Table 7 */
+        /* 32*/ { BARCODE_DATAMATRIX, -1, 0, ZINT_CAPACITY_KANJI, 0 },
+        /* 33*/ { BARCODE_DATAMATRIX, -1, 1, ZINT_CAPACITY_NUMERIC, 6 },
+        /* 34*/ { BARCODE_DATAMATRIX, -1, 1, ZINT_CAPACITY_ALPHANUMERIC, 3 },
+        /* 35*/ { BARCODE_DATAMATRIX, -1, 1, ZINT_CAPACITY_BYTE, 1 },
+        /* 36*/ { BARCODE_DATAMATRIX, -1, 25, ZINT_CAPACITY_ALPHANUMERIC, 6 },
+        /* 37*/ { BARCODE_DATAMATRIX, -1, 48, ZINT_CAPACITY_BYTE, 116 }, /* DMRE 26x64 */
+        /* 38*/ { BARCODE_DATAMATRIX, -1, 49, ZINT_CAPACITY_NUMERIC, 0 },
+        /* 39*/ { BARCODE_AZTEC, -1, 0, ZINT_CAPACITY_NUMERIC, 3835 },
+        /* 40*/ { BARCODE_AZTEC, -1, 0, ZINT_CAPACITY_ALPHANUMERIC, 3069 },
+        /* 41*/ { BARCODE_AZTEC, -1, 0, ZINT_CAPACITY_BYTE, 1915 },
+        /* 42*/ { BARCODE_AZTEC, -1, 0, ZINT_CAPACITY_KANJI, 0 },
+        /* 43*/ { BARCODE_AZTEC, 4, 0, ZINT_CAPACITY_NUMERIC, 2485 },
+        /* 44*/ { BARCODE_AZTEC, -1, 1, ZINT_CAPACITY_NUMERIC, 19 }, /* Compact 1 layer */
+        /* 45*/ { BARCODE_AZTEC, -1, 4, ZINT_CAPACITY_BYTE, 70 },
+        /* 46*/ { BARCODE_AZTEC, -1, 5, ZINT_CAPACITY_ALPHANUMERIC, 21 }, /* Full 1 layer */
+        /* 47*/ { BARCODE_AZTEC, -1, 36, ZINT_CAPACITY_NUMERIC, 4483 },
+        /* 48*/ { BARCODE_AZTEC, -1, 37, ZINT_CAPACITY_NUMERIC, 0 },
+        /* 49*/ { BARCODE_AZTEC, 5, 0, ZINT_CAPACITY_NUMERIC, 0 },
+        /* 50*/ { BARCODE_PDF417, 0, 0, ZINT_CAPACITY_NUMERIC, 2710 }, /* ISO/IEC 15438:2015 5.1.1 c) 3) */
+        /* 51*/ { BARCODE_PDF417, 0, 0, ZINT_CAPACITY_ALPHANUMERIC, 1850 },
+        /* 52*/ { BARCODE_PDF417, 0, 0, ZINT_CAPACITY_BYTE, 1108 },
+        /* 53*/ { BARCODE_PDF417, -1, 0, ZINT_CAPACITY_NUMERIC, 2528 }, /* Default ECC level 5 */
+        /* 54*/ { BARCODE_PDF417, -1, 0, ZINT_CAPACITY_KANJI, 0 },
+        /* 55*/ { BARCODE_PDF417, 8, 0, ZINT_CAPACITY_BYTE, 496 },
+        /* 56*/ { BARCODE_PDF417, 9, 0, ZINT_CAPACITY_BYTE, 0 },
+        /* 57*/ { BARCODE_PDF417COMP, 2, 0, ZINT_CAPACITY_ALPHANUMERIC, 1838 },
+        /* 58*/ { BARCODE_MICROPDF417, -1, 0, ZINT_CAPACITY_NUMERIC, 366 }, /* ISO/IEC 24728:2006 5.1.1 c) 3) */
+        /* 59*/ { BARCODE_MICROPDF417, -1, 0, ZINT_CAPACITY_ALPHANUMERIC, 250 },
+        /* 60*/ { BARCODE_MICROPDF417, -1, 0, ZINT_CAPACITY_BYTE, 150 },
+        /* 61*/ { BARCODE_MICROPDF417, -1, 1, ZINT_CAPACITY_NUMERIC, 55 },
+        /* 62*/ { BARCODE_MICROPDF417, -1, 3, ZINT_CAPACITY_ALPHANUMERIC, 162 },
+        /* 63*/ { BARCODE_MICROPDF417, -1, 5, ZINT_CAPACITY_NUMERIC, 0 },
+        /* 64*/ { BARCODE_CODE128, -1, 0, ZINT_CAPACITY_NUMERIC, 0 }, /* Not supported */
+        /* 65*/ { BARCODE_PDF417, -1, 30, ZINT_CAPACITY_NUMERIC, 2446 }, /* 30 columns x 30 rows */
+        /* 66*/ { BARCODE_PDF417, 0, 30, ZINT_CAPACITY_BYTE, 1075 },
+        /* 67*/ { BARCODE_PDF417, -1, 31, ZINT_CAPACITY_NUMERIC, 0 },
+        /* 68*/ { BARCODE_AZTEC, -1, 36, ZINT_CAPACITY_BYTE, 2237 }, /* 2 B/S blocks */
+        /* 69*/ { BARCODE_AZTEC, 1, 0, ZINT_CAPACITY_BYTE, 2237 },
+        /* 70*/ { BARCODE_HANXIN, -1, 0, ZINT_CAPACITY_NUMERIC, 7827 },
+        /* 71*/ { BARCODE_HANXIN, -1, 0, ZINT_CAPACITY_ALPHANUMERIC, 4350 },
+        /* 72*/ { BARCODE_HANXIN, -1, 0, ZINT_CAPACITY_BYTE, 3261 },
+        /* 73*/ { BARCODE_HANXIN, -1, 0, ZINT_CAPACITY_KANJI, 2174 }, /* GB 2312 Region One */
+        /* 74*/ { BARCODE_HANXIN, 4, 1, ZINT_CAPACITY_NUMERIC, 15 },
+        /* 75*/ { BARCODE_HANXIN, 2, 40, ZINT_CAPACITY_BYTE, 770 },
+        /* 76*/ { BARCODE_HANXIN, -1, 85, ZINT_CAPACITY_NUMERIC, 0 },
+        /* 77*/ { BARCODE_HANXIN, 5, 0, ZINT_CAPACITY_NUMERIC, 0 },
+        /* 78*/ { BARCODE_GRIDMATRIX, -1, 0, ZINT_CAPACITY_NUMERIC, 2751 },
+        /* 79*/ { BARCODE_GRIDMATRIX, -1, 0, ZINT_CAPACITY_ALPHANUMERIC, 1836 },
+        /* 80*/ { BARCODE_GRIDMATRIX, -1, 0, ZINT_CAPACITY_BYTE, 1143 }, /* 3 byte blocks */
+        /* 81*/ { BARCODE_GRIDMATRIX, -1, 0, ZINT_CAPACITY_KANJI, 705 }, /* GB 2312 */
+        /* 82*/ { BARCODE_GRIDMATRIX, 5, 2, ZINT_CAPACITY_KANJI, 20 }, /* ECC level lowered */
+        /* 83*/ { BARCODE_GRIDMATRIX, -1, 14, ZINT_CAPACITY_NUMERIC, 0 },
+        /* 84*/ { BARCODE_GRIDMATRIX, 6, 0, ZINT_CAPACITY_NUMERIC, 0 },
+        /* 85*/ { BARCODE_CODEONE, -1, 0, ZINT_CAPACITY_NUMERIC, 3550 },
+        /* 86*/ { BARCODE_CODEONE, -1, 0, ZINT_CAPACITY_ALPHANUMERIC, 2218 },
+        /* 87*/ { BARCODE_CODEONE, -1, 0, ZINT_CAPACITY_BYTE, 1478 },
+        /* 88*/ { BARCODE_CODEONE, -1, 0, ZINT_CAPACITY_KANJI, 0 },
+        /* 89*/ { BARCODE_CODEONE, -1, 1, ZINT_CAPACITY_NUMERIC, 22 }, /* Version A, last digit in 4 bits */
+        /* 90*/ { BARCODE_CODEONE, -1, 7, ZINT_CAPACITY_NUMERIC, 1755 }, /* Version G (note 1754 doesn't fit) */
+        /* 91*/ { BARCODE_CODEONE, -1, 9, ZINT_CAPACITY_NUMERIC, 18 }, /* Version S */
+        /* 92*/ { BARCODE_CODEONE, -1, 9, ZINT_CAPACITY_BYTE, 0 },
+        /* 93*/ { BARCODE_CODEONE, -1, 10, ZINT_CAPACITY_BYTE, 36 }, /* Version T */
+        /* 94*/ { BARCODE_CODEONE, -1, 11, ZINT_CAPACITY_NUMERIC, 0 },
+        /* 95*/ { BARCODE_DOTCODE, -1, 0, ZINT_CAPACITY_NUMERIC, 0 }, /* Not supported, size open-ended */
+    };
+    int data_size = ARRAY_SIZE(data);
+    int i, j, length, ret;
+    struct zint_symbol *symbol;
+    struct zint_geometry geometry;
+    char *buf;
+
+    /* Units for each `char_type` */
+    static const char *units[] = {
+        "", "1", "A", "\252", "\347\202\271" /* U+70B9 Shift JIS 0x935F, GB 2312 0xB5E3 */
+    };
+
+    testStart("test_capacity");
+
+    buf = (char *) malloc(ZINT_MAX_DATA_LEN + 1);
+    assert_nonnull(buf, "buf malloc failed\n");
+
+    for (i = 0; i < data_size; i++) {
+
+        if (testContinue(p_ctx, i)) continue;
+
+        ret = ZBarcode_Capacity(data[i].symbology, data[i].option_1, data[i].option_2, data[i].char_type);
+        assert_equal(ret, data[i].expected, "i:%d ZBarcode_Capacity %d != %d\n", i, ret, data[i].expected);
+
+        if (ret == 0) {
+            continue;
+        }
+
+        /* Check that capacity fits and one more doesn't */
+        for (j = 0; j < 2; j++) {
+            symbol = ZBarcode_Create();
+            assert_nonnull(symbol, "Symbol not created\n");
+
+            length = test_fill(buf, units[data[i].char_type], data[i].expected + j);
+            (void) testUtilSetSymbol(symbol, data[i].symbology,
+                        data[i].char_type == ZINT_CAPACITY_KANJI ? UNICODE_MODE : DATA_MODE, -1 /*eci*/,
+                        data[i].option_1, data[i].option_2, -1, -1 /*output_options*/, buf, length, debug);
+            if (data[i].symbology == BARCODE_MICROPDF417) {
+                symbol->warn_level = WARN_FAIL_ALL; /* Fail on columns increase */
+            }
+
+            ret = ZBarcode_Geometry(symbol, TU(buf), length, &geometry);
+            if (j == 0) {
+                assert_nonzero(ret < ZINT_ERROR, "i:%d capacity %d ret %d (%s)\n",
+                            i, data[i].expected, ret, symbol->errtxt);
+            } else {
+                assert_nonzero(ret >= ZINT_ERROR, "i:%d capacity + 1 %d ret %d\n", i, data[i].expected + 1, ret);
+            }
+
+            ZBarcode_Delete(symbol);
+        }
+    }
+
+    free(buf);
+
+    testFinish();
+}
+
+/* Check capacity against encoding for every size */
+static void test_capacity_sizes(const testCtx *const p_ctx) {
+    int debug = p_ctx->debug;
+
+    struct item {
+        int symbology;
+        int option_1_min;
+        int option_1_max;
+        int option_2_min;
+        int option_2_max;
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    struct item data[] = {
+        /*  0*/ { BARCODE_QRCODE, 1, 4, 1, 40 },
+        /*  1*/ { BARCODE_MICROQR, 1, 3, 1, 4 },
+        /*  2*/ { BARCODE_RMQR, 2, 4, 1, 32 },
+        /*  3*/ { BARCODE_DATAMATRIX, -1, -1, 1, 48 },
+        /*  4*/ { BARCODE_AZTEC, -1, 4, 0, 0 },
+        /*  5*/ { BARCODE_AZTEC, -1, -1, 1, 36 },
+        /*  6*/ { BARCODE_PDF417, -1, 8, 0, 0 },
+        /*  7*/ { BARCODE_PDF417, -1, -1, 1, 30 },
+        /*  8*/ { BARCODE_MICROPDF417, -1, -1, 0, 4 },
+        /*  9*/ { BARCODE_HANXIN, 1, 4, 1, 84 },
+        /* 10*/ { BARCODE_GRIDMATRIX, 1, 5, 0, 0 },
+        /* 11*/ { BARCODE_GRIDMATRIX, -1, -1, 1, 13 },
+        /* 12*/ { BARCODE_CODEONE, -1, -1, 0, 10 },
+    };
+    int data_size = ARRAY_SIZE(data);
+    int i, j, length, ret;
+    int option_1, option_2, char_type, capacity;
+    struct zint_symbol *symbol;
+    struct zint_geometry geometry;
+    char *buf;
+
+    /* Units for each `char_type` */
+    static const char *units[] = {
+        "", "1", "A", "\252", "\347\202\271" /* U+70B9 Shift JIS 0x935F, GB 2312 0xB5E3 */
+    };
+
+    testStart("test_capacity_sizes");
+
+    buf = (char *) malloc(ZINT_MAX_DATA_LEN + 1);
+    assert_nonnull(buf, "buf malloc failed\n");
+
+    for (i = 0; i < data_size; i++) {
+
+        if (testContinue(p_ctx, i)) continue;
+
+        for (option_1 = data[i].option_1_min; option_1 <= data[i].option_1_max; option_1++) {
+            for (option_2 = data[i].option_2_min; option_2 <= data[i].option_2_max; option_2++) {
+                for (char_type = ZINT_CAPACITY_NUMERIC; char_type <= ZINT_CAPACITY_KANJI; char_type++) {
+                    capacity = ZBarcode_Capacity(data[i].symbology, option_1, option_2, char_type);
+                    if (capacity == 0) {
+                        continue; /* Not available at this size */
+                    }
+
+                    /* Check that capacity fits and one more doesn't */
+                    for (j = 0; j < 2; j++) {
+                        symbol = ZBarcode_Create();
+                        assert_nonnull(symbol, "Symbol not created\n");
+
+                        length = test_fill(buf, units[char_type], capacity + j);
+                        (void) testUtilSetSymbol(symbol, data[i].symbology,
+                                    char_type == ZINT_CAPACITY_KANJI ? UNICODE_MODE : DATA_MODE, -1 /*eci*/,
+                                    option_1, option_2, -1, -1 /*output_options*/, buf, length, debug);
+                        if (data[i].symbology == BARCODE_MICROPDF417) {
+                            symbol->warn_level = WARN_FAIL_ALL; /* Fail on columns increase */
+                        }
+
+                        ret = ZBarcode_Geometry(symbol, TU(buf), length, &geometry);
+                        if (j == 0) {
+                            assert_nonzero(ret < ZINT_ERROR, "i:%d option_1 %d option_2 %d char_type %d capacity %d"
+                                        " ret %d (%s)\n",
+                                        i, option_1, option_2, char_type, capacity, ret, symbol->errtxt);
+                        } else {
+                            assert_nonzero(ret >= ZINT_ERROR, "i:%d option_1 %d option_2 %d char_type %d capacity + 1"
+                                        " %d ret %d\n", i, option_1, option_2, char_type, capacity + 1, ret);
+                        }
+
+                        ZBarcode_Delete(symbol);
+                    }
+                }
+            }
+        }
+    }
+
+    free(buf);
+
+    testFinish();
+}
+
+static void test_fits(const testCtx *const p_ctx) {
+    int debug = p_ctx->debug;
+
+    struct item {
+        int symbology;
+        int input_mode;
+        int eci;
+        int option_1;
+        int option_2;
+        int option_3;
+        char *prefix;
+        char *unit;
+        int count;
+        int ret;
+        char *expected_errtxt;
+        char *comment;
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    struct item data[] = {
+        /*  0*/ { BARCODE_QRCODE, DATA_MODE, 0, -1, -1, -1, "", "1", 7090, ZINT_ERROR_TOO_LONG, "Error 788: Input too long (7089 character maximum)", "Table reject" },
+        /*  1*/ { BARCODE_QRCODE, DATA_MODE, 0, -1, -1, -1, "", "a", 2953, 0, "", "Table accept" },
+        /*  2*/ { BARCODE_QRCODE, DATA_MODE, 0, -1, -1, -1, "", "1", 7089, 0, "", "Sized" },
+        /*  3*/ { BARCODE_QRCODE, DATA_MODE, 0, -1, -1, -1, "", "a", 2954, ZINT_ERROR_TOO_LONG, "Error 561: Input too long for selected error correction level", "Sized" },
+        /*  4*/ { BARCODE_QRCODE, UNICODE_MODE, 0, -1, -1, -1, "", "a", 2953, 0, "", "Table accept" },
+        /*  5*/ { BARCODE_QRCODE, UNICODE_MODE, 0, -1, -1, -1, "\303\251", "a", 2951, 0, "", "Sized as non-ASCII" },
+        /*  6*/ { BARCODE_QRCODE, UNICODE_MODE | ESCAPE_MODE, 0, -1, -1, -1, "", "\\d097", 2953, 0, "", "Sized as escapes" },
+        /*  7*/ { BARCODE_QRCODE, DATA_MODE, 3, -1, -1, -1, "", "a", 2953, ZINT_ERROR_TOO_LONG, "Error 561: Input too long for selected error correction level", "Sized as ECI" },
+        /*  8*/ { BARCODE_QRCODE, GS1_MODE, 0, -1, -1, -1, "[01]", "1", 7100, ZINT_ERROR_INVALID_DATA, "Error 259: Invalid data length for AI (01)", "Sized as GS1" },
+        /*  9*/ { BARCODE_QRCODE, DATA_MODE, 0, 1, 1, -1, "", "1", 42, ZINT_ERROR_TOO_LONG, "Error 788: Input too long (41 character maximum)", "Table reject" },
+        /* 10*/ { BARCODE_RMQR, DATA_MODE, 0, -1, 39, -1, "", "1", 1, ZINT_ERROR_INVALID_OPTION, "Error 579: Invalid rMQR symbol size", "Sized as invalid options" },
+        /* 11*/ { BARCODE_MICROQR, DATA_MODE, 0, -1, -1, -1, "", "1", 36, ZINT_ERROR_TOO_LONG, "Error 788: Input too long (35 character maximum)", "Table reject" },
+        /* 12*/ { BARCODE_MICROQR, DATA_MODE, 0, -1, -1, -1, "", "a", 15, 0, "", "Table accept" },
+        /* 13*/ { BARCODE_RMQR, DATA_MODE, 0, -1, -1, -1, "", "a", 150, 0, "", "Table accept" },
+        /* 14*/ { BARCODE_RMQR, DATA_MODE, 0, -1, -1, -1, "", "A", 219, 0, "", "Sized" },
+        /* 15*/ { BARCODE_DATAMATRIX, DATA_MODE, 0, -1, -1, -1, "", "1", 3117, ZINT_ERROR_TOO_LONG, "Error 788: Input too long (3116 character maximum)", "Table reject" },
+        /* 16*/ { BARCODE_DATAMATRIX, DATA_MODE, 0, -1, -1, -1, "", "\252", 1556, 0, "", "Table accept" },
+        /* 17*/ { BARCODE_DATAMATRIX, DATA_MODE, 0, -1, -1, -1, "[)>", "1", 3114, ZINT_ERROR_TOO_LONG, "Error 719: Data too long to fit in symbol", "Sized as possible macro" },
+        /* 18*/ { BARCODE_PDF417, DATA_MODE, 0, -1, -1, -1, "", "1", 2529, ZINT_ERROR_TOO_LONG, "Error 788: Input too long (2528 character maximum)", "Table reject" },
+        /* 19*/ { BARCODE_PDF417, DATA_MODE, 0, -1, -1, -1, "", "\252", 1034, 0, "", "Table accept" },
+        /* 20*/ { BARCODE_PDF417, DATA_MODE, 0, -1, -1, 10, "", "1", 2529, ZINT_ERROR_TOO_LONG, "Error 464: Input string too long", "Sized as rows given" },
+        /* 21*/ { BARCODE_MICROPDF417, DATA_MODE, 0, -1, 1, -1, "", "1", 56, ZINT_WARN_INVALID_OPTION, "Warning 469: Specified symbol size too small for data", "Sized as columns increased" },
+        /* 22*/ { BARCODE_MICROPDF417, DATA_MODE, 0, -1, 1, -1, "", "1", 367, ZINT_ERROR_TOO_LONG, "Error 788: Input too long (366 character maximum)", "Table reject, any columns" },
+        /* 23*/ { BARCODE_AZTEC, DATA_MODE, 0, -1, -1, -1, "", "1", 3836, ZINT_ERROR_TOO_LONG, "Error 504: Input too long (too many bits for selected ECC)", "Sized" },
+        /* 24*/ { BARCODE_AZTEC, DATA_MODE, 0, -1, -1, -1, "", ". ", 2000, 0, "", "Sized (punctuation pairs)" },
+        /* 25*/ { BARCODE_CODE128, DATA_MODE, 0, -1, -1, -1, "", "1", 10, 0, "", "Sized" },
+    };
+    int data_size = ARRAY_SIZE(data);
+    int i, length, ret, ret_encode;
+    struct zint_symbol *symbol;
+    char *buf;
+
+    testStart("test_fits");
+
+    buf = (char *) malloc(8000 * 5 + 1);
+    assert_nonnull(buf, "buf malloc failed\n");
+
+    for (i = 0; i < data_size; i++) {
+
+        if (testContinue(p_ctx, i)) continue;
+
+        symbol = ZBarcode_Create();
+        assert_nonnull(symbol, "Symbol not created\n");
+
+        strcpy(buf, data[i].prefix);
+        length = (int) strlen(buf);
+        length += test_fill(buf + length, data[i].unit, data[i].count);
+        (void) testUtilSetSymbol(symbol, data[i].symbology, data[i].input_mode, data[i].eci,
+                    data[i].option_1, data[i].option_2, data[i].option_3, -1 /*output_options*/, buf, length, debug);
+
+        ret = ZBarcode_Fits(symbol, TU(buf), length);
+        assert_equal(ret, data[i].ret, "i:%d ZBarcode_Fits ret %d != %d (%s)\n", i, ret, data[i].ret, symbol->errtxt);
+        assert_zero(strcmp(symbol->errtxt, data[i].expected_errtxt), "i:%d errtxt %s != %s\n",
+                    i, symbol->errtxt, data[i].expected_errtxt);
+        assert_zero(symbol->rows, "i:%d symbol->rows %d != 0\n", i, symbol->rows);
+
+        /* Check agrees with encoding */
+        ret_encode = ZBarcode_Encode(symbol, TU(buf), length);
+        assert_equal(ret_encode < ZINT_ERROR, ret < ZINT_ERROR, "i:%d ZBarcode_Encode ret %d, ZBarcode_Fits ret %d\n",
+                    i, ret_encode, ret);
+
+        ZBarcode_Delete(symbol);
+    }
+
+    free(buf);
+
+    testFinish();
+}
+
+static void test_fits_bad_args(const testCtx *const p_ctx) {
+    int ret;
+    struct zint_symbol *symbol;
+
+    (void)p_ctx;
+
+    testStart("test_fits_bad_args");
+
+    symbol = ZBarcode_Create();
+    assert_nonnull(symbol, "Symbol not created\n");
+
+    ret = ZBarcode_Fits(NULL, TU("1"), 0);
+    assert_equal(ret, ZINT_ERROR_INVALID_DATA, "ZBarcode_Fits(NULL) ret %d != ZINT_ERROR_INVALID_DATA\n", ret);
+
+    symbol->symbology = BARCODE_QRCODE;
+    ret = ZBarcode_Fits(symbol, NULL, 1);
+    assert_equal(ret, ZINT_ERROR_INVALID_DATA, "ZBarcode_Fits(source NULL) ret %d != ZINT_ERROR_INVALID_DATA\n",
+                ret);
+    assert_zero(strcmp(symbol->errtxt, "Error 772: Input segment 0 source NULL"), "errtxt %s\n", symbol->errtxt);
+
+    ret = ZBarcode_Fits(symbol, TU(""), 0);
+    assert_equal(ret, ZINT_ERROR_INVALID_DATA, "ZBarcode_Fits(empty) ret %d != ZINT_ERROR_INVALID_DATA\n", ret);
+    assert_zero(strcmp(symbol->errtxt, "Error 778: No input data (segment 0 empty)"), "errtxt %s\n", symbol->errtxt);
+
+    ZBarcode_Delete(symbol);
+
+    testFinish();
+}
+
+#define STATS_PHASE(phase) (1 << ZINT_PHASE_##phase)
+
+static void test_stats(const testCtx *const p_ctx) {
+    int debug = p_ctx->debug;
+
+    struct item {
+        int symbology;
+        int input_mode;
+        int option_1;
+        int option_2;
+        char *outfile;
+        char *data;
+        int ret;
+        int expected_rows;
+        int expected_width;
+        int expected_version;
+        int expected_ecc_level;
+        int expected_mask;
+        int expected_phases; /* Phases entered */
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    struct item data[] = {
+        /*  0*/ { BARCODE_CODE128, -1, -1, -1, "", "1234", 0, 1, 57, -1, -1, -1, STATS_PHASE(ENCODE) | STATS_PHASE(VALIDATE) | STATS_PHASE(PLOT) | STATS_PHASE(OUTPUT) },
+        /*  1*/ { BARCODE_CODE128, UNICODE_MODE, -1, -1, "", "é", 0, 1, 57, -1, -1, -1, STATS_PHASE(ENCODE) | STATS_PHASE(VALIDATE) | STATS_PHASE(ECI) | STATS_PHASE(PLOT) | STATS_PHASE(OUTPUT) },
+        /*  2*/ { BARCODE_CODE128, UNICODE_MODE | ESCAPE_MODE, -1, -1, "", "\\d0491234", 0, 1, 79, -1, -1, -1, STATS_PHASE(ENCODE) | STATS_PHASE(VALIDATE) | STATS_PHASE(ECI) | STATS_PHASE(PLOT) | STATS_PHASE(OUTPUT) },
+        /*  3*/ { BARCODE_GS1_128, GS1_MODE, -1, -1, "", "[01]12345678901231", 0, 1, 134, -1, -1, -1, STATS_PHASE(ENCODE) | STATS_PHASE(VALIDATE) | STATS_PHASE(PLOT) | STATS_PHASE(OUTPUT) },
+        /*  4*/ { BARCODE_QRCODE, -1, -1, -1, "", "1234", 0, 21, 21, 1, 4, 6, STATS_PHASE(ENCODE) | STATS_PHASE(VALIDATE) | STATS_PHASE(MODE) | STATS_PHASE(RS) | STATS_PHASE(MASK) | STATS_PHASE(PLOT) | STATS_PHASE(OUTPUT) },
+        /*  5*/ { BARCODE_QRCODE, GS1_MODE, 1, 2, "out.svg", "[01]12345678901231", 0, 25, 25, 2, 1, 1, STATS_PHASE(ENCODE) | STATS_PHASE(VALIDATE) | STATS_PHASE(GS1) | STATS_PHASE(MODE) | STATS_PHASE(RS) | STATS_PHASE(MASK) | STATS_PHASE(PLOT) | STATS_PHASE(OUTPUT) },
+        /*  6*/ { BARCODE_MICROQR, -1, -1, -1, "", "1234", 0, 11, 11, 1, 1, 2, STATS_PHASE(ENCODE) | STATS_PHASE(VALIDATE) | STATS_PHASE(MODE) | STATS_PHASE(RS) | STATS_PHASE(MASK) | STATS_PHASE(PLOT) | STATS_PHASE(OUTPUT) },
+        /*  7*/ { BARCODE_RMQR, -1, -1, -1, "", "1234", 0, 11, 27, 11, 4, -1, STATS_PHASE(ENCODE) | STATS_PHASE(VALIDATE) | STATS_PHASE(MODE) | STATS_PHASE(RS) | STATS_PHASE(PLOT) | STATS_PHASE(OUTPUT) },
+        /*  8*/ { BARCODE_DATAMATRIX, -1, -1, -1, "out.png", "1234", 0, 10, 10, 1, -1, -1, STATS_PHASE(ENCODE) | STATS_PHASE(VALIDATE) | STATS_PHASE(MODE) | STATS_PHASE(RS) | STATS_PHASE(PLOT) | STATS_PHASE(OUTPUT) },
+        /*  9*/ { BARCODE_PDF417, -1, -1, -1, "", "1234", 0, 6, 103, 2, 2, -1, STATS_PHASE(ENCODE) | STATS_PHASE(VALIDATE) | STATS_PHASE(MODE) | STATS_PHASE(RS) | STATS_PHASE(PLOT) | STATS_PHASE(OUTPUT) },
+        /* 10*/ { BARCODE_AZTEC, -1, -1, -1, "", "1234", 0, 15, 15, 1, -1, -1, STATS_PHASE(ENCODE) | STATS_PHASE(VALIDATE) | STATS_PHASE(RS) | STATS_PHASE(PLOT) | STATS_PHASE(OUTPUT) },
+        /* 11*/ { BARCODE_HANXIN, -1, -1, -1, "out.gif", "1234", 0, 23, 23, 1, 4, -1, STATS_PHASE(ENCODE) | STATS_PHASE(VALIDATE) | STATS_PHASE(MODE) | STATS_PHASE(RS) | STATS_PHASE(MASK) | STATS_PHASE(PLOT) | STATS_PHASE(OUTPUT) },
+        /* 12*/ { BARCODE_QRCODE, -1, 1, 1, "", "12345678901234567890123456789012345678901234", ZINT_ERROR_TOO_LONG, 0, 0, -1, -1, -1, STATS_PHASE(ENCODE) | STATS_PHASE(VALIDATE) | STATS_PHASE(MODE) },
+        /* 13*/ { BARCODE_QRCODE, UNICODE_MODE, -1, -1, "", "\377", ZINT_ERROR_INVALID_DATA, 0, 0, -1, -1, -1, STATS_PHASE(ENCODE) | STATS_PHASE(VALIDATE) },
+        /* 14*/ { BARCODE_CODE128, ESCAPE_MODE, -1, -1, "", "\\x", ZINT_ERROR_INVALID_DATA, 0, 0, -1, -1, -1, STATS_PHASE(ENCODE) | STATS_PHASE(VALIDATE) },
+    };
+    int data_size = ARRAY_SIZE(data);
+    int i, length, ret, phase;
+    struct zint_symbol *symbol;
+    struct zint_stats stats;
+
+    const int have_stats = ZBarcode_HaveStats();
+
+    testStart("test_stats");
+
+    for (i = 0; i < data_size; i++) {
+
+        if (testContinue(p_ctx, i)) continue;
+
+        symbol = ZBarcode_Create();
+        assert_nonnull(symbol, "Symbol not created\n");
+
+        length = testUtilSetSymbol(symbol, data[i].symbology, data[i].input_mode, -1 /*eci*/,
+                    data[i].option_1, data[i].option_2, -1, -1 /*output_options*/, data[i].data, -1, debug);
+        if (*data[i].outfile) {
+            symbol->output_options |= BARCODE_MEMORY_FILE;
+            strcpy(symbol->outfile, data[i].outfile);
+        }
+        memset(&stats, 0xFF, sizeof(stats)); /* Garbage, should be reset on encode */
+        symbol->stats = &stats;
+
+        ret = ZBarcode_Encode(symbol, TU(data[i].data), length);
+        assert_equal(ret, data[i].ret, "i:%d ZBarcode_Encode ret %d != %d (%s)\n", i, ret, data[i].ret,
+                    symbol->errtxt);
+        if (ret < ZINT_ERROR) {
+            if (*data[i].outfile) {
+                ret = ZBarcode_Print(symbol, 0);
+                assert_zero(ret, "i:%d ZBarcode_Print ret %d != 0 (%s)\n", i, ret, symbol->errtxt);
+            } else {
+                ret = ZBarcode_Buffer(symbol, 0);
+                assert_zero(ret, "i:%d ZBarcode_Buffer ret %d != 0 (%s)\n", i, ret, symbol->errtxt);
+            }
+        }
+
+        if (!have_stats) {
+            /* Left untouched */
+            assert_equal(stats.version, -1, "i:%d stats.version %d != -1\n", i, stats.version);
+            assert_equal(stats.rows, -1, "i:%d stats.rows %d != -1\n", i, stats.rows);
+            ZBarcode_Delete(symbol);
+            continue;
+        }
+
+        assert_equal(stats.rows, data[i].expected_rows, "i:%d rows %d != %d\n",
+                    i, stats.rows, data[i].expected_rows);
+        assert_equal(stats.width, data[i].expected_width, "i:%d width %d != %d\n",
+                    i, stats.width, data[i].expected_width);
+        assert_equal(stats.version, data[i].expected_version, "i:%d version %d != %d\n",
+                    i, stats.version, data[i].expected_version);
+        assert_equal(stats.ecc_level, data[i].expected_ecc_level, "i:%d ecc_level %d != %d\n",
+                    i, stats.ecc_level, data[i].expected_ecc_level);
+        assert_equal(stats.mask, data[i].expected_mask, "i:%d mask %d != %d\n",
+                    i, stats.mask, data[i].expected_mask);
+        assert_equal(stats.input_length, length, "i:%d input_length %d != %d\n", i, stats.input_length, length);
+        if (*data[i].outfile && ret < ZINT_ERROR) {
+            assert_equal(stats.output_size, symbol->memfile_size, "i:%d output_size %d != %d\n",
+                        i, stats.output_size, symbol->memfile_size);
+        } else {
+            assert_zero(stats.output_size, "i:%d output_size %d != 0\n", i, stats.output_size);
+        }
+        for (phase = 0; phase < ZINT_PHASE_COUNT; phase++) {
+            if (data[i].expected_phases & (1 << phase)) {
+                assert_nonzero(stats.calls[phase], "i:%d phase %d calls zero\n", i, phase);
+                assert_nonzero(stats.ns[phase] >= 0.0, "i:%d phase %d ns %g < 0\n", i, phase, stats.ns[phase]);
+            } else {
+                assert_zero(stats.calls[phase], "i:%d phase %d calls %lu != 0\n", i, phase, stats.calls[phase]);
+                assert_zero(stats.ns[phase], "i:%d phase %d ns %g != 0\n", i, phase, stats.ns[phase]);
+            }
+        }
+        assert_nonzero(stats.ns[ZINT_PHASE_ENCODE] >= stats.ns[ZINT_PHASE_VALIDATE],
+                    "i:%d encode ns %g < validate ns %g\n",
+                    i, stats.ns[ZINT_PHASE_ENCODE], stats.ns[ZINT_PHASE_VALIDATE]);
+
+        ZBarcode_Delete(symbol);
+    }
+
+    testFinish();
+}
+
+static int test_alloc_count;
+static int test_free_count;
+static size_t test_alloc_size; /* Size of last `test_malloc()` */
+
+static void *test_malloc(size_t size) {
+    test_alloc_count++;
+    test_alloc_size = size;
+    return malloc(size);
+}
+
+static void *test_realloc(void *ptr, size_t size) {
+    if (!ptr) {
+        test_alloc_count++;
+    }
+    return realloc(ptr, size);
+}
+
+static void test_free(void *ptr) {
+    if (ptr) {
+        test_free_count++;
+    }
+    free(ptr);
+}
+
+static void test_allocator(const testCtx *const p_ctx) {
+    int debug = p_ctx->debug;
+
+    struct item {
+        int symbology;
+        int input_mode;
+        int option_1;
+        int option_2;
+        char *data;
+        int arena_size;
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    struct item data[] = {
+        /*  0*/ { BARCODE_QRCODE, -1, -1, -1, "1234", 0 },
+        /*  1*/ { BARCODE_QRCODE, UNICODE_MODE, 2, -1, "1234ABCDéabcdefghijklmnopqrstuvwxyz1234567890", 0 },
+        /*  2*/ { BARCODE_QRCODE, UNICODE_MODE, 2, -1, "1234ABCDéabcdefghijklmnopqrstuvwxyz1234567890", 16 },
+        /*  3*/ { BARCODE_QRCODE, UNICODE_MODE, 2, -1, "1234ABCDéabcdefghijklmnopqrstuvwxyz1234567890", 65536 },
+        /*  4*/ { BARCODE_MICROQR, -1, -1, -1, "1234", 1024 },
+        /*  5*/ { BARCODE_UPNQR, UNICODE_MODE, -1, -1, "1234", 1024 },
+        /*  6*/ { BARCODE_RMQR, -1, -1, -1, "1234", 1024 },
+        /*  7*/ { BARCODE_DATAMATRIX, -1, -1, -1, "1234ABCDabcdefghijklmnopqrstuvwxyz1234567890", 1024 },
+        /*  8*/ { BARCODE_DATAMATRIX, GS1_MODE, -1, -1, "[01]12345678901231[10]ABC", 1024 },
+        /*  9*/ { BARCODE_PDF417, -1, -1, -1, "1234ABCDabcdefghijklmnopqrstuvwxyz1234567890", 1024 },
+        /* 10*/ { BARCODE_CODE128, -1, -1, -1, "1234", 1024 },
+    };
+    int data_size = ARRAY_SIZE(data);
+    int i, length, ret;
+    int alloc_count;
+    struct zint_symbol *symbol;
+
+    testStart("test_allocator");
+
+    ret = ZBarcode_SetAllocator(test_malloc, NULL, test_free);
+    assert_equal(ret, ZINT_ERROR_INVALID_OPTION, "ZBarcode_SetAllocator partial ret %d != ZINT_ERROR_INVALID_OPTION\n",
+                ret);
+    ret = ZBarcode_SetArena(NULL, 1024);
+    assert_equal(ret, ZINT_ERROR_INVALID_DATA, "ZBarcode_SetArena(NULL) ret %d != ZINT_ERROR_INVALID_DATA\n", ret);
+
+    ret = ZBarcode_SetAllocator(test_malloc, test_realloc, test_free);
+    assert_zero(ret, "ZBarcode_SetAllocator ret %d != 0\n", ret);
+
+    /* Compact symbols allocated without `encoded_data` (allow 1K for private state, which varies with build) */
+    symbol = ZBarcode_Create_Compact();
+    assert_nonnull(symbol, "Compact symbol not created\n");
+    assert_nonzero(test_alloc_size < offsetof(struct zint_symbol, encoded_data) + 1024,
+                    "Compact symbol alloc size %d too big\n", (int) test_alloc_size);
+    ZBarcode_Delete(symbol);
+
+    for (i = 0; i < data_size; i++) {
+
+        if (testContinue(p_ctx, i)) continue;
+
+        test_alloc_count = test_free_count = 0;
+
+        symbol = ZBarcode_Create();
+        assert_nonnull(symbol, "Symbol not created\n");
+        assert_equal(test_alloc_count, 1, "i:%d alloc count %d != 1\n", i, test_alloc_count);
+
+        if (data[i].arena_size) {
+            ret = ZBarcode_SetArena(symbol, data[i].arena_size);
+            assert_zero(ret, "i:%d ZBarcode_SetArena ret %d != 0 (%s)\n", i, ret, symbol->errtxt);
+        }
+
+        length = testUtilSetSymbol(symbol, data[i].symbology, data[i].input_mode, -1 /*eci*/,
+                    data[i].option_1, data[i].option_2, -1, -1 /*output_options*/, data[i].data, -1, debug);
+
+        ret = ZBarcode_Encode(symbol, TU(data[i].data), length);
+        assert_zero(ret, "i:%d ZBarcode_Encode ret %d != 0 (%s)\n", i, ret, symbol->errtxt);
+
+        if (data[i].arena_size) {
+            /* Arena warmed up, so re-encode should allocate nothing */
+            alloc_count = test_alloc_count;
+            if (data[i].symbology == BARCODE_UPNQR) {
+                symbol->eci = 0; /* UPNQR sets ECI 4 */
+            }
+            ret = ZBarcode_Encode(symbol, TU(data[i].data), length);
+            assert_zero(ret, "i:%d ZBarcode_Encode 2nd ret %d != 0 (%s)\n", i, ret, symbol->errtxt);
+            assert_equal(test_alloc_count, alloc_count, "i:%d 2nd encode alloc count %d != %d\n",
+                        i, test_alloc_count, alloc_count);
+        }
+
+        ret = ZBarcode_Buffer(symbol, 0);
+        assert_zero(ret, "i:%d ZBarcode_Buffer ret %d != 0 (%s)\n", i, ret, symbol->errtxt);
+
+        ZBarcode_Delete(symbol);
+
+        assert_nonzero(test_alloc_count, "i:%d alloc count zero\n", i);
+        assert_equal(test_free_count, test_alloc_count, "i:%d free count %d != alloc count %d\n",
+                    i, test_free_count, test_alloc_count);
+    }
+
+    ret = ZBarcode_SetAllocator(NULL, NULL, NULL);
+    assert_zero(ret, "ZBarcode_SetAllocator(NULL) ret %d != 0\n", ret);
+
+    testFinish();
+}
+
 int main(int argc, char *argv[]) {
 
     testFunction funcs[] = { /* name, func */
@@ -1613,6 +2954,20 @@ int main(int argc, char *argv[]) {
         { "test_clear", test_clear },
         { "test_scale_from_xdimdp", test_scale_from_xdimdp },
         { "test_xdimdp_from_scale", test_xdimdp_from_scale },
+        { "test_encode_batch", test_encode_batch },
+        { "test_encode_batch_bad_args", test_encode_batch_bad_args },
+        { "test_create_compact", test_create_compact },
+        { "test_module", test_module },
+        { "test_prepare", test_prepare },
+        { "test_prepare_bad_args", test_prepare_bad_args },
+        { "test_geometry", test_geometry },
+        { "test_geometry_bad_args", test_geometry_bad_args },
+        { "test_capacity", test_capacity },
+        { "test_capacity_sizes", test_capacity_sizes },
+        { "test_fits", test_fits },
+        { "test_fits_bad_args", test_fits_bad_args },
+        { "test_stats", test_stats },
+        { "test_allocator", test_allocator },
     };
 
     testRun(argc, argv, funcs, ARRAY_SIZE(funcs));
@@ -4020,6 +4020,29 @@ static void test_qr_encode(const testCtx *const p_ctx) {
                     "100000100100010011101"
                     "111111100011110001100"
                 },
+        /*128*/ { BARCODE_QRCODE, UNICODE_MODE | FAST_MODE, -1, -1, -1, 2 << 8, { 0, 0, "" }, "ABCDEFGHI", 9, 0, 21, 21, 1, "Fast mode with specified mask 001 (previously not applied)",
+                    "111111100011001111111"
+                    "100000101110101000001"
+                    "101110101101101011101"
+                    "101110101010101011101"
+                    "101110101010001011101"
+                    "100000101001001000001"
+                    "111111101010101111111"
+                    "000000000100100000000"
+                    "001001111000010111110"
+                    "000011011001000001010"
+                    "100101101110011111100"
+                    "100110011011001001000"
+                    "000110101010111110100"
+                    "000000001010111000010"
+                    "111111101001010011010"
+                    "100000101000001010100"
+                    "101110100001011101001"
+                    "101110100101100000000"
+                    "101110101011111110111"
+                    "100000100000110111001"
+                    "111111100000101010111"
+                },
     };
     int data_size = ARRAY_SIZE(data);
     int i, length, ret;
@@ -4508,6 +4531,8 @@ static void test_qr_perf(const testCtx *const p_ctx) {
                     "ABCDEFGHIJKLMNOPQRSTUVWXYZ abcdefghijklmnopqrstuvwxyz 12345678901234567890123456 点点点点点点点点点点点点点点点点点点点点点点点点点点"
                     "ABCDEFGHIJKLMNOPQRSTUVWXYZ abcdefghijklmnopqrstuvwxyz 12345678901234567890123456 点点点点点点点点点点点点点点点点点点点点点点点点点点",
                     ZINT_WARN_NONCOMPLIANT, 133, 133, "1498 chars, Mixed modes" },
+        /*  8*/ { BARCODE_QRCODE, UNICODE_MODE, -1, 25, "12345678901234", 0, 117, 117, "14 chars, Version 25 (masking)" },
+        /*  9*/ { BARCODE_QRCODE, UNICODE_MODE, -1, 40, "12345678901234", 0, 177, 177, "14 chars, Version 40 (masking)" },
     };
     int data_size = ARRAY_SIZE(data);
     int i, length, ret;
@@ -37,22 +37,23 @@ static void print_logs(const char *name, int logmod, unsigned int *logt, unsigne
     int i;
     const char *type = u16 ? "short" : "char";
     const char *format = u16 ? " 0x%04X," : " 0x%02X,";
+    const int per_line = u16 ? 12 : 16;
 
     printf("static const unsigned %s logt_%s[%d] = {", type, name, logmod + 1);
     for (i = 0; i < logmod + 1; i++) {
-        if (i % 16 == 0) printf("\n   ");
+        if (i % per_line == 0) printf("\n   ");
         printf(format, i ? logt[i] : 0);
     }
     printf("\n};\n");
 
     printf("static const unsigned %s alog_%s[%d] = {", type, name, logmod * 2);
     for (i = 0; i < logmod; i++) {
-        if (i % 16 == 0) printf("\n   ");
+        if (i % per_line == 0) printf("\n   ");
         printf(format, alog[i]);
     }
     /* Double antilog table */
     for (i = 0; i < logmod; i++) {
-        if (i % 16 == 0) printf("\n   ");
+        if (i % per_line == 0) printf("\n   ");
         printf(format, alog[i]);
     }
     printf("\n};\n");
@@ -93,6 +94,8 @@ static void test_generate(const testCtx *const p_ctx) {
         { "0x11d", 255, 0x11d, 0 },
         { "0x12d", 255, 0x12d, 0 },
         { "0x163", 255, 0x163, 0 },
+        { "0x409", 1023, 0x409, 1 },
+        { "0x1069", 4095, 0x1069, 1 },
     };
     int data_size = ARRAY_SIZE(data);
     int i;
@@ -284,10 +287,7 @@ static void test_uint_encoding(const testCtx *const p_ctx) {
 
         /* Simulate rs_uint_init_gf() malloc() failure and rs_uint_init_gf()'s return val not being checked */
         assert_nonzero(rs_uint_init_gf(&rs_uint, data[i].prime_poly, data[i].logmod), "i:%d rs_uint_init_gf() == 0\n", i);
-        free(rs_uint.logt);
-        rs_uint.logt = NULL;
-        free(rs_uint.alog);
-        rs_uint.alog = NULL;
+        rs_uint_free(&rs_uint); /* Leaves tables NULL */
 
         rs_uint_init_code(&rs_uint, data[i].nsym, data[i].index);
         rs_uint_encode(&rs_uint, data[i].datalen, data[i].data, res);
@@ -302,6 +302,453 @@ static void test_uint_encoding(const testCtx *const p_ctx) {
     testFinish();
 }
 
+static void test_uint_static_logs(const testCtx *const p_ctx) {
+
+    struct item {
+        unsigned int prime_poly;
+        int logmod;
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    struct item data[] = {
+        /*  0*/ { 0x409, 1023 },
+        /*  1*/ { 0x1069, 4095 },
+    };
+    int data_size = ARRAY_SIZE(data);
+    int i, j;
+
+    unsigned int logt[4096];
+    unsigned int alog[8192];
+
+    testStart("test_uint_static_logs");
+
+    for (i = 0; i < data_size; i++) {
+        rs_uint_t rs_uint;
+
+        if (testContinue(p_ctx, i)) continue;
+
+        assert_nonzero(rs_uint_init_gf(&rs_uint, data[i].prime_poly, data[i].logmod), "i:%d rs_uint_init_gf() == 0\n",
+                    i);
+        assert_null(rs_uint.malloced, "i:%d rs_uint.malloced non-NULL\n", i);
+
+        gen_logs(data[i].prime_poly, data[i].logmod, logt, alog);
+        for (j = 1; j <= data[i].logmod; j++) {
+            assert_equal(rs_uint.logt[j], logt[j], "i:%d logt[%d] %d != %d\n", i, j, rs_uint.logt[j], logt[j]);
+        }
+        for (j = 0; j < data[i].logmod * 2; j++) {
+            assert_equal(rs_uint.alog[j], alog[j % data[i].logmod], "i:%d alog[%d] %d != %d\n",
+                        i, j, rs_uint.alog[j], alog[j % data[i].logmod]);
+        }
+        rs_uint_free(&rs_uint);
+    }
+
+    testFinish();
+}
+
+/* Reference shift register encoder using log/antilog lookups per symbol (as `rs_encode()` without product tables) */
+static void ref_rs_encode(const rs_t *rs, const int datalen, const unsigned char *data, unsigned char *res) {
+    int i, k;
+    const int nsym = rs->nsym;
+
+    memset(res, 0, nsym);
+    for (i = 0; i < datalen; i++) {
+        const unsigned int m = res[nsym - 1] ^ data[i];
+        for (k = nsym - 1; k >= 0; k--) {
+            const unsigned char prev = k ? res[k - 1] : 0;
+            if (m && rs->rspoly[k]) {
+                res[k] = (unsigned char) (prev ^ rs->alog[rs->logt[m] + rs->log_rspoly[k]]);
+            } else {
+                res[k] = prev;
+            }
+        }
+    }
+}
+
+/* Simple LCG for reproducible pseudo-random data */
+static unsigned int ref_rand(unsigned int *p_seed) {
+    *p_seed = *p_seed * 1103515245 + 12345;
+    return (*p_seed >> 16) & 0x7FFF;
+}
+
+static void test_encoding_ref(const testCtx *const p_ctx) {
+
+    struct item {
+        unsigned int prime_poly;
+        int logmod;
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    struct item data[] = {
+        /*  0*/ { 0x13, 15 },
+        /*  1*/ { 0x25, 31 },
+        /*  2*/ { 0x43, 63 },
+        /*  3*/ { 0x89, 127 },
+        /*  4*/ { 0x11d, 255 },
+        /*  5*/ { 0x12d, 255 },
+        /*  6*/ { 0x163, 255 },
+    };
+    int data_size = ARRAY_SIZE(data);
+    int i, j, k, nsym, index;
+    unsigned int seed = 1;
+
+    testStart("test_encoding_ref");
+
+    for (i = 0; i < data_size; i++) {
+        rs_t rs;
+        unsigned char cw[1024];
+        unsigned int cw_uint[1024];
+        unsigned char res[256], expected[256];
+        unsigned int res_uint[256];
+
+        if (testContinue(p_ctx, i)) continue;
+
+        rs_init_gf(&rs, data[i].prime_poly);
+
+        /* Keep `index + nsym` within the doubled antilog table */
+        for (nsym = 1; nsym < data[i].logmod; nsym += nsym < 70 ? 1 : 37) {
+            for (index = 0; index <= 1; index++) {
+                const int datalen = (int) (ref_rand(&seed) % 1024) + 1;
+
+                for (j = 0; j < datalen; j++) {
+                    cw_uint[j] = cw[j] = (unsigned char) (ref_rand(&seed) % (data[i].logmod + 1));
+                }
+                rs_init_code(&rs, nsym, index);
+                ref_rs_encode(&rs, datalen, cw, expected);
+
+                rs_encode(&rs, datalen, cw, res);
+                assert_zero(memcmp(res, expected, nsym), "i:%d nsym %d, index %d, datalen %d rs_encode mismatch\n",
+                            i, nsym, index, datalen);
+
+                rs_encode_uint(&rs, datalen, cw_uint, res_uint);
+                for (k = 0; k < nsym; k++) {
+                    assert_equal(res_uint[k], expected[k],
+                                "i:%d nsym %d, index %d, datalen %d res_uint[%d] %d != expected %d\n",
+                                i, nsym, index, datalen, k, res_uint[k], expected[k]);
+                }
+            }
+        }
+    }
+
+    testFinish();
+}
+
+static void test_encode_blocks(const testCtx *const p_ctx) {
+
+    struct item {
+        unsigned int prime_poly;
+        int nsym;
+        int index;
+        int blocks;
+        int datalen;
+        int interleaved; /* Data interleaved (as Data Matrix) else contiguous (as QR Code, Han Xin) */
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    struct item data[] = {
+        /*  0*/ { 0x11d, 30, 0, 1, 15, 0 },
+        /*  1*/ { 0x11d, 30, 0, 19, 15, 0 },
+        /*  2*/ { 0x11d, 30, 0, 61, 16, 0 },
+        /*  3*/ { 0x11d, 7, 0, 1, 19, 0 },
+        /*  4*/ { 0x11d, 5, 0, 3, 5, 0 },
+        /*  5*/ { 0x12d, 62, 1, 8, 156, 1 },
+        /*  6*/ { 0x12d, 7, 1, 2, 5, 1 },
+        /*  7*/ { 0x12d, 68, 1, 5, 175, 1 },
+        /*  8*/ { 0x163, 68, 1, 7, 182, 0 },
+        /*  9*/ { 0x163, 4, 1, 5, 21, 0 },
+        /* 10*/ { 0x43, 10, 1, 6, 10, 1 },
+    };
+    int data_size = ARRAY_SIZE(data);
+    int i, b, j;
+    unsigned int seed = 1;
+
+    testStart("test_encode_blocks");
+
+    for (i = 0; i < data_size; i++) {
+        rs_t rs;
+        unsigned char cw[256 * 64];
+        unsigned char block[256];
+        unsigned char res[256 * 64];
+        unsigned char expected[256];
+        const int blocks = data[i].blocks;
+        const int datalen = data[i].datalen;
+        const int nsym = data[i].nsym;
+        const int data_block_step = data[i].interleaved ? 1 : datalen;
+        const int data_step = data[i].interleaved ? blocks : 1;
+
+        if (testContinue(p_ctx, i)) continue;
+
+        for (j = 0; j < blocks * datalen; j++) {
+            cw[j] = (unsigned char) (ref_rand(&seed) % (data[i].prime_poly >= 0x100 ? 256 : 64));
+        }
+        rs_init_gf(&rs, data[i].prime_poly);
+        rs_init_code(&rs, nsym, data[i].index);
+
+        /* ECC interleaved (res_step `blocks`) */
+        rs_encode_blocks(&rs, blocks, datalen, cw, data_block_step, data_step, res, 1 /*res_block_step*/, blocks);
+
+        for (b = 0; b < blocks; b++) {
+            for (j = 0; j < datalen; j++) {
+                block[j] = cw[b * data_block_step + j * data_step];
+            }
+            ref_rs_encode(&rs, datalen, block, expected);
+            for (j = 0; j < nsym; j++) {
+                assert_equal(res[b + j * blocks], expected[nsym - 1 - j], "i:%d block %d res[%d] %d != %d\n",
+                            i, b, j, res[b + j * blocks], expected[nsym - 1 - j]);
+            }
+        }
+
+        /* ECC contiguous (res_step 1) */
+        rs_encode_blocks(&rs, blocks, datalen, cw, data_block_step, data_step, res, nsym /*res_block_step*/, 1);
+
+        for (b = 0; b < blocks; b++) {
+            for (j = 0; j < datalen; j++) {
+                block[j] = cw[b * data_block_step + j * data_step];
+            }
+            rs_encode(&rs, datalen, block, expected);
+            for (j = 0; j < nsym; j++) {
+                assert_equal(res[b * nsym + j], expected[nsym - 1 - j], "i:%d block %d res[%d] %d != %d\n",
+                            i, b, j, res[b * nsym + j], expected[nsym - 1 - j]);
+            }
+        }
+    }
+
+    testFinish();
+}
+
+static void test_gen_cache(const testCtx *const p_ctx) {
+
+    struct item {
+        unsigned int prime_poly;
+        int nsym;
+        int index;
+        int cached;
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    struct item data[] = {
+        /*  0*/ { 0x11d, 30, 0, 1 },
+        /*  1*/ { 0x12d, 62, 1, 1 },
+        /*  2*/ { 0x13, 5, 1, 1 },
+        /*  3*/ { 0x13, 8, 1, 1 },
+        /*  4*/ { 0x163, 256, 0, 1 },
+        /*  5*/ { 0x43, 10, 2, 0 }, /* Only `index` 0 or 1 cached */
+        /*  6*/ { 0x43, 0, 1, 0 },
+    };
+    int data_size = ARRAY_SIZE(data);
+    int i, nsym;
+    rs_t rs, rs2;
+
+    const int pool_size = rs_gen_cache_reset(); /* Other tests may have filled it */
+
+    testStart("test_gen_cache");
+
+    for (i = 0; i < data_size; i++) {
+
+        if (testContinue(p_ctx, i)) continue;
+
+        if (!pool_size) {
+            data[i].cached = 0;
+        }
+
+        rs_init_gf(&rs, data[i].prime_poly);
+        rs_init_code(&rs, data[i].nsym, data[i].index);
+        rs_init_gf(&rs2, data[i].prime_poly);
+        rs_init_code(&rs2, data[i].nsym, data[i].index);
+
+        assert_equal(rs.nsym, data[i].nsym, "i:%d nsym %d != %d\n", i, rs.nsym, data[i].nsym);
+        assert_zero(memcmp(rs.rspoly, rs2.rspoly, data[i].nsym + 1), "i:%d rspoly mismatch\n", i);
+        assert_zero(memcmp(rs.log_rspoly, rs2.log_rspoly, data[i].nsym + 1), "i:%d log_rspoly mismatch\n", i);
+        if (data[i].cached) {
+            assert_equal(rs.rspoly, rs2.rspoly, "i:%d rspoly %p != %p\n", i, (const void *) rs.rspoly,
+                        (const void *) rs2.rspoly);
+        } else {
+            assert_equal(rs.rspoly, rs.local, "i:%d rspoly %p != local %p\n", i, (const void *) rs.rspoly,
+                        (const void *) rs.local);
+            assert_equal(rs2.rspoly, rs2.local, "i:%d rspoly2 %p != local2 %p\n", i, (const void *) rs2.rspoly,
+                        (const void *) rs2.local);
+        }
+    }
+
+    /* Once the pool is full generators are built locally */
+    (void) rs_gen_cache_reset();
+    rs_init_gf(&rs, 0x12d);
+    for (nsym = 1; nsym <= 256; nsym++) {
+        rs_init_code(&rs, nsym, 1);
+        if (rs.rspoly == rs.local) {
+            break;
+        }
+    }
+    if (pool_size) {
+        assert_nonzero(nsym > 1 && nsym <= 256, "nsym %d pool never full\n", nsym);
+        rs_init_code(&rs, 1, 1); /* Still cached */
+        assert_nonzero(rs.rspoly != rs.local, "nsym 1 rspoly local\n");
+        assert_equal(rs.nsym, 1, "nsym 1 nsym %d != 1\n", rs.nsym);
+    } else {
+        assert_equal(nsym, 1, "nsym %d != 1\n", nsym);
+    }
+
+    testFinish();
+}
+
+#include <time.h>
+
+#define TEST_PERF_ITER_MILLES   100
+#define TEST_PERF_ITERATIONS    (TEST_PERF_ITER_MILLES * 1000)
+#define TEST_PERF_TIME(arg)     (((arg) * 1000.0) / CLOCKS_PER_SEC)
+
+/* Time of `rs_init_code()` and throughput of `rs_encode()` against the reference log/antilog encoder */
+static void test_perf(const testCtx *const p_ctx) {
+    int debug = p_ctx->debug;
+
+    struct item {
+        unsigned int prime_poly;
+        int nsym;
+        int index;
+        int datalen;
+        char *comment;
+    };
+    struct item data[] = {
+        /*  0*/ { 0x11d, 30, 0, 15, "QR 40-H block (15 + 30)" },
+        /*  1*/ { 0x12d, 62, 1, 156, "DM 144x144 block (156 + 62)" },
+        /*  2*/ { 0x163, 68, 1, 182, "Han Xin 84-4 block (182 + 68)" },
+        /*  3*/ { 0x11d, 10, 0, 16, "QR 1-M (16 + 10)" },
+        /*  4*/ { 0x12d, 7, 1, 5, "DM 12x12 (5 + 7)" },
+    };
+    int data_size = ARRAY_SIZE(data);
+    int i, j;
+    unsigned int seed = 1;
+
+    clock_t start;
+    clock_t diff_init, diff_encode, diff_ref;
+    int comment_max = 0;
+
+    if (!(debug & ZINT_DEBUG_TEST_PERFORMANCE)) { /* -d 256 */
+        return;
+    }
+
+    for (i = 0; i < data_size; i++) if ((int) strlen(data[i].comment) > comment_max) comment_max = (int) strlen(data[i].comment);
+
+    printf("Iterations %d\n", TEST_PERF_ITERATIONS);
+
+    for (i = 0; i < data_size; i++) {
+        rs_t rs;
+        unsigned char cw[256];
+        unsigned char res[256], expected[256];
+
+        if (testContinue(p_ctx, i)) continue;
+
+        for (j = 0; j < data[i].datalen; j++) {
+            cw[j] = (unsigned char) ref_rand(&seed);
+        }
+        rs_init_gf(&rs, data[i].prime_poly);
+
+        start = clock();
+        for (j = 0; j < TEST_PERF_ITERATIONS; j++) {
+            rs_init_code(&rs, data[i].nsym, data[i].index);
+        }
+        diff_init = clock() - start;
+
+        start = clock();
+        for (j = 0; j < TEST_PERF_ITERATIONS; j++) {
+            cw[0] = (unsigned char) j; /* Vary input */
+            rs_encode(&rs, data[i].datalen, cw, res);
+        }
+        diff_encode = clock() - start;
+
+        start = clock();
+        for (j = 0; j < TEST_PERF_ITERATIONS; j++) {
+            cw[0] = (unsigned char) j;
+            ref_rs_encode(&rs, data[i].datalen, cw, expected);
+        }
+        diff_ref = clock() - start;
+
+        assert_zero(memcmp(res, expected, data[i].nsym), "i:%d rs_encode mismatch\n", i);
+
+        printf("%*s: init % 8gms, encode % 8gms (%g MB/s), reference % 8gms (%g MB/s)\n", comment_max,
+                data[i].comment, TEST_PERF_TIME(diff_init), TEST_PERF_TIME(diff_encode),
+                diff_encode ? data[i].datalen * TEST_PERF_ITER_MILLES / (TEST_PERF_TIME(diff_encode)) : 0.0,
+                TEST_PERF_TIME(diff_ref),
+                diff_ref ? data[i].datalen * TEST_PERF_ITER_MILLES / (TEST_PERF_TIME(diff_ref)) : 0.0);
+    }
+}
+
+/* Time of `rs_encode_blocks()` against encoding block by block and then interleaving */
+static void test_perf_blocks(const testCtx *const p_ctx) {
+    int debug = p_ctx->debug;
+
+    struct item {
+        unsigned int prime_poly;
+        int nsym;
+        int index;
+        int blocks;
+        int datalen;
+        int interleaved;
+        char *comment;
+    };
+    struct item data[] = {
+        /*  0*/ { 0x11d, 30, 0, 61, 16, 0, "QR 40-H long blocks (61 x (16 + 30))" },
+        /*  1*/ { 0x12d, 62, 1, 8, 156, 1, "DM 144x144 long blocks (8 x (156 + 62))" },
+        /*  2*/ { 0x163, 68, 1, 9, 182, 0, "Han Xin 84-4 blocks (9 x (182 + 68))" },
+        /*  3*/ { 0x11d, 18, 0, 4, 43, 0, "QR 10-M blocks (4 x (43 + 18))" },
+    };
+    int data_size = ARRAY_SIZE(data);
+    int i, j, b, k;
+    unsigned int seed = 1;
+
+    clock_t start;
+    clock_t diff_blocks, diff_single;
+    int comment_max = 0;
+
+    if (!(debug & ZINT_DEBUG_TEST_PERFORMANCE)) { /* -d 256 */
+        return;
+    }
+
+    for (i = 0; i < data_size; i++) if ((int) strlen(data[i].comment) > comment_max) comment_max = (int) strlen(data[i].comment);
+
+    printf("Iterations %d\n", TEST_PERF_ITERATIONS / 10);
+
+    for (i = 0; i < data_size; i++) {
+        rs_t rs;
+        unsigned char cw[256 * 64];
+        unsigned char block[256], ecc[256];
+        unsigned char res[256 * 64], expected[256 * 64];
+        const int blocks = data[i].blocks;
+        const int datalen = data[i].datalen;
+        const int nsym = data[i].nsym;
+        const int data_block_step = data[i].interleaved ? 1 : datalen;
+        const int data_step = data[i].interleaved ? blocks : 1;
+
+        if (testContinue(p_ctx, i)) continue;
+
+        for (j = 0; j < blocks * datalen; j++) {
+            cw[j] = (unsigned char) ref_rand(&seed);
+        }
+        rs_init_gf(&rs, data[i].prime_poly);
+        rs_init_code(&rs, nsym, data[i].index);
+
+        start = clock();
+        for (j = 0; j < TEST_PERF_ITERATIONS / 10; j++) {
+            rs_encode_blocks(&rs, blocks, datalen, cw, data_block_step, data_step, res, 1, blocks);
+        }
+        diff_blocks = clock() - start;
+
+        start = clock();
+        for (j = 0; j < TEST_PERF_ITERATIONS / 10; j++) {
+            for (b = 0; b < blocks; b++) {
+                for (k = 0; k < datalen; k++) {
+                    block[k] = cw[b * data_block_step + k * data_step];
+                }
+                rs_encode(&rs, datalen, block, ecc);
+                for (k = 0; k < nsym; k++) {
+                    expected[b + k * blocks] = ecc[nsym - 1 - k];
+                }
+            }
+        }
+        diff_single = clock() - start;
+
+        assert_zero(memcmp(res, expected, blocks * nsym), "i:%d rs_encode_blocks mismatch\n", i);
+
+        printf("%*s: blocks % 8gms, block by block % 8gms\n", comment_max, data[i].comment,
+                TEST_PERF_TIME(diff_blocks), TEST_PERF_TIME(diff_single));
+    }
+}
+
 int main(int argc, char *argv[]) {
 
     testFunction funcs[] = { /* name, func */
@@ -309,6 +756,12 @@ int main(int argc, char *argv[]) {
         { "test_encoding", test_encoding },
         { "test_encoding_uint", test_encoding_uint },
         { "test_uint_encoding", test_uint_encoding },
+        { "test_uint_static_logs", test_uint_static_logs },
+        { "test_encoding_ref", test_encoding_ref },
+        { "test_encode_blocks", test_encode_blocks },
+        { "test_gen_cache", test_gen_cache },
+        { "test_perf", test_perf },
+        { "test_perf_blocks", test_perf_blocks },
     };
 
     testRun(argc, argv, funcs, ARRAY_SIZE(funcs));
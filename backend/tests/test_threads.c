@@ -0,0 +1,362 @@
+/*
+    libzint - the open source barcode library
+    Copyright (C) 2023 Robin Stuart <rstuart114@gmail.com>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+    3. Neither the name of the project nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+ */
+/* SPDX-License-Identifier: BSD-3-Clause */
+
+
+/* Runs all symbologies through all output types concurrently from multiple threads and checks the results are
+   byte-for-byte identical to single-threaded runs. Best built with CMake option `ZINT_SANITIZE_THREAD` */
+
+#include "testcommon.h"
+#include "../zthread.h"
+
+#define THREADS_DEFAULT     4
+#define THREADS_MSG_SIZE    256
+
+/* Output types - raster buffer, vector buffer, then files */
+static const char *const output_types[] = {
+    "", "", "bmp", "emf", "eps", "gif", "pcx", "png", "svg", "tif", "txt"
+};
+#define OUTPUT_RASTER   0
+#define OUTPUT_VECTOR   1
+#define OUTPUT_TYPES    ARRAY_SIZE(output_types)
+
+/* Candidate inputs, the first to encode successfully is used for each symbology */
+static const struct candidate {
+    int input_mode;
+    const char *data;
+    const char *primary; /* Composites only */
+} candidates[] = {
+    { DATA_MODE, "1234567", "" },
+    { DATA_MODE, "12345678", "" },
+    { DATA_MODE, "01234565", "" },
+    { DATA_MODE, "12345678901", "" },
+    { DATA_MODE, "123456789012", "" },
+    { DATA_MODE, "1234567890123", "" },
+    { DATA_MODE, "0123456789012", "" },
+    { DATA_MODE, "12345678901234567", "" },
+    { DATA_MODE, "01234567094987654321", "" },
+    { DATA_MODE, "15400233-16-4-205", "" },
+    { DATA_MODE, "A123B", "" },
+    { DATA_MODE, "%000393206219912345678101040", "" },
+    { DATA_MODE, "EE876543216CA", "" },
+    { DATA_MODE, "1100000000000XY11", "" },
+    { DATA_MODE, "JGB 012100123412345678AB19XY1A 0", "" },
+    { DATA_MODE, "123", "" },
+    { DATA_MODE, "123456789X", "" },
+    { DATA_MODE, "11111111111111111", "" },
+    { DATA_MODE, "A", "" },
+    { DATA_MODE, "ADFT", "" },
+    { GS1_MODE, "[01]12345678901231", "" },
+    { GS1_MODE, "[21]A12345678", "[01]12345678901231" },
+    { GS1_MODE, "[21]A12345678", "1234567890123" },
+    { GS1_MODE, "[21]A12345678", "0123456789012" },
+    { GS1_MODE, "[21]A12345678", "331234567890" },
+    { GS1_MODE, "[21]A12345678", "12345678901" },
+    { GS1_MODE, "[21]A12345678", "1234567" },
+};
+
+/* A symbology with its chosen input, plus the single-threaded results to compare against */
+struct job {
+    int symbology;
+    const struct candidate *candidate;
+    struct zint_symbol *raster;
+    struct zint_symbol *vector;
+    unsigned char *files[OUTPUT_TYPES];
+    long file_sizes[OUTPUT_TYPES];
+};
+
+/* Per-thread state */
+struct thread_arg {
+    struct job *jobs;
+    int job_count;
+    int thread_no;
+    int iterations;
+    int done;
+    int fails;
+    char msg[THREADS_MSG_SIZE]; /* First failure */
+};
+
+static void set_symbol(struct zint_symbol *symbol, const struct job *job) {
+    symbol->symbology = job->symbology;
+    symbol->input_mode = job->candidate->input_mode;
+    strcpy(symbol->primary, job->candidate->primary);
+    symbol->show_hrt = 1;
+}
+
+/* Read file `filename` into a malloc'd buffer, setting `p_size`. Returns NULL on failure */
+static unsigned char *read_file(const char *filename, long *p_size) {
+    FILE *fp;
+    unsigned char *buf = NULL;
+    long size;
+
+    if (!(fp = fopen(filename, "rb"))) {
+        return NULL;
+    }
+    if (fseek(fp, 0, SEEK_END) == 0 && (size = ftell(fp)) >= 0 && fseek(fp, 0, SEEK_SET) == 0
+            && (buf = (unsigned char *) malloc(size + 1))) {
+        if (fread(buf, 1, size, fp) != (size_t) size) {
+            free(buf);
+            buf = NULL;
+        } else {
+            *p_size = size;
+        }
+    }
+    fclose(fp);
+    return buf;
+}
+
+/* Encode `job` with output type `output_type`, returning the symbol, and if a file, its contents in `p_file` */
+static struct zint_symbol *do_output(const struct job *job, const int output_type, const char *prefix,
+            unsigned char **p_file, long *p_file_size, int *p_ret) {
+    struct zint_symbol *symbol;
+    const unsigned char *data = (const unsigned char *) job->candidate->data;
+    const int length = (int) strlen(job->candidate->data);
+
+    *p_file = NULL;
+    if (!(symbol = ZBarcode_Create())) {
+        *p_ret = ZINT_ERROR_MEMORY;
+        return NULL;
+    }
+    set_symbol(symbol, job);
+
+    if (output_type == OUTPUT_RASTER) {
+        *p_ret = ZBarcode_Encode_and_Buffer(symbol, data, length, 0);
+    } else if (output_type == OUTPUT_VECTOR) {
+        *p_ret = ZBarcode_Encode_and_Buffer_Vector(symbol, data, length, 0);
+    } else {
+        sprintf(symbol->outfile, "%s.%s", prefix, output_types[output_type]);
+        *p_ret = ZBarcode_Encode_and_Print(symbol, data, length, 0);
+        if (*p_ret < ZINT_ERROR) {
+            *p_file = read_file(symbol->outfile, p_file_size);
+        }
+        (void) remove(symbol->outfile);
+    }
+    return symbol;
+}
+
+/* Compare `symbol` (and `file`) output as `output_type` to the single-threaded results of `job` */
+static int cmp_output(const struct job *job, const int output_type, const struct zint_symbol *symbol,
+            const unsigned char *file, const long file_size) {
+    const struct zint_symbol *ref = output_type == OUTPUT_VECTOR ? job->vector : job->raster;
+
+    if (output_type == OUTPUT_RASTER) {
+        if (testUtilSymbolCmp(symbol, ref)) {
+            return 1;
+        }
+        if (symbol->bitmap_width != ref->bitmap_width || symbol->bitmap_height != ref->bitmap_height
+                || memcmp(symbol->bitmap, ref->bitmap, (size_t) ref->bitmap_width * ref->bitmap_height * 3)) {
+            return 2;
+        }
+    } else if (output_type == OUTPUT_VECTOR) {
+        if (testUtilSymbolCmp(symbol, ref)) {
+            return 1;
+        }
+        if (testUtilVectorCmp(symbol->vector, ref->vector)) {
+            return 3;
+        }
+    } else if (!file || file_size != job->file_sizes[output_type]
+            || memcmp(file, job->files[output_type], file_size)) {
+        return 4;
+    }
+    return 0;
+}
+
+static void thread_func(void *arg) {
+    struct thread_arg *t_arg = (struct thread_arg *) arg;
+    char prefix[32];
+    int i, j, k, ret, cmp;
+
+    sprintf(prefix, "test_threads_%d", t_arg->thread_no);
+
+    for (k = 0; k < t_arg->iterations; k++) {
+        /* Each thread starts at a different job so that different symbologies are encoded at the same time */
+        for (j = 0; j < t_arg->job_count; j++) {
+            const struct job *job = &t_arg->jobs[(j + t_arg->thread_no * 7) % t_arg->job_count];
+            for (i = 0; i < OUTPUT_TYPES; i++) {
+                struct zint_symbol *symbol;
+                unsigned char *file;
+                long file_size = 0;
+
+                if (!job->files[i] && i > OUTPUT_VECTOR) {
+                    continue; /* File type not available (PNG) */
+                }
+                symbol = do_output(job, i, prefix, &file, &file_size, &ret);
+                if (!symbol || ret >= ZINT_ERROR || (cmp = cmp_output(job, i, symbol, file, file_size))) {
+                    if (t_arg->fails++ == 0) {
+                        sprintf(t_arg->msg, "thread %d, %s output %d (%s): ret %d, cmp %d (%s)",
+                                t_arg->thread_no, testUtilBarcodeName(job->symbology), i, output_types[i], ret,
+                                symbol && ret < ZINT_ERROR ? cmp : 0, symbol ? symbol->errtxt : "");
+                    }
+                }
+                t_arg->done++;
+                free(file);
+                ZBarcode_Delete(symbol);
+            }
+        }
+    }
+}
+
+static void free_jobs(struct job *jobs, const int job_count) {
+    int i, j;
+
+    for (i = 0; i < job_count; i++) {
+        ZBarcode_Delete(jobs[i].raster);
+        ZBarcode_Delete(jobs[i].vector);
+        for (j = 0; j < OUTPUT_TYPES; j++) {
+            free(jobs[i].files[j]);
+        }
+    }
+    free(jobs);
+}
+
+static void test_threads(const testCtx *const p_ctx) {
+    int debug = p_ctx->debug;
+
+    struct job *jobs;
+    int job_count = 0;
+    struct thread_arg t_args[THREADS_DEFAULT * 4];
+    z_thread_t threads[THREADS_DEFAULT * 4];
+    int num_threads = THREADS_DEFAULT;
+    int iterations = 1;
+    int symbology, i, j, ret;
+    int started;
+    int total = 0, expected = 0;
+
+    testStart("test_threads");
+
+    if (debug & ZINT_DEBUG_TEST_PERFORMANCE) {
+        num_threads = ARRAY_SIZE(threads);
+        iterations = 10;
+    }
+
+    jobs = (struct job *) calloc(BARCODE_LAST + 1, sizeof(struct job));
+    assert_nonnull(jobs, "calloc jobs failed\n");
+
+    /* Choose input for each symbology and record single-threaded results */
+    for (symbology = 1; symbology <= BARCODE_LAST; symbology++) {
+        struct job *job = &jobs[job_count];
+
+        if (!ZBarcode_ValidID(symbology)) {
+            continue;
+        }
+        job->symbology = symbology;
+        for (i = 0; i < ARRAY_SIZE(candidates); i++) {
+            if ((candidates[i].primary[0] != '\0') != (is_composite(symbology) != 0)) {
+                continue;
+            }
+            job->candidate = &candidates[i];
+            job->raster = do_output(job, OUTPUT_RASTER, "", &job->files[OUTPUT_RASTER], &job->file_sizes[0], &ret);
+            assert_nonnull(job->raster, "%s raster do_output NULL\n", testUtilBarcodeName(symbology));
+            if (ret < ZINT_ERROR) {
+                break;
+            }
+            ZBarcode_Delete(job->raster);
+            job->raster = NULL;
+        }
+        assert_nonnull(job->raster, "%s no candidate input encodes\n", testUtilBarcodeName(symbology));
+        job_count++;
+
+        job->vector = do_output(job, OUTPUT_VECTOR, "", &job->files[OUTPUT_VECTOR], &job->file_sizes[1], &ret);
+        assert_nonnull(job->vector, "%s vector do_output NULL\n", testUtilBarcodeName(symbology));
+        assert_equal(ret < ZINT_ERROR, 1, "%s vector ret %d >= ZINT_ERROR (%s)\n",
+                    testUtilBarcodeName(symbology), ret, job->vector->errtxt);
+
+        for (i = OUTPUT_VECTOR + 1; i < OUTPUT_TYPES; i++) {
+            struct zint_symbol *symbol;
+
+            if (ZBarcode_NoPng() && strcmp(output_types[i], "png") == 0) {
+                continue;
+            }
+            symbol = do_output(job, i, "test_threads_ref", &job->files[i], &job->file_sizes[i], &ret);
+            assert_nonnull(symbol, "%s %s do_output NULL\n", testUtilBarcodeName(symbology), output_types[i]);
+            assert_equal(ret < ZINT_ERROR, 1, "%s %s ret %d >= ZINT_ERROR (%s)\n",
+                        testUtilBarcodeName(symbology), output_types[i], ret, symbol->errtxt);
+            assert_nonnull(job->files[i], "%s %s file not read\n", testUtilBarcodeName(symbology), output_types[i]);
+            ZBarcode_Delete(symbol);
+        }
+        if (debug & ZINT_DEBUG_PRINT) {
+            printf("%s: \"%s\" (primary \"%s\")\n", testUtilBarcodeName(symbology), job->candidate->data,
+                    job->candidate->primary);
+        }
+    }
+
+    /* Now run all concurrently */
+    memset(t_args, 0, sizeof(t_args));
+    for (i = 0; i < num_threads; i++) {
+        t_args[i].jobs = jobs;
+        t_args[i].job_count = job_count;
+        t_args[i].thread_no = i;
+        t_args[i].iterations = iterations;
+    }
+    for (started = 0; started < num_threads; started++) {
+        if (!z_thread_create(&threads[started], thread_func, &t_args[started])) {
+            break;
+        }
+    }
+    assert_equal(started, num_threads, "started %d != num_threads %d\n", started, num_threads);
+
+    for (i = 0; i < started; i++) {
+        z_thread_join(&threads[i]);
+    }
+    for (i = 0; i < started; i++) {
+        assert_zero(t_args[i].fails, "%d fails: %s\n", t_args[i].fails, t_args[i].msg);
+        total += t_args[i].done;
+    }
+    for (i = 0; i < job_count; i++) {
+        for (j = 0; j < OUTPUT_TYPES; j++) {
+            expected += j <= OUTPUT_VECTOR || jobs[i].files[j] != NULL;
+        }
+    }
+    expected *= num_threads * iterations;
+    assert_equal(total, expected, "total %d != expected %d\n", total, expected);
+
+    if (debug & ZINT_DEBUG_TEST_PERFORMANCE) {
+        printf("%d symbologies, %d outputs on %d threads\n", job_count, total, num_threads);
+    }
+
+    free_jobs(jobs, job_count);
+
+    testFinish();
+}
+
+int main(int argc, char *argv[]) {
+
+    testFunction funcs[] = { /* name, func */
+        { "test_threads", test_threads },
+    };
+
+    testRun(argc, argv, funcs, ARRAY_SIZE(funcs));
+
+    testReport();
+
+    return 0;
+}
+
+/* vim: set ts=4 sw=4 et : */
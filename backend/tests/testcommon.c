@@ -718,20 +718,11 @@ int testUtilSymbolCmp(const struct zint_symbol *a, const struct zint_symbol *b)
     if (a->width != b->width) {
         return 3;
     }
-    if (a->symbology == BARCODE_ULTRA) {
-        for (i = 0; i < a->rows; i++) {
-            for (j = 0; j < a->width; j++) {
-                if (module_colour_is_set(a, i, j) != module_colour_is_set(b, i, j)) {
-                    return 4;
-                }
-            }
-        }
-    } else {
-        for (i = 0; i < a->rows; i++) {
-            for (j = 0; j < a->width; j++) {
-                if (module_is_set(a, i, j) != module_is_set(b, i, j)) {
-                    return 4;
-                }
+    /* Use `ZBarcode_Module()` as `modules` pointer may be stale if symbol copied */
+    for (i = 0; i < a->rows; i++) {
+        for (j = 0; j < a->width; j++) {
+            if (ZBarcode_Module(a, i, j) != ZBarcode_Module(b, i, j)) {
+                return 4;
             }
         }
     }
@@ -0,0 +1,422 @@
+/*
+    libzint - the open source barcode library
+    Copyright (C) 2023 Robin Stuart <rstuart114@gmail.com>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+    3. Neither the name of the project nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+ */
+/* SPDX-License-Identifier: BSD-3-Clause */
+
+/* Benchmark of a standard corpus across all symbologies and output paths, reporting JSON, with optional comparison
+   against a previously saved baseline - see "README" */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "zint.h"
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+#include <malloc.h>
+#define ZBENCH_HEAP_IN_USE() ((long) mallinfo2().uordblks)
+#elif defined(__GLIBC__)
+#include <malloc.h>
+#define ZBENCH_HEAP_IN_USE() ((long) mallinfo().uordblks)
+#else
+#define ZBENCH_HEAP_IN_USE() (-1L) /* Not available */
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#define ZBENCH_HAVE_RUSAGE
+#endif
+
+#define ZBENCH_DEFAULT_ITERATIONS   50
+#define ZBENCH_DEFAULT_THRESHOLD    10.0 /* Percent */
+#define ZBENCH_MAX_RESULTS          (BARCODE_LAST * 16)
+
+/* Output paths */
+#define ZBENCH_ENCODE   0 /* `ZBarcode_Encode()` only */
+#define ZBENCH_BUFFER   1 /* `ZBarcode_Encode_and_Buffer()` */
+#define ZBENCH_VECTOR   2 /* `ZBarcode_Encode_and_Buffer_Vector()` */
+#define ZBENCH_FILE     3 /* `ZBarcode_Encode_and_Print()` to in-memory file, types from here on */
+
+static const char *const zbench_paths[] = {
+    "encode", "buffer", "vector", "png", "gif", "bmp", "pcx", "tif", "svg", "eps", "emf", "txt"
+};
+
+/* Standard corpus - for each symbology the first item that encodes without error is used */
+struct zbench_corpus {
+    const char *data;
+    const char *primary; /* Linear component if composite */
+    int input_mode;
+};
+
+static const struct zbench_corpus zbench_corpus[] = {
+    { "Zint Bench 0123456789", "", UNICODE_MODE },
+    { "ZINT BENCH 0123456789", "", UNICODE_MODE },
+    { "ZINTBENCH0123456789", "", UNICODE_MODE },
+    { "0123456789", "", UNICODE_MODE },
+    { "12345678", "", UNICODE_MODE },
+    { "1234567", "", UNICODE_MODE },
+    { "12345", "", UNICODE_MODE },
+    { "123", "", UNICODE_MODE },
+    { "DAFTFADTDAFTFADT", "", UNICODE_MODE },
+    { "A0123456789B", "", UNICODE_MODE }, /* Codabar */
+    { "12344", "", UNICODE_MODE }, /* UPC-E with check digit */
+    { "A", "", UNICODE_MODE }, /* FIM */
+    { "2FTPX28L0XCA15511", "", UNICODE_MODE }, /* VIN */
+    { "01234567094987654321", "", UNICODE_MODE }, /* USPS Intelligent Mail */
+    { "%000393206219912345678101040", "", UNICODE_MODE }, /* DPD */
+    { "EE876543216CA", "", UNICODE_MODE }, /* UPU S10 */
+    { "1100000000000XY11     ", "", UNICODE_MODE }, /* Mailmark 4-state */
+    { "012100123412345678AB19XY1A 0", "", UNICODE_MODE }, /* Mailmark 2D */
+    { "[01]12345678901231[10]ABC123", "", GS1_MODE },
+    { "[01]12345678901231", "", GS1_MODE },
+    { "[10]ABC123", "[01]12345678901231", GS1_MODE },
+    { "[10]ABC123", "331234567890", GS1_MODE },
+    { "[10]ABC123", "12345678901", GS1_MODE },
+    { "[10]ABC123", "1234567", GS1_MODE },
+};
+
+struct zbench_result {
+    int symbology;
+    int path;
+    int iterations;
+    double ns_per_op;
+    long bytes_allocated; /* Heap still held by symbol after the operation, -1 if unknown */
+    long peak_rss_kb; /* Process high-water mark after the run, -1 if unknown */
+    double baseline_ns_per_op; /* Compare mode only, < 0 if no baseline */
+};
+
+/* Process peak resident set size in kilobytes, or -1 if unavailable */
+static long zbench_peak_rss_kb(void) {
+#ifdef ZBENCH_HAVE_RUSAGE
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#ifdef __APPLE__
+        return (long) (usage.ru_maxrss / 1024); /* Bytes on macOS */
+#else
+        return (long) usage.ru_maxrss;
+#endif
+    }
+#endif
+    return -1;
+}
+
+/* Perform one operation of `path` on `symbol`, returning zint return code */
+static int zbench_op(struct zint_symbol *symbol, const int path, const struct zbench_corpus *item) {
+    const int length = (int) strlen(item->data);
+
+    ZBarcode_Clear(symbol);
+
+    if (path == ZBENCH_ENCODE) {
+        return ZBarcode_Encode(symbol, (const unsigned char *) item->data, length);
+    }
+    if (path == ZBENCH_BUFFER) {
+        return ZBarcode_Encode_and_Buffer(symbol, (const unsigned char *) item->data, length, 0);
+    }
+    if (path == ZBENCH_VECTOR) {
+        return ZBarcode_Encode_and_Buffer_Vector(symbol, (const unsigned char *) item->data, length, 0);
+    }
+    return ZBarcode_Encode_and_Print(symbol, (const unsigned char *) item->data, length, 0);
+}
+
+/* Create a symbol for `symbology` & `path` using corpus `item` (fresh each time as encoding can set fields) */
+static struct zint_symbol *zbench_create(const int symbology, const int path, const struct zbench_corpus *item) {
+    struct zint_symbol *symbol = ZBarcode_Create();
+
+    if (symbol) {
+        symbol->symbology = symbology;
+        symbol->input_mode = item->input_mode;
+        strcpy(symbol->primary, item->primary);
+        if (path >= ZBENCH_FILE) {
+            symbol->output_options |= BARCODE_MEMORY_FILE;
+            sprintf(symbol->outfile, "bench.%s", zbench_paths[path]);
+        }
+    }
+    return symbol;
+}
+
+/* Find the first corpus item that `symbology` encodes, returning its index or -1 if none */
+static int zbench_corpus_index(const int symbology) {
+    const int is_composite = ZBarcode_Cap(symbology, ZINT_CAP_COMPOSITE) != 0;
+    int i;
+
+    for (i = 0; i < (int) (sizeof(zbench_corpus) / sizeof(zbench_corpus[0])); i++) {
+        struct zint_symbol *symbol;
+        int ret;
+
+        if ((zbench_corpus[i].primary[0] != '\0') != is_composite) {
+            continue;
+        }
+        if (!(symbol = zbench_create(symbology, ZBENCH_ENCODE, zbench_corpus + i))) {
+            return -1;
+        }
+        ret = zbench_op(symbol, ZBENCH_ENCODE, zbench_corpus + i);
+        ZBarcode_Delete(symbol);
+        if (ret < ZINT_ERROR) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/* Time `iterations` runs of `path`, returning 0 on success */
+static int zbench_run(const int symbology, const int path, const int corpus_index, const int iterations,
+            struct zbench_result *result) {
+    const struct zbench_corpus *item = zbench_corpus + corpus_index;
+    struct zint_symbol *symbol;
+    long heap_before;
+    clock_t start, total;
+    int i, ret;
+
+    if (!(symbol = zbench_create(symbology, path, item))) {
+        return ZINT_ERROR_MEMORY;
+    }
+
+    /* Warm-up, also measuring heap held by result */
+    heap_before = ZBENCH_HEAP_IN_USE();
+    if ((ret = zbench_op(symbol, path, item)) >= ZINT_ERROR) {
+        fprintf(stderr, "zint_bench: %d %s: %s\n", symbology, zbench_paths[path], symbol->errtxt);
+        ZBarcode_Delete(symbol);
+        return ret;
+    }
+    result->bytes_allocated = heap_before == -1 ? -1 : ZBENCH_HEAP_IN_USE() - heap_before;
+
+    start = clock();
+    for (i = 0; i < iterations; i++) {
+        (void) zbench_op(symbol, path, item);
+    }
+    total = clock() - start;
+    ZBarcode_Delete(symbol);
+
+    result->symbology = symbology;
+    result->path = path;
+    result->iterations = iterations;
+    result->ns_per_op = (double) total * 1e9 / CLOCKS_PER_SEC / iterations;
+    result->peak_rss_kb = zbench_peak_rss_kb();
+    result->baseline_ns_per_op = -1.0;
+
+    return 0;
+}
+
+/* Load "ns_per_op" of each result in baseline `filename` into `results`, returning number matched or -1 */
+static int zbench_load_baseline(const char *filename, struct zbench_result results[], const int result_cnt) {
+    FILE *fp;
+    char line[512];
+    int matched = 0;
+
+    if (!(fp = fopen(filename, "r"))) {
+        fprintf(stderr, "zint_bench: could not open baseline \"%s\"\n", filename);
+        return -1;
+    }
+    /* Results are written one per line (see `zbench_print()`) */
+    while (fgets(line, sizeof(line), fp)) {
+        char name[64], path[16];
+        int id, iterations, i;
+        double ns_per_op;
+
+        if (sscanf(line, " { \"symbology\": \"%63[^\"]\", \"id\": %d, \"path\": \"%15[^\"]\", \"iterations\": %d,"
+                    " \"ns_per_op\": %lf", name, &id, path, &iterations, &ns_per_op) != 5) {
+            continue;
+        }
+        for (i = 0; i < result_cnt; i++) {
+            if (results[i].symbology == id && strcmp(zbench_paths[results[i].path], path) == 0) {
+                results[i].baseline_ns_per_op = ns_per_op;
+                matched++;
+                break;
+            }
+        }
+    }
+    fclose(fp);
+
+    return matched;
+}
+
+/* Print JSON, returning number of results slower than baseline by more than `threshold` percent */
+static int zbench_print(FILE *fp, const struct zbench_result results[], const int result_cnt, const int iterations,
+            const int compare, const double threshold) {
+    int i;
+    int regressions = 0;
+
+    fprintf(fp, "{\n  \"zint_version\": %d,\n  \"iterations\": %d,\n", ZBarcode_Version(), iterations);
+    if (compare) {
+        fprintf(fp, "  \"threshold_pct\": %g,\n", threshold);
+    }
+    fputs("  \"results\": [\n", fp);
+    for (i = 0; i < result_cnt; i++) {
+        const struct zbench_result *r = results + i;
+        char name[32];
+
+        (void) ZBarcode_BarcodeName(r->symbology, name);
+        fprintf(fp, "    { \"symbology\": \"%s\", \"id\": %d, \"path\": \"%s\", \"iterations\": %d,"
+                    " \"ns_per_op\": %.1f, ", name + 8 /* Skip "BARCODE_" */, r->symbology, zbench_paths[r->path],
+                    r->iterations, r->ns_per_op);
+        if (r->bytes_allocated == -1) {
+            fputs("\"bytes_allocated\": null, ", fp);
+        } else {
+            fprintf(fp, "\"bytes_allocated\": %ld, ", r->bytes_allocated);
+        }
+        if (r->peak_rss_kb == -1) {
+            fputs("\"peak_rss_kb\": null", fp);
+        } else {
+            fprintf(fp, "\"peak_rss_kb\": %ld", r->peak_rss_kb);
+        }
+        if (compare) {
+            if (r->baseline_ns_per_op > 0.0) {
+                const double change_pct = (r->ns_per_op - r->baseline_ns_per_op) * 100.0 / r->baseline_ns_per_op;
+                const int regression = change_pct > threshold;
+                fprintf(fp, ", \"baseline_ns_per_op\": %.1f, \"change_pct\": %.1f, \"regression\": %s",
+                        r->baseline_ns_per_op, change_pct, regression ? "true" : "false");
+                regressions += regression;
+            } else {
+                fputs(", \"baseline_ns_per_op\": null, \"change_pct\": null, \"regression\": false", fp);
+            }
+        }
+        fprintf(fp, " }%s\n", i + 1 < result_cnt ? "," : "");
+    }
+    fputs("  ]", fp);
+    if (compare) {
+        fprintf(fp, ",\n  \"regressions\": %d", regressions);
+    }
+    fputs("\n}\n", fp);
+
+    return regressions;
+}
+
+static void zbench_usage(void) {
+    printf("Usage: zint_bench [-n <iterations>] [-b <symbology-id>] [-p <path>] [-o <file>]\n"
+           "                  [-c <baseline-file>] [-t <threshold-percent>]\n"
+           "  -n  Iterations per result (default %d)\n"
+           "  -b  Only benchmark symbology with this id\n"
+           "  -p  Only benchmark this output path (encode, buffer, vector, or a file type e.g. png)\n"
+           "  -o  Write JSON to file instead of stdout\n"
+           "  -c  Compare with baseline JSON (previous output), exiting with 1 if any regressions\n"
+           "  -t  Regression threshold percent (default %g)\n",
+           ZBENCH_DEFAULT_ITERATIONS, ZBENCH_DEFAULT_THRESHOLD);
+}
+
+int main(int argc, char *argv[]) {
+    int iterations = ZBENCH_DEFAULT_ITERATIONS;
+    double threshold = ZBENCH_DEFAULT_THRESHOLD;
+    int only_symbology = 0, only_path = -1;
+    const char *outfile = NULL, *baseline = NULL;
+    struct zbench_result *results;
+    int result_cnt = 0, regressions;
+    int symbology, path, i;
+    FILE *fp = stdout;
+
+    for (i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        if (arg[0] != '-' || arg[1] == '\0' || arg[2] != '\0' || (arg[1] != 'h' && i + 1 >= argc)) {
+            zbench_usage();
+            return 2;
+        }
+        switch (arg[1]) {
+            case 'n': iterations = atoi(argv[++i]);
+                break;
+            case 'b': only_symbology = atoi(argv[++i]);
+                break;
+            case 'p':
+                i++;
+                for (path = 0; path < (int) (sizeof(zbench_paths) / sizeof(zbench_paths[0])); path++) {
+                    if (strcmp(argv[i], zbench_paths[path]) == 0) {
+                        only_path = path;
+                        break;
+                    }
+                }
+                if (only_path == -1) {
+                    fprintf(stderr, "zint_bench: unknown path \"%s\"\n", argv[i]);
+                    return 2;
+                }
+                break;
+            case 'o': outfile = argv[++i];
+                break;
+            case 'c': baseline = argv[++i];
+                break;
+            case 't': threshold = atof(argv[++i]);
+                break;
+            case 'h': zbench_usage();
+                return 0;
+                break;
+            default: zbench_usage();
+                return 2;
+                break;
+        }
+    }
+    if (iterations < 1) {
+        fprintf(stderr, "zint_bench: iterations must be >= 1\n");
+        return 2;
+    }
+
+    if (!(results = (struct zbench_result *) malloc(sizeof(struct zbench_result) * ZBENCH_MAX_RESULTS))) {
+        fprintf(stderr, "zint_bench: out of memory\n");
+        return 2;
+    }
+
+    for (symbology = 1; symbology < BARCODE_LAST; symbology++) {
+        int corpus_index;
+
+        if (!ZBarcode_ValidID(symbology) || (only_symbology && symbology != only_symbology)) {
+            continue;
+        }
+        if ((corpus_index = zbench_corpus_index(symbology)) == -1) {
+            char name[32];
+            (void) ZBarcode_BarcodeName(symbology, name);
+            fprintf(stderr, "zint_bench: no corpus item for %s (%d), skipping\n", name, symbology);
+            continue;
+        }
+        for (path = 0; path < (int) (sizeof(zbench_paths) / sizeof(zbench_paths[0])); path++) {
+            if ((only_path != -1 && path != only_path)
+                    || (strcmp(zbench_paths[path], "png") == 0 && ZBarcode_NoPng())) {
+                continue;
+            }
+            if (zbench_run(symbology, path, corpus_index, iterations, results + result_cnt) == 0) {
+                result_cnt++;
+            }
+        }
+    }
+
+    if (baseline && zbench_load_baseline(baseline, results, result_cnt) == -1) {
+        free(results);
+        return 2;
+    }
+
+    if (outfile && !(fp = fopen(outfile, "w"))) {
+        fprintf(stderr, "zint_bench: could not open output \"%s\"\n", outfile);
+        free(results);
+        return 2;
+    }
+    regressions = zbench_print(fp, results, result_cnt, iterations, baseline != NULL, threshold);
+    if (fp != stdout) {
+        fclose(fp);
+    }
+    free(results);
+
+    return regressions ? 1 : 0;
+}
+
+/* vim: set ts=4 sw=4 et : */
@@ -10,6 +10,8 @@
  *
  *   php backend/tools/gen_eci_mb_h.php
  *
+ * or, if PHP is not available, with the Python port "gen_eci_mb_h.py" (same output)
+ *
  * NOTE: backend/tools/data/GB18030.TXT will have to be downloaded first from the tarball
  *       https://haible.de/bruno/charsets/conversion-tables/GB18030.tar.bz2
  *       using the version jdk-1.4.2/GB18030.TXT
@@ -97,52 +99,70 @@ function out_tab_entries(&$out, $arr, $cnt, $not_hex = false) {
     }
 }
 
-/* Output tables to `$out` array */
-function out_tabs(&$out, $name, $sort, $mb, $no_u_ind = false, $u_comment = '', $mb_comment = '') {
-    if ($u_comment == '') $u_comment = 'Unicode codepoints sorted';
-    $cnt_sort = count($sort);
+/* Output tables to `$out` array, with non-URO codepoints looked up via two-level page/bit-flag tables, `$uro_cnt`
+   being the no. of URO entries in `$mb` */
+function out_tabs(&$out, $name, $sort, $mb, $uro_cnt = 0) {
+    // Page (U+xx00-xxFF) -> 1-based block no. of 16 entries, each covering 16 codepoints
+    $page = array_fill(0, 256, 0);
+    $page_u = array();
+    $page_mb_ind = array();
+    for ($i = 0, $cnt_sort = count($sort); $i < $cnt_sort; $i++) {
+        $u = $sort[$i];
+        $p = $u >> 8;
+        if (!$page[$p]) {
+            $page[$p] = count($page_u) / 16 + 1;
+            for ($j = 0; $j < 16; $j++) {
+                $page_u[] = 0;
+                $page_mb_ind[] = -1;
+            }
+        }
+        $u2 = (($page[$p] - 1) << 4) | (($u >> 4) & 0xF);
+        $page_u[$u2] |= 1 << ($u & 0xF);
+        if ($page_mb_ind[$u2] === -1) {
+            $page_mb_ind[$u2] = $u >= 0x4E00 ? $i + $uro_cnt : $i; // Adjust for URO block
+        }
+    }
+    foreach ($page_mb_ind as $i => $ind) {
+        if ($ind === -1) {
+            $page_mb_ind[$i] = 0; // Unused
+        }
+    }
+
+    $out[] = '';
+    $out[] = '/* Page (U+xx00-xxFF) blocks of `' . $name . '_page_u[]` & `' . $name . '_page_mb_ind[]`, 1-based, 0 if'
+                . ' none */';
+    $out[] = 'static const unsigned char ' . $name . '_page[256] = {';
+    $line = '   ';
+    for ($i = 0; $i < 256; $i++) {
+        if ($i && $i % 16 === 0) {
+            $out[] = $line;
+            $line = '   ';
+        }
+        $line .= sprintf(' %3d,', $page[$i]);
+    }
+    $out[] = $line;
+    $out[] = '};';
+
+    $cnt = count($page_u);
     $out[] = '';
-    $out[] = '/* ' . $u_comment . ' */';
-    $out[] = 'static const unsigned short ' . $name . '_u[' . $cnt_sort . '] = {';
-    out_tab_entries($out, $sort, $cnt_sort);
+    $out[] = '/* Unicode usage bit-flags for pages in blocks of 16 */';
+    $out[] = 'static const unsigned short ' . $name . '_page_u[' . $cnt . '] = {';
+    out_tab_entries($out, $page_u, $cnt);
+    $out[] = '};';
+    $out[] = '';
+    $out[] = '/* Multibyte indexes for pages in blocks of 16 */';
+    $out[] = 'static const unsigned short ' . $name . '_page_mb_ind[' . $cnt . '] = {';
+    out_tab_entries($out, $page_mb_ind, $cnt, true /*not_hex*/);
     $out[] = '};';
 
     if (!empty($mb)) {
-        if ($mb_comment == '') $mb_comment = 'Multibyte values sorted in Unicode order';
         $cnt = count($mb);
         $out[] = '';
-        $out[] = '/* ' . $mb_comment . ' */';
+        $out[] = '/* Multibyte values sorted in Unicode order */';
         $out[] = 'static const unsigned short ' . $name . '_mb[' . $cnt . '] = {';
-        $line = '   ';
         out_tab_entries($out, $mb, $cnt);
         $out[] = '};';
     }
-    if (!$no_u_ind) {
-        $ind_cnt = ($sort[$cnt_sort - 1] >> 8) + 1;
-        $out[] = '';
-        $out[] = '/* Indexes into Unicode `' . $name . '_u[]` array in blocks of 0x100 */';
-        $ind_idx = count($out);
-        $out[] = 'static const unsigned short ' . $name . '_u_ind[] = {';
-        $line = '   ';
-        $i = 0;
-        foreach ($sort as $ind => $u) {
-            $div = ($u - $sort[0]) >> 8;
-            while ($div >= $i) {
-                if ($i && $i % 8 === 0) {
-                    $out[] = $line;
-                    $line = '   ';
-                }
-                $line .= sprintf(' %5d,', $ind);
-                $i++;
-            }
-        }
-        if ($line !== '   ') {
-            $out[] = $line;
-            $line = '   ';
-        }
-        $out[] = '};';
-        $out[$ind_idx] = 'static const unsigned short ' . $name . '_u_ind[' . $i . '] = {';
-    }
 }
 
 /* Helper to output special-case URO (Unified Repertoire and Ordering) block (U+4E00-U+9FFF) tables */
@@ -224,11 +244,12 @@ for ($u = 0x4E00; $u <= 0x9FAF; $u += 16) {
 out_uro_tabs($out, 'big5', $big5_uro_u, $big5_uro_mb_ind);
 
 // Remove URO block from Unicode table
-array_splice($sort, $start_u_i, $end_u_i - $start_u_i + 1);
+$uro_cnt = $end_u_i - $start_u_i + 1;
+array_splice($sort, $start_u_i, $uro_cnt);
 
 // Output Big5 tables
 
-out_tabs($out, 'big5', $sort, $mb, true /*no_ind*/);
+out_tabs($out, 'big5', $sort, $mb, $uro_cnt);
 
 $out[] = '';
 $out[] = '#endif /* Z_BIG5_H */';
@@ -310,10 +331,11 @@ for ($u = 0x4E00; $u <= 0x9F9F; $u += 16) {
 out_uro_tabs($out, 'ksx1001', $ksx1001_uro_u, $ksx1001_uro_mb_ind);
 
 // Remove URO block from Unicode table
-array_splice($sort, $start_u_i, $end_u_i - $start_u_i + 1);
+$uro_cnt = $end_u_i - $start_u_i + 1;
+array_splice($sort, $start_u_i, $uro_cnt);
 
 // Output KS X 1001 tables
-out_tabs($out, 'ksx1001', $sort, $mb);
+out_tabs($out, 'ksx1001', $sort, $mb, $uro_cnt);
 
 $out[] = '';
 $out[] = '#endif /* Z_KSX1001_H */';
@@ -392,10 +414,11 @@ for ($u = 0x4E00; $u <= 0x9FAF; $u += 16) {
 out_uro_tabs($out, 'sjis', $sjis_uro_u, $sjis_uro_mb_ind);
 
 // Remove URO block from Unicode table
-array_splice($sort, $start_u_i, $end_u_i - $start_u_i + 1);
+$uro_cnt = $end_u_i - $start_u_i + 1;
+array_splice($sort, $start_u_i, $uro_cnt);
 
 // Output Shift JIS tables
-out_tabs($out, 'sjis', $sort, $mb, true /*no_ind*/);
+out_tabs($out, 'sjis', $sort, $mb, $uro_cnt);
 
 $out[] = '';
 $out[] = '#endif /* Z_SJIS_H */';
@@ -472,10 +495,11 @@ for ($u = 0x4E00; $u <= 0x9CEF; $u += 16) {
 out_uro_tabs($out, 'gb2312', $gb2312_uro_u, $gb2312_uro_mb_ind);
 
 // Remove URO block from Unicode table
-array_splice($sort, $start_u_i, $end_u_i - $start_u_i + 1);
+$uro_cnt = $end_u_i - $start_u_i + 1;
+array_splice($sort, $start_u_i, $uro_cnt);
 
 // Output GB 2312 tables
-out_tabs($out, 'gb2312', $sort, $mb);
+out_tabs($out, 'gb2312', $sort, $mb, $uro_cnt);
 
 $out[] = '';
 $out[] = '#endif /* Z_GB2312_H */';
@@ -554,10 +578,11 @@ for ($u = 0x4E00; $u <= 0x9FAF; $u += 16) {
 out_uro_tabs($out, 'gbk', $gbk_uro_u, $gbk_uro_mb_ind);
 
 // Remove URO block from Unicode table
-array_splice($sort, $start_u_i, $end_u_i - $start_u_i + 1);
+$uro_cnt = $end_u_i - $start_u_i + 1;
+array_splice($sort, $start_u_i, $uro_cnt);
 
 // Output GBK tables
-out_tabs($out, 'gbk', $sort, $mb, true /*no_ind*/);
+out_tabs($out, 'gbk', $sort, $mb, $uro_cnt);
 
 $out[] = '';
 $out[] = '#endif /* Z_GBK_H */';
@@ -690,7 +715,7 @@ for ($i = 1, $cnt = count($gb18030_4_u_b); $i < $cnt; $i++) {
 // Output GB 18030 tables
 
 array_multisort($sort2, $mb2);
-out_tabs($out, 'gb18030_2', $sort2, $mb2, true /*no_ind*/);
+out_tabs($out, 'gb18030_2', $sort2, $mb2);
 
 // Start codepoints `gb18030_4_u_b` array not needed by `u_gb18030()`
 $cnt = count($gb18030_4_u_e);
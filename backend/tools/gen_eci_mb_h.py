@@ -0,0 +1,335 @@
+#!/usr/bin/env python3
+# Generate ECI multibyte tables from unicode.org mapping files
+#
+#   libzint - the open source barcode library
+#   Copyright (C) 2022 Robin Stuart <rstuart114@gmail.com>
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Port of "gen_eci_mb_h.php" for when PHP is not available - the output is identical, so any change to the
+# tables must be made to both.
+#
+# To create "backend/big5/gb18030/gb2312/gbk/ksx1001/sjis.h" (from project root directory):
+#
+#   python3 backend/tools/gen_eci_mb_h.py
+#
+# NOTE: backend/tools/data/GB18030.TXT will have to be downloaded first from the tarball
+#       https://haible.de/bruno/charsets/conversion-tables/GB18030.tar.bz2
+#       using the version jdk-1.4.2/GB18030.TXT
+
+import getopt
+import os
+import re
+import sys
+
+COPYRIGHT_TEXT = """
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+    3. Neither the name of the project nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+ */
+/* SPDX-License-Identifier: BSD-3-Clause */
+"""
+
+basename = 'gen_eci_mb_h.php'  # As named in the generated headers
+dirname = os.path.dirname(os.path.abspath(__file__))
+
+opts = dict(getopt.getopt(sys.argv[1:], 'd:o:')[0])
+data_dirname = opts.get('-d', dirname + '/data')  # Where to load file from.
+out_dirname = opts.get('-o', dirname + '/..')  # Where to put output.
+
+year = 2022
+
+
+def out_header(out, name, descr, file, start_year=0, extra_comment=''):
+    caps = name.upper()
+    out.append('/*  ' + name + '.h - tables for Unicode to ' + descr + ', generated by "backend/tools/'
+               + basename + '"')
+    if extra_comment != '':
+        out.append('    from "' + file + '"')
+        out.append('    ' + extra_comment + ' */')
+    else:
+        out.append('    from "' + file + '" */')
+    out.append('/*')
+    out.append('    libzint - the open source barcode library')
+    if start_year and start_year != year:
+        out.append('    Copyright (C) %d-%d Robin Stuart <rstuart114@gmail.com>' % (start_year, year))
+    else:
+        out.append('    Copyright (C) %d Robin Stuart <rstuart114@gmail.com>' % year)
+    out.extend(COPYRIGHT_TEXT.split('\n'))
+    out.append('#ifndef Z_' + caps + '_H')
+    out.append('#define Z_' + caps + '_H')
+
+
+def out_tab_entries(out, arr, cnt, not_hex=False):
+    line = '   '
+    for i in range(cnt):
+        if i and i % 8 == 0:
+            out.append(line)
+            line = '   '
+        line += (' %5d,' % arr[i]) if not_hex else (' 0x%04X,' % arr[i])
+    if line != '   ':
+        out.append(line)
+
+
+def out_tabs(out, name, sort, mb, uro_cnt=0):
+    """Output two-level page tables for the Unicode codepoints `sort` (sorted), and their multibyte values `mb`"""
+    page = [0] * 256
+    page_u = []
+    page_mb_ind = []
+    for i, u in enumerate(sort):
+        p = u >> 8
+        if not page[p]:
+            page[p] = len(page_u) // 16 + 1
+            page_u.extend([0] * 16)
+            page_mb_ind.extend([-1] * 16)
+        u2 = ((page[p] - 1) << 4) | ((u >> 4) & 0xF)
+        page_u[u2] |= 1 << (u & 0xF)
+        if page_mb_ind[u2] == -1:
+            # URO entries were removed from `sort` but not from `mb`
+            page_mb_ind[u2] = i + uro_cnt if u >= 0x4E00 else i
+    page_mb_ind = [0 if ind == -1 else ind for ind in page_mb_ind]
+
+    out.append('')
+    out.append('/* Page (U+xx00-xxFF) blocks of `' + name + '_page_u[]` & `' + name + '_page_mb_ind[]`, 1-based,'
+               + ' 0 if none */')
+    out.append('static const unsigned char ' + name + '_page[256] = {')
+    for i in range(0, 256, 16):
+        out.append('   ' + ''.join(' %3d,' % v for v in page[i:i + 16]))
+    out.append('};')
+
+    cnt = len(page_u)
+    out.append('')
+    out.append('/* Unicode usage bit-flags for pages in blocks of 16 */')
+    out.append('static const unsigned short ' + name + '_page_u[%d] = {' % cnt)
+    out_tab_entries(out, page_u, cnt)
+    out.append('};')
+    out.append('')
+    out.append('/* Multibyte indexes for pages in blocks of 16 */')
+    out.append('static const unsigned short ' + name + '_page_mb_ind[%d] = {' % cnt)
+    out_tab_entries(out, page_mb_ind, cnt, True)
+    out.append('};')
+
+    if mb:
+        cnt = len(mb)
+        out.append('')
+        out.append('/* Multibyte values sorted in Unicode order */')
+        out.append('static const unsigned short ' + name + '_mb[%d] = {' % cnt)
+        out_tab_entries(out, mb, cnt)
+        out.append('};')
+
+
+def out_uro_tabs(out, name, sort, end):
+    """Output URO (U+4E00-`end`) tables, removing the URO entries from `sort` and returning their count"""
+    u_i = 0
+    while u_i < len(sort) and sort[u_i] < 0x4E00:
+        u_i += 1
+    start_u_i = end_u_i = u_i
+    sort_search = {u: i for i, u in enumerate(sort)}
+    uro_u = []
+    uro_mb_ind = []
+    for u in range(0x4E00, end + 1, 16):
+        used = 0
+        next_u_i = u_i
+        for j in range(16):
+            if u + j in sort_search:
+                i = sort_search[u + j]
+                used |= 1 << j
+                next_u_i = i + 1
+                end_u_i = i
+        uro_u.append(used)
+        uro_mb_ind.append(u_i)
+        u_i = next_u_i
+
+    cnt = len(uro_u)
+    out.append('')
+    out.append('/* Unicode usage bit-flags for URO (U+4E00-U+9FFF) block */')
+    out.append('static const unsigned short ' + name + '_uro_u[%d] = {' % cnt)
+    out_tab_entries(out, uro_u, cnt)
+    out.append('};')
+    cnt = len(uro_mb_ind)
+    out.append('')
+    out.append('/* Multibyte indexes for URO (U+4E00-U+9FFF) block */')
+    out.append('static const unsigned short ' + name + '_uro_mb_ind[%d] = {' % cnt)
+    out_tab_entries(out, uro_mb_ind, cnt, True)
+    out.append('};')
+
+    uro_cnt = end_u_i - start_u_i + 1
+    del sort[start_u_i:start_u_i + uro_cnt]
+    return uro_cnt
+
+
+def out_footer(out, name):
+    out.append('')
+    out.append('#endif /* Z_' + name.upper() + '_H */')
+    with open(out_dirname + '/' + name + '.h', 'w', newline='\n') as f:
+        f.write('\n'.join(out) + '\n')
+
+
+def read_mappings(filename, mb_digits, trail=r'[ \t]'):
+    """Return (multibyte, Unicode) pairs of mapping file `filename`, with `mb_digits` hex digits multibyte values"""
+    file = data_dirname + '/' + filename
+    try:
+        with open(file, encoding='latin-1') as f:
+            lines = f.read().split('\n')
+    except OSError:
+        sys.exit('%s: ERROR: Could not read mapping file "%s"' % (os.path.basename(__file__), file))
+    ret = []
+    for line in lines:
+        line = line.strip()
+        if line == '' or not line.startswith('0x') or '*** NO MAPPING ***' in line:
+            continue
+        m = re.match(r'^0x([0-9A-F]' + mb_digits + r')[ \t]+0x([0-9A-F]{4})' + trail, line)
+        if m:
+            ret.append((int(m.group(1), 16), int(m.group(2), 16)))
+    return ret
+
+
+def sort_by_u(sort, mb):
+    """Sort `sort` and `mb` together by Unicode then multibyte value (as PHP `array_multisort()`)"""
+    pairs = sorted(zip(sort, mb))
+    return [p[0] for p in pairs], [p[1] for p in pairs]
+
+
+def out_mb(name, descr, url, start_year, pairs, uro_end, extra_comment=''):
+    out = []
+    out_header(out, name, descr, url, start_year, extra_comment)
+    sort, mb = sort_by_u([u for d, u in pairs], [d for d, u in pairs])
+    uro_cnt = out_uro_tabs(out, name, sort, uro_end)
+    out_tabs(out, name, sort, mb, uro_cnt)
+    out_footer(out, name)
+
+
+# BIG5
+
+out_mb('big5', 'Big5', 'https://unicode.org/Public/MAPPINGS/OBSOLETE/EASTASIA/OTHER/BIG5.TXT', 2021,
+       [(d, u) for d, u in read_mappings('BIG5.TXT', '{4}')], 0x9FAF)
+
+# KS X 1001
+
+pairs = [(d + 0x8080, u) for d, u in read_mappings('KSX1001.TXT', '{4}')]
+pairs.append((0x2266 + 0x8080, 0x20AC))  # Euro sign added KS X 1001:1998
+pairs.append((0x2267 + 0x8080, 0xAE))  # Registered trademark added KS X 1001:1998
+pairs.append((0x2268 + 0x8080, 0x327E))  # Korean postal code symbol added KS X 1001:2002
+out_mb('ksx1001', 'EUC-KR (KS X 1001)', 'https://unicode.org/Public/MAPPINGS/OBSOLETE/EASTASIA/KSC/KSX1001.TXT',
+       2021, pairs, 0x9F9F)
+
+# Shift JIS
+
+pairs = [(d, u) for d, u in read_mappings('SHIFTJIS.TXT', '{2,4}')
+         if (d >= 0x80 or d == 0x5C or d == 0x7E) and not 0xE000 <= u <= 0xE757]  # Skip user-defined PUA
+out_mb('sjis', 'Shift JIS', 'https://unicode.org/Public/MAPPINGS/OBSOLETE/EASTASIA/JIS/SHIFTJIS.TXT', 2009,
+       pairs, 0x9FAF)
+
+# GB 2312
+
+pairs = [(d + 0x8080, u) for d, u in read_mappings('GB2312.TXT', '{2,4}') if d >= 0x80]
+in_gb2312 = set(u for d, u in pairs)
+out_mb('gb2312', 'GB 2312-1980 (EUC-CN)', 'unicode.org-mappings/EASTASIA/GB/GB2312.TXT', 2009, pairs, 0x9CEF,
+       '(see https://haible.de/bruno/charsets/conversion-tables/GB2312.tar.bz2)')
+
+# GBK
+
+pairs = [(d, u) for d, u in read_mappings('CP936.TXT', '{2,4}') if d >= 0x80]
+in_gbk = set(u for d, u in pairs)
+pairs = [(d, u) for d, u in pairs if u == 0x2015 or u not in in_gb2312]  # U+2015 mapped differently by GBK
+out_mb('gbk', 'GBK, excluding mappings in GB 2312',
+       'https://unicode.org/Public/MAPPINGS/VENDORS/MICSFT/WINDOWS/CP936.TXT', 0, pairs, 0x9FAF)
+
+# GB 18030
+
+out = []
+out_header(out, 'gb18030', 'GB 18030-2005', 'jdk-1.4.2/GB18030.TXT', 2016,
+           '(see https://haible.de/bruno/charsets/conversion-tables/GB18030.tar.bz2)')
+
+sort2 = []
+mb2 = []
+sort4 = []
+# Excluding U+10000..10FFFF to save space
+for d, u in read_mappings('GB18030.TXT', '{2,8}', r'(?![0-9A-F])'):
+    if d < 0x80:
+        continue
+    if u == 0xE7C7:  # 4-byte extension change, PUA
+        continue
+    if d < 0x10000:
+        if u in in_gbk:
+            continue
+        if 0xE000 <= u <= 0xE765:  # User-defined, dealt with programatically by `u_gb18030()`
+            continue
+        sort2.append(u)
+        mb2.append(d)
+    elif u < 0x10000:
+        sort4.append(u)
+
+# 2-byte extension GB 18030-2005 change, was PUA U+E7C7 below, see Table 3-39, p.111, Lunde 2nd ed.
+sort2.append(0x1E3F)
+mb2.append(0xA8BC)
+
+# 2-byte extension GB 18030-2005 change, were PUA, see Table 3-37, p.109, Lunde 2nd ed.
+sort2.extend(range(0x9FB4, 0x9FBC))
+mb2.extend((0xFE59, 0xFE61, 0xFE66, 0xFE67, 0xFE6D, 0xFE7E, 0xFE90, 0xFEA0))
+sort2.extend(range(0xFE10, 0xFE1A))
+mb2.extend((0xA6D9, 0xA6DB, 0xA6DA, 0xA6DC, 0xA6DD, 0xA6DE, 0xA6DF, 0xA6EC, 0xA6ED, 0xA6F3))
+
+# Calculate Unicode start/end codepoints mapping to consecutive 4-byte blocks
+
+sort4.sort()
+gb18030_4_u_b = []
+gb18030_4_u_e = []
+prev_u = begin_u = sort4[0]
+for u in sort4[1:]:
+    if u == prev_u + 1:
+        prev_u += 1
+        continue
+    gb18030_4_u_b.append(begin_u)
+    gb18030_4_u_e.append(prev_u)
+    begin_u = prev_u = u
+gb18030_4_u_b.append(begin_u)
+gb18030_4_u_e.append(prev_u)
+
+# Gaps between blocks
+gb18030_4_mb_o = [0]
+for i in range(1, len(gb18030_4_u_b)):
+    gb18030_4_mb_o.append(gb18030_4_u_b[i] - (gb18030_4_u_e[i - 1] + 1) + gb18030_4_mb_o[-1])
+
+# Output GB 18030 tables
+
+sort2, mb2 = sort_by_u(sort2, mb2)
+out_tabs(out, 'gb18030_2', sort2, mb2)
+
+# Start codepoints `gb18030_4_u_b` array not needed by `u_gb18030()`
+cnt = len(gb18030_4_u_e)
+out.append('')
+out.append('/* End Unicode codepoints of blocks mapping consecutively to 4-byte multibyte blocks */')
+out.append('static const unsigned short gb18030_4_u_e[%d] = {' % cnt)
+out_tab_entries(out, gb18030_4_u_e, cnt)
+out.append('};')
+cnt = len(gb18030_4_mb_o)
+out.append('')
+out.append('/* Cumulative gaps between Unicode blocks mapping consecutively to 4-byte multibyte blocks,')
+out.append('   used to adjust multibyte offsets */')
+out.append('static const unsigned short gb18030_4_mb_o[%d] = {' % cnt)
+out_tab_entries(out, gb18030_4_mb_o, cnt, True)
+out.append('};')
+
+out_footer(out, 'gb18030')
@@ -10,6 +10,8 @@
  *
  *   php backend/tools/gen_eci_sb_h.php
  *
+ * or, if PHP is not available, with the Python port "gen_eci_sb_h.py" (same output)
+ *
  * Requires "8859-*.TXT" from https://unicode.org/Public/MAPPINGS/ISO8859/
  * and "CP1250/1/2/6.TXT" from https://unicode.org/Public/MAPPINGS/VENDORS/MICSFT/
  * to be in "backend/tools/data" directory.
@@ -65,14 +67,13 @@ EOD;
 
 $out = explode("\n", $head);
 
-$u_iso8859 = <<<'EOD'
+$u_sb = <<<'EOD'
 
-/* Forward reference to base ISO/IEC 8859 routine - see "eci.c" */
-static int u_iso8859(const unsigned int u, const unsigned short *tab_s, const unsigned short *tab_u,
-            const unsigned char *tab_sb, int e, unsigned char *dest);
+/* Forward reference to base single-byte routine - see "eci.c" */
+static int u_sb(const unsigned int u, const unsigned char *tab_ind, const int ind_size, unsigned char *dest);
 EOD;
 
-$out = array_merge($out, explode("\n", $u_iso8859));
+$out = array_merge($out, explode("\n", $u_sb));
 
 $iso8859_comments = array(
     array(), array(), // 0-1
@@ -94,122 +95,6 @@ $iso8859_comments = array(
     array( '18', 'Latin alphabet No. 10 (Latin-10) (South-Eastern European)' ),
 );
 
-// Read the 8859 files.
-
-$tot_8859 = 0;
-for ($k = 2; $k <= 16; $k++) {
-    if ($k == 12) continue;
-
-    $file = $data_dirname . '/' . '8859-' . $k . '.TXT';
-
-    if (($get = file_get_contents($file)) === false) {
-        error_log($error = "$basename: ERROR: Could not read mapping file \"$file\"");
-        exit($error . PHP_EOL);
-    }
-
-    $lines = explode("\n", $get);
-
-    // Parse the file.
-
-    $sort = array();
-    $sb = array();
-    $same = array();
-    foreach ($lines as $line) {
-        $line = trim($line);
-        if ($line === '' || strncmp($line, '0x', 2) !== 0 || strpos($line, "*** NO MAPPING ***") !== false) {
-            continue;
-        }
-        $matches = array();
-        if (preg_match('/^0x([0-9A-F]{2})[ \t]+0x([0-9A-F]{4})[ \t].*$/', $line, $matches)) {
-            $mb = hexdec($matches[1]);
-            $unicode = hexdec($matches[2]);
-            if ($unicode >= 0xA0) {
-                if ($unicode <= 0xFF && $unicode == $mb) {
-                    $same[] = $mb;
-                } else {
-                    $sort[] = $unicode;
-                    $sb[] = $mb;
-                }
-            }
-        }
-    }
-
-    sort($same);
-    array_multisort($sort, $sb);
-
-    $s = array( 0, 0, 0, 0, 0, 0 );
-    for ($i = 0, $cnt = count($same); $i < $cnt; $i++) {
-        $v = $same[$i] - 0xA0;
-        $j = $v >> 4;
-        $s[$j] |= 1 << ($v & 0xF);
-    }
-
-    // Output.
-
-    $out[] = '';
-    $out[] = '/* Tables for ISO/IEC 8859-' . $k . ' */';
-    $out[] = 'static const unsigned short iso8859_' . $k . '_s[6] = { /* Straight-thru bit-flags */';
-    $line = '   ';
-    for ($i = 0; $i < 6; $i++) {
-        $line .= sprintf(" 0x%04X,", $s[$i]);
-    }
-    $out[] = $line;
-    $out[] = '};';
-    $tot_8859 += 6 * 2;
-
-    $cnt = count($sort);
-    $out[] = 'static const unsigned short iso8859_' . $k . '_u[' . $cnt . '] = { /* Unicode codepoints sorted */';
-    $line = '   ';
-    for ($i = 0; $i < $cnt; $i++) {
-        if ($i && $i % 8 === 0) {
-            $out[] = $line;
-            $line = '   ';
-        }
-        $line .= sprintf(' 0x%04X,', $sort[$i]);
-    }
-    if ($line !== '   ') {
-        $out[] = $line;
-    }
-    $out[] = '};';
-    $tot_8859 += $cnt * 2;
-
-    $cnt = count($sb);
-    $out[] = 'static const unsigned char iso8859_' . $k . '_sb[' . $cnt . '] = { /* Single-byte in Unicode order */';
-    $line = ' ';
-    for ($i = 0; $i < $cnt; $i++) {
-        if ($i && $i % 8 === 0) {
-            $out[] = $line;
-            $line = ' ';
-        }
-        $line .= sprintf('   0x%02X,', $sb[$i]);
-    }
-    if ($line !== '   ') {
-        $out[] = $line;
-    }
-    $out[] = '};';
-    $tot_8859 += $cnt;
-
-    $out[] = '';
-    $out[] = '/* ECI ' . $iso8859_comments[$k][0] . ' ISO/IEC 8859-' . $k . ' ' . $iso8859_comments[$k][1] . ' */';
-    $out[] = 'static int u_iso8859_' . $k . '(const unsigned int u, unsigned char *dest) {';
-    $out[] = '    return u_iso8859(u, iso8859_' . $k . '_s, iso8859_' . $k . '_u, iso8859_' . $k . '_sb, ARRAY_SIZE(iso8859_' . $k . '_u) - 1, dest);';
-    $out[] = '}';
-}
-
-if (0) {
-    $out[] = '';
-    $out[] = '/* Total ISO/IEC 8859 bytes: ' . $tot_8859 . ' */';
-}
-
-$u_cp125x = <<<'EOD'
-
-/* Forward reference to base Windows-125x routine - see "eci.c" */
-static int u_cp125x(const unsigned int u, const unsigned short *tab_s, const unsigned short *tab_u,
-            const unsigned char *tab_sb, int e, unsigned char *dest);
-EOD;
-
-$out = array_merge($out, explode("\n", $u_cp125x));
-
 $cp125x_comments = array(
     //    ECI    Description
     array( '21', 'Latin 2 (Central Europe)' ),
@@ -219,13 +104,33 @@ $cp125x_comments = array(
     array( '24', 'Arabic' ),
 );
 
-// Read the Windows 125x files.
+// Single-byte ECIs able to encode each codepoint >= U+00A0, as bit-flags `1 << ECI`, starting with ECI 3 ISO/IEC 8859-1.
 
-$tot_cp125x = 0;
-for ($k = 0; $k <= 6; $k++) {
-    if ($k >= 3 && $k <= 5) continue;
+$masks = array();
+for ($u = 0xA0; $u <= 0xFF; $u++) {
+    $masks[$u] = 1 << 3;
+}
 
-    $file = $data_dirname . '/' . 'CP125' . $k . '.TXT';
+// Read the 8859 & Windows 125x files into codepoint -> single-byte maps.
+
+$ecis = array();
+for ($k = 2; $k <= 16 + 7; $k++) {
+    if ($k == 12) continue;
+    if ($k <= 16) {
+        $file = $data_dirname . '/' . '8859-' . $k . '.TXT';
+        $name = 'iso8859_' . $k;
+        $title = 'ISO/IEC 8859-' . $k;
+        $comment = $iso8859_comments[$k];
+        $min = 0xA0; // U+0080-9F fail
+    } else {
+        $cp = $k - 17;
+        if ($cp >= 3 && $cp <= 5) continue;
+        $file = $data_dirname . '/' . 'CP125' . $cp . '.TXT';
+        $name = 'cp125' . $cp;
+        $title = 'Windows-125' . $cp;
+        $comment = $cp125x_comments[$cp];
+        $min = 0x80;
+    }
 
     if (($get = file_get_contents($file)) === false) {
         error_log($error = "$basename: ERROR: Could not read mapping file \"$file\"");
@@ -236,9 +141,7 @@ for ($k = 0; $k <= 6; $k++) {
 
     // Parse the file.
 
-    $sort = array();
-    $sb = array();
-    $same = array();
+    $map = array();
     foreach ($lines as $line) {
         $line = trim($line);
         if ($line === '' || strncmp($line, '0x', 2) !== 0 || strpos($line, "*** NO MAPPING ***") !== false) {
@@ -248,86 +151,141 @@ for ($k = 0; $k <= 6; $k++) {
         if (preg_match('/^0x([0-9A-F]{2})[ \t]+0x([0-9A-F]{4})[ \t].*$/', $line, $matches)) {
             $mb = hexdec($matches[1]);
             $unicode = hexdec($matches[2]);
-            if ($unicode >= 0x80) {
-                if ($unicode <= 0xFF && $unicode == $mb) {
-                    $same[] = $mb;
-                } else {
-                    $sort[] = $unicode;
-                    $sb[] = $mb;
-                }
+            if ($unicode >= $min) {
+                $map[$unicode] = $mb;
             }
         }
     }
 
-    sort($same);
-    array_multisort($sort, $sb);
-
-    $s = array( 0, 0, 0, 0, 0, 0 );
-    for ($i = 0, $cnt = count($same); $i < $cnt; $i++) {
-        $v = $same[$i] - 0xA0;
-        $j = $v >> 4;
-        $s[$j] |= 1 << ($v & 0xF);
+    // Add this ECI's bit-flag to every codepoint it maps (ISO/IEC 8859 and Windows-125x alike).
+    $eci = (int) $comment[0];
+    foreach ($map as $unicode => $mb) {
+        $masks[$unicode] = (isset($masks[$unicode]) ? $masks[$unicode] : 0) | (1 << $eci);
     }
 
-    // Output.
+    $ecis[] = array( 'name' => $name, 'title' => $title, 'eci' => $comment[0], 'desc' => $comment[1],
+                    'map' => $map );
+}
 
-    $out[] = '';
-    $out[] = '/* Tables for Windows 125' . $k . ' */';
-    $out[] = 'static const unsigned short cp125' . $k . '_s[6] = { /* Straight-thru bit-flags */';
-    $line = '   ';
-    for ($i = 0; $i < 6; $i++) {
-        $line .= sprintf(" 0x%04X,", $s[$i]);
+// Split into blocks of 64 codepoints, sharing identical blocks (block 0 being empty).
+
+$blocks = array( implode(',', array_fill(0, 64, 0)) => 0 );
+foreach ($ecis as $i => $eci) {
+    $ind = array();
+    $max_block = max(array_keys($eci['map'])) >> 6;
+    for ($b = 0; $b <= $max_block; $b++) {
+        $block = array();
+        for ($j = 0; $j < 64; $j++) {
+            $u = ($b << 6) | $j;
+            $block[] = isset($eci['map'][$u]) ? $eci['map'][$u] : 0;
+        }
+        $key = implode(',', $block);
+        if (!isset($blocks[$key])) {
+            $blocks[$key] = count($blocks);
+        }
+        $ind[] = $blocks[$key];
     }
-    $out[] = $line;
-    $out[] = '};';
-    $tot_cp125x += 6 * 2;
+    $ecis[$i]['ind'] = $ind;
+}
 
-    $cnt = count($sort);
-    $out[] = 'static const unsigned short cp125' . $k . '_u[' . $cnt . '] = { /* Unicode codepoints sorted */';
-    $line = '   ';
-    for ($i = 0; $i < $cnt; $i++) {
-        if ($i && $i % 8 === 0) {
-            $out[] = $line;
-            $line = '   ';
+// Output.
+
+$out[] = '';
+$out[] = '/* Single-byte values of blocks of 64 codepoints (0 if none), shared by the single-byte ECIs */';
+$out[] = 'static const unsigned char eci_sb_blocks[' . count($blocks) . '][64] = {';
+foreach ($blocks as $key => $b) {
+    $block = explode(',', $key);
+    $out[] = sprintf('    { /*%3d*/', $b);
+    for ($i = 0; $i < 64; $i += 16) {
+        $line = '       ';
+        for ($j = $i; $j < $i + 16; $j++) {
+            $line .= sprintf(' 0x%02X,', $block[$j]);
         }
-        $line .= sprintf(' 0x%04X,', $sort[$i]);
-    }
-    if ($line !== '   ') {
         $out[] = $line;
     }
-    $out[] = '};';
-    $tot_cp125x += $cnt * 2;
+    $out[] = '    },';
+}
+$out[] = '};';
 
-    $cnt = count($sb);
-    $out[] = 'static const unsigned char cp125' . $k . '_sb[' . $cnt . '] = { /* Single-byte in Unicode order */';
-    $line = ' ';
+foreach ($ecis as $eci) {
+    $cnt = count($eci['ind']);
+    $out[] = '';
+    $out[] = '/* ' . $eci['title'] . ' `eci_sb_blocks[]` indexes by codepoint block `u >> 6` */';
+    $out[] = 'static const unsigned char ' . $eci['name'] . '_ind[' . $cnt . '] = {';
+    $line = '   ';
     for ($i = 0; $i < $cnt; $i++) {
-        if ($i && $i % 8 === 0) {
+        if ($i && $i % 16 === 0) {
             $out[] = $line;
-            $line = ' ';
+            $line = '   ';
         }
-        $line .= sprintf('   0x%02X,', $sb[$i]);
-    }
-    if ($line !== '   ') {
-        $out[] = $line;
+        $line .= sprintf(' %2d,', $eci['ind'][$i]);
     }
+    $out[] = $line;
     $out[] = '};';
-    $tot_cp125x += $cnt;
 
     $out[] = '';
-    $out[] = '/* ECI ' . $cp125x_comments[$k][0] . ' Windows-125' . $k . ' ' . $cp125x_comments[$k][1] . ' */';
-    $out[] = 'static int u_cp125' . $k . '(const unsigned int u, unsigned char *dest) {';
-    $out[] = '    return u_cp125x(u, cp125' . $k . '_s, cp125' . $k . '_u, cp125' . $k . '_sb, ARRAY_SIZE(cp125' . $k . '_u) - 1, dest);';
+    $out[] = '/* ECI ' . $eci['eci'] . ' ' . $eci['title'] . ' ' . $eci['desc'] . ' */';
+    $out[] = 'static int u_' . $eci['name'] . '(const unsigned int u, unsigned char *dest) {';
+    $out[] = '    return u_sb(u, ' . $eci['name'] . '_ind, ARRAY_SIZE(' . $eci['name'] . '_ind), dest);';
     $out[] = '}';
 }
 
-if (0) {
-    $out[] = '';
-    $out[] = '/* Total Windows 125x bytes: ' . $tot_cp125x . ' */';
+// Output ECI bit-flags, direct for U+00A0-FF, otherwise sorted by codepoint (binary searched by `eci_sb_mask()`).
 
-    $out[] = '';
-    $out[] = '/* Total bytes: ' . ($tot_8859 + $tot_cp125x) . ' */';
+ksort($masks);
+
+$out[] = '';
+$out[] = '/* Single-byte ECIs (bit-flags `1 << ECI`) able to encode U+00A0-FF */';
+$out[] = 'static const unsigned int eci_sb_latin1_masks[96] = {';
+$line = '   ';
+for ($u = 0xA0; $u <= 0xFF; $u++) {
+    if ($u !== 0xA0 && ($u - 0xA0) % 8 === 0) {
+        $out[] = $line;
+        $line = '   ';
+    }
+    $line .= sprintf(' 0x%07X,', $masks[$u]);
+}
+$out[] = $line;
+$out[] = '};';
+
+$sort = array();
+$mask = array();
+foreach ($masks as $unicode => $m) {
+    if ($unicode > 0xFF) {
+        $sort[] = $unicode;
+        $mask[] = $m;
+    }
+}
+
+$cnt = count($sort);
+$out[] = '';
+$out[] = '/* Unicode codepoints > U+00FF encodable by at least one single-byte ECI */';
+$out[] = 'static const unsigned short eci_sb_u[' . $cnt . '] = { /* Unicode codepoints sorted */';
+$line = '   ';
+for ($i = 0; $i < $cnt; $i++) {
+    if ($i && $i % 8 === 0) {
+        $out[] = $line;
+        $line = '   ';
+    }
+    $line .= sprintf(' 0x%04X,', $sort[$i]);
+}
+if ($line !== '   ') {
+    $out[] = $line;
+}
+$out[] = '};';
+$out[] = 'static const unsigned int eci_sb_masks[' . $cnt . '] = { /* ECI bit-flags in Unicode order */';
+$line = '   ';
+for ($i = 0; $i < $cnt; $i++) {
+    if ($i && $i % 8 === 0) {
+        $out[] = $line;
+        $line = '   ';
+    }
+    $line .= sprintf(' 0x%07X,', $mask[$i]);
+}
+if ($line !== '   ') {
+    $out[] = $line;
 }
+$out[] = '};';
 
 $out[] = '';
 $out[] = '#endif /* Z_ECI_SB_H */';
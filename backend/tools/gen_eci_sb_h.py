@@ -0,0 +1,227 @@
+#!/usr/bin/env python3
+# Generate ECI single-byte tables & routines from unicode.org mapping files
+#
+#   libzint - the open source barcode library
+#   Copyright (C) 2022 Robin Stuart <rstuart114@gmail.com>
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Port of "gen_eci_sb_h.php" for when PHP is not available - the output is identical, so any change to the
+# tables must be made to both.
+#
+# To create "backend/eci_sb.h" (from project root directory):
+#
+#   python3 backend/tools/gen_eci_sb_h.py
+#
+# Requires "8859-*.TXT" from https://unicode.org/Public/MAPPINGS/ISO8859/
+# and "CP1250/1/2/6.TXT" from https://unicode.org/Public/MAPPINGS/VENDORS/MICSFT/
+# to be in "backend/tools/data" directory.
+
+import getopt
+import os
+import re
+import sys
+
+dirname = os.path.dirname(os.path.abspath(__file__))
+
+opts = dict(getopt.getopt(sys.argv[1:], 'd:o:')[0])
+data_dirname = opts.get('-d', dirname + '/data')  # Where to load file from.
+out_dirname = opts.get('-o', dirname + '/..')  # Where to put output.
+
+HEAD = '''/*  eci_sb.h - Extended Channel Interpretations single-byte, generated by "backend/tools/gen_eci_sb_h.php"
+    from "https://unicode.org/Public/MAPPINGS/ISO8859/8859-*.TXT"
+    and "https://unicode.org/Public/MAPPINGS/VENDORS/MICSFT/WINDOWS/CP125*.TXT" */
+/*
+    libzint - the open source barcode library
+    Copyright (C) 2021-2022 Robin Stuart <rstuart114@gmail.com>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+    3. Neither the name of the project nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+ */
+/* SPDX-License-Identifier: BSD-3-Clause */
+
+#ifndef Z_ECI_SB_H
+#define Z_ECI_SB_H'''
+
+U_SB = '''
+/* Forward reference to base single-byte routine - see "eci.c" */
+static int u_sb(const unsigned int u, const unsigned char *tab_ind, const int ind_size, unsigned char *dest);'''
+
+
+def out_hex_tab(out, tab, fmt, per_line):
+    """Output `tab` entries formatted by `fmt`, `per_line` to a line"""
+    line = '   '
+    for i, v in enumerate(tab):
+        if i and i % per_line == 0:
+            out.append(line)
+            line = '   '
+        line += fmt % v
+    if line != '   ':
+        out.append(line)
+
+
+out = HEAD.split('\n')
+out += U_SB.split('\n')
+
+iso8859_comments = [
+    [], [],  # 0-1 not used
+    ['4', 'Latin alphabet No. 2 (Latin-2)'],
+    ['5', 'Latin alphabet No. 3 (Latin-3) (South European)'],
+    ['6', 'Latin alphabet No. 4 (Latin-4) (North European)'],
+    ['7', 'Latin/Cyrillic'],
+    ['8', 'Latin/Arabic'],
+    ['9', 'Latin/Greek'],
+    ['10', 'Latin/Hebrew'],
+    ['11', 'Latin alphabet No. 5 (Latin-5) (Latin/Turkish)'],
+    ['12', 'Latin alphabet No. 6 (Latin-6) (Nordic)'],
+    ['13', 'Latin/Thai'],
+    [],  # 12 doesn't exist
+    ['15', 'Latin alphabet No. 7 (Latin-7) (Baltic Rim)'],
+    ['16', 'Latin alphabet No. 8 (Latin-8) (Celtic)'],
+    ['17', 'Latin alphabet No. 9 (Latin-9)'],
+    ['18', 'Latin alphabet No. 10 (Latin-10) (South-Eastern European)'],
+]
+
+cp125x_comments = [
+    ['21', 'Latin 2 (Central Europe)'],
+    ['22', 'Cyrillic'],
+    ['23', 'Latin 1'],
+    [], [], [],  # Not supported
+    ['24', 'Arabic'],
+]
+
+# ECI bit-flags `1 << ECI` of the single-byte ECIs able to encode each codepoint, accumulated over all the
+# mapping files below. ISO/IEC 8859-1 (ECI 3) encodes all of U+00A0-00FF.
+masks = {}
+for u in range(0xA0, 0x100):
+    masks[u] = 1 << 3
+
+ecis = []
+
+for k in range(2, 16 + 7 + 1):
+    if k == 12:
+        continue
+    if k <= 16:
+        file = data_dirname + '/8859-%d.TXT' % k
+        name = 'iso8859_%d' % k
+        title = 'ISO/IEC 8859-%d' % k
+        comment = iso8859_comments[k]
+        min_u = 0xA0
+    else:
+        cp = k - 17
+        if 3 <= cp <= 5:
+            continue
+        file = data_dirname + '/CP125%d.TXT' % cp
+        name = 'cp125%d' % cp
+        title = 'Windows-125%d' % cp
+        comment = cp125x_comments[cp]
+        min_u = 0x80
+
+    # Read & parse the file.
+
+    try:
+        with open(file, encoding='latin-1') as f:
+            lines = f.read().split('\n')
+    except OSError:
+        sys.exit('%s: ERROR: Could not read mapping file "%s"' % (os.path.basename(__file__), file))
+
+    map_u = {}
+    for line in lines:
+        line = line.strip()
+        if line == '' or not line.startswith('0x') or '*** NO MAPPING ***' in line:
+            continue
+        m = re.match(r'^0x([0-9A-F]{2})[ \t]+0x([0-9A-F]{4})[ \t].*$', line)
+        if m:
+            mb = int(m.group(1), 16)
+            unicode = int(m.group(2), 16)
+            if unicode >= min_u:
+                map_u[unicode] = mb
+
+    eci = int(comment[0])
+    for unicode in map_u:
+        masks[unicode] = masks.get(unicode, 0) | (1 << eci)
+
+    ecis.append({'name': name, 'title': title, 'eci': comment[0], 'desc': comment[1], 'map': map_u})
+
+# Split the codepoints into blocks of 64 (`u >> 6`), sharing identical blocks (mostly the all-zero one) between the
+# ECIs. Each ECI then only needs a byte index per block up to its highest mapped codepoint.
+
+blocks = {','.join(['0'] * 64): 0}
+for e in ecis:
+    ind = []
+    for b in range((max(e['map']) >> 6) + 1):
+        key = ','.join(str(e['map'].get((b << 6) | j, 0)) for j in range(64))
+        if key not in blocks:
+            blocks[key] = len(blocks)
+        ind.append(blocks[key])
+    e['ind'] = ind
+
+out.append('')
+out.append('/* Single-byte values of blocks of 64 codepoints (0 if none), shared by the single-byte ECIs */')
+out.append('static const unsigned char eci_sb_blocks[%d][64] = {' % len(blocks))
+for key, b in blocks.items():
+    block = [int(v) for v in key.split(',')]
+    out.append('    { /*%3d*/' % b)
+    for i in range(0, 64, 16):
+        out.append('       ' + ''.join(' 0x%02X,' % v for v in block[i:i + 16]))
+    out.append('    },')
+out.append('};')
+
+for e in ecis:
+    out.append('')
+    out.append('/* ' + e['title'] + ' `eci_sb_blocks[]` indexes by codepoint block `u >> 6` */')
+    out.append('static const unsigned char %s_ind[%d] = {' % (e['name'], len(e['ind'])))
+    out_hex_tab(out, e['ind'], ' %2d,', 16)
+    out.append('};')
+    out.append('')
+    out.append('/* ECI ' + e['eci'] + ' ' + e['title'] + ' ' + e['desc'] + ' */')
+    out.append('static int u_' + e['name'] + '(const unsigned int u, unsigned char *dest) {')
+    out.append('    return u_sb(u, ' + e['name'] + '_ind, ARRAY_SIZE(' + e['name'] + '_ind), dest);')
+    out.append('}')
+
+# U+00A0-00FF (the most common case) is looked up directly, the rest by binary search of `eci_sb_u[]`.
+
+out.append('')
+out.append('/* Single-byte ECIs (bit-flags `1 << ECI`) able to encode U+00A0-FF */')
+out.append('static const unsigned int eci_sb_latin1_masks[96] = {')
+out_hex_tab(out, [masks[u] for u in range(0xA0, 0x100)], ' 0x%07X,', 8)
+out.append('};')
+
+sort = sorted(u for u in masks if u > 0xFF)
+cnt = len(sort)
+out.append('')
+out.append('/* Unicode codepoints > U+00FF encodable by at least one single-byte ECI */')
+out.append('static const unsigned short eci_sb_u[%d] = { /* Unicode codepoints sorted */' % cnt)
+out_hex_tab(out, sort, ' 0x%04X,', 8)
+out.append('};')
+out.append('static const unsigned int eci_sb_masks[%d] = { /* ECI bit-flags in Unicode order */' % cnt)
+out_hex_tab(out, [masks[u] for u in sort], ' 0x%07X,', 8)
+out.append('};')
+
+out.append('')
+out.append('#endif /* Z_ECI_SB_H */')
+
+with open(out_dirname + '/eci_sb.h', 'w', newline='\n') as f:
+    f.write('\n'.join(out) + '\n')
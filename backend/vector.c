@@ -42,7 +42,7 @@ static struct zint_vector_rect *vector_plot_create_rect(struct zint_symbol *symb
                                 const float x, const float y, const float width, const float height) {
     struct zint_vector_rect *rect;
 
-    rect = (struct zint_vector_rect *) malloc(sizeof(struct zint_vector_rect));
+    rect = (struct zint_vector_rect *) z_malloc(sizeof(struct zint_vector_rect));
     if (!rect) {
         strcpy(symbol->errtxt, "691: Insufficient memory for vector rectangle");
         return NULL;
@@ -72,7 +72,7 @@ static struct zint_vector_hexagon *vector_plot_create_hexagon(struct zint_symbol
                                     const float x, const float y, const float diameter) {
     struct zint_vector_hexagon *hexagon;
 
-    hexagon = (struct zint_vector_hexagon *) malloc(sizeof(struct zint_vector_hexagon));
+    hexagon = (struct zint_vector_hexagon *) z_malloc(sizeof(struct zint_vector_hexagon));
     if (!hexagon) {
         strcpy(symbol->errtxt, "692: Insufficient memory for vector hexagon");
         return NULL;
@@ -101,7 +101,7 @@ static struct zint_vector_circle *vector_plot_create_circle(struct zint_symbol *
                                     const int colour) {
     struct zint_vector_circle *circle;
 
-    circle = (struct zint_vector_circle *) malloc(sizeof(struct zint_vector_circle));
+    circle = (struct zint_vector_circle *) z_malloc(sizeof(struct zint_vector_circle));
     if (!circle) {
         strcpy(symbol->errtxt, "693: Insufficient memory for vector circle");
         return NULL;
@@ -131,7 +131,7 @@ static int vector_plot_add_string(struct zint_symbol *symbol, const unsigned cha
             struct zint_vector_string **last_string) {
     struct zint_vector_string *string;
 
-    string = (struct zint_vector_string *) malloc(sizeof(struct zint_vector_string));
+    string = (struct zint_vector_string *) z_malloc(sizeof(struct zint_vector_string));
     if (!string) {
         strcpy(symbol->errtxt, "694: Insufficient memory for vector string");
         return 0;
@@ -144,9 +144,9 @@ static int vector_plot_add_string(struct zint_symbol *symbol, const unsigned cha
     string->length = length == -1 ? (int) ustrlen(text) : length;
     string->rotation = 0;
     string->halign = halign;
-    string->text = (unsigned char *) malloc(string->length + 1);
+    string->text = (unsigned char *) z_malloc(string->length + 1);
     if (!string->text) {
-        free(string);
+        z_free(string);
         strcpy(symbol->errtxt, "695: Insufficient memory for vector string text");
         return 0;
     }
@@ -174,7 +174,7 @@ INTERNAL void vector_free(struct zint_symbol *symbol) {
         while (rect) {
             struct zint_vector_rect *r = rect;
             rect = rect->next;
-            free(r);
+            z_free(r);
         }
 
         /* Free Hexagons */
@@ -182,7 +182,7 @@ INTERNAL void vector_free(struct zint_symbol *symbol) {
         while (hex) {
             struct zint_vector_hexagon *h = hex;
             hex = hex->next;
-            free(h);
+            z_free(h);
         }
 
         /* Free Circles */
@@ -190,7 +190,7 @@ INTERNAL void vector_free(struct zint_symbol *symbol) {
         while (circle) {
             struct zint_vector_circle *c = circle;
             circle = circle->next;
-            free(c);
+            z_free(c);
         }
 
         /* Free Strings */
@@ -198,12 +198,12 @@ INTERNAL void vector_free(struct zint_symbol *symbol) {
         while (string) {
             struct zint_vector_string *s = string;
             string = string->next;
-            free(s->text);
-            free(s);
+            z_free(s->text);
+            z_free(s);
         }
 
         /* Free vector */
-        free(symbol->vector);
+        z_free(symbol->vector);
         symbol->vector = NULL;
     }
 }
@@ -363,6 +363,13 @@ static void vector_rotate(struct zint_symbol *symbol, const int rotate_angle) {
     }
 }
 
+/* Scale and rotate the dimensions of an empty vector (`ZBarcode_Geometry()`) */
+static int vector_size_only(struct zint_symbol *symbol, const int rotate_angle) {
+    vector_scale(symbol, OUT_SIZE_ONLY);
+    vector_rotate(symbol, rotate_angle);
+    return 0;
+}
+
 static void vector_reduce_rectangles(struct zint_symbol *symbol) {
     /* Looks for vertically aligned rectangles and merges them together */
     struct zint_vector_rect *rect, *target, *prev;
@@ -377,7 +384,7 @@ static void vector_reduce_rectangles(struct zint_symbol *symbol) {
                     && (stripf(rect->y + rect->height) == target->y) && (rect->colour == target->colour)) {
                 rect->height += target->height;
                 prev->next = target->next;
-                free(target);
+                z_free(target);
             } else {
                 prev = target;
             }
@@ -389,7 +396,7 @@ static void vector_reduce_rectangles(struct zint_symbol *symbol) {
 }
 
 INTERNAL int plot_vector(struct zint_symbol *symbol, int rotate_angle, int file_type) {
-    int error_number;
+    int error_number = 0;
     int main_width;
     int comp_xoffset = 0;
     unsigned char addon[6];
@@ -440,14 +447,8 @@ INTERNAL int plot_vector(struct zint_symbol *symbol, int rotate_angle, int file_
     /* Free any previous rendering structures */
     vector_free(symbol);
 
-    /* Sanity check colours */
-    error_number = out_check_colour_options(symbol);
-    if (error_number != 0) {
-        return error_number;
-    }
-
     /* Allocate memory */
-    vector = symbol->vector = (struct zint_vector *) malloc(sizeof(struct zint_vector));
+    vector = symbol->vector = (struct zint_vector *) z_malloc(sizeof(struct zint_vector));
     if (!vector) {
         strcpy(symbol->errtxt, "696: Insufficient memory for vector header");
         return ZINT_ERROR_MEMORY;
@@ -517,6 +518,10 @@ INTERNAL int plot_vector(struct zint_symbol *symbol, int rotate_angle, int file_
     vector->width = symbol->width + dot_overspill + (xoffset + roffset);
     vector->height = symbol->height + textoffset + dot_overspill + (yoffset + boffset);
 
+    if (file_type == OUT_SIZE_ONLY && symbol->symbology != BARCODE_MAXICODE) {
+        return vector_size_only(symbol, rotate_angle);
+    }
+
     /* Plot Maxicode symbols */
     if (symbol->symbology == BARCODE_MAXICODE) {
         float bull_x, bull_y, bull_d_incr, bull_width;
@@ -533,6 +538,9 @@ INTERNAL int plot_vector(struct zint_symbol *symbol, int rotate_angle, int file_
         vector->width = 30 * hex_diameter + (xoffset + roffset);
         /* 32 rows drawn yposn_offset apart + final hexagon */
         vector->height = 32 * yposn_offset + hex_ydiameter + (yoffset + boffset);
+        if (file_type == OUT_SIZE_ONLY) {
+            return vector_size_only(symbol, rotate_angle);
+        }
 
         /* Bullseye (ISO/IEC 16023:2000 4.2.1.1 and 4.11.4) */
         bull_x = 14.5f * hex_diameter + xoffset; /* 14W right from leftmost centre = 14.5X */
@@ -956,6 +964,7 @@ INTERNAL int plot_vector(struct zint_symbol *symbol, int rotate_angle, int file_
         vector_rotate(symbol, rotate_angle);
     }
 
+    STATS_BEGIN(symbol, ZINT_PHASE_OUTPUT);
     switch (file_type) {
         case OUT_EPS_FILE:
             error_number = ps_plot(symbol);
@@ -968,6 +977,7 @@ INTERNAL int plot_vector(struct zint_symbol *symbol, int rotate_angle, int file_
             break;
         /* case OUT_BUFFER: No more work needed */
     }
+    STATS_END(symbol, ZINT_PHASE_OUTPUT);
 
     return error_number;
 }
@@ -35,6 +35,7 @@
 
 /* File types */
 #define OUT_BUFFER              0
+#define OUT_SIZE_ONLY           1   /* Dimensions only, nothing drawn (`ZBarcode_Geometry()`) */
 #define OUT_SVG_FILE            10
 #define OUT_EPS_FILE            20
 #define OUT_EMF_FILE            30
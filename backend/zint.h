@@ -38,6 +38,8 @@
 #ifndef ZINT_H
 #define ZINT_H
 
+#include <stddef.h> /* For size_t */
+
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
@@ -92,6 +94,66 @@ extern "C" {
         char id[32];        /* Optional ID to distinguish sequence, ASCII, NUL-terminated unless max 32 long */
     };
 
+    /* Encode result cache for use with `symbol->cache` (opaque), see `ZBarcode_Cache_Create()` below */
+    struct zint_cache;
+
+    /* Internal state of a symbol (opaque, internal only) */
+    struct zint_symbol_private;
+
+    /* Cache statistics, see `ZBarcode_Cache_Stats()` below */
+    struct zint_cache_stats {
+        unsigned long hits; /* Number of lookups satisfied from the cache */
+        unsigned long misses; /* Number of lookups not satisfied */
+        unsigned long evictions; /* Number of entries discarded to keep within the memory cap */
+        unsigned long entries; /* Number of entries currently held */
+        unsigned long memory; /* Bytes currently used by entries */
+        unsigned long max_memory; /* Memory cap in bytes */
+    };
+
+    /* Symbol geometry, see `ZBarcode_Geometry()` below */
+    struct zint_geometry {
+        int rows;           /* Number of rows */
+        int width;          /* Width in modules */
+        int version;        /* Value of `option_2` selecting the size chosen (Aztec, Data Matrix, QR Code) or for
+                               PDF417 the number of columns chosen, -1 if not applicable */
+        int ecc_level;      /* Value of `option_1` selecting the error correction level chosen (Aztec, PDF417,
+                               QR Code), -1 if not applicable */
+        int bitmap_width;   /* Width of raster output in pixels, as `bitmap_width` from `ZBarcode_Buffer()` */
+        int bitmap_height;  /* Height of raster output in pixels, as `bitmap_height` from `ZBarcode_Buffer()` */
+        float vector_width; /* Width of vector output, as `vector->width` from `ZBarcode_Buffer_Vector()` */
+        float vector_height; /* Height of vector output, as `vector->height` from `ZBarcode_Buffer_Vector()` */
+        float width_mm;     /* Width in mm if `dpmm` set, else 0 */
+        float height_mm;    /* Height in mm if `dpmm` set, else 0 */
+    };
+
+    /* Phases timed by `struct zint_stats` below */
+#define ZINT_PHASE_ENCODE       0   /* Whole of `ZBarcode_Encode()` etc, including the phases 1 to 6 below */
+#define ZINT_PHASE_VALIDATE     1   /* Input validation (segment checks, UTF-8 validation, escape processing) */
+#define ZINT_PHASE_GS1          2   /* GS1 verification */
+#define ZINT_PHASE_ECI          3   /* ECI selection and conversion */
+#define ZINT_PHASE_MODE         4   /* Mode optimisation (Data Matrix, Han Xin, PDF417, QR Code) */
+#define ZINT_PHASE_RS           5   /* Reed-Solomon error correction */
+#define ZINT_PHASE_MASK         6   /* Mask evaluation (Han Xin, QR Code, Micro QR) */
+#define ZINT_PHASE_PLOT         7   /* Raster or vector plotting, including phase 8 below for these formats */
+#define ZINT_PHASE_OUTPUT       8   /* Output formatting, compression and file I/O */
+#define ZINT_PHASE_COUNT        9
+
+    /* Per-phase timings and counters, see `stats` in `struct zint_symbol` below. Only filled in if Zint built with
+       ZINT_STATS (see `ZBarcode_HaveStats()`) */
+    struct zint_stats {
+        double ns[ZINT_PHASE_COUNT]; /* Monotonic time spent in each phase in nanoseconds */
+        unsigned long calls[ZINT_PHASE_COUNT]; /* Number of times each phase entered */
+        int version;        /* Value of `option_2` selecting the size chosen (Aztec, Data Matrix, Han Xin, QR Code) or
+                               for PDF417 the number of columns chosen, -1 if not applicable */
+        int ecc_level;      /* Value of `option_1` selecting the error correction level chosen (Han Xin, PDF417,
+                               QR Code), -1 if not applicable */
+        int mask;           /* Mask pattern chosen, 0-based (QR Code, Micro QR), -1 if not applicable */
+        int input_length;   /* Total length of input after validation */
+        int rows;           /* Number of rows of encoded symbol */
+        int width;          /* Width of encoded symbol in modules */
+        int output_size;    /* Size in bytes of last file output (in-memory or file) */
+    };
+
     /* Main symbol structure */
     struct zint_symbol {
         int symbology;      /* Symbol to use (see BARCODE_XXX below) */
@@ -121,10 +183,15 @@ extern "C" {
         struct zint_structapp structapp; /* Structured Append info. Default structapp.count 0 (none) */
         int warn_level;     /* Affects error/warning value returned by Zint API (see WARN_XXX below) */
         int debug;          /* Debugging flags */
+        struct zint_cache *cache; /* Encode result cache to use, if any. Default NULL (none) */
+        int (*write_fn)(void *ctx, const void *buf, size_t len); /* Output callback if BARCODE_STREAM_WRITE,
+                                                                    returns 0 on success else an `errno` value */
+        void *write_ctx;    /* Context passed as `ctx` to `write_fn` */
+        struct zint_stats *stats; /* If set, per-phase timings of each encode and output (see `struct zint_stats`).
+                                     Reset on each encode. Default NULL (none) */
         unsigned char text[128]; /* Human Readable Text (HRT) (if any), UTF-8, NUL-terminated (output only) */
         int rows;           /* Number of rows used by the symbol (output only) */
         int width;          /* Width of the generated symbol (output only) */
-        unsigned char encoded_data[200][144]; /* Encoded data (output only). Allows for rows of 1152 modules */
         float row_height[200]; /* Heights of rows (output only). Allows for 200 row DotCode */
         char errtxt[100];   /* Error message if an error or warning occurs, NUL-terminated (output only) */
         unsigned char *bitmap; /* Stored bitmap image (raster output only) */
@@ -133,6 +200,11 @@ extern "C" {
         unsigned char *alphamap; /* Array of alpha values used (raster output only) */
         unsigned int bitmap_byte_length; /* Size of BMP bitmap data (raster output only) */
         struct zint_vector *vector; /* Pointer to vector header (vector output only) */
+        unsigned char *memfile; /* Pointer to in-memory file buffer if BARCODE_MEMORY_FILE (output only) */
+        int memfile_size;   /* Length of in-memory file buffer (output only) */
+        struct zint_symbol_private *priv; /* Internal state (internal only) */
+        unsigned char encoded_data[200][144]; /* Encoded data (output only). Allows for rows of 1152 modules.
+                               Last so that it can be left out of symbols created by `ZBarcode_Create_Compact()` */
     };
 
     /* Segment for use with `ZBarcode_Encode_Segs()` below */
@@ -142,6 +214,20 @@ extern "C" {
         int eci;            /* Extended Channel Interpretation */
     };
 
+    /* Batch item for use with `ZBarcode_Encode_Batch()` below */
+    struct zint_batch_item {
+        const unsigned char *source; /* Data to encode */
+        int length;         /* Length of `source`. If 0, `source` must be NUL-terminated */
+        struct zint_symbol *symbol; /* Symbol created for item (output only). Free with `ZBarcode_Delete()` */
+        int error_number;   /* Error/warning value returned for item (output only) */
+    };
+
+    /* Callback for use with `ZBarcode_Encode_Batch()` below, called once per item in input order */
+    typedef void (*zint_batch_callback_t)(void *ctx, struct zint_batch_item *item, int index);
+
+    /* Prepared options for use with `ZBarcode_Encode_Prepared()` below (opaque) */
+    struct zint_prepared;
+
 /* Symbologies (`symbol->symbology`) */
     /* Tbarcode 7 codes */
 #define BARCODE_CODE11          1   /* Code 11 */
@@ -292,6 +378,8 @@ extern "C" {
                                          */
 #define BARCODE_NO_QUIET_ZONES  0x1000  /* Disable quiet zones, notably those with defaults as listed above */
 #define COMPLIANT_HEIGHT        0x2000  /* Warn if height not compliant and use standard height (if any) as default */
+#define BARCODE_MEMORY_FILE     0x4000  /* Write output to in-memory buffer `memfile` instead of to `outfile` file */
+#define BARCODE_STREAM_WRITE    0x8000  /* Write output in chunks to callback `write_fn` instead of to `outfile` */
 
 /* Input data types (`symbol->input_mode`) */
 #define DATA_MODE               0       /* Binary */
@@ -333,6 +421,11 @@ extern "C" {
 #define ZINT_ERROR_USES_ECI         13  /* Error counterpart of warning if WARN_FAIL_ALL set (see below) */
 #define ZINT_ERROR_NONCOMPLIANT     14  /* Error counterpart of warning if WARN_FAIL_ALL set */
 
+/* Batch/prepared output types (`ZBarcode_Encode_Batch()`, `ZBarcode_Prepare()` `output_type`) */
+#define ZINT_BATCH_ENCODE       0   /* Encode only, as `ZBarcode_Encode()` */
+#define ZINT_BATCH_BUFFER       1   /* Encode and output to memory as raster, as `ZBarcode_Buffer()` */
+#define ZINT_BATCH_BUFFER_VECTOR 2  /* Encode and output to memory as vector, as `ZBarcode_Buffer_Vector()` */
+
 /* Warning level (`symbol->warn_level`) */
 #define WARN_DEFAULT            0  /* Default behaviour */
 #define WARN_FAIL_ALL           2  /* Treat warning as error */
@@ -353,6 +446,12 @@ extern "C" {
 #define ZINT_CAP_STRUCTAPP          0x1000  /* Supports Structured Append? */
 #define ZINT_CAP_COMPLIANT_HEIGHT   0x2000  /* Has compliant height? */
 
+/* Character types (ZBarcode_Capacity() `char_type`) */
+#define ZINT_CAPACITY_NUMERIC       1   /* Digits */
+#define ZINT_CAPACITY_ALPHANUMERIC  2   /* Uppercase letters, digits and space (see manual for exact set) */
+#define ZINT_CAPACITY_BYTE          3   /* 8-bit binary */
+#define ZINT_CAPACITY_KANJI         4   /* Shift JIS (GB 2312 for Grid Matrix/Han Xin) double-byte characters */
+
 /* The largest amount of data that can be encoded is 4350 4-byte UTF-8 chars in Han Xin Code */
 #define ZINT_MAX_DATA_LEN       17400
 /* Maximum number of segments allowed for (`seg_count`) */
@@ -374,15 +473,25 @@ extern "C" {
 #  define ZINT_EXTERN extern
 #endif
 
-    /* Create and initialize a symbol structure */
+    /* Create and initialize a symbol structure. Different symbols may be used concurrently on different threads,
+       but each symbol must only be used by one thread at a time */
     ZINT_EXTERN struct zint_symbol *ZBarcode_Create(void);
 
+    /* Create and initialize a compact symbol structure, allocated without `encoded_data`, which instead keeps a
+       heap-allocated module matrix sized to the rows and width of the last encoded symbol. Modules must be read
+       using `ZBarcode_Module()`, and the structure must not be copied whole */
+    ZINT_EXTERN struct zint_symbol *ZBarcode_Create_Compact(void);
+
     /* Free any output buffers that may have been created and initialize output fields */
     ZINT_EXTERN void ZBarcode_Clear(struct zint_symbol *symbol);
 
     /* Free a symbol structure, including any output buffers */
     ZINT_EXTERN void ZBarcode_Delete(struct zint_symbol *symbol);
 
+    /* Return the module at `row`, `column` of a previously encoded symbol: 1 if set (dark), 0 if not, or for
+       Ultracode its colour (as `zint_vector_rect` `colour`). Returns -1 if `row` or `column` out of range */
+    ZINT_EXTERN int ZBarcode_Module(const struct zint_symbol *symbol, int row, int column);
+
 
     /* Encode a barcode. If `length` is 0, `source` must be NUL-terminated */
     ZINT_EXTERN int ZBarcode_Encode(struct zint_symbol *symbol, const unsigned char *source, int length);
@@ -443,6 +552,68 @@ extern "C" {
                         int rotate_angle);
 
 
+    /* Determine the size of the symbol that encoding `source` would produce, and of its raster and vector output
+       (unrotated), without placing modules or rendering, and set `geometry`. Returns as `ZBarcode_Encode()`.
+       `symbol` is left cleared apart from any options adjusted by the encoder and `errtxt` */
+    ZINT_EXTERN int ZBarcode_Geometry(struct zint_symbol *symbol, const unsigned char *source, int length,
+                        struct zint_geometry *geometry);
+
+    /* Determine the size of the symbol that encoding segments `segs` would produce, as `ZBarcode_Geometry()` */
+    ZINT_EXTERN int ZBarcode_Geometry_Segs(struct zint_symbol *symbol, const struct zint_seg segs[],
+                        const int seg_count, struct zint_geometry *geometry);
+
+
+    /* Encode `item_count` items using `symbol` as a template for their options, using up to `num_threads` worker
+       threads (0 for one per processor), and output each as `output_type` (see ZINT_BATCH_XXX above) to its own
+       symbol `items[i].symbol`. If `callback` non-NULL it is called once per item in input order as items complete.
+       Returns the highest `items[i].error_number`, or an error if the batch could not be processed */
+    ZINT_EXTERN int ZBarcode_Encode_Batch(const struct zint_symbol *symbol, struct zint_batch_item items[],
+                        const int item_count, const int output_type, const int rotate_angle, const int num_threads,
+                        zint_batch_callback_t callback, void *callback_ctx);
+
+    /* Check the options of `symbol` once for encoding many inputs with `ZBarcode_Encode_Prepared()`, each output as
+       `output_type` (see ZINT_BATCH_XXX above) with `rotate_angle`. On success (or warning) sets `*p_prepared`, which
+       must be freed with `ZBarcode_Delete_Prepared()`. `symbol` itself is not changed apart from `errtxt` */
+    ZINT_EXTERN int ZBarcode_Prepare(struct zint_symbol *symbol, int output_type, int rotate_angle,
+                        struct zint_prepared **p_prepared);
+
+    /* Encode `source` into `symbol` using the options of `prepared`, and output as prepared. `symbol` is first
+       cleared and its options overwritten. `prepared` is not changed, so may be shared between threads */
+    ZINT_EXTERN int ZBarcode_Encode_Prepared(const struct zint_prepared *prepared, struct zint_symbol *symbol,
+                        const unsigned char *source, int length);
+
+    /* Free prepared options */
+    ZINT_EXTERN void ZBarcode_Delete_Prepared(struct zint_prepared *prepared);
+
+
+    /* Create an encode result cache holding up to `max_memory` bytes (0 for default 16 MiB), for use by setting
+       `symbol->cache`. Caches encode results and raster/vector buffer output, least recently used discarded first.
+       May be shared between threads. Returns NULL on failure (no memory) */
+    ZINT_EXTERN struct zint_cache *ZBarcode_Cache_Create(unsigned long max_memory);
+
+    /* Discard all entries of `cache`, leaving its statistics as is */
+    ZINT_EXTERN void ZBarcode_Cache_Clear(struct zint_cache *cache);
+
+    /* Copy the statistics of `cache` into `stats` */
+    ZINT_EXTERN void ZBarcode_Cache_Stats(struct zint_cache *cache, struct zint_cache_stats *stats);
+
+    /* Free `cache`. Must not be in use by any symbol */
+    ZINT_EXTERN void ZBarcode_Cache_Delete(struct zint_cache *cache);
+
+
+    /* Route all heap allocations made by Zint through `malloc_fn`, `realloc_fn` and `free_fn` (all NULL to restore
+       the standard library functions). Must be called before any other Zint function, or when no symbols, prepared
+       options or caches exist. Returns 0 on success, ZINT_ERROR_INVALID_OPTION if only some NULL */
+    ZINT_EXTERN int ZBarcode_SetAllocator(void *(*malloc_fn)(size_t size),
+                        void *(*realloc_fn)(void *ptr, size_t size), void (*free_fn)(void *ptr));
+
+    /* Take large encoding scratch buffers from a per-symbol arena, initially of `size` bytes and grown as needed,
+       instead of from the stack or heap, so that repeated encodes make no allocations. `size` 0 frees any arena.
+       `symbol` must have been created by `ZBarcode_Create()` or `ZBarcode_Create_Compact()`. Returns 0 on success,
+       else ZINT_ERROR_MEMORY or ZINT_ERROR_INVALID_OPTION */
+    ZINT_EXTERN int ZBarcode_SetArena(struct zint_symbol *symbol, size_t size);
+
+
     /* Is `symbol_id` a recognized symbology? */
     ZINT_EXTERN int ZBarcode_ValidID(int symbol_id);
 
@@ -453,6 +624,17 @@ extern "C" {
     /* Return the capability flags for symbology `symbol_id` that match `cap_flag` */
     ZINT_EXTERN unsigned int ZBarcode_Cap(int symbol_id, unsigned int cap_flag);
 
+    /* Return the maximum number of characters of `char_type` (ZINT_CAPACITY_XXX) that symbology `symbol_id` can hold
+       when encoded alone, for error correction level `option_1` and size `option_2` as given to `ZBarcode_Encode()`
+       (-1 and 0 for the defaults). Returns 0 if `char_type` not supported or options invalid. Supports Aztec Code,
+       Code One, Data Matrix, Grid Matrix, Han Xin, MicroPDF417, Micro QR Code, PDF417, QR Code and rMQR only
+       (DotCode and Ultracode sizes being open-ended) */
+    ZINT_EXTERN int ZBarcode_Capacity(int symbol_id, int option_1, int option_2, int char_type);
+
+    /* Whether `source` would fit in `symbol` as currently set up. Returns as `ZBarcode_Geometry()`, deciding from
+       capacity tables alone where possible and otherwise sizing with `ZBarcode_Geometry()` */
+    ZINT_EXTERN int ZBarcode_Fits(struct zint_symbol *symbol, const unsigned char *source, int length);
+
 
     /* Return default X-dimension in mm for symbology `symbol_id`. Returns 0 on error (invalid `symbol_id`) */
     ZINT_EXTERN float ZBarcode_Default_Xdim(int symbol_id);
@@ -470,6 +652,9 @@ extern "C" {
     /* Whether Zint built without PNG support */
     ZINT_EXTERN int ZBarcode_NoPng(void);
 
+    /* Whether Zint built with per-phase timing instrumentation (ZINT_STATS), see `struct zint_stats` */
+    ZINT_EXTERN int ZBarcode_HaveStats(void);
+
     /* Return the version of Zint linked to */
     ZINT_EXTERN int ZBarcode_Version(void);
 
@@ -0,0 +1,161 @@
+/*  zthread.c - Minimal threading primitives for internal use */
+/*
+    libzint - the open source barcode library
+    Copyright (C) 2023 Robin Stuart <rstuart114@gmail.com>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+    3. Neither the name of the project nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+ */
+/* SPDX-License-Identifier: BSD-3-Clause */
+
+#include "common.h"
+#include "zthread.h"
+#if !defined(ZINT_NO_THREADS) && !defined(_WIN32)
+#include <unistd.h> /* sysconf(3) */
+#endif
+
+#if defined(ZINT_NO_THREADS)
+
+INTERNAL int z_thread_create(z_thread_t *thread, z_thread_func_t func, void *arg) {
+    (void)thread; (void)func; (void)arg;
+    return 0;
+}
+
+INTERNAL void z_thread_join(z_thread_t *thread) {
+    (void)thread;
+}
+
+INTERNAL int z_thread_cpu_count(void) {
+    return 1;
+}
+
+INTERNAL int z_mutex_init(z_mutex_t *mutex) {
+    *mutex = 0;
+    return 1;
+}
+
+INTERNAL void z_mutex_destroy(z_mutex_t *mutex) {
+    (void)mutex;
+}
+
+INTERNAL void z_mutex_lock(z_mutex_t *mutex) {
+    (void)mutex;
+}
+
+INTERNAL void z_mutex_unlock(z_mutex_t *mutex) {
+    (void)mutex;
+}
+
+#elif defined(_WIN32)
+
+/* Trampoline to adapt `z_thread_func_t` to Windows thread signature */
+static DWORD WINAPI z_thread_start(LPVOID param) {
+    z_thread_t *thread = (z_thread_t *) param;
+    thread->func(thread->arg);
+    return 0;
+}
+
+INTERNAL int z_thread_create(z_thread_t *thread, z_thread_func_t func, void *arg) {
+    thread->func = func;
+    thread->arg = arg;
+    thread->handle = CreateThread(NULL, 0, z_thread_start, thread, 0, NULL);
+    return thread->handle != NULL;
+}
+
+INTERNAL void z_thread_join(z_thread_t *thread) {
+    (void) WaitForSingleObject(thread->handle, INFINITE);
+    (void) CloseHandle(thread->handle);
+}
+
+INTERNAL int z_thread_cpu_count(void) {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (int) info.dwNumberOfProcessors : 1;
+}
+
+INTERNAL int z_mutex_init(z_mutex_t *mutex) {
+    InitializeCriticalSection(mutex);
+    return 1;
+}
+
+INTERNAL void z_mutex_destroy(z_mutex_t *mutex) {
+    DeleteCriticalSection(mutex);
+}
+
+INTERNAL void z_mutex_lock(z_mutex_t *mutex) {
+    EnterCriticalSection(mutex);
+}
+
+INTERNAL void z_mutex_unlock(z_mutex_t *mutex) {
+    LeaveCriticalSection(mutex);
+}
+
+#else /* POSIX threads */
+
+/* Trampoline to adapt `z_thread_func_t` to pthreads signature */
+static void *z_thread_start(void *param) {
+    z_thread_t *thread = (z_thread_t *) param;
+    thread->func(thread->arg);
+    return NULL;
+}
+
+INTERNAL int z_thread_create(z_thread_t *thread, z_thread_func_t func, void *arg) {
+    thread->func = func;
+    thread->arg = arg;
+    return pthread_create(&thread->handle, NULL, z_thread_start, thread) == 0;
+}
+
+INTERNAL void z_thread_join(z_thread_t *thread) {
+    (void) pthread_join(thread->handle, NULL);
+}
+
+INTERNAL int z_thread_cpu_count(void) {
+#ifdef _SC_NPROCESSORS_ONLN
+    const long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (int) count : 1;
+#else
+    return 1;
+#endif
+}
+
+INTERNAL int z_mutex_init(z_mutex_t *mutex) {
+    return pthread_mutex_init(mutex, NULL) == 0;
+}
+
+INTERNAL void z_mutex_destroy(z_mutex_t *mutex) {
+    (void) pthread_mutex_destroy(mutex);
+}
+
+INTERNAL void z_mutex_lock(z_mutex_t *mutex) {
+    (void) pthread_mutex_lock(mutex);
+}
+
+INTERNAL void z_mutex_unlock(z_mutex_t *mutex) {
+    (void) pthread_mutex_unlock(mutex);
+}
+
+#endif /* ZINT_NO_THREADS */
+
+/* vim: set ts=4 sw=4 et : */
@@ -0,0 +1,91 @@
+/*  zthread.h - Minimal threading primitives for internal use */
+/*
+    libzint - the open source barcode library
+    Copyright (C) 2023 Robin Stuart <rstuart114@gmail.com>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+    3. Neither the name of the project nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+ */
+/* SPDX-License-Identifier: BSD-3-Clause */
+
+#ifndef Z_ZTHREAD_H
+#define Z_ZTHREAD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* If `ZINT_NO_THREADS` defined, `z_thread_create()` always fails and the mutex functions are no-ops, so callers
+   must be prepared to do all the work on the calling thread */
+#if defined(ZINT_NO_THREADS)
+typedef int z_thread_handle_t;
+typedef int z_mutex_t;
+#elif defined(_WIN32)
+#include <windows.h>
+typedef HANDLE z_thread_handle_t;
+typedef CRITICAL_SECTION z_mutex_t;
+#else
+#include <pthread.h>
+typedef pthread_t z_thread_handle_t;
+typedef pthread_mutex_t z_mutex_t;
+#endif
+
+typedef void (*z_thread_func_t)(void *arg);
+
+/* Thread, must remain valid until `z_thread_join()` */
+typedef struct z_thread {
+    z_thread_handle_t handle;
+    z_thread_func_t func;
+    void *arg;
+} z_thread_t;
+
+/* Start `thread` running `func(arg)`. Returns 1 on success, 0 on failure */
+INTERNAL int z_thread_create(z_thread_t *thread, z_thread_func_t func, void *arg);
+
+/* Wait for `thread` to finish */
+INTERNAL void z_thread_join(z_thread_t *thread);
+
+/* Return the number of online processors (at least 1) */
+INTERNAL int z_thread_cpu_count(void);
+
+
+/* Initialize `mutex`. Returns 1 on success, 0 on failure */
+INTERNAL int z_mutex_init(z_mutex_t *mutex);
+
+/* Release resources of `mutex` */
+INTERNAL void z_mutex_destroy(z_mutex_t *mutex);
+
+/* Lock `mutex` */
+INTERNAL void z_mutex_lock(z_mutex_t *mutex);
+
+/* Unlock `mutex` */
+INTERNAL void z_mutex_unlock(z_mutex_t *mutex);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+/* vim: set ts=4 sw=4 et : */
+#endif /* Z_ZTHREAD_H */
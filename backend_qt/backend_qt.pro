@@ -48,6 +48,7 @@ HEADERS +=  ../backend/aztec.h \
             ../backend/eci.h \
             ../backend/eci_sb.h \
             ../backend/emf.h \
+            ../backend/filemem.h \
             ../backend/font.h \
             ../backend/gb18030.h \
             ../backend/gb2312.h \
@@ -77,6 +78,8 @@ HEADERS +=  ../backend/aztec.h \
             ../backend/zfiletypes.h \
             ../backend/zintconfig.h \
             ../backend/zint.h \
+            ../backend/zthread.h \
+            ../backend/cache.h \
             qzint.h
 
 SOURCES += ../backend/2of5.c \
@@ -96,6 +99,7 @@ SOURCES += ../backend/2of5.c \
            ../backend/dotcode.c \
            ../backend/eci.c \
            ../backend/emf.c \
+           ../backend/filemem.c \
            ../backend/general_field.c \
            ../backend/gif.c \
            ../backend/gridmtx.c \
@@ -124,6 +128,8 @@ SOURCES += ../backend/2of5.c \
            ../backend/ultra.c \
            ../backend/upcean.c \
            ../backend/vector.c \
+           ../backend/zthread.c \
+           ../backend/cache.c \
            ../backend/dllversion.c \
            qzint.cpp
 
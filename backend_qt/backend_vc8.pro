@@ -29,6 +29,7 @@ HEADERS +=  ../backend/aztec.h \
             ../backend/dmatrix_trace.h \
             ../backend/eci.h \
             ../backend/emf.h \
+            ../backend/filemem.h \
             ../backend/font.h \
             ../backend/gb18030.h \
             ../backend/gb2312.h \
@@ -50,6 +51,8 @@ HEADERS +=  ../backend/aztec.h \
             ../backend/sjis.h \
             ../backend/tif.h \
             ../backend/zint.h \
+            ../backend/zthread.h \
+            ../backend/cache.h \
             qzint.h
 
 SOURCES += ../backend/2of5.c \
@@ -69,6 +72,7 @@ SOURCES += ../backend/2of5.c \
            ../backend/dotcode.c \
            ../backend/eci.c \
            ../backend/emf.c \
+           ../backend/filemem.c \
            ../backend/gridmtx.c \
            ../backend/general_field.c \
            ../backend/gif.c \
@@ -96,4 +100,6 @@ SOURCES += ../backend/2of5.c \
            ../backend/ultra.c \
            ../backend/upcean.c \
            ../backend/vector.c \
+           ../backend/zthread.c \
+           ../backend/cache.c \
            qzint.cpp
@@ -161,6 +161,10 @@ SOURCE=..\backend\emf.c
 # End Source File
 # Begin Source File
 
+SOURCE=..\backend\filemem.c
+# End Source File
+# Begin Source File
+
 SOURCE=..\backend\general_field.c
 # End Source File
 # Begin Source File
@@ -273,6 +277,14 @@ SOURCE=..\backend\vector.c
 # End Source File
 # Begin Source File
 
+SOURCE=..\backend\zthread.c
+# End Source File
+# Begin Source File
+
+SOURCE=..\backend\cache.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\zint.c
 # End Source File
 # End Group
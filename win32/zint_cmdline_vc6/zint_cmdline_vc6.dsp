@@ -156,6 +156,10 @@ SOURCE=..\..\backend\emf.c
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\backend\filemem.c
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\backend\general_field.c
 # End Source File
 # Begin Source File
@@ -278,6 +282,14 @@ SOURCE=..\..\backend\upcean.c
 
 SOURCE=..\..\backend\vector.c
 # End Source File
+# Begin Source File
+
+SOURCE=..\..\backend\zthread.c
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\backend\cache.c
+# End Source File
 # End Group
 # Begin Group "Header Files"
 